@@ -0,0 +1,42 @@
+# project information
+project(TxStreams
+        VERSION 1.0
+        DESCRIPTION "Transaction stream parsers of the Zcash app"
+        LANGUAGES C)
+
+# specify C standard
+set(CMAKE_C_STANDARD 11)
+set(CMAKE_C_STANDARD_REQUIRED True)
+set(CMAKE_C_FLAGS_DEBUG
+    "${CMAKE_C_FLAGS_DEBUG} -Wall -Wextra -Wno-unused-function -DFUZZ -g -O0"
+)
+
+# the parsers use the types and the hashing API of the SDK,
+# the SDK calls are stubbed by the fuzz target
+if(NOT DEFINED ENV{BOLOS_SDK})
+    message(FATAL_ERROR "BOLOS_SDK must point to the Ledger SDK")
+endif()
+set(BOLOS_SDK $ENV{BOLOS_SDK})
+
+add_library(txstreams STATIC
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/varint.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/read.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/write.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/common/buffer.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/apdu/t_in_stream.c
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/apdu/enc_stream.c
+)
+
+target_compile_definitions(txstreams PUBLIC
+    TARGET_NANOX ORCHARD TX_STREAMS HAVE_BAGL HAVE_UX_FLOW
+    IO_SEPROXYHAL_BUFFER_SIZE_B=300 "PRINTF(...)="
+)
+
+target_include_directories(txstreams PUBLIC
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src
+    ${CMAKE_CURRENT_SOURCE_DIR}/../src/crypto
+    ${BOLOS_SDK}/include
+    ${BOLOS_SDK}/lib_cxng/include
+    ${BOLOS_SDK}/lib_ux/include
+    ${BOLOS_SDK}/target/nanox/include
+)
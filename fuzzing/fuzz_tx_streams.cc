@@ -0,0 +1,176 @@
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/types.h>
+#include <vector>
+
+extern "C" {
+#include "globals.h"
+#include "sw.h"
+#include "common/buffer.h"
+#include "apdu/t_in_stream.h"
+#include "apdu/enc_stream.h"
+}
+
+// Fuzzing of the parsers of the ADD_T_IN stream, of the SIGN_TRANSPARENT
+// records and of the ciphertext streams
+// The first byte picks the parser, the rest is a sequence of APDUs
+// Lc (1) || data (Lc), plus P1 (1) before Lc for the ciphertext streams
+// and the SIGN_TRANSPARENT records, which come after a complete ADD_T_IN stream
+// The hashers are stubs that only read their input, the random key
+// of the tags is zero
+
+extern "C" {
+global_ctx_t G_context;
+temp_t G_store;
+
+cx_err_t cx_blake2b_init2_no_throw(cx_blake2b_t *hash, size_t out_len,
+                                   uint8_t *salt, size_t salt_len,
+                                   uint8_t *perso, size_t perso_len) {
+    (void) out_len; (void) salt; (void) salt_len; (void) perso; (void) perso_len;
+    memset(hash, 0, sizeof(cx_blake2b_t));
+    return CX_OK;
+}
+
+cx_err_t cx_hash_no_throw(cx_hash_t *hash, uint32_t mode, const uint8_t *in, size_t len,
+                          uint8_t *out, size_t out_len) {
+    (void) hash; (void) mode;
+    volatile uint8_t acc = 0;
+    for (size_t i = 0; i < len; i++) acc ^= in[i];
+    if (out != NULL) memset(out, acc, out_len);
+    return CX_OK;
+}
+
+size_t cx_hash_get_size(const cx_hash_t *ctx) {
+    (void) ctx;
+    return 32;
+}
+
+void cx_get_random_bytes(void *buffer, size_t len) {
+    memset(buffer, 0, len);
+}
+
+void os_longjmp(unsigned int exception) {
+    (void) exception;
+    abort();
+}
+
+int io_send_sw(uint16_t sw) {
+    return sw;
+}
+
+int helper_send_response_bytes(const uint8_t *data, int data_len) {
+    (void) data; (void) data_len;
+    return SW_OK;
+}
+
+void reset_app() {
+    memset(&G_context.signing_ctx, 0, sizeof(tx_signing_ctx_t));
+}
+
+// same as in crypto/tx.c
+int process_t_in_amount(uint64_t amount) {
+    if (G_context.signing_ctx.stage != T_IN) {
+        reset_app();
+        return SW_BAD_STATE;
+    }
+    G_context.signing_ctx.has_t_in = true;
+    G_context.signing_ctx.t_net += (int64_t)amount;
+    if (G_context.signing_ctx.t_net < -MAX_MONEY || G_context.signing_ctx.t_net > MAX_MONEY)
+        return SW_INVALID_PARAM;
+    cx_hash((cx_hash_t *) &G_context.hasher, 0, (uint8_t *) &amount, 8, NULL, 0);
+    return SW_OK;
+}
+
+int sign_transparent(uint8_t count, const uint8_t *txin_sig_digests) {
+    (void) count; (void) txin_sig_digests;
+    return SW_OK;
+}
+}
+
+enum { FUZZ_T_IN_STREAM, FUZZ_T_IN_RECORDS, FUZZ_S_ENC_STREAM, FUZZ_O_ENC_STREAM, FUZZ_SIGN_RECORDS };
+#define FUZZ_TARGETS 5
+
+/// @brief Read the next APDU, the data is copied so that reads past Lc are caught
+static bool next_apdu(buffer_t *buf, bool has_p1, uint8_t *p1, std::vector<uint8_t> &data) {
+    uint8_t lc;
+    if (has_p1 && !buffer_read_u8(buf, p1))
+        return false;
+    if (!buffer_read_u8(buf, &lc) || !buffer_can_read(buf, lc))
+        return false;
+    data.assign(buf->ptr + buf->offset, buf->ptr + buf->offset + lc);
+    buffer_seek_cur(buf, lc);
+    return true;
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) {
+    buffer_t buf = {.ptr = data, .size = size, .offset = 0};
+    uint8_t target;
+    uint8_t p1 = 0;
+    std::vector<uint8_t> apdu;
+
+    if (!buffer_read_u8(&buf, &target))
+        return 0;
+
+    memset(&G_context, 0, sizeof(G_context));
+    G_context.tx = &G_context.tx_ring[0];
+
+    switch (target % FUZZ_TARGETS) {
+        case FUZZ_T_IN_STREAM:
+            G_context.signing_ctx.stage = T_IN;
+            while (next_apdu(&buf, false, &p1, apdu)) {
+                if (t_in_stream(apdu.data(), apdu.size()) != SW_OK)
+                    break;
+            }
+            break;
+
+        case FUZZ_T_IN_RECORDS:
+            while (next_apdu(&buf, false, &p1, apdu)) {
+                buffer_t records = {.ptr = apdu.data(), .size = apdu.size(), .offset = 0};
+                uint8_t digest[32];
+                while (t_in_record_digest(&records, digest))
+                    continue;
+            }
+            break;
+
+        case FUZZ_SIGN_RECORDS:
+            G_context.signing_ctx.stage = T_IN;
+            while (!G_context.signing_ctx.t_in_streamed && next_apdu(&buf, false, &p1, apdu)) {
+                if (t_in_stream(apdu.data(), apdu.size()) != SW_OK)
+                    return 0;
+            }
+            G_context.signing_ctx.stage = SIGN;
+            // P1 is the number of records
+            while (next_apdu(&buf, true, &p1, apdu)) {
+                uint8_t count = p1 % SIGN_BATCH_MAX + 1;
+                if (sign_t_in_records(count, apdu.data(), apdu.size()) != SW_OK)
+                    break;
+            }
+            break;
+
+        case FUZZ_S_ENC_STREAM:
+        case FUZZ_O_ENC_STREAM: {
+            uint8_t n_outputs;
+            if (!buffer_read_u8(&buf, &n_outputs))
+                return 0;
+            G_context.signing_ctx.stage = FEE;
+            G_context.signing_ctx.n_s_out = n_outputs;
+            G_context.signing_ctx.n_o_action = n_outputs;
+            while (next_apdu(&buf, true, &p1, apdu)) {
+                command_t cmd = {
+                    .cla = 0xE0,
+                    .ins = target % FUZZ_TARGETS == FUZZ_S_ENC_STREAM ? SET_S_MERKLE_PROOF : SET_O_MERKLE_PROOF,
+                    .p1 = p1,
+                    .p2 = 0,
+                    .lc = (uint8_t) apdu.size(),
+                    .data = apdu.data(),
+                };
+                if (enc_stream(&cmd) != SW_OK)
+                    break;
+            }
+            break;
+        }
+    }
+
+    return 0;
+}
@@ -37,25 +37,83 @@
 #include "../crypto/fr.h"
 #include "../crypto/prf.h"
 #include "../crypto/key.h"
+#include "out_chain.h"
+#include "t_in_stream.h"
+#include "enc_stream.h"
 
 #define MOVE_FIELD(s,field) memmove(&s.field, p, sizeof(s.field)); p += sizeof(s.field);
 #define TRANSPARENT_OUT_LEN (8+1+20)
 
-#ifdef TEST
-#define OVERRIDE_CONFIRMATION(p) do { confirmation = p; } while(0);
-#define OVERRIDE_RSEED(s)
-#define OVERRIDE_ALPHA(a)
-#else
-#define OVERRIDE_CONFIRMATION(p) do { confirmation = true; } while(0);
-#define OVERRIDE_RSEED(s) do { prf_chacha(&chacha_rseed_rng, s.rseed, 32); } while(0);
-#define OVERRIDE_ALPHA(a) do { prf_chacha(&chacha_alpha_rng, a, 64); } while(0);
-#endif
-
-#define SAPLING_OUT_LEN (43+8+32+52+32)
-#define ORCHARD_OUT_LEN (32+43+8+32+52+32)
 
 const uint8_t VERSION[] = { 1, 0, 1 };
 
+/// @brief Commands allowed in BATCH: they have no response data and no UI
+/// INIT_TX is not, the host needs its seed. The streams of ADD_T_IN and
+/// SET_S/O_MERKLE_PROOF (P1 != 0) are not either, they return data or keep
+/// state across APDUs
+static bool is_batchable(const command_t *sub) {
+    switch (sub->ins) {
+        case CHANGE_STAGE:
+        case SET_S_NET:
+        case SET_O_NET:
+        case SET_HEADER_DIGEST:
+        case SET_T_MERKLE_PROOF:
+            return true;
+        case ADD_T_IN:
+        case SET_S_MERKLE_PROOF:
+        case SET_O_MERKLE_PROOF:
+            return sub->p1 == 0;
+        default:
+            return false;
+    }
+}
+
+/// @brief Read the next sub-command INS (1) || P1 (1) || P2 (1) || Lc (1) || data (Lc)
+/// @return SW_OK, or the status word that rejects the batch
+static uint16_t read_sub_command(buffer_t *buf, uint8_t cla, command_t *sub) {
+    uint8_t ins;
+    sub->cla = cla;
+    if (!buffer_read_u8(buf, &ins) ||
+        !buffer_read_u8(buf, &sub->p1) ||
+        !buffer_read_u8(buf, &sub->p2) ||
+        !buffer_read_u8(buf, &sub->lc) ||
+        !buffer_can_read(buf, sub->lc))
+        return SW_WRONG_DATA_LENGTH;
+    sub->ins = (command_e) ins;
+    sub->data = sub->lc > 0 ? (uint8_t *)buf->ptr + buf->offset : NULL;
+    buffer_seek_cur(buf, sub->lc);
+    if (!is_batchable(sub))
+        return SW_INS_NOT_SUPPORTED;
+    return SW_OK;
+}
+
+/// @brief Run the sub-commands in order and stop at the first error.
+/// The whole batch is checked before the first one runs, the ones that
+/// succeeded before an error are not rolled back
+/// @return n (1) || SW (2), n is the number of successful sub-commands
+/// and SW is the status word of the last one that ran
+static int handle_batch(const command_t *cmd) {
+    buffer_t buf = {.ptr = cmd->data, .size = cmd->lc, .offset = 0};
+    command_t sub;
+    uint8_t n = 0;
+    uint16_t sw = SW_OK;
+    while (sw == SW_OK && buf.offset < buf.size)
+        sw = read_sub_command(&buf, cmd->cla, &sub);
+
+    buf.offset = 0;
+    while (sw == SW_OK && buf.offset < buf.size) {
+        read_sub_command(&buf, cmd->cla, &sub);
+        io_capture_begin();
+        apdu_dispatcher(&sub);
+        sw = io_capture_end();
+        if (sw == SW_OK)
+            n++;
+    }
+
+    uint8_t res[3] = { n, sw >> 8, sw & 0xFF };
+    return helper_send_response_bytes(res, 3);
+}
+
 int apdu_dispatcher(const command_t *cmd) {
     if (cmd->cla != CLA) {
         return io_send_sw(SW_CLA_NOT_SUPPORTED);
@@ -93,8 +151,8 @@ int apdu_dispatcher(const command_t *cmd) {
             if (cmd->lc != 0)
                 return io_send_sw(SW_WRONG_DATA_LENGTH);
 
-            derive_default_keys();
-            return helper_send_response_bytes(G_context.transparent_key_info.pub_key, 33);
+            require_keys(KEYS_TRANSPARENT);
+            return helper_send_response_bytes(G_context.keys->transparent_key_info.pub_key, 33);
 
         case GET_FVK:
             if (cmd->p1 != 0 || cmd->p2 != 0) {
@@ -102,21 +160,21 @@ int apdu_dispatcher(const command_t *cmd) {
             }
 
             {
-            derive_default_keys();
-            memmove(G_store.out_buffer, &G_context.proofk_info.ak, 32);
-            memmove(G_store.out_buffer + 32, &G_context.proofk_info.nk, 32);
-            memmove(G_store.out_buffer + 64, &G_context.exp_sk_info.ovk, 32);
-            memmove(G_store.out_buffer + 96, &G_context.exp_sk_info.dk, 32);
+            require_keys(KEYS_SAPLING);
+            memmove(G_store.out_buffer, &G_context.keys->proofk_info.ak, 32);
+            memmove(G_store.out_buffer + 32, &G_context.keys->proofk_info.nk, 32);
+            memmove(G_store.out_buffer + 64, &G_context.keys->exp_sk_info.ovk, 32);
+            memmove(G_store.out_buffer + 96, &G_context.keys->exp_sk_info.dk, 32);
             return helper_send_response_bytes(G_store.out_buffer, 128);
             }
 
         case GET_OFVK: {
             #ifdef ORCHARD
-            derive_default_keys();
-            memmove(G_store.out_buffer, G_context.orchard_key_info.ak, 32);
-            memmove(G_store.out_buffer + 32, G_context.orchard_key_info.nk, 32);
+            require_keys(KEYS_ORCHARD);
+            memmove(G_store.out_buffer, G_context.keys->orchard_key_info.ak, 32);
+            memmove(G_store.out_buffer + 32, G_context.keys->orchard_key_info.nk, 32);
             swap_endian(G_store.out_buffer + 32, 32);
-            memmove(G_store.out_buffer + 64, G_context.orchard_key_info.rivk, 32);
+            memmove(G_store.out_buffer + 64, G_context.keys->orchard_key_info.rivk, 32);
             swap_endian(G_store.out_buffer + 64, 32);
             return helper_send_response_bytes(G_store.out_buffer, 96);
             #else
@@ -132,18 +190,36 @@ int apdu_dispatcher(const command_t *cmd) {
         }
 
         case INIT_TX:
-            if (cmd->p1 != 0 || cmd->p2 != 0) {
+            // P1 = 1: next transaction of a session
+            if (cmd->p1 > 1 || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+            if (cmd->lc != 0)
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+
+            return init_tx(cmd->p1 == 1);
+
+        case SELECT_TX:
+            if (cmd->p2 != 0) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
             if (cmd->lc != 0)
                 return io_send_sw(SW_WRONG_DATA_LENGTH);
 
-            return init_tx();
+            return select_tx(cmd->p1);
 
         case ADD_T_IN:
-            if (cmd->p1 != 0 || cmd->p2 != 0) {
+            if (cmd->p1 > 1 || cmd->p2 != 0) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
+            // P1 = 1: chunk of the transparent input stream
+            if (cmd->p1 == 1) {
+                #ifdef TX_STREAMS
+                return t_in_stream(cmd->data, cmd->lc);
+                #else
+                return io_send_sw(SW_INS_NOT_SUPPORTED);
+                #endif
+            }
             if (cmd->lc != 8)
                 return io_send_sw(SW_WRONG_DATA_LENGTH);
 
@@ -185,18 +261,7 @@ int apdu_dispatcher(const command_t *cmd) {
 
             OVERRIDE_CONFIRMATION(cmd->p1);
             {
-                memset(&G_context.s_out, 0, sizeof(s_out_t));
-                p = cmd->data;
-
-                MOVE_FIELD(G_context.s_out, address);
-                MOVE_FIELD(G_context.s_out, amount);
-                MOVE_FIELD(G_context.s_out, epk);
-                MOVE_FIELD(G_context.s_out, enc);
-                if (cmd->lc == SAPLING_OUT_LEN)
-                    MOVE_FIELD(G_context.s_out, rseed);
-
-                // in prod, rseed is picked by our PRNG, not the client's
-                OVERRIDE_RSEED(G_context.s_out);
+                parse_s_out(&G_context.s_out, cmd->data, cmd->lc == SAPLING_OUT_LEN);
 
                 // Check parameters
                 // diversifier is checked later
@@ -215,19 +280,7 @@ int apdu_dispatcher(const command_t *cmd) {
 
             OVERRIDE_CONFIRMATION(cmd->p1);
             {
-                memset(&G_context.o_action, 0, sizeof(o_action_t));
-                p = cmd->data;
-
-                MOVE_FIELD(G_context.o_action, nf);
-                MOVE_FIELD(G_context.o_action, address);
-                MOVE_FIELD(G_context.o_action, amount);
-                MOVE_FIELD(G_context.o_action, epk);
-                MOVE_FIELD(G_context.o_action, enc);
-                if (cmd->lc == ORCHARD_OUT_LEN)
-                    MOVE_FIELD(G_context.o_action, rseed);
-
-                // in prod, rseed is picked by our PRNG, not the client's
-                OVERRIDE_RSEED(G_context.o_action);
+                parse_o_action(&G_context.o_action, cmd->data, cmd->lc == ORCHARD_OUT_LEN);
 
                 // Check parameters
                 CHECK_MONEY(G_context.o_action.amount);
@@ -237,6 +290,26 @@ int apdu_dispatcher(const command_t *cmd) {
                 return io_send_sw(SW_INS_NOT_SUPPORTED);
             #endif
 
+        case ADD_S_OUT_CHAIN:
+            if (cmd->lc == 0)
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            return out_chain_start(cmd);
+
+        case ADD_O_ACTION_CHAIN:
+            #ifdef ORCHARD
+            if (cmd->lc == 0)
+                return io_send_sw(SW_WRONG_DATA_LENGTH);
+            return out_chain_start(cmd);
+            #else
+                return io_send_sw(SW_INS_NOT_SUPPORTED);
+            #endif
+
+        case BATCH:
+            if (cmd->p1 != 0 || cmd->p2 != 0) {
+                return io_send_sw(SW_WRONG_P1P2);
+            }
+            return handle_batch(cmd);
+
         case SET_S_NET:
             if (cmd->p1 > 1 || cmd->p2 != 0) {
                 return io_send_sw(SW_WRONG_P1P2);
@@ -285,7 +358,15 @@ int apdu_dispatcher(const command_t *cmd) {
             return set_t_merkle_proof((t_proofs_t *)cmd->data);
 
         case SET_S_MERKLE_PROOF:
-            if (cmd->p1 != 0 || cmd->p2 != 0) {
+            // P1 != 0: chunk of the output ciphertext stream
+            if (cmd->p1 != 0) {
+                #ifdef TX_STREAMS
+                return enc_stream(cmd);
+                #else
+                return io_send_sw(SW_INS_NOT_SUPPORTED);
+                #endif
+            }
+            if (cmd->p2 != 0) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
             if (cmd->lc != 3 * 32)
@@ -295,7 +376,14 @@ int apdu_dispatcher(const command_t *cmd) {
 
         case SET_O_MERKLE_PROOF:
             #ifdef ORCHARD
-            if (cmd->p1 != 0 || cmd->p2 != 0) {
+            if (cmd->p1 != 0) {
+                #ifdef TX_STREAMS
+                return enc_stream(cmd);
+                #else
+                return io_send_sw(SW_INS_NOT_SUPPORTED);
+                #endif
+            }
+            if (cmd->p2 != 0) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
             if (cmd->lc != 3 * 32)
@@ -326,52 +414,60 @@ int apdu_dispatcher(const command_t *cmd) {
             if (cmd->p1 != 0 || cmd->p2 != 0) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
-            memmove(G_store.out_buffer, G_context.proofk_info.ak, 32);
-            memmove(G_store.out_buffer + 32, G_context.exp_sk_info.nsk, 32);
+            require_keys(KEYS_SAPLING);
+            memmove(G_store.out_buffer, G_context.keys->proofk_info.ak, 32);
+            memmove(G_store.out_buffer + 32, G_context.keys->exp_sk_info.nsk, 32);
             swap_endian(G_store.out_buffer + 32, 32);
             return helper_send_response_bytes(G_store.out_buffer, 64);
             }
 
-        case SIGN_TRANSPARENT:
-            if (cmd->p1 != 0 || cmd->p2 != 0) {
+        case SIGN_TRANSPARENT: {
+            // P1 is the number of inputs, 0 stands for 1
+            // P2 = 1: the data has the input records of the ADD_T_IN stream
+            if (cmd->p1 > SIGN_BATCH_MAX || cmd->p2 > 1) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
-            if (cmd->lc != 32)
+            uint8_t count = cmd->p1 != 0 ? cmd->p1 : 1;
+            if (cmd->p2 == 1) {
+                #ifdef TX_STREAMS
+                return sign_t_in_records(count, cmd->data, cmd->lc);
+                #else
+                return io_send_sw(SW_INS_NOT_SUPPORTED);
+                #endif
+            }
+            #ifdef TX_STREAMS
+            // streamed inputs are only signed from their tagged records
+            if (G_context.tx->t_in_streamed) {
+                reset_app();
+                return io_send_sw(SW_BAD_STATE);
+            }
+            #endif
+            if (cmd->lc != count * 32)
                 return io_send_sw(SW_WRONG_DATA_LENGTH);
-            memmove(G_context.txin_sig_digest, cmd->data, 32);
-            return sign_transparent();
+            return sign_transparent(count, cmd->data);
+        }
 
         case SIGN_SAPLING:
-            if (cmd->p1 != 0 || cmd->p2 != 0) {
+        case SIGN_ORCHARD: {
+            #ifndef ORCHARD
+            if (cmd->ins == SIGN_ORCHARD)
+                return io_send_sw(SW_INS_NOT_SUPPORTED);
+            #endif
+            // P1 is the number of signatures, 0 stands for 1
+            if (cmd->p1 > SIGN_BATCH_MAX || cmd->p2 != 0) {
                 return io_send_sw(SW_WRONG_P1P2);
             }
-            if (cmd->lc != 0 && cmd->lc != 64)
+            uint8_t count = cmd->p1 != 0 ? cmd->p1 : 1;
+            if (cmd->lc != 0 && cmd->lc != count * 64)
                 return io_send_sw(SW_WRONG_DATA_LENGTH);
-            memset(G_context.alpha, 0, 64);
-            if (cmd->lc == 64)
-                memmove(G_context.alpha, cmd->data, 64);
-            // In prod, alpha is picked by our PRNG, not the client's
-            OVERRIDE_ALPHA(G_context.alpha);
+            const uint8_t *alphas = cmd->lc != 0 ? cmd->data : NULL;
 
-            return sign_sapling();
-
-        case SIGN_ORCHARD:
             #ifdef ORCHARD
-            if (cmd->p1 != 0 || cmd->p2 != 0) {
-                return io_send_sw(SW_WRONG_P1P2);
-            }
-            if (cmd->lc != 0 && cmd->lc != 64)
-                return io_send_sw(SW_WRONG_DATA_LENGTH);
-            memset(G_context.alpha, 0, 64);
-            if (cmd->lc == 64)
-                memmove(G_context.alpha, cmd->data, 64);
-            // In prod, alpha is picked by our PRNG, not the client's
-            OVERRIDE_ALPHA(G_context.alpha);
-
-            return sign_orchard();
-            #else
-                return io_send_sw(SW_INS_NOT_SUPPORTED);
+            if (cmd->ins == SIGN_ORCHARD)
+                return sign_orchard(count, alphas);
             #endif
+            return sign_sapling(count, alphas);
+        }
 
         case GET_S_SIGHASH:
             if (cmd->p1 != 0 || cmd->p2 != 0) {
@@ -399,6 +495,7 @@ int apdu_dispatcher(const command_t *cmd) {
             if (cmd->lc != 96)
                 return io_send_sw(SW_WRONG_DATA_LENGTH);
             memmove(G_context.alpha, cmd->data, 64);
+            require_keys(KEYS_SAPLING);
             sapling_sign(G_store.out_buffer, cmd->data + 64);
             return helper_send_response_bytes(G_store.out_buffer, 64);
 
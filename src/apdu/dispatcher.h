@@ -1,6 +1,17 @@
 #pragma once
 
 #include "../types.h"
+#include "../crypto/tx.h"
+
+#ifdef TEST
+#define OVERRIDE_CONFIRMATION(p) do { confirmation = p; } while(0);
+#define OVERRIDE_RSEED(s)
+#define OVERRIDE_ALPHA(a)
+#else
+#define OVERRIDE_CONFIRMATION(p) do { confirmation = true; } while(0);
+#define OVERRIDE_RSEED(s) do { prf_chacha(&chacha_rseed_rng, s.rseed, 32); } while(0);
+#define OVERRIDE_ALPHA(a) do { prf_chacha(&G_context.tx->alpha_rng, a, 64); } while(0);
+#endif
 
 /**
  * Dispatch APDU command received to the right handler.
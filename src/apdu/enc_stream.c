@@ -0,0 +1,118 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memset, memmove
+#include <stdbool.h>  // bool
+
+#include <lcx_blake2.h>
+
+#include "enc_stream.h"
+#include "out_chain.h"
+#include "../globals.h"
+#include "../io.h"
+#include "../sw.h"
+#include "../common/buffer.h"
+#include "../ui/action/validate.h"
+
+#ifdef TX_STREAMS
+
+#define min(a, b) ((a) > (b) ? (b) : (a))
+
+static int enc_stream_abort(int sw) {
+    memset(&G_context.enc_stream, 0, sizeof(enc_stream_t));
+    reset_app();
+    return io_send_sw(sw);
+}
+
+/// @brief Start a stream, the data begins with the spends digest (Sapling)
+/// or the anchor (Orchard)
+static void enc_stream_init(enc_stream_t *s, uint8_t ins, uint8_t *proofs, buffer_t *buf) {
+    memset(s, 0, sizeof(enc_stream_t));
+    s->ins = ins;
+    s->record_len = ins == SET_S_MERKLE_PROOF ? S_ENC_RECORD_LEN : O_ENC_RECORD_LEN;
+    cx_blake2b_init2_no_throw(&s->memos_hasher, 256, NULL, 0,
+        (uint8_t *) (ins == SET_S_MERKLE_PROOF ? "ZTxIdSOutM__Hash" : "ZTxIdOrcActMHash"), 16);
+    cx_blake2b_init2_no_throw(&s->noncompact_hasher, 256, NULL, 0,
+        (uint8_t *) (ins == SET_S_MERKLE_PROOF ? "ZTxIdSOutN__Hash" : "ZTxIdOrcActNHash"), 16);
+    buffer_move(buf, proofs, 32);
+}
+
+int enc_stream(const command_t *cmd) {
+    tx_signing_ctx_t *ctx = &G_context.signing_ctx;
+    enc_stream_t *s = &G_context.enc_stream;
+    if ((cmd->p1 & ~(CHAIN_FIRST | CHAIN_LAST)) != 0 || cmd->p2 != 0)
+        return enc_stream_abort(SW_WRONG_P1P2);
+
+    // s_proofs_t and o_proofs_t are: spends digest or anchor, memos, noncompact
+    uint8_t *proofs = (uint8_t *) &ctx->s_proofs;
+    uint16_t n_outputs = ctx->n_s_out;
+    bool *streamed = &ctx->s_enc_streamed;
+    #ifdef ORCHARD
+    if (cmd->ins == SET_O_MERKLE_PROOF) {
+        proofs = (uint8_t *) &ctx->o_proofs;
+        n_outputs = ctx->n_o_action;
+        streamed = &ctx->o_enc_streamed;
+    }
+    #endif
+
+    buffer_t buf = {.ptr = cmd->data, .size = cmd->lc, .offset = 0};
+    if (cmd->p1 & CHAIN_FIRST) {
+        // every output must have been added
+        if (ctx->stage != FEE || *streamed)
+            return enc_stream_abort(SW_BAD_STATE);
+        if (cmd->lc < 32)
+            return enc_stream_abort(SW_WRONG_DATA_LENGTH);
+        enc_stream_init(s, cmd->ins, proofs, &buf);
+    }
+    else if (s->ins != cmd->ins || ctx->stage != FEE)
+        return enc_stream_abort(SW_BAD_STATE);
+
+    // hash in place, a record may be split between APDUs
+    while (buf.offset < buf.size) {
+        const uint8_t *p = buf.ptr + buf.offset;
+        uint16_t n;
+        if (s->offset < ENC_MEMO_LEN) {
+            n = min(buf.size - buf.offset, ENC_MEMO_LEN - s->offset);
+            cx_hash((cx_hash_t *) &s->memos_hasher, 0, p, n, NULL, 0);
+        }
+        else {
+            n = min(buf.size - buf.offset, s->record_len - s->offset);
+            cx_hash((cx_hash_t *) &s->noncompact_hasher, 0, p, n, NULL, 0);
+        }
+        buffer_seek_cur(&buf, n);
+        s->offset += n;
+        if (s->offset == s->record_len) {
+            s->offset = 0;
+            s->records++;
+        }
+    }
+
+    if (cmd->p1 & CHAIN_LAST) {
+        if (s->offset != 0 || s->records != n_outputs)
+            return enc_stream_abort(SW_WRONG_DATA_LENGTH);
+        cx_hash((cx_hash_t *) &s->memos_hasher, CX_LAST, NULL, 0, proofs + 32, 32);
+        cx_hash((cx_hash_t *) &s->noncompact_hasher, CX_LAST, NULL, 0, proofs + 64, 32);
+        PRINTF("MEMOS: %.*H\n", 32, proofs + 32);
+        PRINTF("NONCOMPACT: %.*H\n", 32, proofs + 64);
+        memset(s, 0, sizeof(enc_stream_t));
+        *streamed = true;
+    }
+    return io_send_sw(SW_OK);
+}
+
+#endif
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "../types.h"
+
+/// Streamed variants of SET_S_MERKLE_PROOF and SET_O_MERKLE_PROOF
+/// (P1 has the CHAIN_FIRST/CHAIN_LAST flags of out_chain.h)
+/// The data of the first APDU starts with the sapling_spends_digest or the
+/// orchard anchor. It is followed by one record per output/action, in the
+/// order in which they were added
+/// Sapling: enc[52..564] || cv || enc[564..580] || out_ciphertext
+/// Orchard: enc[52..564] || cv || rk || enc[564..580] || out_ciphertext
+/// i.e. the memo part of the note ciphertext then the data of the
+/// noncompact digest of ZIP-244, in hashing order.
+/// Records may be split anywhere between APDUs. They are hashed in place
+/// and the app computes the memos and noncompact digests itself.
+/// The stream runs in the FEE stage, after every output was added
+/// Only with TX_STREAMS, i.e. not on the Nano S
+
+/// @brief Handle an APDU of a ciphertext stream
+/// @param cmd 
+/// @return 
+int enc_stream(const command_t *cmd);
@@ -0,0 +1,189 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memset, memmove
+#include <stdbool.h>  // bool
+
+#include "out_chain.h"
+#include "dispatcher.h"
+#include "../globals.h"
+#include "../io.h"
+#include "../sw.h"
+#include "../crypto/tx.h"
+#include "../ui/display.h"
+#include "../ui/menu.h"
+#include "../ui/action/validate.h"
+#include "../helper/send_response.h"
+
+#define READ_FIELD(s, field) memmove(&(s)->field, p, sizeof((s)->field)); p += sizeof((s)->field);
+#define IS_MONEY(x) (((int64_t)x) >= -MAX_MONEY && ((int64_t)x) <= MAX_MONEY)
+
+#define min(a, b) ((a) > (b) ? (b) : (a))
+
+void parse_s_out(s_out_t *out, const uint8_t *p, bool has_rseed) {
+    memset(out, 0, sizeof(s_out_t));
+    READ_FIELD(out, address);
+    READ_FIELD(out, amount);
+    READ_FIELD(out, epk);
+    READ_FIELD(out, enc);
+    if (has_rseed)
+        READ_FIELD(out, rseed);
+
+    // in prod, rseed is picked by our PRNG, not the client's
+    OVERRIDE_RSEED((*out));
+}
+
+void parse_o_action(o_action_t *action, const uint8_t *p, bool has_rseed) {
+    memset(action, 0, sizeof(o_action_t));
+    READ_FIELD(action, nf);
+    READ_FIELD(action, address);
+    READ_FIELD(action, amount);
+    READ_FIELD(action, epk);
+    READ_FIELD(action, enc);
+    if (has_rseed)
+        READ_FIELD(action, rseed);
+
+    // in prod, rseed is picked by our PRNG, not the client's
+    OVERRIDE_RSEED((*action));
+}
+
+/// @brief The chain state shares its memory with the T_IN
+/// and FEE streams, it is only valid in the output stages
+static bool in_out_stage() {
+    return G_context.signing_ctx.stage == S_OUT || G_context.signing_ctx.stage == O_ACTION;
+}
+
+bool out_chain_active() {
+    return in_out_stage() && G_context.out_chain.ins != 0;
+}
+
+void out_chain_clear() {
+    if (out_chain_active())
+        memset(&G_context.out_chain, 0, sizeof(out_chain_t));
+}
+
+static int out_chain_abort(int sw) {
+    out_chain_clear();
+    return io_send_sw(sw);
+}
+
+/// @brief Process the records of the current APDU until the end
+/// or until an output needs confirmation
+static int out_chain_run() {
+    out_chain_t *chain = &G_context.out_chain;
+    for (;;) {
+        const uint8_t *record;
+        if (chain->partial_len == 0 && chain->remaining >= chain->record_len) {
+            // parse in place
+            record = chain->next;
+            chain->next += chain->record_len;
+            chain->remaining -= chain->record_len;
+        }
+        else {
+            if (chain->remaining == 0) break;
+            uint8_t n = min(chain->record_len - chain->partial_len, chain->remaining);
+            memmove(chain->partial + chain->partial_len, chain->next, n);
+            chain->partial_len += n;
+            chain->next += n;
+            chain->remaining -= n;
+            if (chain->partial_len < chain->record_len) break; // rest in the next APDU
+            chain->partial_len = 0;
+            record = chain->partial;
+        }
+
+        bool confirmation;
+        OVERRIDE_CONFIRMATION((chain->flags & CHAIN_CONFIRM) != 0);
+        bool has_rseed = (chain->flags & CHAIN_RSEED) != 0;
+        uint8_t *cm = chain->cm + 32 * chain->n_cm;
+        int sw;
+        if (chain->ins == ADD_S_OUT_CHAIN) {
+            parse_s_out(&G_context.s_out, record, has_rseed);
+            if (!IS_MONEY(G_context.s_out.amount))
+                return out_chain_abort(SW_INVALID_PARAM);
+            sw = process_s_output(&G_context.s_out, cm, &confirmation);
+        }
+        #ifdef ORCHARD
+        else {
+            parse_o_action(&G_context.o_action, record, has_rseed);
+            if (!IS_MONEY(G_context.o_action.amount))
+                return out_chain_abort(SW_INVALID_PARAM);
+            sw = process_o_action(&G_context.o_action, cm, &confirmation);
+        }
+        #else
+        else
+            sw = SW_INS_NOT_SUPPORTED;
+        #endif
+        if (sw != SW_OK)
+            return out_chain_abort(sw);
+        chain->n_cm++;
+
+        if (confirmation) {
+            // resumed by out_chain_validate
+            if (chain->ins == ADD_S_OUT_CHAIN)
+                return ui_confirm_s_out(&G_context.s_out);
+            #ifdef ORCHARD
+            return ui_confirm_o_out(&G_context.o_action);
+            #endif
+        }
+    }
+
+    if (chain->last && chain->partial_len != 0)
+        return out_chain_abort(SW_WRONG_DATA_LENGTH);
+
+    ui_menu_main();
+    uint8_t n = chain->n_cm;
+    chain->n_cm = 0;
+    if (chain->last)
+        chain->ins = 0;
+    return helper_send_response_bytes(chain->cm, 32 * n);
+}
+
+int out_chain_start(const command_t *cmd) {
+    out_chain_t *chain = &G_context.out_chain;
+    if (G_context.signing_ctx.stage != (cmd->ins == ADD_S_OUT_CHAIN ? S_OUT : O_ACTION)) {
+        reset_app();
+        return io_send_sw(SW_BAD_STATE);
+    }
+    if ((cmd->p1 & ~(CHAIN_FIRST | CHAIN_LAST)) != 0 || (cmd->p2 & ~(CHAIN_RSEED | CHAIN_CONFIRM)) != 0)
+        return out_chain_abort(SW_WRONG_P1P2);
+
+    if (cmd->p1 & CHAIN_FIRST) {
+        memset(chain, 0, sizeof(out_chain_t));
+        chain->ins = cmd->ins;
+        chain->flags = cmd->p2;
+        uint8_t len = cmd->ins == ADD_S_OUT_CHAIN ? SAPLING_OUT_LEN : ORCHARD_OUT_LEN;
+        chain->record_len = (cmd->p2 & CHAIN_RSEED) ? len : len - 32;
+    }
+    else if (chain->ins != cmd->ins)
+        return out_chain_abort(SW_BAD_STATE);
+
+    chain->last = (cmd->p1 & CHAIN_LAST) != 0;
+    chain->next = cmd->data;
+    chain->remaining = cmd->lc;
+    chain->n_cm = 0;
+    return out_chain_run();
+}
+
+void out_chain_validate(bool choice) {
+    if (choice)
+        out_chain_run();
+    else {
+        reset_app();
+        io_send_sw(SW_DENY);
+    }
+}
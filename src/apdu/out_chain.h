@@ -0,0 +1,50 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "../types.h"
+
+/// Chained variants of ADD_S_OUT and ADD_O_ACTION
+/// The data of the APDUs of a chain is a stream of records in the
+/// format of the single record instructions. A record may be split
+/// between two APDUs. Each response has the CMU/CMX of the records
+/// completed by its APDU, concatenated.
+/// Outputs that need a confirmation pause the chain until the user
+/// approves them
+
+// P1
+#define CHAIN_FIRST 0x01
+#define CHAIN_LAST  0x02
+// P2, taken from the first APDU
+#define CHAIN_RSEED   0x01 // records include rseed, ignored in prod
+#define CHAIN_CONFIRM 0x02 // TEST only, prod always asks for confirmation
+
+/// @brief Parse a Sapling output record
+/// @param out 
+/// @param p record, SAPLING_OUT_LEN bytes with rseed, 32 bytes less without
+/// @param has_rseed 
+void parse_s_out(s_out_t *out, const uint8_t *p, bool has_rseed);
+
+/// @brief Parse an Orchard action record
+/// @param action 
+/// @param p record, ORCHARD_OUT_LEN bytes with rseed, 32 bytes less without
+/// @param has_rseed 
+void parse_o_action(o_action_t *action, const uint8_t *p, bool has_rseed);
+
+/// @brief Handle an APDU of ADD_S_OUT_CHAIN or ADD_O_ACTION_CHAIN
+/// @param cmd 
+/// @return 
+int out_chain_start(const command_t *cmd);
+
+/// @brief Check if a chain is in progress
+/// @return true in the S_OUT or O_ACTION stage if a chain was
+/// started and its last APDU was not processed yet
+bool out_chain_active();
+
+/// @brief Drop the chain in progress, if any
+void out_chain_clear();
+
+/// @brief Resume the chain after a confirmation
+/// @param choice 
+void out_chain_validate(bool choice);
@@ -0,0 +1,272 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memset, memmove
+#include <stdbool.h>  // bool
+
+#include <lcx_blake2.h>
+
+#include "t_in_stream.h"
+#include "../globals.h"
+#include "../io.h"
+#include "../sw.h"
+#include "../common/buffer.h"
+#include "../common/read.h"
+#include "../common/varint.h"
+#include "../crypto/tx.h"
+#include "../ui/action/validate.h"
+#include "../helper/send_response.h"
+
+#ifdef TX_STREAMS
+
+#define min(a, b) ((a) > (b) ? (b) : (a))
+
+/// @brief Size of a CompactSize from its first byte
+static uint8_t compact_size_len(uint8_t b) {
+    switch (b) {
+        case 0xFD: return 3;
+        case 0xFE: return 5;
+        case 0xFF: return 9;
+        default: return 1;
+    }
+}
+
+/// @brief Tag of the index-th record of the stream
+/// BLAKE2b-128(t_in_key || index (2) || txin_sig_digest), the key
+/// is drawn by the stream and never leaves the device
+static void t_in_tag(uint8_t *tag, uint16_t index, const uint8_t *txin_sig_digest) {
+    cx_blake2b_t hasher;
+    cx_blake2b_init2_no_throw(&hasher, 8 * T_IN_TAG_LEN,
+                              NULL, 0, (uint8_t *) "Zcash_LedgerTInT", 16);
+    cx_hash((cx_hash_t *) &hasher, 0, G_context.tx->t_in_key, 32, NULL, 0);
+    cx_hash((cx_hash_t *) &hasher, 0, (uint8_t *) &index, 2, NULL, 0);
+    cx_hash((cx_hash_t *) &hasher, CX_LAST, txin_sig_digest, 32, tag, T_IN_TAG_LEN);
+}
+
+static void t_in_stream_init(t_in_stream_t *s) {
+    memset(s, 0, sizeof(t_in_stream_t));
+    s->field = T_IN_COUNT;
+    s->left = 1;
+    cx_blake2b_init2_no_throw(&s->prevouts_hasher, 256,
+                              NULL, 0, (uint8_t *) "ZTxIdPrevoutHash", 16);
+    cx_blake2b_init2_no_throw(&s->scripts_hasher, 256,
+                              NULL, 0, (uint8_t *) "ZTxTrScriptsHash", 16);
+    cx_blake2b_init2_no_throw(&s->sequence_hasher, 256,
+                              NULL, 0, (uint8_t *) "ZTxIdSequencHash", 16);
+}
+
+static void t_in_stream_expect(t_in_stream_t *s, t_in_field_e field, uint64_t len) {
+    s->field = field;
+    s->left = len;
+    s->carry_len = 0;
+    if (field == T_IN_PREVOUT)
+        cx_blake2b_init2_no_throw(&s->txin_hasher, 256,
+                                  NULL, 0, (uint8_t *) "Zcash___TxInHash", 16);
+}
+
+/// @brief Tag the record that was just completed, the tags of the
+/// APDU are returned in its response
+static void t_in_stream_tag(t_in_stream_t *s) {
+    uint8_t digest[32];
+    cx_hash((cx_hash_t *) &s->txin_hasher, CX_LAST, NULL, 0, digest, 32);
+    uint16_t index = G_context.tx->n_t_in - s->inputs;
+    t_in_tag(G_store.out_buffer + s->n_tags * T_IN_TAG_LEN, index, digest);
+    s->n_tags++;
+}
+
+/// @brief Move to the next field once the current one is complete
+/// @return SW_OK or an error status word
+static int t_in_stream_next(t_in_stream_t *s) {
+    uint64_t v;
+    switch (s->field) {
+        case T_IN_COUNT:
+        case T_IN_SCRIPT_LEN: {
+            uint8_t len = compact_size_len(s->carry[0]);
+            if (s->carry_len < len) {
+                s->left = len - s->carry_len;
+                return SW_OK;
+            }
+            if (varint_read(s->carry, s->carry_len, &v) < 0)
+                return SW_INVALID_PARAM;
+            if (s->field == T_IN_COUNT) {
+                // SIGN_TRANSPARENT counts the inputs it checks on 16 bits
+                if (v > 0xFFFF)
+                    return SW_INVALID_PARAM;
+                s->inputs = v;
+                G_context.tx->n_t_in = v;
+                if (v == 0)
+                    t_in_stream_expect(s, T_IN_DONE, 0);
+                else
+                    t_in_stream_expect(s, T_IN_PREVOUT, 36);
+            }
+            else {
+                // the CompactSize is part of the scriptPubKey serialization
+                cx_hash((cx_hash_t *) &s->scripts_hasher, 0, s->carry, s->carry_len, NULL, 0);
+                cx_hash((cx_hash_t *) &s->txin_hasher, 0, s->carry, s->carry_len, NULL, 0);
+                if (v == 0)
+                    t_in_stream_expect(s, T_IN_SEQUENCE, 4);
+                else
+                    t_in_stream_expect(s, T_IN_SCRIPT, v);
+            }
+            return SW_OK;
+        }
+        case T_IN_PREVOUT:
+            t_in_stream_expect(s, T_IN_VALUE, 8);
+            return SW_OK;
+        case T_IN_VALUE: {
+            cx_hash((cx_hash_t *) &s->txin_hasher, 0, s->carry, 8, NULL, 0);
+            int sw = process_t_in_amount(read_u64_le(s->carry, 0));
+            if (sw != SW_OK)
+                return sw;
+            t_in_stream_expect(s, T_IN_SCRIPT_LEN, 1);
+            return SW_OK;
+        }
+        case T_IN_SCRIPT:
+            t_in_stream_expect(s, T_IN_SEQUENCE, 4);
+            return SW_OK;
+        case T_IN_SEQUENCE:
+            t_in_stream_tag(s);
+            s->inputs--;
+            if (s->inputs == 0)
+                t_in_stream_expect(s, T_IN_DONE, 0);
+            else
+                t_in_stream_expect(s, T_IN_PREVOUT, 36);
+            return SW_OK;
+        default:
+            return SW_BAD_STATE;
+    }
+}
+
+static int t_in_stream_abort(int sw) {
+    G_context.signing_ctx.t_in_streaming = false;
+    reset_app();
+    return io_send_sw(sw);
+}
+
+int t_in_stream(const uint8_t *data, size_t len) {
+    tx_signing_ctx_t *ctx = &G_context.signing_ctx;
+    t_in_stream_t *s = &G_context.t_in_stream;
+    if (ctx->stage != T_IN || ctx->t_in_streamed || (ctx->has_t_in && !ctx->t_in_streaming))
+        return t_in_stream_abort(SW_BAD_STATE);
+    if (!ctx->t_in_streaming) {
+        t_in_stream_init(s);
+        cx_get_random_bytes(G_context.tx->t_in_key, 32);
+        ctx->t_in_streaming = true;
+    }
+    s->n_tags = 0;
+
+    buffer_t buf = {.ptr = data, .size = len, .offset = 0};
+    while (buf.offset < buf.size) {
+        if (s->field == T_IN_DONE)
+            return t_in_stream_abort(SW_WRONG_DATA_LENGTH);
+        size_t n = min(buf.size - buf.offset, s->left);
+        const uint8_t *p = buf.ptr + buf.offset;
+        switch (s->field) {
+            case T_IN_PREVOUT:
+                cx_hash((cx_hash_t *) &s->prevouts_hasher, 0, p, n, NULL, 0);
+                cx_hash((cx_hash_t *) &s->txin_hasher, 0, p, n, NULL, 0);
+                break;
+            case T_IN_SCRIPT:
+                cx_hash((cx_hash_t *) &s->scripts_hasher, 0, p, n, NULL, 0);
+                cx_hash((cx_hash_t *) &s->txin_hasher, 0, p, n, NULL, 0);
+                break;
+            case T_IN_SEQUENCE:
+                cx_hash((cx_hash_t *) &s->sequence_hasher, 0, p, n, NULL, 0);
+                cx_hash((cx_hash_t *) &s->txin_hasher, 0, p, n, NULL, 0);
+                break;
+            default: // short fields are collected before they are parsed
+                memmove(s->carry + s->carry_len, p, n);
+                s->carry_len += n;
+                break;
+        }
+        buffer_seek_cur(&buf, n);
+        s->left -= n;
+        if (s->left == 0) {
+            int sw = t_in_stream_next(s);
+            if (sw != SW_OK)
+                return t_in_stream_abort(sw);
+        }
+    }
+
+    if (s->field == T_IN_DONE) {
+        t_proofs_t *proofs = &ctx->t_proofs;
+        cx_hash((cx_hash_t *) &s->prevouts_hasher, CX_LAST, NULL, 0, proofs->prevouts_sig_digest, 32);
+        cx_hash((cx_hash_t *) &s->scripts_hasher, CX_LAST, NULL, 0, proofs->scriptpubkeys_sig_digest, 32);
+        cx_hash((cx_hash_t *) &s->sequence_hasher, CX_LAST, NULL, 0, proofs->sequence_sig_digest, 32);
+        PRINTF("T PREVOUTS: %.*H\n", 32, proofs->prevouts_sig_digest);
+        PRINTF("T SCRIPTS: %.*H\n", 32, proofs->scriptpubkeys_sig_digest);
+        PRINTF("T SEQUENCES: %.*H\n", 32, proofs->sequence_sig_digest);
+        ctx->t_in_streaming = false;
+        ctx->t_in_streamed = true;
+        G_context.tx->t_in_streamed = true;
+    }
+    return helper_send_response_bytes(G_store.out_buffer, s->n_tags * T_IN_TAG_LEN);
+}
+
+bool t_in_record_digest(buffer_t *buf, uint8_t *digest) {
+    size_t start = buf->offset;
+    uint64_t script_len;
+    if (!buffer_seek_cur(buf, 36 + 8) ||
+        !buffer_read_varint(buf, &script_len) ||
+        script_len > buf->size ||
+        !buffer_seek_cur(buf, script_len + 4))
+        return false;
+
+    cx_blake2b_t hasher;
+    cx_blake2b_init2_no_throw(&hasher, 256,
+                              NULL, 0, (uint8_t *) "Zcash___TxInHash", 16);
+    cx_hash((cx_hash_t *) &hasher, CX_LAST, buf->ptr + start, buf->offset - start, digest, 32);
+    return true;
+}
+
+int sign_t_in_records(uint8_t count, const uint8_t *data, size_t len) {
+    tx_signing_ctx_t *ctx = &G_context.signing_ctx;
+    uint16_t n_t_in = G_context.tx->n_t_in;
+    if (ctx->stage != SIGN || !G_context.tx->t_in_streamed || ctx->t_in_signed + count > n_t_in) {
+        reset_app();
+        return io_send_sw(SW_BAD_STATE);
+    }
+
+    // every record of the batch must carry the tag the stream gave it
+    // at its position before any of them is signed
+    uint8_t digests[SIGN_BATCH_MAX * 32];
+    buffer_t buf = {.ptr = data, .size = len, .offset = 0};
+    for (uint8_t i = 0; i < count; i++) {
+        uint8_t tag[T_IN_TAG_LEN];
+        if (!t_in_record_digest(&buf, digests + i * 32) ||
+            !buffer_can_read(&buf, T_IN_TAG_LEN)) {
+            reset_app();
+            return io_send_sw(SW_WRONG_DATA_LENGTH);
+        }
+        t_in_tag(tag, ctx->t_in_signed + i, digests + i * 32);
+        if (memcmp(tag, buf.ptr + buf.offset, T_IN_TAG_LEN) != 0) {
+            reset_app();
+            return io_send_sw(SW_INVALID_PARAM);
+        }
+        buffer_seek_cur(&buf, T_IN_TAG_LEN);
+    }
+    if (buf.offset != buf.size) {
+        reset_app();
+        return io_send_sw(SW_WRONG_DATA_LENGTH);
+    }
+
+    ctx->t_in_signed += count;
+    return sign_transparent(count, digests);
+}
+
+#endif
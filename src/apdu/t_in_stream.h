@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stddef.h>   // size_t
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "../types.h"
+#include "../common/buffer.h"
+
+/// Streamed transparent inputs (ADD_T_IN with P1 = 1)
+/// The stream is CompactSize(n) followed by n records
+/// prevout (36) || amount (8) || CompactSize(len) || scriptPubKey (len) || nSequence (4)
+/// i.e. the preimages of the txin_sig_digest of ZIP-244, with the amount
+/// and the scriptPubKey of the outputs being spent.
+/// Records can be split anywhere between APDUs. The device hashes the
+/// amounts, prevouts, scriptPubKeys and sequences as they arrive and
+/// computes the digests otherwise given by SET_T_MERKLE_PROOF.
+/// The response of each APDU has a 16-byte tag per record it completed,
+/// SIGN_TRANSPARENT P2 = 1 only signs a record with its tag
+/// Only with TX_STREAMS, i.e. not on the Nano S
+
+/// @brief Handle a chunk of the stream
+/// @param data 
+/// @param len 
+/// @return 
+int t_in_stream(const uint8_t *data, size_t len);
+
+/// @brief Compute txin_sig_digest from a record of the stream
+/// @param buf advanced past the record
+/// @param digest 32 bytes
+/// @return false if buf does not hold a whole record
+bool t_in_record_digest(buffer_t *buf, uint8_t *digest);
+
+/// @brief SIGN_TRANSPARENT with P2 = 1, the data has the records
+/// of the inputs, each followed by its tag, instead of their txin_sig_digest.
+/// Only for a transaction whose inputs were streamed. The records
+/// must come in the order of the stream: the app hashes them again
+/// and checks every tag before it signs any record of the batch
+/// @param count number of records
+/// @param data 
+/// @param len 
+/// @return 
+int sign_t_in_records(uint8_t count, const uint8_t *data, size_t len);
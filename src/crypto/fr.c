@@ -47,9 +47,21 @@ void fp_from_wide(uint8_t *data_512) {
     fp_from_wide_be(data_512);
 }
 
+/// @brief Reduce a 512 bit BE number in place, result in the first 32 bytes
+static void from_wide_be(uint8_t *data_512, field_e f) {
+    bn_session_begin();
+    cx_bn_t a, r;
+    CX_THROW(cx_bn_alloc_init(&a, 64, data_512, 64));
+    CX_THROW(cx_bn_alloc(&r, 32));
+    cx_bn_reduce(r, a, field_ctx(f)->M);
+    cx_bn_export(r, data_512, 32);
+    cx_bn_destroy(&a);
+    cx_bn_destroy(&r);
+    bn_session_end();
+}
+
 void fp_from_wide_be(uint8_t *data_512) {
-    cx_math_modm_no_throw(data_512, 64, fp_m, 32);
-    memmove(data_512, data_512 + 32, 32);
+    from_wide_be(data_512, FIELD_FP);
 }
 
 void fv_from_wide(uint8_t *data_512) {
@@ -58,8 +70,128 @@ void fv_from_wide(uint8_t *data_512) {
 }
 
 void fv_from_wide_be(uint8_t *data_512) {
-    cx_math_modm_no_throw(data_512, 64, fv_m, 32);
-    memmove(data_512, data_512 + 32, 32);
+    from_wide_be(data_512, FIELD_FV);
+}
+
+typedef enum { FV_ADD, FV_SUB, FV_MUL } fv_op_e;
+
+static void fv_op(fv_t *v, const fv_t *a, const fv_t *b, fv_op_e op) {
+    bn_session_begin();
+    const field_ctx_t *f = field_ctx(FIELD_FV);
+    cx_bn_t zero = f->zero;
+    BN_DEF(x); cx_bn_init(x, *a, 32);
+    BN_DEF(y); cx_bn_init(y, *b, 32);
+    BN_DEF(r);
+    switch (op) {
+        case FV_ADD: 
+            cx_bn_mod_add_fixed(r, x, y, f->M);
+            break;
+        case FV_SUB:
+            cx_bn_mod_sub(r, x, y, f->M);
+            break;
+        case FV_MUL:
+            cx_bn_mod_mul(r, x, y, f->M);
+            break;
+    }
+    cx_bn_export(r, *v, 32);
+    cx_bn_destroy(&x);
+    cx_bn_destroy(&y);
+    cx_bn_destroy(&r);
+    bn_session_end();
+}
+
+void fv_negate(fv_t *v) {
+    fv_t zero;
+    memset(&zero, 0, 32);
+    fv_op(v, &zero, v, FV_SUB);
+}
+
+void fv_add(fv_t *v, const fv_t *a, const fv_t *b) {
+    fv_op(v, a, b, FV_ADD);
+}
+
+void fv_mult(fv_t *v, const fv_t *a, const fv_t *b) {
+    fv_op(v, a, b, FV_MUL);
+}
+
+static const uint8_t *const FIELD_MODULI[FIELD_COUNT] = {fp_m, fv_m, fq_m, fr_m};
+static field_ctx_t field_ctxs[FIELD_COUNT];
+static uint8_t bn_session_depth;
+
+void bn_session_begin(void) {
+    if (bn_session_depth == 0) {
+        CX_THROW(cx_bn_lock(32, 0));
+        for (int i = 0; i < FIELD_COUNT; i++)
+            field_ctxs[i].ready = false;
+    }
+    bn_session_depth++;
+}
+
+void bn_session_end(void) {
+    if (bn_session_depth == 0) return;
+    if (--bn_session_depth == 0)
+        cx_bn_unlock();
+}
+
+void bn_session_abort(void) {
+    bn_session_depth = 0;
+    cx_bn_unlock();
+}
+
+const field_ctx_t *field_ctx(field_e f) {
+    field_ctx_t *ctx = &field_ctxs[f];
+    if (ctx->ready) return ctx;
+
+    CX_THROW(cx_bn_alloc_init(&ctx->M, 32, FIELD_MODULI[f], 32));
+    CX_THROW(cx_bn_alloc(&ctx->zero, 32)); cx_bn_set_u32(ctx->zero, 0);
+#ifndef NO_MONTGOMERY
+    // R = 2^256 [M]
+    cx_bn_t r_wide, R;
+    CX_THROW(cx_bn_alloc(&r_wide, 64)); cx_bn_set_u32(r_wide, 0);
+    cx_bn_set_bit(r_wide, 256);
+    CX_THROW(cx_bn_alloc(&R, 32));
+    cx_bn_reduce(R, r_wide, ctx->M);
+    cx_bn_destroy(&r_wide);
+#ifdef MONTGOMERY_EMU
+    ctx->R = R;
+    CX_THROW(cx_bn_alloc(&ctx->RInv, 32));
+    cx_bn_mod_invert_nprime(ctx->RInv, ctx->R, ctx->M);
+    CX_THROW(cx_bn_alloc(&ctx->temp, 32));
+#else
+    // H = R^2 [M]
+    cx_bn_t H;
+    CX_THROW(cx_bn_alloc(&H, 32));
+    cx_bn_mod_mul(H, R, R, ctx->M);
+    CX_THROW(cx_mont_alloc(&ctx->mont, 32));
+    cx_mont_init2(&ctx->mont, ctx->M, H);
+    cx_bn_destroy(&R);
+    cx_bn_destroy(&H);
+#endif
+#endif
+    ctx->ready = true;
+    return ctx;
+}
+
+void recode_signed_radix16(int8_t *digits, const uint8_t *x, int n_digits) {
+    int8_t carry = 0;
+    for (int i = 0; i < n_digits; i++) {
+        uint8_t b = i < 64 ? x[31 - i / 2] : 0;
+        int8_t n = (int8_t)((i & 1) ? b >> 4 : b & 0x0F) + carry;
+        carry = (n + 8) >> 4; // 1 if n >= 8
+        digits[i] = n - (carry << 4);
+    }
+}
+
+void bn_cmov(cx_bn_t r, cx_bn_t a, cx_bn_t mask, cx_bn_t temp) {
+    cx_bn_xor(temp, r, a);
+    cx_bn_and(temp, temp, mask);
+    cx_bn_xor(r, r, temp);
+}
+
+void bn_set_mask(cx_bn_t mask, uint8_t m) {
+    uint8_t v[32];
+    memset(v, m, 32);
+    cx_bn_init(mask, v, 32);
 }
 
 #ifdef TEST
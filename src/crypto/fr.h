@@ -1,5 +1,7 @@
 #pragma once
 
+#include <stdbool.h>  // bool
+#include <string.h>   // memcmp
 #include <lcx_math.h>
 
 #include "../types.h"
@@ -15,6 +17,28 @@
 #define cx_bn_mod_add_fixed(a, b, c, m) cx_bn_mod_add(a, b, c, m)
 #endif
 
+/**
+ * Lazy reduction
+ * cx_bn_mod_sub reduces a first operand in [0, 2m), that is how the fix
+ * above works. So a sum that only goes into the first operand of
+ * subtractions can stay in [0, 2m): cx_bn_mod_add_lazy skips the fix.
+ * Lazy values must not go into a multiplication, a comparison, an export,
+ * an addition or the second operand of a subtraction.
+ * cx_bn_mod_add_reduce adds a reduced c to a lazy b by subtracting -c,
+ * which gives a reduced result in 2 operations instead of 3. t is a
+ * temporary
+ * The other sums of the point doubling and addition formulas feed a
+ * multiplication and must be reduced. The formulas avoid them instead:
+ * the BN unit squares at the cost of a multiplication, so the
+ * (x + y)^2 - x^2 - y^2 terms are computed as 2.x.y
+*/
+#define cx_bn_mod_add_lazy(a, b, c, m) cx_bn_mod_add(a, b, c, m)
+#ifdef MOD_ADD_FIX
+#define cx_bn_mod_add_reduce(a, b, c, t, m) cx_bn_mod_sub(t, zero, c, m); cx_bn_mod_sub(a, b, t, m)
+#else
+#define cx_bn_mod_add_reduce(a, b, c, t, m) cx_bn_mod_add(a, b, c, m)
+#endif
+
 /// Modulus of Pasta base field
 /// p = 0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001
 static const uint8_t fp_m[32] = {
@@ -33,6 +57,67 @@ static const uint8_t fv_m[32] = {
   0x8c, 0x46, 0xeb, 0x21, 0x00, 0x00, 0x00, 0x01,
 };
 
+/// Modulus of Jubjub base field
+/// q = 0x73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001
+static const uint8_t fq_m[32] = {
+  0x73, 0xed, 0xa7, 0x53, 0x29, 0x9d, 0x7d, 0x48, 
+  0x33, 0x39, 0xd8, 0x08, 0x09, 0xa1, 0xd8, 0x05, 
+  0x53, 0xbd, 0xa4, 0x02, 0xff, 0xfe, 0x5b, 0xfe, 
+  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01    
+};
+
+/// Modulus of Jubjub scalar field
+/// r = 0x0e7db4ea6533afa906673b0101343b00a6682093ccc81082d0970e5ed6f72cb7
+static const uint8_t fr_m[32] = {
+  0x0e, 0x7d, 0xb4, 0xea, 0x65, 0x33, 0xaf, 0xa9, 
+  0x06, 0x67, 0x3b, 0x01, 0x01, 0x34, 0x3b, 0x00, 
+  0xa6, 0x68, 0x20, 0x93, 0xcc, 0xc8, 0x10, 0x82, 
+  0xd0, 0x97, 0x0e, 0x5e, 0xd6, 0xf7, 0x2c, 0xb7
+};
+
+typedef enum {
+    FIELD_FP, // Pallas base field
+    FIELD_FV, // Pallas scalar field
+    FIELD_FQ, // Jubjub base field
+    FIELD_FR, // Jubjub scalar field
+    FIELD_COUNT,
+} field_e;
+
+/// @brief Modulus and Montgomery context of a field, in the BN unit
+/// Contexts live for the duration of a BN session and are set up
+/// on first use
+typedef struct {
+    cx_bn_t M;
+    cx_bn_t zero;
+#ifdef MONTGOMERY_EMU
+    cx_bn_t R;
+    cx_bn_t RInv;
+    cx_bn_t temp;
+#elif !defined(NO_MONTGOMERY)
+    cx_bn_mont_ctx_t mont;
+#endif
+    bool ready;
+} field_ctx_t;
+
+/// @brief Lock the BN unit, or join the session already open
+/// Sessions nest: only the outermost end unlocks, so a high level
+/// operation can open one and have every curve function it calls
+/// share the lock and the field contexts
+/// @remark Functions of lcx_math lock the BN unit and cannot be used
+/// inside a session, use the fv_ helpers below
+void bn_session_begin(void);
+
+/// @brief Leave the session, unlocks the BN unit if it is the outermost
+void bn_session_end(void);
+
+/// @brief Unlock the BN unit whatever the nesting level, after an exception
+void bn_session_abort(void);
+
+/// @brief Context of a field, must be in a session
+/// @param f 
+/// @return 
+const field_ctx_t *field_ctx(field_e f);
+
 /// @brief Reverse bytes of data
 /// @param data pointer to the beginning of the array
 /// @param len length of the array
@@ -56,24 +141,13 @@ void fp_from_wide(uint8_t *data_512);
 void fp_from_wide_be(uint8_t *data_512);
 
 static inline bool fp_ok(fq_t *v) {
-    int diff;
-    cx_math_cmp_no_throw((uint8_t *)v, fp_m, 32, &diff);
-    return diff < 0;
-}
-
-static inline void fv_negate(fv_t *v) {
-    fv_t zero;
-    memset(&zero, 0, 32);
-    cx_math_subm_no_throw((uint8_t *)v, (uint8_t *)zero, (uint8_t *)v, fv_m, 32);
-}
-
-static inline void fv_add(fv_t *v, const fv_t *a, const fv_t *b) {
-    cx_math_addm_no_throw((uint8_t *)v, (uint8_t *)a, (uint8_t *)b, fv_m, 32);
+    // both are big endian
+    return memcmp((uint8_t *)v, fp_m, 32) < 0;
 }
 
-static inline void fv_mult(fv_t *v, const fv_t *a, const fv_t *b) {
-    cx_math_multm_no_throw((uint8_t *)v, (uint8_t *)a, (uint8_t *)b, fv_m, 32);
-}
+void fv_negate(fv_t *v);
+void fv_add(fv_t *v, const fv_t *a, const fv_t *b);
+void fv_mult(fv_t *v, const fv_t *a, const fv_t *b);
 
 #ifdef TEST
 void print_bn_internal(const char *label, cx_bn_t bn);
@@ -84,6 +158,29 @@ void print_bn_internal(const char *label, cx_bn_t bn);
 
 bool ff_is_zero(uint8_t *v);
 
+/// @brief Recode a 256 bit big endian scalar into signed radix-16 digits
+/// in [-8, 7], least significant first. Runs in constant time.
+/// The tables hold the multiples 0..8 for the absolute value |digit| <= 8.
+/// The top digit must not overflow, i.e. n_digits*4 must exceed the bit
+/// length of the scalar by at least 1
+/// @param digits output, n_digits values
+/// @param x scalar, 32 bytes BE
+/// @param n_digits number of digits (64 or 65)
+void recode_signed_radix16(int8_t *digits, const uint8_t *x, int n_digits);
+
+/// @brief 0xFF if a == b, 0x00 otherwise, in constant time
+static inline uint8_t ct_eq_mask(uint8_t a, uint8_t b) {
+    return (uint8_t)(((uint32_t)(a ^ b) - 1) >> 24);
+}
+
+/// @brief r = a if mask is all ones, unchanged if mask is zero
+/// Runs in constant time
+/// @param temp scratch
+void bn_cmov(cx_bn_t r, cx_bn_t a, cx_bn_t mask, cx_bn_t temp);
+
+/// @brief Fill mask with the byte m (0x00 or 0xFF)
+void bn_set_mask(cx_bn_t mask, uint8_t m);
+
 #define BN_DEF(a) cx_bn_t a; CX_THROW(cx_bn_alloc(&a, 32));
 #define BN_DEF_ZERO BN_DEF(zero); cx_bn_set_u32(zero, 0);
 
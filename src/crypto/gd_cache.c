@@ -0,0 +1,72 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memmove, memcmp
+#include <stdbool.h>  // bool
+
+#include "gd_cache.h"
+
+// entries[0..count) ordered from most to least recently used
+static gd_cache_entry_t entries[GD_CACHE_SIZE];
+static uint8_t count;
+
+static int find(gd_pool_e pool, const uint8_t *d) {
+    for (int i = 0; i < count; i++) {
+        if (entries[i].pool == pool && memcmp(entries[i].d, d, 11) == 0)
+            return i;
+    }
+    return -1;
+}
+
+static void move_to_front(int i) {
+    gd_cache_entry_t e;
+    memmove(&e, &entries[i], sizeof(gd_cache_entry_t));
+    memmove(&entries[1], &entries[0], i * sizeof(gd_cache_entry_t));
+    memmove(&entries[0], &e, sizeof(gd_cache_entry_t));
+}
+
+bool gd_cache_get(gd_pool_e pool, const uint8_t *d, uint8_t *g_d) {
+    int i = find(pool, d);
+    if (i < 0) return false;
+    move_to_front(i);
+    memmove(g_d, entries[0].g_d, 32);
+    return true;
+}
+
+void gd_cache_put(gd_pool_e pool, const uint8_t *d, const uint8_t *g_d, bool pin) {
+    if (pin) {
+        for (int i = 0; i < count; i++)
+            if (entries[i].pool == pool) entries[i].pinned = false;
+    }
+
+    int i = find(pool, d);
+    if (i < 0) {
+        if (count < GD_CACHE_SIZE)
+            i = count++;
+        else {
+            // evict the least recently used entry that is not pinned
+            for (i = count - 1; i >= 0 && entries[i].pinned; i--);
+            if (i < 0) return;
+        }
+        entries[i].pool = pool;
+        memmove(entries[i].d, d, 11);
+        memmove(entries[i].g_d, g_d, 32);
+    }
+    entries[i].pinned |= pin;
+    move_to_front(i);
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+/// Cache of the diversified base G_d of recipient addresses
+/// G_d only depends on the diversifier d, so the entries stay
+/// valid across transactions and accounts
+
+typedef enum {
+    GD_SAPLING,
+    GD_ORCHARD,
+} gd_pool_e;
+
+#ifdef TARGET_NANOS
+#define GD_CACHE_SIZE 4
+#else
+#define GD_CACHE_SIZE 8
+#endif
+
+typedef struct {
+    uint8_t pool;
+    bool pinned;
+    uint8_t d[11];
+    uint8_t g_d[32]; // compressed point, validated
+} gd_cache_entry_t;
+
+/// @brief Lookup G_d and mark the entry as most recently used
+/// @param pool 
+/// @param d diversifier, 11 bytes
+/// @param g_d output, 32 bytes
+/// @return true if found
+bool gd_cache_get(gd_pool_e pool, const uint8_t *d, uint8_t *g_d);
+
+/// @brief Insert G_d, evicting the least recently used entry
+/// that is not pinned
+/// @param pool 
+/// @param d diversifier, 11 bytes
+/// @param g_d 32 bytes
+/// @param pin true for the default address of the account.
+/// It replaces the previous pinned entry of the same pool
+void gd_cache_put(gd_pool_e pool, const uint8_t *d, const uint8_t *g_d, bool pin);
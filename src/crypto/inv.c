@@ -0,0 +1,377 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memset, explicit_bzero
+#include <stdbool.h>  // bool
+#include <os.h>
+#include <ox_bn.h>
+
+#include "fr.h"
+#include "inv.h"
+
+#include "mont.h"
+
+/**
+ * Modular inversion by safegcd (Bernstein-Yang, "Fast constant-time gcd
+ * computation and modular inversion"), in the constant time variant of
+ * libsecp256k1 (modinv32): numbers are 9 signed limbs of 30 bits and the
+ * divsteps are batched by 30, with the 2x2 transition matrix applied to
+ * (f, g) and (d, e) once per batch.
+ * 20 batches = 600 divsteps are enough for moduli up to 256 bits.
+*/
+
+#define M30 ((int32_t)(UINT32_MAX >> 2))
+#define LIMBS 9
+
+typedef struct {
+    int32_t v[LIMBS];
+} signed30_t;
+
+typedef struct {
+    signed30_t modulus;
+    uint32_t modulus_inv30; // 1/modulus mod 2^30
+} modinfo_t;
+
+typedef struct {
+    int32_t u, v, q, r;
+} trans2x2_t;
+
+#ifdef ORCHARD
+static const modinfo_t FP_MODINFO = {
+    {{ 0x00000001, 0x24b4c3b4, 0x14cf91b9, 0x11a63f02, 0x00000022,
+       0x00000000, 0x00000000, 0x00000000, 0x00004000 }},
+    0x00000001,
+};
+#endif
+
+static const modinfo_t FQ_MODINFO = {
+    {{ 0x00000001, 0x3ffffffc, 0x3fe5bfef, 0x2f6900bf, 0x21d80553,
+       0x27602026, 0x17d48333, 0x29d4ca67, 0x000073ed }},
+    0x00000001,
+};
+
+/// @brief 30 divsteps on the low bits of f and g
+/// @return new zeta = -(delta + 1/2)
+static int32_t divsteps_30(int32_t zeta, uint32_t f0, uint32_t g0, trans2x2_t *t) {
+    uint32_t u = 1, v = 0, q = 0, r = 1;
+    uint32_t c1, c2, f = f0, g = g0, x, y, z;
+
+    for (int i = 0; i < 30; i++) {
+        // c1 = (zeta < 0), c2 = g odd
+        c1 = (uint32_t)(zeta >> 31);
+        c2 = -(g & 1);
+        // conditionally negated f, u, v added to g, q, r if g is odd
+        x = (f ^ c1) - c1;
+        y = (u ^ c1) - c1;
+        z = (v ^ c1) - c1;
+        g += x & c2;
+        q += y & c2;
+        r += z & c2;
+        // if zeta < 0 and g odd: swap, i.e. zeta = -zeta - 2 and (f, u, v) += (g, q, r)
+        c1 &= c2;
+        zeta = (zeta ^ (int32_t)c1) - 1;
+        f += g & c1;
+        u += q & c1;
+        v += r & c1;
+        g >>= 1;
+        u <<= 1;
+        v <<= 1;
+    }
+    t->u = (int32_t)u;
+    t->v = (int32_t)v;
+    t->q = (int32_t)q;
+    t->r = (int32_t)r;
+    return zeta;
+}
+
+/// @brief [d, e] = t.[d, e] / 2^30 mod modulus, keeping d, e in (-2.modulus, modulus)
+static void update_de_30(signed30_t *d, signed30_t *e, const trans2x2_t *t, const modinfo_t *mi) {
+    const int32_t u = t->u, v = t->v, q = t->q, r = t->r;
+    int32_t di, ei, md, me, sd, se;
+    int64_t cd, ce;
+
+    // add [u, q] if d is negative and [v, r] if e is negative
+    sd = d->v[LIMBS - 1] >> 31;
+    se = e->v[LIMBS - 1] >> 31;
+    md = (u & sd) + (v & se);
+    me = (q & sd) + (r & se);
+    di = d->v[0];
+    ei = e->v[0];
+    cd = (int64_t)u * di + (int64_t)v * ei;
+    ce = (int64_t)q * di + (int64_t)r * ei;
+    // multiple of the modulus that clears the bottom 30 bits
+    md -= (int32_t)((mi->modulus_inv30 * (uint32_t)cd + (uint32_t)md) & M30);
+    me -= (int32_t)((mi->modulus_inv30 * (uint32_t)ce + (uint32_t)me) & M30);
+    cd += (int64_t)mi->modulus.v[0] * md;
+    ce += (int64_t)mi->modulus.v[0] * me;
+    cd >>= 30;
+    ce >>= 30;
+    for (int i = 1; i < LIMBS; i++) {
+        di = d->v[i];
+        ei = e->v[i];
+        cd += (int64_t)u * di + (int64_t)v * ei;
+        ce += (int64_t)q * di + (int64_t)r * ei;
+        cd += (int64_t)mi->modulus.v[i] * md;
+        ce += (int64_t)mi->modulus.v[i] * me;
+        d->v[i - 1] = (int32_t)cd & M30;
+        cd >>= 30;
+        e->v[i - 1] = (int32_t)ce & M30;
+        ce >>= 30;
+    }
+    d->v[LIMBS - 1] = (int32_t)cd;
+    e->v[LIMBS - 1] = (int32_t)ce;
+}
+
+/// @brief [f, g] = t.[f, g] / 2^30, exact
+static void update_fg_30(signed30_t *f, signed30_t *g, const trans2x2_t *t) {
+    const int32_t u = t->u, v = t->v, q = t->q, r = t->r;
+    int32_t fi, gi;
+    int64_t cf, cg;
+
+    fi = f->v[0];
+    gi = g->v[0];
+    cf = (int64_t)u * fi + (int64_t)v * gi;
+    cg = (int64_t)q * fi + (int64_t)r * gi;
+    cf >>= 30;
+    cg >>= 30;
+    for (int i = 1; i < LIMBS; i++) {
+        fi = f->v[i];
+        gi = g->v[i];
+        cf += (int64_t)u * fi + (int64_t)v * gi;
+        cg += (int64_t)q * fi + (int64_t)r * gi;
+        f->v[i - 1] = (int32_t)cf & M30;
+        cf >>= 30;
+        g->v[i - 1] = (int32_t)cg & M30;
+        cg >>= 30;
+    }
+    f->v[LIMBS - 1] = (int32_t)cf;
+    g->v[LIMBS - 1] = (int32_t)cg;
+}
+
+/// @brief add the modulus if r < 0
+static void cond_add_modulus(signed30_t *r, const modinfo_t *mi) {
+    int32_t cond_add = r->v[LIMBS - 1] >> 31;
+    for (int i = 0; i < LIMBS; i++)
+        r->v[i] += mi->modulus.v[i] & cond_add;
+}
+
+/// @brief bring the limbs back to (-2^30, 2^30), the top one keeps the sign
+static void propagate(signed30_t *r) {
+    for (int i = 0; i < LIMBS - 1; i++) {
+        r->v[i + 1] += r->v[i] >> 30;
+        r->v[i] &= M30;
+    }
+}
+
+/// @brief r in (-2.modulus, modulus) to [0, modulus), negated if sign < 0
+static void normalize_30(signed30_t *r, int32_t sign, const modinfo_t *mi) {
+    int32_t cond_negate = sign >> 31;
+    cond_add_modulus(r, mi);
+    for (int i = 0; i < LIMBS; i++)
+        r->v[i] = (r->v[i] ^ cond_negate) - cond_negate;
+    propagate(r);
+    cond_add_modulus(r, mi);
+    propagate(r);
+}
+
+static void from_bytes(signed30_t *r, const uint8_t *x) {
+    uint64_t acc = 0;
+    int bits = 0, k = 0;
+    for (int i = 31; i >= 0; i--) {
+        acc |= (uint64_t)x[i] << bits;
+        bits += 8;
+        if (bits >= 30) {
+            r->v[k++] = (int32_t)(acc & M30);
+            acc >>= 30;
+            bits -= 30;
+        }
+    }
+    r->v[k] = (int32_t)acc;
+}
+
+static void to_bytes(uint8_t *x, const signed30_t *r) {
+    uint64_t acc = 0;
+    int bits = 0, k = 0;
+    for (int i = 31; i >= 0; i--) {
+        if (bits < 8) {
+            acc |= (uint64_t)(uint32_t)r->v[k++] << bits;
+            bits += 30;
+        }
+        x[i] = acc & 0xFF;
+        acc >>= 8;
+        bits -= 8;
+    }
+}
+
+/// @brief x = 1/x mod modulus, 32 bytes BE, x < modulus
+static void modinv(uint8_t *x, const modinfo_t *mi) {
+    signed30_t d, e, f, g;
+    trans2x2_t t;
+    int32_t zeta = -1; // delta = 1/2
+
+    memset(&d, 0, sizeof(d));
+    memset(&e, 0, sizeof(e));
+    e.v[0] = 1;
+    f = mi->modulus;
+    from_bytes(&g, x);
+
+    for (int i = 0; i < 20; i++) {
+        zeta = divsteps_30(zeta, (uint32_t)f.v[0], (uint32_t)g.v[0], &t);
+        update_de_30(&d, &e, &t, mi);
+        update_fg_30(&f, &g, &t);
+    }
+    // g = 0 and f = +/- gcd = +/- 1, d = +/- 1/x
+    normalize_30(&d, f.v[LIMBS - 1], mi);
+    to_bytes(x, &d);
+
+    explicit_bzero(&d, sizeof(d));
+    explicit_bzero(&e, sizeof(e));
+    explicit_bzero(&f, sizeof(f));
+    explicit_bzero(&g, sizeof(g));
+    explicit_bzero(&t, sizeof(t));
+}
+
+static const modinfo_t *modinfo(field_e f) {
+    switch (f) {
+#ifdef ORCHARD
+        case FIELD_FP:
+            return &FP_MODINFO;
+#endif
+        case FIELD_FQ:
+            return &FQ_MODINFO;
+        default:
+            THROW(CX_INVALID_PARAMETER);
+    }
+    return NULL;
+}
+
+void ff_inv(field_e f, cx_bn_t r, cx_bn_t a) {
+    uint8_t x[32];
+    cx_bn_export(a, x, 32);
+    modinv(x, modinfo(f));
+    cx_bn_init(r, x, 32);
+    explicit_bzero(x, 32);
+}
+
+/// @brief a' = a, or 1 if a = 0
+static void nonzero(cx_bn_t r, cx_bn_t a, cx_bn_t one, cx_bn_t mask, cx_bn_t temp) {
+    int cmp;
+    cx_bn_cmp_u32(a, 0, &cmp);
+    cx_bn_copy(r, a);
+    bn_set_mask(mask, (uint8_t)-(uint8_t)(cmp == 0));
+    bn_cmov(r, one, mask, temp);
+}
+
+void ff_batch_inv(field_e f, cx_bn_t *r, const cx_bn_t *a, uint8_t n) {
+    if (n == 0 || n > FF_BATCH_MAX) THROW(CX_INVALID_PARAMETER);
+    if (n == 1) {
+        ff_inv(f, r[0], a[0]);
+        return;
+    }
+    bn_session_begin();
+    use_field(field_ctx(f));
+    BN_DEF(inv);
+    BN_DEF(ai);
+    BN_DEF(one); cx_bn_set_u32(one, 1);
+    BN_DEF(mask);
+    BN_DEF(temp);
+
+    // r[i] = a'[0]...a'[i], where zeros are replaced by 1
+    nonzero(r[0], a[0], one, mask, temp);
+    for (uint8_t i = 1; i < n; i++) {
+        nonzero(ai, a[i], one, mask, temp);
+        CX_BN_MOD_MUL(r[i], r[i - 1], ai);
+    }
+    ff_inv(f, inv, r[n - 1]);
+    // walk back: inv = 1/(a'[0]...a'[i])
+    for (uint8_t i = n - 1; i > 0; i--) {
+        nonzero(ai, a[i], one, mask, temp);
+        CX_BN_MOD_MUL(r[i], inv, r[i - 1]);
+        CX_BN_MOD_MUL(temp, inv, ai);
+        cx_bn_copy(inv, temp);
+    }
+    cx_bn_copy(r[0], inv);
+    // zeros have a zero inverse
+    cx_bn_set_u32(ai, 0);
+    for (uint8_t i = 0; i < n; i++) {
+        int cmp;
+        cx_bn_cmp_u32(a[i], 0, &cmp);
+        bn_set_mask(mask, (uint8_t)-(uint8_t)(cmp == 0));
+        bn_cmov(r[i], ai, mask, temp);
+    }
+
+    cx_bn_destroy(&inv);
+    cx_bn_destroy(&ai);
+    cx_bn_destroy(&one);
+    cx_bn_destroy(&mask);
+    cx_bn_destroy(&temp);
+    bn_session_end();
+}
+
+#ifdef TEST
+static bool test_ff_inv_field(field_e f) {
+    bool ok = true;
+    int diff;
+    bn_session_begin();
+    use_field(field_ctx(f));
+    cx_bn_t a[FF_BATCH_MAX];
+    cx_bn_t r[FF_BATCH_MAX];
+    for (uint8_t i = 0; i < FF_BATCH_MAX; i++) {
+        CX_THROW(cx_bn_alloc(&a[i], 32));
+        CX_THROW(cx_bn_alloc(&r[i], 32));
+    }
+    BN_DEF(inv);
+    BN_DEF(ref);
+
+    // 1, p - 1, 0 and a random value
+    cx_bn_set_u32(a[0], 1);
+    cx_bn_mod_sub(a[1], zero, a[0], M);
+    cx_bn_set_u32(a[2], 0);
+    cx_bn_rng(a[3], M);
+
+    ff_batch_inv(f, r, a, FF_BATCH_MAX);
+    for (uint8_t i = 0; i < FF_BATCH_MAX; i++) {
+        ff_inv(f, inv, a[i]);
+        if (i == 2)
+            cx_bn_set_u32(ref, 0); // 0 has a zero inverse
+        else
+            cx_bn_mod_invert_nprime(ref, a[i], M);
+        cx_bn_cmp(inv, ref, &diff);
+        ok = ok && diff == 0;
+        cx_bn_cmp(r[i], ref, &diff);
+        ok = ok && diff == 0;
+    }
+
+    for (uint8_t i = 0; i < FF_BATCH_MAX; i++) {
+        cx_bn_destroy(&a[i]);
+        cx_bn_destroy(&r[i]);
+    }
+    cx_bn_destroy(&inv);
+    cx_bn_destroy(&ref);
+    bn_session_end();
+    return ok;
+}
+
+bool test_ff_inv() {
+    bool ok = test_ff_inv_field(FIELD_FQ);
+#ifdef ORCHARD
+    ok = ok && test_ff_inv_field(FIELD_FP);
+#endif
+    return ok;
+}
+#endif
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+#include <ox_bn.h>
+
+#include "fr.h"
+
+/// Maximum number of values of a batch inversion
+#define FF_BATCH_MAX 4
+
+/// @brief r = 1/a mod p in Fp (Pallas base) or Fq (Jubjub base), 0 if a = 0.
+/// Constant time safegcd (Bernstein-Yang) on the CPU, in place of the
+/// Fermat exponentiation of cx_bn_mod_invert_nprime. Like the latter, it
+/// inverts the value as stored: the inverse of x.R (MF) is 1/(x.R)
+/// Must be called in a BN session
+/// @param f FIELD_FP or FIELD_FQ
+/// @param r result, may be a
+/// @param a
+void ff_inv(field_e f, cx_bn_t r, cx_bn_t a);
+
+/// @brief r[i] = 1/a[i] for i < n with a single inversion (Montgomery's trick)
+/// Zero values have a zero inverse and do not affect the others.
+/// Runs in constant time. Must be called in a BN session
+/// @param f FIELD_FP or FIELD_FQ
+/// @param r results, allocated, must not overlap a
+/// @param a values
+/// @param n count, at most FF_BATCH_MAX
+void ff_batch_inv(field_e f, cx_bn_t *r, const cx_bn_t *a, uint8_t n);
+
+#ifdef TEST
+/// @brief Check ff_inv and ff_batch_inv in Fq (and Fp) against the Fermat
+/// inversion of cx_bn_mod_invert_nprime for 1, p - 1, 0 and a random value
+/// @return true if the inverses are the same
+bool test_ff_inv();
+#endif
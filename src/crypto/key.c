@@ -21,10 +21,10 @@
 #include <os.h>       // sprintf
 
 #include "key.h"
+#include "key_cache.h"
 #include "transparent.h"
 #include "sapling.h"
 #include "orchard.h"
-#include "ua.h"
 #include "../globals.h"
 
 #ifdef USE_TEST_KEY
@@ -53,25 +53,108 @@ int derive_tsk(uint8_t *tsk, uint8_t account) {
     return 0;
 }
 
-static void derive_keys_inner(uint8_t account) {
-    transparent_derive_pubkey(account);
-    sapling_derive_spending_key(account);
-    #ifdef ORCHARD
-    orchard_derive_spending_key(account);
-    #endif
+/// @brief Return the slot of the account, or else
+/// the least recently used slot that should be reused
+static account_slot_t *find_slot(uint8_t account) {
+    account_slot_t *lru = NULL;
+    for (int i = 0; i < ACCOUNT_SLOTS; i++) {
+        account_slot_t *slot = &G_context.key_slots[i];
+        if (slot->used && slot->account == account)
+            return slot;
+        if (!slot->used) {
+            if (lru == NULL || lru->used) lru = slot; // prefer free slots
+        }
+        else if (lru == NULL || (lru->used && slot->age > lru->age))
+            lru = slot;
+    }
+    return lru;
+}
+
+/// @brief Write the keys of a slot to the NVRAM cache
+/// if they changed since they were loaded or stored
+static void flush_slot(account_slot_t *slot) {
+    if (!slot->used || !slot->dirty) return;
+    uint8_t tsk[32];
+    derive_tsk(tsk, slot->account);
+    key_cache_store(&slot->keys, slot->account, tsk);
+    explicit_bzero(tsk, sizeof(tsk));
+    slot->dirty = false;
+}
+
+void flush_keys() {
+    for (int i = 0; i < ACCOUNT_SLOTS; i++)
+        flush_slot(&G_context.key_slots[i]);
+}
+
+/// @brief Make the account current. A new slot is filled from
+/// the NVRAM cache if possible, otherwise the keys are derived
+/// later by require_keys
+/// @param account 
+static void select_account(uint8_t account) {
+    if (G_context.keys_derived && G_context.account == account)
+        return;
+
+    account_slot_t *slot = find_slot(account);
+    G_context.keys = &slot->keys;
+    if (!slot->used || slot->account != account) {
+        flush_slot(slot);
+        memset(&slot->keys, 0, sizeof(account_keys_t));
+        uint8_t tsk[32];
+        derive_tsk(tsk, account);
+        key_cache_load(&slot->keys, account, tsk);
+        explicit_bzero(tsk, sizeof(tsk));
+        slot->account = account;
+        slot->used = true;
+        slot->dirty = false;
+    }
+    for (int i = 0; i < ACCOUNT_SLOTS; i++) {
+        account_slot_t *s = &G_context.key_slots[i];
+        if (s->age < 0xFF) s->age++;
+    }
+    slot->age = 0;
     G_context.account = account;
     G_context.keys_derived = true;
-    check_canary();
 }
 
-void derive_default_keys() {
+void require_keys(uint8_t pools) {
     if (!G_context.keys_derived)
-        derive_keys_inner(0);
-    encode_my_ua();
+        select_account(0);
+
+    account_keys_t *keys = G_context.keys;
+    pools &= ~keys->pools;
+    if (pools == 0) return;
+
+    // One BIP32 derivation for all the missing pools
+    uint8_t tsk[32];
+    derive_tsk(tsk, G_context.account);
+    if (pools & KEYS_TRANSPARENT) {
+        transparent_derive_pubkey(tsk);
+        keys->pools |= KEYS_TRANSPARENT;
+    }
+    if (pools & KEYS_SAPLING) {
+        sapling_derive_spending_key(tsk);
+        keys->pools |= KEYS_SAPLING;
+    }
+    #ifdef ORCHARD
+    if (pools & KEYS_ORCHARD) {
+        orchard_derive_spending_key(tsk);
+        keys->pools |= KEYS_ORCHARD;
+    }
+    #endif
+    explicit_bzero(tsk, sizeof(tsk));
+
+    // Writing to flash is slow, the keys derived in the middle
+    // of a transaction are saved when it ends, see reset_app
+    for (int i = 0; i < ACCOUNT_SLOTS; i++) {
+        account_slot_t *slot = &G_context.key_slots[i];
+        if (&slot->keys != keys) continue;
+        slot->dirty = true;
+        if (G_context.signing_ctx.stage == IDLE)
+            flush_slot(slot);
+    }
+    check_canary();
 }
 
 void derive_keys(uint8_t account) {
-    if (!G_context.keys_derived || G_context.account != account)
-        derive_keys_inner(account);
-    encode_my_ua();
+    select_account(account);
 }
@@ -8,9 +8,26 @@
 /// @return 
 int derive_tsk(uint8_t *tsk, uint8_t account);
 
-/// @brief derive keys using the default account (0)
-void derive_default_keys();
+#define KEYS_TRANSPARENT 0x01
+#define KEYS_SAPLING     0x02
+#define KEYS_ORCHARD     0x04
+#ifdef ORCHARD
+#define KEYS_ALL (KEYS_TRANSPARENT | KEYS_SAPLING | KEYS_ORCHARD)
+#else
+#define KEYS_ALL (KEYS_TRANSPARENT | KEYS_SAPLING)
+#endif
 
-/// @brief derive keys using the given account #
+/// @brief select the given account #
+/// The keys of each pool are derived on first use, see require_keys
 /// @param account 
 void derive_keys(uint8_t account);
+
+/// @brief derive the keys of the given pools for the current account,
+/// if they are not derived yet. Selects the default account (0)
+/// if there is no current account
+/// @param pools KEYS_* flags
+void require_keys(uint8_t pools);
+
+/// @brief Save the keys derived since the last save in the
+/// NVRAM cache. Called at the end of a transaction
+void flush_keys();
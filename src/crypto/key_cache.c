@@ -0,0 +1,154 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memset, explicit_bzero
+#include <stdbool.h>  // bool
+#include <os.h>       // nvm_write, PIC, cx_get_random_bytes
+
+#include "key_cache.h"
+#include "key.h"
+#include "gd_cache.h"
+#include "chacha.h"
+#include "../globals.h"
+
+const key_cache_storage_t N_key_cache_real;
+#define N_key_cache (*(volatile key_cache_storage_t *)PIC(&N_key_cache_real))
+
+// The hasher and the cipher share their memory in G_store. An entry
+// is encrypted then authenticated in G_store.nv_entry, and written to
+// flash in one pass
+
+/// @brief Derive the encryption key (nv_keys[0..32]) and
+/// the mac key (nv_keys[32..64]) from tsk
+static void derive_nv_keys(const uint8_t *tsk) {
+    cx_blake2b_init2_no_throw(&G_store.nv_hasher, 512, NULL, 0, (uint8_t *)"Zcash_LedgerKeys", 16);
+    cx_hash((cx_hash_t *)&G_store.nv_hasher, CX_LAST, (uint8_t *)tsk, 32, G_store.nv_keys, 64);
+}
+
+/// @brief Start the cipher with the nonce of the entry
+static void cipher_start(const uint8_t *nonce) {
+    // iv = counter (4) || nonce (12)
+    uint8_t iv[16];
+    memset(iv, 0, 4);
+    memmove(iv + 4, nonce, 12);
+    cx_chacha_init(&G_store.nv_chacha, 20);
+    cx_chacha_set_key(&G_store.nv_chacha, G_store.nv_keys, 32);
+    cx_chacha_start(&G_store.nv_chacha, iv, 16);
+}
+
+/// @brief BLAKE2b(mac key || account || nonce || data)
+static void compute_tag(const key_cache_entry_t *entry, uint8_t account, const uint8_t *nonce, uint8_t *tag) {
+    cx_blake2b_init2_no_throw(&G_store.nv_hasher, 128, NULL, 0, (uint8_t *)"Zcash_LedgerTags", 16);
+    cx_hash((cx_hash_t *)&G_store.nv_hasher, 0, G_store.nv_keys + 32, 32, NULL, 0);
+    cx_hash((cx_hash_t *)&G_store.nv_hasher, 0, &account, 1, NULL, 0);
+    cx_hash((cx_hash_t *)&G_store.nv_hasher, 0, (uint8_t *)nonce, 12, NULL, 0);
+    cx_hash((cx_hash_t *)&G_store.nv_hasher, CX_LAST, (uint8_t *)entry->data, sizeof(entry->data), tag, 16);
+}
+
+static void clear_keys() {
+    explicit_bzero(G_store.nv_keys, sizeof(G_store.nv_keys));
+    explicit_bzero(&G_store.nv_entry, sizeof(G_store.nv_entry));
+    explicit_bzero(&G_store.nv_chacha, sizeof(G_store.nv_chacha));
+}
+
+static bool is_zero(const uint8_t *p, size_t len) {
+    uint8_t acc = 0;
+    for (size_t i = 0; i < len; i++) acc |= p[i];
+    return acc == 0;
+}
+
+bool key_cache_load(account_keys_t *keys, uint8_t account, const uint8_t *tsk) {
+    derive_nv_keys(tsk);
+    for (int i = 0; i < KEY_CACHE_SLOTS; i++) {
+        const key_cache_entry_t *entry = (const key_cache_entry_t *)&N_key_cache.entries[i];
+        if (entry->valid != KEY_CACHE_MAGIC || entry->account != account)
+            continue;
+
+        uint8_t tag[16];
+        compute_tag(entry, account, entry->nonce, tag);
+        if (memcmp(tag, entry->tag, 16) != 0)
+            continue; // different seed
+
+        cipher_start(entry->nonce);
+        cx_chacha_update(&G_store.nv_chacha, entry->data, (uint8_t *)keys, sizeof(account_keys_t));
+        // G_d of the default Sapling address, then Orchard
+        const uint8_t *gd = entry->data + sizeof(account_keys_t);
+        cx_chacha_update(&G_store.nv_chacha, gd, G_store.nv_block, 32);
+        if ((keys->pools & KEYS_SAPLING) && !is_zero(G_store.nv_block, 32))
+            gd_cache_put(GD_SAPLING, keys->exp_sk_info.d, G_store.nv_block, true);
+        #ifdef ORCHARD
+        cx_chacha_update(&G_store.nv_chacha, gd + 32, G_store.nv_block, 32);
+        if ((keys->pools & KEYS_ORCHARD) && !is_zero(G_store.nv_block, 32))
+            gd_cache_put(GD_ORCHARD, keys->orchard_key_info.address, G_store.nv_block, true);
+        #endif
+        clear_keys();
+        PRINTF("Keys of account %d loaded from cache\n", account);
+        return true;
+    }
+    clear_keys();
+    return false;
+}
+
+void key_cache_store(const account_keys_t *keys, uint8_t account, const uint8_t *tsk) {
+    int slot = N_key_cache.next % KEY_CACHE_SLOTS;
+    for (int i = 0; i < KEY_CACHE_SLOTS; i++) {
+        if (N_key_cache.entries[i].valid == KEY_CACHE_MAGIC && N_key_cache.entries[i].account == account) {
+            slot = i;
+            break;
+        }
+    }
+    key_cache_entry_t *entry = &G_store.nv_entry;
+    memset(entry, 0, sizeof(key_cache_entry_t));
+    entry->account = account;
+
+    // never reuse a keystream, the same entry is rewritten
+    // when the keys of more pools are derived
+    cx_get_random_bytes(entry->nonce, 12);
+
+    derive_nv_keys(tsk);
+    cipher_start(entry->nonce);
+    cx_chacha_update(&G_store.nv_chacha, (uint8_t *)keys, entry->data, sizeof(account_keys_t));
+
+    // G_d of the default addresses, all zeros if not in the G_d cache
+    uint8_t *gd = entry->data + sizeof(account_keys_t);
+    uint8_t g_d[32];
+    memset(g_d, 0, 32);
+    if (keys->pools & KEYS_SAPLING)
+        gd_cache_get(GD_SAPLING, keys->exp_sk_info.d, g_d);
+    cx_chacha_update(&G_store.nv_chacha, g_d, gd, 32);
+    memset(g_d, 0, 32);
+    #ifdef ORCHARD
+    if (keys->pools & KEYS_ORCHARD)
+        gd_cache_get(GD_ORCHARD, keys->orchard_key_info.address, g_d);
+    #endif
+    cx_chacha_update(&G_store.nv_chacha, g_d, gd + 32, 32);
+
+    compute_tag(entry, account, entry->nonce, entry->tag);
+
+    // the entry is written invalid, then marked valid once complete
+    key_cache_entry_t *nv_entry = (key_cache_entry_t *)&N_key_cache.entries[slot];
+    nvm_write(nv_entry, entry, sizeof(key_cache_entry_t));
+    uint8_t b = KEY_CACHE_MAGIC;
+    nvm_write(&nv_entry->valid, &b, 1);
+
+    if (slot == N_key_cache.next) {
+        b = (slot + 1) % KEY_CACHE_SLOTS;
+        nvm_write((void *)&N_key_cache.next, &b, 1);
+    }
+    clear_keys();
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+
+#include "../types.h"
+
+/// Cache of the derived account keys in NVRAM
+/// Entries are encrypted with a key derived from the account
+/// transparent secret key (tsk) and a random nonce drawn at every
+/// write. They are authenticated by a tag that also acts as the
+/// seed fingerprint. An entry written with another seed fails
+/// the tag check and is ignored.
+/// The G_d of the default addresses follow the keys, so that
+/// they are pinned in the G_d cache without being recomputed
+
+#ifdef TARGET_NANOS
+#define KEY_CACHE_SLOTS 2
+#else
+#define KEY_CACHE_SLOTS 4
+#endif
+
+#define KEY_CACHE_MAGIC 0xA6
+
+// key_cache_entry_t is in types.h, the entry is built in G_store
+// before it is written to flash
+
+typedef struct {
+    uint8_t next; // slot to replace
+    key_cache_entry_t entries[KEY_CACHE_SLOTS];
+} key_cache_storage_t;
+
+/// @brief Load the keys of an account from the cache
+/// and pin the G_d of its default addresses
+/// @param keys output
+/// @param account 
+/// @param tsk transparent secret key of the account, see derive_tsk
+/// @return true if the keys were found and authenticated
+bool key_cache_load(account_keys_t *keys, uint8_t account, const uint8_t *tsk);
+
+/// @brief Save the keys of an account in the cache, with the G_d
+/// of its default addresses if they are in the G_d cache
+/// Replaces the entry of the same account if any, otherwise
+/// the oldest entry
+/// @param keys 
+/// @param account 
+/// @param tsk transparent secret key of the account, see derive_tsk
+void key_cache_store(const account_keys_t *keys, uint8_t account, const uint8_t *tsk);
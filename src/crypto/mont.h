@@ -13,24 +13,31 @@
  * 
  * Converting TO MF: x => x.h
  * Converting FROM MF: x => x/h
+ * 
+ * h = R = 2^256 [M], constants stored in flash in Montgomery form
+ * can be used directly
 */
 #include <ox_bn.h>
+#include "fr.h"
 
+/// The field of the translation unit, bound by use_field from a
+/// context of the current BN session
+static cx_bn_t M;
 static cx_bn_t zero;
 
 #ifdef MONTGOMERY_EMU
 static cx_bn_t R, RInv, mont_temp;
-static void init_mont(const uint8_t *fx_m) {
-    cx_bn_alloc(&zero, 32); cx_bn_set_u32(zero, 0);
-    cx_bn_alloc_init(&M, 32, fx_m, 32);
-    cx_bn_alloc(&mont_temp, 32);
-    cx_bn_alloc_init(&R, 32, mont_h, 32);
-    cx_bn_alloc(&RInv, 32);
-    cx_bn_mod_invert_nprime(RInv, R, M);
+static void use_field(const field_ctx_t *f) {
+    M = f->M;
+    zero = f->zero;
+    R = f->R;
+    RInv = f->RInv;
+    mont_temp = f->temp;
 }
 #define FROM_MONT(a) from_mont(a)
 #define TO_MONT(a) to_mont(a)
 #define CX_MUL(r, a, b) mont_mul(r, a, b)
+#define CX_POW(r, a, e, e_len) mont_pow(r, a, e, e_len)
 
 static void from_mont(cx_bn_t a) {
     cx_bn_mod_mul(mont_temp, a, RInv, M);
@@ -44,28 +51,31 @@ static void mont_mul(cx_bn_t r, cx_bn_t a, cx_bn_t b) {
     cx_bn_mod_mul(r, a, b, M);
     from_mont(r);
 }
+static inline void mont_pow(cx_bn_t r, cx_bn_t a, const uint8_t *e, uint32_t e_len) {
+    cx_bn_mod_mul(r, a, RInv, M);
+    cx_bn_mod_pow(mont_temp, r, e, e_len, M);
+    cx_bn_mod_mul(r, mont_temp, R, M);
+}
 #elif defined(NO_MONTGOMERY)
-static void init_mont(const uint8_t *fx_m) {
-    cx_bn_alloc(&zero, 32); cx_bn_set_u32(zero, 0);
-    cx_bn_alloc_init(&M, 32, fx_m, 32);
+static void use_field(const field_ctx_t *f) {
+    M = f->M;
+    zero = f->zero;
 }
 #define FROM_MONT(a) 
 #define TO_MONT(a) 
 #define CX_MUL(r, a, b) cx_bn_mod_mul(r, a, b, M)
+#define CX_POW(r, a, e, e_len) cx_bn_mod_pow(r, a, e, e_len, M)
 #else
-static cx_bn_t H;
 static cx_bn_mont_ctx_t MONT_CTX;
-static void init_mont(const uint8_t *fx_m) {
-    cx_bn_alloc(&zero, 32); cx_bn_set_u32(zero, 0);
-    cx_bn_alloc_init(&M, 32, fx_m, 32);
-    cx_bn_alloc_init(&H, 32, mont_h, 32);
-    cx_mont_alloc(&MONT_CTX, 32);
-    cx_mont_init2(&MONT_CTX, M, H);
+static void use_field(const field_ctx_t *f) {
+    M = f->M;
+    zero = f->zero;
+    MONT_CTX = f->mont;
 }
 #define FROM_MONT(a) cx_mont_from_montgomery(a, a, &MONT_CTX)
 #define TO_MONT(a) cx_mont_to_montgomery(a, a, &MONT_CTX)
 #define CX_MUL(r, a, b) cx_mont_mul(r, a, b, &MONT_CTX)
+#define CX_POW(r, a, e, e_len) cx_mont_pow(r, a, e, e_len, &MONT_CTX)
 #endif
 
 #define CX_BN_MOD_MUL(r, a, b) cx_bn_mod_mul(r, a, b, M)
-
@@ -25,6 +25,7 @@
 #include "fr.h"
 #include "pallas.h"
 #include "sinsemilla.h"
+#include "gd_cache.h"
 #include "prf.h"
 #include "ff1.h"
 #include "orchard.h"
@@ -39,19 +40,20 @@
 static uint8_t spending_key[32];
 static uint8_t hash[64];
 
-void orchard_derive_spending_key(int8_t account) {
+void orchard_derive_spending_key(const uint8_t *tsk) {
     ui_display_processing("o-key");
-    derive_tsk(spending_key, account);
 
-    cx_blake2b_init2_no_throw(&G_context.hasher, 256,
+    cx_blake2b_init2_no_throw(&G_store.hasher, 256,
                               NULL, 0,
                               (uint8_t *) "ZOrchardSeedHash", 16);
-    cx_hash((cx_hash_t *) &G_context.hasher,
+    cx_hash((cx_hash_t *) &G_store.hasher,
             CX_LAST,
-            spending_key, 32,
+            (uint8_t *)tsk, 32,
             spending_key, 32);
 
     PRINTF("SPENDING KEY %.*H\n", 32, spending_key);
+    // one BN session for the whole derivation
+    bn_session_begin();
     memmove(hash, spending_key, 32);
 
     // SpendingKey => SpendAuthorizingKey
@@ -59,17 +61,17 @@ void orchard_derive_spending_key(int8_t account) {
     PRINTF("PRF EXPAND 6 %.*H\n", 64, hash);
     fv_from_wide(hash); // reduce to pallas scalar
     PRINTF("TO SCALAR %.*H\n", 32, hash);
-    memmove(G_context.orchard_key_info.ask, hash, 32);
-    PRINTF("SPENDING AUTHORIZATION KEY %.*H\n", 32, G_context.orchard_key_info.ask);
+    memmove(G_context.keys->orchard_key_info.ask, hash, 32);
+    PRINTF("SPENDING AUTHORIZATION KEY %.*H\n", 32, G_context.keys->orchard_key_info.ask);
 
     jac_p_t p;
-    pallas_base_mult(&p, &SPEND_AUTH_GEN, &G_context.orchard_key_info.ask);
-    pallas_to_bytes(G_context.orchard_key_info.ak, &p);
-    if ((G_context.orchard_key_info.ak[31] & 0x80) != 0) {
-        fv_negate(&G_context.orchard_key_info.ask);
-        pallas_base_mult(&p, &SPEND_AUTH_GEN, &G_context.orchard_key_info.ask);
-        pallas_to_bytes(G_context.orchard_key_info.ak, &p);
-        PRINTF("NEW SPENDING AUTHORIZATION KEY %.*H\n", 32, G_context.orchard_key_info.ask);
+    pallas_fixed_base_mult(&p, SPEND_AUTH_GEN_TABLE, &G_context.keys->orchard_key_info.ask);
+    pallas_to_bytes(G_context.keys->orchard_key_info.ak, &p);
+    if ((G_context.keys->orchard_key_info.ak[31] & 0x80) != 0) {
+        // -ask.G = -(x, y) has the same x and the opposite sign of y
+        fv_negate(&G_context.keys->orchard_key_info.ask);
+        G_context.keys->orchard_key_info.ak[31] &= 0x7F;
+        PRINTF("NEW SPENDING AUTHORIZATION KEY %.*H\n", 32, G_context.keys->orchard_key_info.ask);
     }
 
     memmove(hash, spending_key, 32);
@@ -77,18 +79,18 @@ void orchard_derive_spending_key(int8_t account) {
     PRINTF("PRF EXPAND 7 %.*H\n", 64, hash);
     fp_from_wide(hash); // reduce to pallas base
     PRINTF("TO BASE %.*H\n", 32, hash);
-    memmove(G_context.orchard_key_info.nk, hash, 32);
-    PRINTF("NULLIFIER DERIVATION KEY %.*H\n", 32, G_context.orchard_key_info.nk);
+    memmove(G_context.keys->orchard_key_info.nk, hash, 32);
+    PRINTF("NULLIFIER DERIVATION KEY %.*H\n", 32, G_context.keys->orchard_key_info.nk);
 
     memmove(hash, spending_key, 32);
     prf_expand_seed(hash, 0x08); // hash to 512 bit value
     PRINTF("PRF EXPAND 8 %.*H\n", 64, hash);
     fv_from_wide(hash); // reduce to pallas scalar
     PRINTF("TO SCALAR %.*H\n", 32, hash);
-    memmove(G_context.orchard_key_info.rivk, hash, 32);
-    PRINTF("RIVK %.*H\n", 32, G_context.orchard_key_info.rivk);
+    memmove(G_context.keys->orchard_key_info.rivk, hash, 32);
+    PRINTF("RIVK %.*H\n", 32, G_context.keys->orchard_key_info.rivk);
 
-    memmove(hash, G_context.orchard_key_info.rivk, 32); 
+    memmove(hash, G_context.keys->orchard_key_info.rivk, 32); 
     swap_endian(hash, 32); // to_repr
     uint8_t dst = 0x82;
     cx_blake2b_t hash_ctx;
@@ -96,9 +98,9 @@ void orchard_derive_spending_key(int8_t account) {
     PRINTF("rivk %.*H\n", 32, hash);
     cx_hash((cx_hash_t *)&hash_ctx, 0, hash, 32, NULL, 0);
     cx_hash((cx_hash_t *)&hash_ctx, 0, &dst, 1, NULL, 0);
-    PRINTF("ak %.*H\n", 32, G_context.orchard_key_info.ak);
-    cx_hash((cx_hash_t *)&hash_ctx, 0, G_context.orchard_key_info.ak, 32, NULL, 0);
-    memmove(hash, G_context.orchard_key_info.nk, 32); 
+    PRINTF("ak %.*H\n", 32, G_context.keys->orchard_key_info.ak);
+    cx_hash((cx_hash_t *)&hash_ctx, 0, G_context.keys->orchard_key_info.ak, 32, NULL, 0);
+    memmove(hash, G_context.keys->orchard_key_info.nk, 32); 
     swap_endian(hash, 32); // to_repr
     PRINTF("nk %.*H\n", 32, hash);
     cx_hash((cx_hash_t *)&hash_ctx, 0, hash, 32, NULL, 0);
@@ -106,41 +108,43 @@ void orchard_derive_spending_key(int8_t account) {
     PRINTF("dk %.*H\n", 32, hash);
     PRINTF("ovk %.*H\n", 32, hash + 32);
 
-    memmove(G_context.orchard_key_info.dk, hash, 32);
+    memmove(G_context.keys->orchard_key_info.dk, hash, 32);
 
     sinsemilla_state_t sinsemilla;
-    init_commit(&sinsemilla, (uint8_t *)"z.cash:Orchard-CommitIvk-M", 26);
-    memmove(hash, G_context.orchard_key_info.nk, 32); 
+    init_commit(&sinsemilla, SINSEMILLA_COMMIT_IVK);
+    memmove(hash, G_context.keys->orchard_key_info.nk, 32); 
     swap_endian(hash, 32); // to_repr
-    hash_sinsemilla(&sinsemilla, G_context.orchard_key_info.ak, 255);
+    hash_sinsemilla(&sinsemilla, G_context.keys->orchard_key_info.ak, 255);
     hash_sinsemilla(&sinsemilla, hash, 255);
-    finalize_commit(&sinsemilla, (uint8_t *)"z.cash:Orchard-CommitIvk-r", 26, 
-        &G_context.orchard_key_info.rivk, hash);
+    finalize_commit(&sinsemilla, SINSEMILLA_COMMIT_IVK, 
+        &G_context.keys->orchard_key_info.rivk, hash);
 
     PRINTF("commit %.*H\n", 32, hash);
-    memmove(G_context.orchard_key_info.ivk, hash, 32);
+    memmove(G_context.keys->orchard_key_info.ivk, hash, 32);
 
     // ivk is fp_t but can be safely cast to fv_t
     // because the modulus of vesta is smaller than pasta
 
     uint8_t d[11];
     memset(d, 0, 11);
-    ff1_inplace(G_context.orchard_key_info.dk, d);
+    ff1_inplace(G_context.keys->orchard_key_info.dk, d);
     PRINTF("d %.*H\n", 11, d);
-    memcpy(G_context.orchard_key_info.div, d, 11);
+    memcpy(G_context.keys->orchard_key_info.address, d, 11);
 
     jac_p_t G_d;
     hash_to_curve(&G_d, (uint8_t *)"z.cash:Orchard-gd", 17,
         d, 11);
-
-    pallas_base_mult(&G_d, &G_d, (fv_t *)&G_context.orchard_key_info.ivk);
-    pallas_to_bytes(hash, &G_d);
-    PRINTF("pk_d %.*H\n", 32, hash);
-    memmove(G_context.orchard_key_info.pk_d, hash, 32);
-
-    memmove(G_context.orchard_key_info.address, G_context.orchard_key_info.div, 11);
-    memmove(G_context.orchard_key_info.address + 11, G_context.orchard_key_info.pk_d, 32);
-    PRINTF("address %.*H\n", 43, G_context.orchard_key_info.address);
+    jac_p_t pk_d;
+    pallas_base_mult(&pk_d, &G_d, (fv_t *)&G_context.keys->orchard_key_info.ivk);
+    // compress G_d and pk_d with a single inversion
+    uint8_t *const gdpkb[2] = {hash, G_context.keys->orchard_key_info.address + 11};
+    const jac_p_t *const gdpk[2] = {&G_d, &pk_d};
+    pallas_to_bytes_batch(gdpkb, gdpk, 2);
+    PRINTF("pk_d %.*H\n", 32, G_context.keys->orchard_key_info.address + 11);
+    // Keep the default address in the G_d cache for change outputs
+    gd_cache_put(GD_ORCHARD, d, hash, true);
+    PRINTF("address %.*H\n", 43, G_context.keys->orchard_key_info.address);
+    bn_session_end();
     ui_menu_main();
 }
 
@@ -158,6 +162,7 @@ int cmx(uint8_t *cmx, uint8_t *address, uint64_t value, uint8_t *rseed, uint8_t
     PRINTF("rho %.*H\n", 32, rho);
     PRINTF("amount %.*H\n", 8, &value);
 
+    bn_session_begin();
     memmove(hash, rseed, 32);
     prf_expand_seed_with_ad(hash, 4, rho, 32);
     PRINTF("PRF ESK %.*H\n", 64, hash);
@@ -179,17 +184,19 @@ int cmx(uint8_t *cmx, uint8_t *address, uint64_t value, uint8_t *rseed, uint8_t
     memmove(rcm, hash, 32);
     PRINTF("SCALAR RCM %.*H\n", 32, rcm);
 
-    jac_p_t G_d;
-    PRINTF("hash_to_curve gd %.*H\n", 11, address);
-    hash_to_curve(&G_d, (uint8_t *)"z.cash:Orchard-gd", 17,
-        address, 11);
-    
-    pallas_to_bytes(g_d, &G_d);
+    if (!gd_cache_get(GD_ORCHARD, address, g_d)) {
+        jac_p_t G_d;
+        PRINTF("hash_to_curve gd %.*H\n", 11, address);
+        hash_to_curve(&G_d, (uint8_t *)"z.cash:Orchard-gd", 17,
+            address, 11);
+        pallas_to_bytes(g_d, &G_d);
+        gd_cache_put(GD_ORCHARD, address, g_d, false);
+    }
     PRINTF("G_d %.*H\n", 32, g_d);
 
     sinsemilla_state_t sinsemilla;
 
-    init_commit(&sinsemilla, (uint8_t *)"z.cash:Orchard-NoteCommit-M", 27);
+    init_commit(&sinsemilla, SINSEMILLA_NOTE_COMMIT);
     hash_sinsemilla(&sinsemilla, g_d, 256);
     hash_sinsemilla(&sinsemilla, address + 11, 256);
     hash_sinsemilla(&sinsemilla, (uint8_t *)&value, 64);
@@ -197,7 +204,9 @@ int cmx(uint8_t *cmx, uint8_t *address, uint64_t value, uint8_t *rseed, uint8_t
     memmove(hash, psi, 32); // psi.to_repr
     swap_endian(hash, 32);
     hash_sinsemilla(&sinsemilla, hash, 255);
-    finalize_commit(&sinsemilla, (uint8_t *)"z.cash:Orchard-NoteCommit-r", 27, &rcm, hash);
+    finalize_commit(&sinsemilla, SINSEMILLA_NOTE_COMMIT, &rcm, hash);
+
+    bn_session_end();
 
     memmove(cmx, hash, 32);
     PRINTF("CMX %.*H\n", 32, cmx);
@@ -206,21 +215,23 @@ int cmx(uint8_t *cmx, uint8_t *address, uint64_t value, uint8_t *rseed, uint8_t
 }
 
 void do_sign_orchard(uint8_t *signature) {
+    bn_session_begin();
     fv_from_wide(G_context.alpha);
     PRINTF("ALPHA: %.*H\n", 32, G_context.alpha);
 
-    PRINTF("ASK: %.*H\n", 32, &G_context.orchard_key_info.ask);
+    PRINTF("ASK: %.*H\n", 32, &G_context.keys->orchard_key_info.ask);
     fv_t ask; // rerandomized ask
-    fv_add(&ask, &G_context.orchard_key_info.ask, (fv_t *)G_context.alpha);
+    fv_add(&ask, &G_context.keys->orchard_key_info.ask, (fv_t *)G_context.alpha);
     PRINTF("R ASK: %.*H\n", 32, ask);
 
     uint8_t msg[64];
     jac_p_t p;
-    pallas_base_mult(&p, &SPEND_AUTH_GEN, &ask);
+    pallas_fixed_base_mult(&p, SPEND_AUTH_GEN_TABLE, &ask);
     pallas_to_bytes(msg, &p);
-    memmove(msg + 32, G_context.signing_ctx.sapling_sig_hash, 32); // sign the same sig hash as sapling
+    memmove(msg + 32, G_context.tx->sapling_sig_hash, 32); // sign the same sig hash as sapling
     PRINTF("MSG: %.*H\n", 64, msg);
 
     pallas_sign(signature, &ask, msg);
+    bn_session_end();
 }
 #endif
@@ -3,8 +3,8 @@
 #include "../types.h"
 
 /// @brief Derive the account keys
-/// @param account 
-void orchard_derive_spending_key(int8_t account);
+/// @param tsk transparent secret key, see derive_tsk
+void orchard_derive_spending_key(const uint8_t *tsk);
 
 /// @brief Compute the note commitment
 /// @param cmx Note commitment, 32 byte hash
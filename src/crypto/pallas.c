@@ -25,47 +25,14 @@
 #include "../types.h"
 #include "fr.h"
 #include "pallas.h"
+#include "inv.h"
+#include "sqrt.h"
 #include "tx.h"
 
 #include "globals.h"
 
 #ifdef ORCHARD
 
-const uint8_t THETA[] = {
-    0x0f, 0x7b, 0xdb, 0x65, 0x81, 0x41, 0x79, 0xb4, 
-    0x46, 0x47, 0xae, 0xf7, 0x82, 0xd5, 0xcd, 0xc8, 
-    0x51, 0xf6, 0x4f, 0xc4, 0xdc, 0x88, 0x88, 0x57, 
-    0xca, 0x33, 0x0b, 0xcc, 0x09, 0xac, 0x31, 0x8e,
-};
-
-const uint8_t Z[] = {
-    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-    0x22, 0x46, 0x98, 0xfc, 0x09, 0x4c, 0xf9, 0x1b,
-    0x99, 0x2d, 0x30, 0xec, 0xff, 0xff, 0xff, 0xf4,
-};
-
-const uint8_t iso_a[] = { 0x18, 0x35, 0x4a, 0x2e, 0xb0, 0xea, 0x8c, 0x9c, 0x49, 0xbe, 0x2d, 0x72, 0x58, 0x37, 0x07, 0x42, 0xb7, 0x41, 0x34, 0x58, 0x1a, 0x27, 0xa5, 0x9f, 0x92, 0xbb, 0x4b, 0x0b, 0x65, 0x7a, 0x01, 0x4b };
-const uint8_t iso_b[] = { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf1 };
-
-const uint8_t ROOT_OF_UNITY[] = { 0x2b, 0xce, 0x74, 0xde, 0xac, 0x30, 0xeb, 0xda, 0x36, 0x21, 0x20, 0x83, 0x05, 0x61, 0xf8, 0x1a, 0xea, 0x32, 0x2b, 0xf2, 0xb7, 0xbb, 0x75, 0x84, 0xbd, 0xad, 0x6f, 0xab, 0xd8, 0x7e, 0xa3, 0x2f };
-
-const uint8_t ISOGENY_CONSTANTS[13][32] = {
-    { 0x0e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x40, 0x81, 0x77, 0x54, 0x73, 0xd8, 0x37, 0x5b, 0x77, 0x5f, 0x60, 0x34, 0xaa, 0xaa, 0xaa, 0xab },
-    { 0x35, 0x09, 0xaf, 0xd5, 0x18, 0x72, 0xd8, 0x8e, 0x26, 0x7c, 0x7f, 0xfa, 0x51, 0xcf, 0x41, 0x2a, 0x0f, 0x93, 0xb8, 0x2e, 0xe4, 0xb9, 0x94, 0x95, 0x8c, 0xf8, 0x63, 0xb0, 0x28, 0x14, 0xfb, 0x76 },
-    { 0x17, 0x32, 0x9b, 0x9e, 0xc5, 0x25, 0x37, 0x53, 0x98, 0xc7, 0xd7, 0xac, 0x3d, 0x98, 0xfd, 0x13, 0x38, 0x0a, 0xf0, 0x66, 0xcf, 0xeb, 0x6d, 0x69, 0x0e, 0xb6, 0x4f, 0xae, 0xf3, 0x7e, 0xa4, 0xf7 },
-    { 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x81, 0x02, 0xee, 0xa8, 0xe7, 0xb0, 0x6e, 0xb6, 0xee, 0xbe, 0xc0, 0x69, 0x55, 0x55, 0x55, 0x80 },
-    { 0x1d, 0x57, 0x2e, 0x7d, 0xdc, 0x09, 0x9c, 0xff, 0x5a, 0x60, 0x7f, 0xcc, 0xe0, 0x49, 0x4a, 0x79, 0x9c, 0x43, 0x4a, 0xc1, 0xc9, 0x6b, 0x69, 0x80, 0xc4, 0x7f, 0x2a, 0xb6, 0x68, 0xbc, 0xd7, 0x1f },
-    { 0x32, 0x56, 0x69, 0xbe, 0xca, 0xec, 0xd5, 0xd1, 0x1d, 0x13, 0xbf, 0x2a, 0x7f, 0x22, 0xb1, 0x05, 0xb4, 0xab, 0xf9, 0xfb, 0x9a, 0x1f, 0xc8, 0x1c, 0x2a, 0xa3, 0xaf, 0x1e, 0xae, 0x5b, 0x66, 0x04 },
-    { 0x1a, 0x12, 0xf6, 0x84, 0xbd, 0xa1, 0x2f, 0x68, 0x4b, 0xda, 0x12, 0xf6, 0x84, 0xbd, 0xa1, 0x2f, 0x76, 0x42, 0xb0, 0x1a, 0xd4, 0x61, 0xba, 0xd2, 0x5a, 0xd9, 0x85, 0xb5, 0xe3, 0x8e, 0x38, 0xe4 },
-    { 0x1a, 0x84, 0xd7, 0xea, 0x8c, 0x39, 0x6c, 0x47, 0x13, 0x3e, 0x3f, 0xfd, 0x28, 0xe7, 0xa0, 0x95, 0x07, 0xc9, 0xdc, 0x17, 0x72, 0x5c, 0xca, 0x4a, 0xc6, 0x7c, 0x31, 0xd8, 0x14, 0x0a, 0x7d, 0xbb },
-    { 0x3f, 0xb9, 0x8f, 0xf0, 0xd2, 0xdd, 0xca, 0xdd, 0x30, 0x32, 0x16, 0xcc, 0xe1, 0xdb, 0x9f, 0xf1, 0x17, 0x65, 0xe9, 0x24, 0xf7, 0x45, 0x93, 0x78, 0x02, 0xe2, 0xbe, 0x87, 0xd2, 0x25, 0xb2, 0x34 },
-    { 0x02, 0x5e, 0xd0, 0x97, 0xb4, 0x25, 0xed, 0x09, 0x7b, 0x42, 0x5e, 0xd0, 0x97, 0xb4, 0x25, 0xed, 0x0a, 0xc0, 0x3e, 0x8e, 0x13, 0x4e, 0xb3, 0xe4, 0x93, 0xe5, 0x3a, 0xb3, 0x71, 0xc7, 0x1c, 0x4f },
-    { 0x0c, 0x02, 0xc5, 0xbc, 0xca, 0x0e, 0x6b, 0x7f, 0x07, 0x90, 0xbf, 0xb3, 0x50, 0x6d, 0xef, 0xb6, 0x59, 0x41, 0xa3, 0xa4, 0xa9, 0x7a, 0xa1, 0xb3, 0x5a, 0x28, 0x27, 0x9b, 0x1d, 0x1b, 0x42, 0xae },
-    { 0x17, 0x03, 0x3d, 0x3c, 0x60, 0xc6, 0x81, 0x73, 0x57, 0x3b, 0x3d, 0x7f, 0x7d, 0x68, 0x13, 0x10, 0xd9, 0x76, 0xbb, 0xfa, 0xbb, 0xc5, 0x66, 0x1d, 0x4d, 0x90, 0xab, 0x82, 0x0b, 0x12, 0x32, 0x0a },
-    { 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x46, 0x98, 0xfc, 0x09, 0x4c, 0xf9, 0x1b, 0x99, 0x2d, 0x30, 0xec, 0xff, 0xff, 0xfd, 0xe5 },
-};
-
 const jac_p_t SPEND_AUTH_GEN = {
     .x = { 0x37, 0x55, 0x23, 0xB3, 0x28, 0xF1, 0xD6, 0x06, 0x3B, 0x8D, 0x18, 0x7C, 0x3E, 0x5F, 0x44, 0x5F, 0x0C, 0x7F, 0x0C, 0xE3, 0x7B, 0x70, 0xA1, 0x0C, 0x8D, 0x1A, 0x72, 0x84, 0xB8, 0x75, 0xC9, 0x63 },
     .y = { 0x1A, 0xD0, 0x35, 0x7F, 0xDF, 0x1A, 0x66, 0xDB, 0x7B, 0x10, 0xBC, 0xFC, 0xFE, 0xD6, 0x24, 0xFB, 0xDF, 0xC9, 0x14, 0xFE, 0xC0, 0x05, 0xBD, 0xD8, 0x4C, 0xE3, 0x3E, 0x81, 0x7B, 0x0C, 0x3B, 0xC9 },
@@ -75,12 +42,6 @@ const jac_p_t SPEND_AUTH_GEN = {
 uint8_t buffer[64];
 uint8_t b0[64];
 
-static cx_bn_t M;
-
-static const uint8_t mont_h[] = {
-    0x09, 0x6d, 0x41, 0xaf, 0x7b, 0x9c, 0xb7, 0x14, 0x77, 0x97, 0xa9, 0x9b, 0xc3, 0xc9, 0x5d, 0x18, 0xd7, 0xd3, 0x0d, 0xbd, 0x8b, 0x0d, 0xe0, 0xe7, 0x8c, 0x78, 0xec, 0xb3, 0x00, 0x00, 0x00, 0x0f    
-};
-
 #include "mont.h"
 
 #ifdef TEST
@@ -89,6 +50,7 @@ void print_mont_bn(const char *label, cx_bn_t x) {
     cx_bn_copy(tt, x);
     FROM_MONT(tt);
     print_bn(label, tt);
+    cx_bn_destroy(&tt);
 }
 
 void print_mont(jac_p_bn_t *p) {
@@ -174,11 +136,18 @@ static void hash_to_field(fp_t *h, uint8_t *dst, size_t dst_len, uint8_t *msg, s
     memmove(&h[1], buffer, 32);
 }
 
+/// @brief Simplified SWU map to the isogenous curve iso-Pallas, RFC 9380 6.6.2
+/// with the optimizations of pasta_curves: x = num_x/div is never inverted,
+/// one sqrt_ratio decides whether gx1 is a square and gives a root of gx2
+/// otherwise, and the branches are constant time selections
+/// @param p result in jacobian coordinates (num_x.div, y.div^3, div), MF
+/// @param u field element, MF
 static void map_to_curve_simple_swu(jac_p_bn_t *p, cx_bn_t u) {
     BN_DEF(temp);
     BN_DEF(temp2);
-    BN_DEF(one); cx_bn_set_u32(one, 1); TO_MONT(one);
-    BN_DEF(z); cx_bn_init(z, Z, 32); TO_MONT(z);
+    BN_DEF(mask);
+    BN_DEF(one); cx_bn_init(one, FP_ONE, 32);
+    BN_DEF(z); cx_bn_init(z, SWU_Z, 32);
 
     // print_bn("u", u);
     BN_DEF(u2);
@@ -194,21 +163,19 @@ static void map_to_curve_simple_swu(jac_p_bn_t *p, cx_bn_t u) {
     // print_bn("ta", ta);
     BN_DEF(num_x1);
     cx_bn_mod_add_fixed(num_x1, ta, one, M);
-    BN_DEF(b); cx_bn_init(b, iso_b, 32); TO_MONT(b);
+    BN_DEF(b); cx_bn_init(b, ISO_B, 32);
     CX_MUL(temp, b, num_x1);
     cx_bn_copy(num_x1, temp);
     // print_bn("num_x1", num_x1);
 
+    // div = a.(-ta), or a.z if ta = 0
     BN_DEF(div);
     int cmp;
     cx_bn_cmp_u32(ta, 0, &cmp);
-    if (cmp == 0)
-        cx_bn_copy(div, z);
-    else {
-        cx_bn_copy(div, ta);
-        cx_bn_mod_sub(div, zero, div, M);
-    }
-    BN_DEF(a); cx_bn_init(a, iso_a, 32); TO_MONT(a);
+    cx_bn_mod_sub(div, zero, ta, M);
+    bn_set_mask(mask, (uint8_t)-(uint8_t)(cmp == 0));
+    bn_cmov(div, z, mask, temp);
+    BN_DEF(a); cx_bn_init(a, ISO_A, 32);
     CX_MUL(temp, a, div);
     cx_bn_copy(div, temp);
     // print_bn("div", div);
@@ -235,48 +202,27 @@ static void map_to_curve_simple_swu(jac_p_bn_t *p, cx_bn_t u) {
     CX_MUL(num_x2, z_u2, num_x1);
     // print_bn("num_x2", num_x2);
 
-    cx_bn_copy(temp, div3);
-    FROM_MONT(temp);
-    // #region notMF 
-    // this part is not in MF (Montgomery Form)
-    cx_bn_mod_invert_nprime(temp2, temp, M);
-    CX_BN_MOD_MUL(temp, num_gx1, temp2); // num_gx1 is MF -> temp MF
-    FROM_MONT(temp);
-    bool gx1_square = true;
-
-    // print_bn("num_gx1/div3", temp);
-    cx_err_t err = cx_bn_mod_sqrt(temp2, temp, M, 0);
-    BN_DEF(root); cx_bn_init(root, ROOT_OF_UNITY, 32);
-    if (err != CX_OK) {
-        // PRINTF("Not a square\n");
-        gx1_square = false;
-        CX_BN_MOD_MUL(temp2, root, temp);
-        cx_bn_mod_sqrt(temp, temp2, M, 1);
-        cx_bn_copy(temp2, temp);
-    }
-    // #endregion
-    TO_MONT(temp2);
+    // y1 = sqrt(gx1) or sqrt(g.gx1) with g the 2^32-th root of unity (THETA
+    // is sqrt(Z/g)), gx1 = num_gx1/div3
     BN_DEF(y1);
-    cx_bn_copy(y1, temp2);
+    bool gx1_square = ff_sqrt_ratio(FIELD_FP, y1, num_gx1, div3);
     // print_mont_bn("y1", y1);
 
     BN_DEF(y2);
-    BN_DEF(theta); cx_bn_init(theta, THETA, 32); TO_MONT(theta);
+    BN_DEF(theta); cx_bn_init(theta, SWU_THETA, 32);
     CX_MUL(temp, theta, z_u2);
     CX_MUL(temp2, temp, u);
     CX_MUL(y2, temp2, y1);
     // print_mont_bn("y2", y2);
 
+    // gx2 = (z.theta.u^3)^2.(g.gx1), so y2 is a root of gx2 when gx1 is not a square
     BN_DEF(num_x);
     BN_DEF(y);
-    if (gx1_square) {
-        cx_bn_copy(num_x, num_x1);
-        cx_bn_copy(y, y1);
-    }
-    else {
-        cx_bn_copy(num_x, num_x2);
-        cx_bn_copy(y, y2);
-    }
+    cx_bn_copy(num_x, num_x2);
+    cx_bn_copy(y, y2);
+    bn_set_mask(mask, (uint8_t)-(uint8_t)gx1_square);
+    bn_cmov(num_x, num_x1, mask, temp);
+    bn_cmov(y, y1, mask, temp);
     // print_mont_bn("num_x", num_x);
     // print_mont_bn("y", y);
 
@@ -285,10 +231,10 @@ static void map_to_curve_simple_swu(jac_p_bn_t *p, cx_bn_t u) {
     cx_bn_is_odd(temp, &u_odd);
     cx_bn_copy(temp, y); FROM_MONT(temp);
     cx_bn_is_odd(temp, &y_odd);
-    if (u_odd != y_odd) {
-        cx_bn_mod_sub(temp, zero, y, M);
-        cx_bn_copy(y, temp);
-    }
+    // y = -y if sgn0(u) != sgn0(y)
+    cx_bn_mod_sub(temp2, zero, y, M);
+    bn_set_mask(mask, (uint8_t)-(uint8_t)(u_odd ^ y_odd));
+    bn_cmov(y, temp2, mask, temp);
 
     CX_MUL(temp, num_x, div);
     cx_bn_copy(p->x, temp);
@@ -298,6 +244,7 @@ static void map_to_curve_simple_swu(jac_p_bn_t *p, cx_bn_t u) {
 
     cx_bn_destroy(&temp);
     cx_bn_destroy(&temp2);
+    cx_bn_destroy(&mask);
     cx_bn_destroy(&one);
     cx_bn_destroy(&z);
     cx_bn_destroy(&u2);
@@ -313,7 +260,6 @@ static void map_to_curve_simple_swu(jac_p_bn_t *p, cx_bn_t u) {
     cx_bn_destroy(&div3);
     cx_bn_destroy(&num_gx1);
     cx_bn_destroy(&num_x2);
-    cx_bn_destroy(&root);
     cx_bn_destroy(&y1);
     cx_bn_destroy(&y2);    
     cx_bn_destroy(&theta);
@@ -336,49 +282,49 @@ static void iso_map(jac_p_bn_t *res, const jac_p_bn_t *p) {
 
     BN_DEF(iso);
     BN_DEF(num_x);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[0], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[0], 32);
     CX_MUL(temp, iso, p->x);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[1], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[1], 32);
     CX_MUL(num_x, iso, z2);
     cx_bn_mod_add_fixed(num_x, temp, num_x, M);
     CX_MUL(temp, num_x, p->x);
     cx_bn_copy(num_x, temp);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[2], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[2], 32);
     CX_MUL(temp, iso, z4);
     cx_bn_mod_add_fixed(num_x, temp, num_x, M);
     CX_MUL(temp, num_x, p->x);
     cx_bn_copy(num_x, temp);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[3], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[3], 32);
     CX_MUL(temp, iso, z6);
     cx_bn_mod_add_fixed(num_x, temp, num_x, M);
     // print_bn("num_x", num_x);
 
     BN_DEF(div_x);
     CX_MUL(temp, z2, p->x);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[4], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[4], 32);
     CX_MUL(div_x, iso, z4);
     cx_bn_mod_add_fixed(div_x, temp, div_x, M);
     CX_MUL(temp, div_x, p->x);
     cx_bn_copy(div_x, temp);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[5], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[5], 32);
     CX_MUL(temp, iso, z6);
     cx_bn_mod_add_fixed(div_x, temp, div_x, M);
     // print_bn("div_x", div_x);
 
     BN_DEF(num_y);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[6], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[6], 32);
     CX_MUL(temp, iso, p->x);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[7], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[7], 32);
     CX_MUL(num_y, iso, z2);
     cx_bn_mod_add_fixed(num_y, temp, num_y, M);
     CX_MUL(temp, num_y, p->x);
     cx_bn_copy(num_y, temp);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[8], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[8], 32);
     CX_MUL(temp, iso, z4);
     cx_bn_mod_add_fixed(num_y, temp, num_y, M);
     CX_MUL(temp, num_y, p->x);
     cx_bn_copy(num_y, temp);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[9], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[9], 32);
     CX_MUL(temp, iso, z6);
     cx_bn_mod_add_fixed(num_y, temp, num_y, M);
     CX_MUL(temp, num_y, p->y);
@@ -386,17 +332,17 @@ static void iso_map(jac_p_bn_t *res, const jac_p_bn_t *p) {
     // print_bn("num_y", num_y);
 
     BN_DEF(div_y);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[10], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[10], 32);
     CX_MUL(div_y, iso, z2);
     cx_bn_mod_add_fixed(div_y, div_y, p->x, M);
     CX_MUL(temp, div_y, p->x);
     cx_bn_copy(div_y, temp);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[11], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[11], 32);
     CX_MUL(temp, iso, z4);
     cx_bn_mod_add_fixed(div_y, div_y, temp, M);
     CX_MUL(temp, div_y, p->x);
     cx_bn_copy(div_y, temp);
-    cx_bn_init(iso, ISOGENY_CONSTANTS[12], 32); TO_MONT(iso);
+    cx_bn_init(iso, ISOGENY_CONSTANTS[12], 32);
     CX_MUL(temp, iso, z6);
     cx_bn_mod_add_fixed(div_y, div_y, temp, M);
     CX_MUL(temp, div_y, z3);
@@ -440,8 +386,8 @@ void hash_to_curve(jac_p_t *res, uint8_t *domain, size_t domain_len, uint8_t *ms
     // PRINTF("h0 %.*H\n", 32, &h[0]);
     // PRINTF("h1 %.*H\n", 32, &h[1]);
 
-    cx_bn_lock(32, 0);
-    init_mont((uint8_t *)fp_m);
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FP));
     jac_p_bn_t p[2];
     BN_DEF(hh);
     for (int i = 0; i < 2; i++) {
@@ -449,6 +395,7 @@ void hash_to_curve(jac_p_t *res, uint8_t *domain, size_t domain_len, uint8_t *ms
         cx_bn_init(hh, h[i], 32); TO_MONT(hh);
         map_to_curve_simple_swu(&p[i], hh);
     }
+    cx_bn_destroy(&hh);
 
     // print_mont(p);
     // print_mont(p + 1);
@@ -458,7 +405,8 @@ void hash_to_curve(jac_p_t *res, uint8_t *domain, size_t domain_len, uint8_t *ms
     iso_map(p, p);
     pallas_from_mont(p);
     pallas_jac_export(res, p);
-    cx_bn_unlock();
+    pallas_jac_destroy(p + 1);
+    bn_session_end();
 }
 
 int pallas_from_bytes(jac_p_t *res, uint8_t *a) {
@@ -474,19 +422,38 @@ int pallas_from_bytes(jac_p_t *res, uint8_t *a) {
         memset(res, 0, sizeof(jac_p_t));
         return CX_OK;
     }
-    cx_bn_lock(32, 0);
-    init_mont((uint8_t *)fp_m);
-    BN_DEF(x0); cx_bn_init(x0, tmp, 32);
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FP));
+    BN_DEF(x0); cx_bn_init(x0, tmp, 32); TO_MONT(x0);
     BN_DEF(x3);
-    CX_BN_MOD_MUL(x3, x0, x0);
-    CX_BN_MOD_MUL(x3, x3, x0);
-    BN_DEF(b); cx_bn_set_u32(b, 5);
+    BN_DEF(temp);
+    CX_MUL(temp, x0, x0);
+    CX_MUL(x3, temp, x0);
+    BN_DEF(b); cx_bn_init(b, PALLAS_B, 32);
     cx_bn_mod_add_fixed(x3, x3, b, M);
     BN_DEF(y);
-    cx_err_t err = cx_bn_mod_sqrt(y, x3, M, sign);
-    if (err < 0) return CX_INVALID_PARAMETER;
-    cx_bn_export(y, res->y, 32);
-    cx_bn_unlock();
+    bool square = ff_sqrt(FIELD_FP, y, x3);
+    FROM_MONT(y);
+    // pick the root whose parity is the sign bit, y = 0 has no odd root
+    bool y_odd, y_zero;
+    cx_bn_is_odd(y, &y_odd);
+    int cmp;
+    cx_bn_cmp_u32(y, 0, &cmp);
+    y_zero = cmp == 0;
+    if (y_odd != sign) {
+        cx_bn_mod_sub(temp, zero, y, M);
+        cx_bn_copy(y, temp);
+    }
+    cx_err_t err = (square && !(y_zero && sign)) ? CX_OK : CX_INVALID_PARAMETER;
+    if (err == CX_OK)
+        cx_bn_export(y, res->y, 32);
+    cx_bn_destroy(&x0);
+    cx_bn_destroy(&x3);
+    cx_bn_destroy(&temp);
+    cx_bn_destroy(&b);
+    cx_bn_destroy(&y);
+    bn_session_end();
+    if (err != CX_OK) return CX_INVALID_PARAMETER;
     memmove(res->x, x, 32);
     memset(res->z, 0, 32);
     res->z[31] = 1;
@@ -494,32 +461,51 @@ int pallas_from_bytes(jac_p_t *res, uint8_t *a) {
 }
 
 void pallas_to_bytes(uint8_t *res, const jac_p_t *p) {
-    cx_bn_lock(32, 0);
-    init_mont((uint8_t *)fp_m);
-    BN_DEF(zinv); cx_bn_init(zinv, p->z, 32);
-    int cmp;
-    cx_bn_cmp_u32(zinv, 0, &cmp);
-    if (cmp == 0) memset(res, 0, 32);
-    else {
-        cx_bn_mod_invert_nprime(zinv, zinv, M);
-        BN_DEF(zinv2);
-        CX_BN_MOD_MUL(zinv2, zinv, zinv);
-        BN_DEF(zinv3);
-        CX_BN_MOD_MUL(zinv3, zinv2, zinv);
-        BN_DEF(x);
-        BN_DEF(x0); cx_bn_init(x0, p->x, 32);
+    pallas_to_bytes_batch(&res, &p, 1);
+}
+
+void pallas_to_bytes_batch(uint8_t *const *res, const jac_p_t *const *p, uint8_t n) {
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FP));
+    cx_bn_t z[FF_BATCH_MAX];
+    cx_bn_t zinv[FF_BATCH_MAX];
+    for (uint8_t i = 0; i < n; i++) {
+        CX_THROW(cx_bn_alloc_init(&z[i], 32, p[i]->z, 32));
+        CX_THROW(cx_bn_alloc(&zinv[i], 32));
+    }
+    // the identity has z = 0, therefore x = y = 0 and bytes = 0
+    ff_batch_inv(FIELD_FP, zinv, z, n);
+    BN_DEF(zinv2);
+    BN_DEF(zinv3);
+    BN_DEF(x);
+    BN_DEF(x0);
+    BN_DEF(y);
+    BN_DEF(y0);
+    for (uint8_t i = 0; i < n; i++) {
+        CX_BN_MOD_MUL(zinv2, zinv[i], zinv[i]);
+        CX_BN_MOD_MUL(zinv3, zinv2, zinv[i]);
+        cx_bn_init(x0, p[i]->x, 32);
         CX_BN_MOD_MUL(x, x0, zinv2);
-        BN_DEF(y);
-        BN_DEF(y0); cx_bn_init(y0, p->y, 32);
+        cx_bn_init(y0, p[i]->y, 32);
         CX_BN_MOD_MUL(y, y0, zinv3);
         bool odd;
         cx_bn_is_odd(y, &odd);
         uint8_t sign = !!odd << 7;
-        cx_bn_export(x, res, 32);
-        swap_endian(res, 32);
-        res[31] |= sign;
+        cx_bn_export(x, res[i], 32);
+        swap_endian(res[i], 32);
+        res[i][31] |= sign;
+    }
+    for (uint8_t i = 0; i < n; i++) {
+        cx_bn_destroy(&z[i]);
+        cx_bn_destroy(&zinv[i]);
     }
-    cx_bn_unlock();
+    cx_bn_destroy(&zinv2);
+    cx_bn_destroy(&zinv3);
+    cx_bn_destroy(&x);
+    cx_bn_destroy(&x0);
+    cx_bn_destroy(&y);
+    cx_bn_destroy(&y0);
+    bn_session_end();
 }
 
 bool pallas_is_identity(const jac_p_bn_t *a) {
@@ -603,20 +589,18 @@ void pallas_add_jac(jac_p_bn_t *res, const jac_p_bn_t *a, const jac_p_bn_t *b) {
 
         CX_MUL(temp, s1, j);
         cx_bn_copy(s1, temp);
-        cx_bn_mod_add_fixed(s1, s1, s1, M);
 
+        // y3 = (v - x3).r - 2.s1, subtracting s1 twice
         BN_DEF(y3);
         cx_bn_mod_sub(y3, v, x3, M);
         CX_MUL(temp, y3, r);
-        cx_bn_copy(y3, temp);
+        cx_bn_mod_sub(y3, temp, s1, M);
         cx_bn_mod_sub(y3, y3, s1, M);
 
+        // z3 = ((z1 + z2)^2 - z1z1 - z2z2).h = 2.z1.z2.h
         BN_DEF(z3);
-        cx_bn_mod_add_fixed(z3, a->z, b->z, M);
-        CX_MUL(temp, z3, z3);
-        cx_bn_copy(z3, temp);
-        cx_bn_mod_sub(z3, z3, z1z1, M);
-        cx_bn_mod_sub(z3, z3, z2z2, M);
+        CX_MUL(z3, a->z, b->z);
+        cx_bn_mod_add_fixed(z3, z3, z3, M);
         CX_MUL(temp, z3, h);
         cx_bn_copy(z3, temp);
 
@@ -660,16 +644,14 @@ void pallas_double_jac(jac_p_bn_t *v) {
     CX_MUL(b, v->y, v->y);
     BN_DEF(c);
     CX_MUL(c, b, b);
+    // d = 2.((x + b)^2 - a - c) = 4.x.b, one multiplication either way
     BN_DEF(d);
-    cx_bn_mod_add_fixed(d, v->x, b, M);
-    CX_MUL(temp, d, d);
-    cx_bn_copy(d, temp);
-    cx_bn_mod_sub(d, d, a, M);
-    cx_bn_mod_sub(d, d, c, M);
+    CX_MUL(d, v->x, b);
+    cx_bn_mod_add_fixed(d, d, d, M);
     cx_bn_mod_add_fixed(d, d, d, M);
     BN_DEF(e);
-    cx_bn_mod_add_fixed(e, a, a, M);
-    cx_bn_mod_add_fixed(e, e, a, M);
+    cx_bn_mod_add_lazy(e, a, a, M);
+    cx_bn_mod_add_reduce(e, e, a, temp, M);
     BN_DEF(f);
     CX_MUL(f, e, e);
 
@@ -688,11 +670,11 @@ void pallas_double_jac(jac_p_bn_t *v) {
     cx_bn_mod_sub(x3, x3, d, M);
     cx_bn_mod_add_fixed(c, c, c, M);
     cx_bn_mod_add_fixed(c, c, c, M);
-    cx_bn_mod_add_fixed(c, c, c, M);
+    // y3 = e.(d - x3) - 8c, subtracting 4c twice
     BN_DEF(y3);
     cx_bn_mod_sub(y3, d, x3, M);
     CX_MUL(temp, e, y3);
-    cx_bn_copy(y3, temp);
+    cx_bn_mod_sub(y3, temp, c, M);
     cx_bn_mod_sub(y3, y3, c, M);
 
     cx_bn_copy(v->x, x3);
@@ -712,8 +694,8 @@ void pallas_double_jac(jac_p_bn_t *v) {
 }
 
 void pallas_base_mult(jac_p_t *res, const jac_p_t *base, fv_t *x) {
-    cx_bn_lock(32, 0);
-    init_mont((uint8_t *)fp_m);
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FP));
 
     jac_p_bn_t acc, id;
     pallas_jac_alloc(&acc);
@@ -742,8 +724,156 @@ void pallas_base_mult(jac_p_t *res, const jac_p_t *base, fv_t *x) {
     }
     pallas_from_mont(&acc);
     pallas_jac_export(res, &acc);
+    pallas_jac_destroy(&id);
+    pallas_jac_destroy(&b);
 
-    cx_bn_unlock();
+    bn_session_end();
+}
+
+void pallas_add_mixed(jac_p_bn_t *v, const jac_p_bn_t *a, const aff_p_bn_t *b) {
+    // madd-2007-bl
+    BN_DEF(temp);
+    BN_DEF(z1z1);
+    CX_MUL(z1z1, a->z, a->z);
+    BN_DEF(u2);
+    CX_MUL(u2, b->x, z1z1);
+    BN_DEF(s2);
+    CX_MUL(temp, b->y, a->z);
+    CX_MUL(s2, temp, z1z1);
+
+    BN_DEF(h);
+    cx_bn_mod_sub(h, u2, a->x, M);
+    BN_DEF(hh);
+    CX_MUL(hh, h, h);
+    BN_DEF(i);
+    cx_bn_mod_add_fixed(i, hh, hh, M);
+    cx_bn_mod_add_fixed(i, i, i, M);
+    BN_DEF(j);
+    CX_MUL(j, h, i);
+    BN_DEF(r);
+    cx_bn_mod_sub(r, s2, a->y, M);
+    cx_bn_mod_add_fixed(r, r, r, M);
+    BN_DEF(vv);
+    CX_MUL(vv, a->x, i);
+
+    BN_DEF(x3);
+    CX_MUL(x3, r, r);
+    cx_bn_mod_sub(x3, x3, j, M);
+    cx_bn_mod_sub(x3, x3, vv, M);
+    cx_bn_mod_sub(x3, x3, vv, M);
+
+    BN_DEF(y3);
+    cx_bn_mod_sub(temp, vv, x3, M);
+    CX_MUL(y3, temp, r);
+    CX_MUL(temp, a->y, j);
+    // y3 - 2.y1.j, subtracting y1.j twice
+    cx_bn_mod_sub(y3, y3, temp, M);
+    cx_bn_mod_sub(y3, y3, temp, M);
+
+    // z3 = (z1 + h)^2 - z1z1 - hh = 2.z1.h
+    BN_DEF(z3);
+    CX_MUL(z3, a->z, h);
+    cx_bn_mod_add_fixed(z3, z3, z3, M);
+
+    cx_bn_copy(v->x, x3);
+    cx_bn_copy(v->y, y3);
+    cx_bn_copy(v->z, z3);
+
+    cx_bn_destroy(&temp);
+    cx_bn_destroy(&z1z1);
+    cx_bn_destroy(&u2);
+    cx_bn_destroy(&s2);
+    cx_bn_destroy(&h);
+    cx_bn_destroy(&hh);
+    cx_bn_destroy(&i);
+    cx_bn_destroy(&j);
+    cx_bn_destroy(&r);
+    cx_bn_destroy(&vv);
+    cx_bn_destroy(&x3);
+    cx_bn_destroy(&y3);
+    cx_bn_destroy(&z3);
+}
+
+/// @brief Constant time lookup of |digit|.G in a tooth
+/// Scans every entry, returns (0, 0) for digit = 0
+static void select_aff(aff_p_t *res, const aff_p_t *tooth, int8_t digit) {
+    int8_t sign = digit >> 7;
+    uint8_t d = (uint8_t)((digit ^ sign) - sign);
+    memset(res, 0, sizeof(aff_p_t));
+    for (uint8_t j = 0; j < 8; j++) {
+        uint8_t mask = ct_eq_mask(d, j + 1);
+        const uint8_t *e = (const uint8_t *)&tooth[j];
+        uint8_t *r = (uint8_t *)res;
+        for (size_t k = 0; k < sizeof(aff_p_t); k++)
+            r[k] |= e[k] & mask;
+    }
+}
+
+void pallas_fixed_base_mult(jac_p_t *res, const aff_p_t (*table)[8], fv_t *x) {
+    int8_t digits[64];
+    recode_signed_radix16(digits, *x, 64); // x < v < 2^255
+
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FP));
+
+    jac_p_bn_t acc, sum;
+    pallas_jac_alloc(&acc);
+    pallas_jac_alloc(&sum);
+    aff_p_bn_t q;
+    CX_THROW(cx_bn_alloc(&q.x, 32));
+    CX_THROW(cx_bn_alloc(&q.y, 32));
+    BN_DEF(one); cx_bn_init(one, FP_ONE, 32);
+    BN_DEF(neg);
+    BN_DEF(mask);
+    BN_DEF(temp);
+
+    aff_p_t entry;
+    uint8_t is_id = 0xFF; // acc is the identity
+    for (int s = PALLAS_FB_SPACING - 1; s >= 0; s--) {
+        if (s != PALLAS_FB_SPACING - 1) {
+            // doubling the identity keeps z = 0
+            for (int k = 0; k < 4; k++)
+                pallas_double_jac(&acc);
+        }
+        for (int t = 0; t < PALLAS_FB_TEETH; t++) {
+            int8_t d = digits[t * PALLAS_FB_SPACING + s];
+            uint8_t is_neg = (uint8_t)(d >> 7);
+            uint8_t is_zero = ct_eq_mask((uint8_t)d, 0);
+
+            select_aff(&entry, table[t], d);
+            cx_bn_init(q.x, entry.x, 32);
+            cx_bn_init(q.y, entry.y, 32);
+            cx_bn_mod_sub(neg, zero, q.y, M);
+            bn_set_mask(mask, is_neg);
+            bn_cmov(q.y, neg, mask, temp);
+
+            // always add, then keep acc, sum or q depending on the flags
+            pallas_add_mixed(&sum, &acc, &q);
+            bn_set_mask(mask, ~is_zero & ~is_id);
+            bn_cmov(acc.x, sum.x, mask, temp);
+            bn_cmov(acc.y, sum.y, mask, temp);
+            bn_cmov(acc.z, sum.z, mask, temp);
+            bn_set_mask(mask, ~is_zero & is_id);
+            bn_cmov(acc.x, q.x, mask, temp);
+            bn_cmov(acc.y, q.y, mask, temp);
+            bn_cmov(acc.z, one, mask, temp);
+            is_id &= is_zero;
+        }
+    }
+    explicit_bzero(digits, sizeof(digits));
+    explicit_bzero(&entry, sizeof(entry));
+
+    pallas_from_mont(&acc);
+    pallas_jac_export(res, &acc);
+    pallas_jac_destroy(&sum);
+    cx_bn_destroy(&q.x);
+    cx_bn_destroy(&q.y);
+    cx_bn_destroy(&one);
+    cx_bn_destroy(&neg);
+    cx_bn_destroy(&mask);
+    cx_bn_destroy(&temp);
+
+    bn_session_end();
 }
 
 void pallas_jac_alloc(jac_p_bn_t *dest) {
@@ -758,6 +888,12 @@ void pallas_jac_init(jac_p_bn_t *dest, const jac_p_t *src) {
     cx_bn_alloc_init(&dest->z, 32, src->z, 32);
 }
 
+void pallas_jac_destroy(jac_p_bn_t *p) {
+    cx_bn_destroy(&p->x);
+    cx_bn_destroy(&p->y);
+    cx_bn_destroy(&p->z);
+}
+
 void pallas_jac_export(jac_p_t *dest, jac_p_bn_t *src) {
     cx_bn_export(src->x, dest->x, 32);
     cx_bn_export(src->y, dest->y, 32);
@@ -767,15 +903,42 @@ void pallas_jac_export(jac_p_t *dest, jac_p_bn_t *src) {
     cx_bn_destroy(&src->z);
 }
 
+void pallas_jac_load(jac_p_bn_t *dest, const jac_p_t *src) {
+    use_field(field_ctx(FIELD_FP));
+    pallas_jac_init(dest, src);
+    pallas_to_mont(dest);
+}
+
+void pallas_jac_store(jac_p_t *dest, jac_p_bn_t *src) {
+    use_field(field_ctx(FIELD_FP));
+    pallas_from_mont(src);
+    pallas_jac_export(dest, src);
+}
+
+void pallas_sinsemilla_step(jac_p_bn_t *acc, const aff_p_t *s) {
+    use_field(field_ctx(FIELD_FP));
+    aff_p_bn_t q;
+    CX_THROW(cx_bn_alloc_init(&q.x, 32, s->x, 32));
+    CX_THROW(cx_bn_alloc_init(&q.y, 32, s->y, 32));
+    jac_p_bn_t t;
+    pallas_jac_alloc(&t);
+    pallas_add_mixed(&t, acc, &q); // acc + S
+    pallas_add_jac(acc, &t, acc);  // (acc + S) + acc
+    pallas_jac_destroy(&t);
+    cx_bn_destroy(&q.x);
+    cx_bn_destroy(&q.y);
+}
+
 void pallas_add_assign(jac_p_t *v, const jac_p_t *a) {
-    cx_bn_lock(32, 0);
-    init_mont((uint8_t *)fp_m);
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FP));
     jac_p_bn_t v0, a0;
     pallas_jac_init(&v0, v); pallas_to_mont(&v0);
     pallas_jac_init(&a0, a); pallas_to_mont(&a0);
     pallas_add_jac(&v0, &v0, &a0);
     pallas_from_mont(&v0); pallas_jac_export(v, &v0);
-    cx_bn_unlock();
+    pallas_jac_destroy(&a0);
+    bn_session_end();
 }
 
 static int h_star(uint8_t *hash, uint8_t *data, size_t len) {
@@ -803,7 +966,7 @@ int pallas_sign(uint8_t *signature, fv_t *sk, uint8_t *message) {
     fv_t r;
     memmove(&r, r_buffer, 32);
     jac_p_t p;
-    pallas_base_mult(&p, &SPEND_AUTH_GEN, &r);
+    pallas_fixed_base_mult(&p, SPEND_AUTH_GEN_TABLE, &r);
     pallas_to_bytes(m_buffer, &p); // R = r.G
     PRINTF("R %.*H\n", 32, m_buffer);
 
@@ -821,4 +984,45 @@ int pallas_sign(uint8_t *signature, fv_t *sk, uint8_t *message) {
 
     return 0;
 }
+
+#ifdef TEST
+bool test_pallas_fixed_base() {
+    fv_t x[3];
+    memset(x[0], 0, 32); x[0][31] = 1; // 1
+    memmove(x[1], fv_m, 32); x[1][31] = 0; // v - 1
+    cx_get_random_bytes(x[2], 32); x[2][0] &= 0x3F; // < v
+
+    for (int i = 0; i < 3; i++) {
+        jac_p_t p, p_ref;
+        uint8_t pb[32], pb_ref[32];
+        pallas_fixed_base_mult(&p, SPEND_AUTH_GEN_TABLE, &x[i]);
+        pallas_base_mult(&p_ref, &SPEND_AUTH_GEN, &x[i]);
+        pallas_to_bytes(pb, &p);
+        pallas_to_bytes(pb_ref, &p_ref);
+        if (memcmp(pb, pb_ref, 32) != 0)
+            return false;
+    }
+    return true;
+}
+
+bool test_pallas_order() {
+    fv_t x;
+    memmove(x, fv_m, 32); x[31] = 0; // v - 1
+    jac_p_t p;
+    pallas_base_mult(&p, &SPEND_AUTH_GEN, &x);
+    pallas_add_assign(&p, &SPEND_AUTH_GEN);
+    fp_t z0 = {0};
+    return memcmp(p.z, z0, 32) == 0; // z = 0
+}
+
+bool test_hash_to_curve() {
+    // SpendAuthG is defined as GroupHash("z.cash:Orchard", "G")
+    jac_p_t p;
+    uint8_t pb[32], gb[32];
+    hash_to_curve(&p, (uint8_t *)"z.cash:Orchard", 14, (uint8_t *)"G", 1);
+    pallas_to_bytes(pb, &p);
+    pallas_to_bytes(gb, &SPEND_AUTH_GEN);
+    return memcmp(pb, gb, 32) == 0;
+}
+#endif
 #endif
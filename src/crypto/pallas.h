@@ -5,15 +5,46 @@ typedef struct {
     fp_t x, y, z;
 } jac_p_t;
 
+/// @brief Point in affine coordinates
+typedef struct {
+    fp_t x, y;
+} aff_p_t;
+
 /// @brief Point in jacobian coordinates stored in 
 /// the big number unit
 typedef struct {
     cx_bn_t x, y, z;
 } jac_p_bn_t;
 
+/// @brief Point in affine coordinates stored in
+/// the big number unit
+typedef struct {
+    cx_bn_t x, y;
+} aff_p_bn_t;
+
 /// @brief Spend authentication generator
 extern const jac_p_t SPEND_AUTH_GEN;
 
+/// Fixed base tables are combs of signed radix-16 digits
+/// Tooth t holds (j+1).16^(t*PALLAS_FB_SPACING).G for j in [0, 8)
+/// Every tooth is 512 bytes of flash, every extra unit of spacing
+/// costs 4 doublings
+#define PALLAS_FB_SPACING 2
+#define PALLAS_FB_TEETH (64 / PALLAS_FB_SPACING)
+
+/// @brief Precomputed multiples of SPEND_AUTH_GEN, see pallas_tables.c
+extern const aff_p_t SPEND_AUTH_GEN_TABLE[PALLAS_FB_TEETH][8];
+
+/// @brief 1, the curve parameter b and the constants of hash_to_curve,
+/// in Montgomery form, see pallas_tables.c
+extern const uint8_t FP_ONE[32];
+extern const uint8_t PALLAS_B[32];
+extern const uint8_t SWU_Z[32];
+extern const uint8_t SWU_THETA[32];
+extern const uint8_t ISO_A[32];
+extern const uint8_t ISO_B[32];
+extern const uint8_t ISOGENY_CONSTANTS[13][32];
+
 /// @brief Hash a message to a point on Pallas
 /// @param res Result: Point in Jacobian coordinates
 /// @param domain Domain separator, i.e. personalisation
@@ -33,6 +64,12 @@ int pallas_from_bytes(jac_p_t *res, uint8_t *a);
 /// @param p 
 void pallas_to_bytes(uint8_t *res, const jac_p_t *p);
 
+/// @brief Convert several points to 32-byte values with a single inversion
+/// @param res n buffers of 32 bytes
+/// @param p n points
+/// @param n count, at most FF_BATCH_MAX
+void pallas_to_bytes_batch(uint8_t *const *res, const jac_p_t *const *p, uint8_t n);
+
 /// @brief Copy one point to another
 /// @param res destination, must be allocated first
 /// @param a source
@@ -52,6 +89,10 @@ void pallas_jac_alloc(jac_p_bn_t *dest);
 /// @param src 
 void pallas_jac_init(jac_p_bn_t *dest, const jac_p_t *src);
 
+/// @brief Free the BN of a point
+/// @param p 
+void pallas_jac_destroy(jac_p_bn_t *p);
+
 /// @brief Copy from a point in BN to its integer values
 /// @param dest 
 /// @param src BN values are deallocated
@@ -67,17 +108,49 @@ void pallas_add_jac(jac_p_bn_t *v, const jac_p_bn_t *a, const jac_p_bn_t *b);
 /// @param v 
 void pallas_double_jac(jac_p_bn_t *v);
 
-/// @brief Multiplies a point (usually a generator point) by a scalar
+/// @brief Mixed addition: v = a + b where b has z = 1
+/// a must not be the identity nor +/- b
+/// @param v may be the same as a
+/// @param a 
+/// @param b 
+void pallas_add_mixed(jac_p_bn_t *v, const jac_p_bn_t *a, const aff_p_bn_t *b);
+
+/// @brief Multiplies a point by a scalar
 /// @param res 
-/// @param base generator point
+/// @param base variable point
 /// @param x scalar
 void pallas_base_mult(jac_p_t *res, const jac_p_t *base, fv_t *x);
 
+/// @brief Multiplies a fixed point by a scalar using its precomputed table
+/// Constant time: every tooth does a full table scan and an addition
+/// @param res 
+/// @param table precomputed table in Montgomery form, i.e. SPEND_AUTH_GEN_TABLE
+/// @param x scalar
+void pallas_fixed_base_mult(jac_p_t *res, const aff_p_t (*table)[8], fv_t *x);
+
 /// @brief Copy a point into another
 /// @param res 
 /// @param a 
 void pallas_copy_jac(jac_p_t *res, const jac_p_t *a);
 
+/// @brief Load a point into the BN unit in Montgomery form
+/// Must be called within a BN session, see bn_session_begin
+/// @param dest Destination must NOT be allocated before
+/// @param src 
+void pallas_jac_load(jac_p_bn_t *dest, const jac_p_t *src);
+
+/// @brief Inverse of pallas_jac_load
+/// @param dest 
+/// @param src BN values are deallocated
+void pallas_jac_store(jac_p_t *dest, jac_p_bn_t *src);
+
+/// @brief Sinsemilla round: acc = (acc + S) + acc, with a mixed addition
+/// for S. Incomplete addition as in the specification.
+/// Must be called within a BN session
+/// @param acc loaded with pallas_jac_load
+/// @param s affine point in Montgomery form, i.e. an entry of SINSEMILLA_S
+void pallas_sinsemilla_step(jac_p_bn_t *acc, const aff_p_t *s);
+
 /// @brief v += a
 /// @param v 
 /// @param a 
@@ -89,3 +162,20 @@ void pallas_add_assign(jac_p_t *v, const jac_p_t *a);
 /// @param message Message Hash: 32 bytes
 /// @return 
 int pallas_sign(uint8_t *signature, fv_t *sk, uint8_t *message);
+
+#ifdef TEST
+/// @brief Check pallas_fixed_base_mult against pallas_base_mult
+/// for 1, v - 1 and a random scalar
+/// @return true if the points are the same
+bool test_pallas_fixed_base();
+
+/// @brief Check that (v - 1).G + G is the identity, where the doublings
+/// and additions of pallas_base_mult use lazy reductions
+/// @return true if it is
+bool test_pallas_order();
+
+/// @brief Check hash_to_curve against the value of SpendAuthG
+/// given by the specification
+/// @return true if it is the same
+bool test_hash_to_curve();
+#endif
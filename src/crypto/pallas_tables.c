@@ -0,0 +1,1278 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+// GENERATED by tools/gen_tables.py - DO NOT EDIT
+
+#include <stdint.h>
+
+#include "fr.h"
+#include "pallas.h"
+
+#ifdef ORCHARD
+
+/// @brief Field constants of Pallas, of the simplified SWU map to iso-Pallas
+/// and of the 3-isogeny back to Pallas, big endian
+/// SPEND_AUTH_GEN_TABLE[t][j] = (j+1).16^(t*PALLAS_FB_SPACING).SPEND_AUTH_GEN
+/// in affine coordinates (x, y), big endian
+/// Values are in Montgomery form (x.2^256 mod p), except on the Nano S
+/// that does not use Montgomery multiplication
+
+#ifdef NO_MONTGOMERY
+
+const uint8_t FP_ONE[32] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+
+const uint8_t PALLAS_B[32] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05
+};
+
+const uint8_t SWU_Z[32] = {
+    0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x46, 0x98, 0xfc, 0x09, 0x4c, 0xf9, 0x1b, 0x99, 0x2d, 0x30, 0xec, 0xff, 0xff, 0xff, 0xf4
+};
+
+const uint8_t SWU_THETA[32] = {
+    0x0f, 0x7b, 0xdb, 0x65, 0x81, 0x41, 0x79, 0xb4, 0x46, 0x47, 0xae, 0xf7, 0x82, 0xd5, 0xcd, 0xc8, 0x51, 0xf6, 0x4f, 0xc4, 0xdc, 0x88, 0x88, 0x57, 0xca, 0x33, 0x0b, 0xcc, 0x09, 0xac, 0x31, 0x8e
+};
+
+const uint8_t ISO_A[32] = {
+    0x18, 0x35, 0x4a, 0x2e, 0xb0, 0xea, 0x8c, 0x9c, 0x49, 0xbe, 0x2d, 0x72, 0x58, 0x37, 0x07, 0x42, 0xb7, 0x41, 0x34, 0x58, 0x1a, 0x27, 0xa5, 0x9f, 0x92, 0xbb, 0x4b, 0x0b, 0x65, 0x7a, 0x01, 0x4b
+};
+
+const uint8_t ISO_B[32] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xf1
+};
+
+const uint8_t ISOGENY_CONSTANTS[13][32] = {
+    { 0x0e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x38, 0xe3, 0x8e, 0x40, 0x81, 0x77, 0x54, 0x73, 0xd8, 0x37, 0x5b, 0x77, 0x5f, 0x60, 0x34, 0xaa, 0xaa, 0xaa, 0xab },
+    { 0x35, 0x09, 0xaf, 0xd5, 0x18, 0x72, 0xd8, 0x8e, 0x26, 0x7c, 0x7f, 0xfa, 0x51, 0xcf, 0x41, 0x2a, 0x0f, 0x93, 0xb8, 0x2e, 0xe4, 0xb9, 0x94, 0x95, 0x8c, 0xf8, 0x63, 0xb0, 0x28, 0x14, 0xfb, 0x76 },
+    { 0x17, 0x32, 0x9b, 0x9e, 0xc5, 0x25, 0x37, 0x53, 0x98, 0xc7, 0xd7, 0xac, 0x3d, 0x98, 0xfd, 0x13, 0x38, 0x0a, 0xf0, 0x66, 0xcf, 0xeb, 0x6d, 0x69, 0x0e, 0xb6, 0x4f, 0xae, 0xf3, 0x7e, 0xa4, 0xf7 },
+    { 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x71, 0xc7, 0x1c, 0x81, 0x02, 0xee, 0xa8, 0xe7, 0xb0, 0x6e, 0xb6, 0xee, 0xbe, 0xc0, 0x69, 0x55, 0x55, 0x55, 0x80 },
+    { 0x1d, 0x57, 0x2e, 0x7d, 0xdc, 0x09, 0x9c, 0xff, 0x5a, 0x60, 0x7f, 0xcc, 0xe0, 0x49, 0x4a, 0x79, 0x9c, 0x43, 0x4a, 0xc1, 0xc9, 0x6b, 0x69, 0x80, 0xc4, 0x7f, 0x2a, 0xb6, 0x68, 0xbc, 0xd7, 0x1f },
+    { 0x32, 0x56, 0x69, 0xbe, 0xca, 0xec, 0xd5, 0xd1, 0x1d, 0x13, 0xbf, 0x2a, 0x7f, 0x22, 0xb1, 0x05, 0xb4, 0xab, 0xf9, 0xfb, 0x9a, 0x1f, 0xc8, 0x1c, 0x2a, 0xa3, 0xaf, 0x1e, 0xae, 0x5b, 0x66, 0x04 },
+    { 0x1a, 0x12, 0xf6, 0x84, 0xbd, 0xa1, 0x2f, 0x68, 0x4b, 0xda, 0x12, 0xf6, 0x84, 0xbd, 0xa1, 0x2f, 0x76, 0x42, 0xb0, 0x1a, 0xd4, 0x61, 0xba, 0xd2, 0x5a, 0xd9, 0x85, 0xb5, 0xe3, 0x8e, 0x38, 0xe4 },
+    { 0x1a, 0x84, 0xd7, 0xea, 0x8c, 0x39, 0x6c, 0x47, 0x13, 0x3e, 0x3f, 0xfd, 0x28, 0xe7, 0xa0, 0x95, 0x07, 0xc9, 0xdc, 0x17, 0x72, 0x5c, 0xca, 0x4a, 0xc6, 0x7c, 0x31, 0xd8, 0x14, 0x0a, 0x7d, 0xbb },
+    { 0x3f, 0xb9, 0x8f, 0xf0, 0xd2, 0xdd, 0xca, 0xdd, 0x30, 0x32, 0x16, 0xcc, 0xe1, 0xdb, 0x9f, 0xf1, 0x17, 0x65, 0xe9, 0x24, 0xf7, 0x45, 0x93, 0x78, 0x02, 0xe2, 0xbe, 0x87, 0xd2, 0x25, 0xb2, 0x34 },
+    { 0x02, 0x5e, 0xd0, 0x97, 0xb4, 0x25, 0xed, 0x09, 0x7b, 0x42, 0x5e, 0xd0, 0x97, 0xb4, 0x25, 0xed, 0x0a, 0xc0, 0x3e, 0x8e, 0x13, 0x4e, 0xb3, 0xe4, 0x93, 0xe5, 0x3a, 0xb3, 0x71, 0xc7, 0x1c, 0x4f },
+    { 0x0c, 0x02, 0xc5, 0xbc, 0xca, 0x0e, 0x6b, 0x7f, 0x07, 0x90, 0xbf, 0xb3, 0x50, 0x6d, 0xef, 0xb6, 0x59, 0x41, 0xa3, 0xa4, 0xa9, 0x7a, 0xa1, 0xb3, 0x5a, 0x28, 0x27, 0x9b, 0x1d, 0x1b, 0x42, 0xae },
+    { 0x17, 0x03, 0x3d, 0x3c, 0x60, 0xc6, 0x81, 0x73, 0x57, 0x3b, 0x3d, 0x7f, 0x7d, 0x68, 0x13, 0x10, 0xd9, 0x76, 0xbb, 0xfa, 0xbb, 0xc5, 0x66, 0x1d, 0x4d, 0x90, 0xab, 0x82, 0x0b, 0x12, 0x32, 0x0a },
+    { 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x46, 0x98, 0xfc, 0x09, 0x4c, 0xf9, 0x1b, 0x99, 0x2d, 0x30, 0xec, 0xff, 0xff, 0xfd, 0xe5 }
+};
+
+const aff_p_t SPEND_AUTH_GEN_TABLE[PALLAS_FB_TEETH][8] = {
+    {
+        { { 0x37, 0x55, 0x23, 0xb3, 0x28, 0xf1, 0xd6, 0x06, 0x3b, 0x8d, 0x18, 0x7c, 0x3e, 0x5f, 0x44, 0x5f, 0x0c, 0x7f, 0x0c, 0xe3, 0x7b, 0x70, 0xa1, 0x0c, 0x8d, 0x1a, 0x72, 0x84, 0xb8, 0x75, 0xc9, 0x63 },
+          { 0x1a, 0xd0, 0x35, 0x7f, 0xdf, 0x1a, 0x66, 0xdb, 0x7b, 0x10, 0xbc, 0xfc, 0xfe, 0xd6, 0x24, 0xfb, 0xdf, 0xc9, 0x14, 0xfe, 0xc0, 0x05, 0xbd, 0xd8, 0x4c, 0xe3, 0x3e, 0x81, 0x7b, 0x0c, 0x3b, 0xc9 } },
+        { { 0x08, 0xea, 0x00, 0x58, 0xba, 0xc9, 0x57, 0x6a, 0x7f, 0xf7, 0x47, 0xca, 0x15, 0xc8, 0x6a, 0x57, 0x41, 0x9c, 0x3b, 0xd7, 0x5e, 0xdd, 0x96, 0x6d, 0x7d, 0x61, 0xb5, 0x7f, 0xe4, 0x49, 0xab, 0x05 },
+          { 0x28, 0x7d, 0x6a, 0xb1, 0x42, 0xb8, 0xdb, 0x91, 0xf4, 0x7e, 0xe8, 0x58, 0xfc, 0xd3, 0x0f, 0x90, 0x13, 0xcf, 0x25, 0xbe, 0xca, 0x0d, 0x88, 0x1f, 0x96, 0x05, 0x56, 0xf3, 0xef, 0xbc, 0x9e, 0x99 } },
+        { { 0x3f, 0xc9, 0x24, 0xee, 0xef, 0x4c, 0xc2, 0x49, 0xc7, 0xa6, 0x4f, 0xdf, 0xdf, 0x3e, 0x52, 0xbb, 0x3e, 0x0b, 0xe6, 0x90, 0xd2, 0x6c, 0xf0, 0x76, 0xc2, 0x07, 0xda, 0xab, 0x27, 0xed, 0x30, 0xf2 },
+          { 0x1d, 0xf9, 0x67, 0x85, 0x62, 0x15, 0x58, 0xff, 0xba, 0x96, 0x8d, 0xdb, 0x77, 0x8d, 0xb2, 0xc3, 0x64, 0x33, 0x18, 0x4d, 0x7f, 0x2a, 0xae, 0x48, 0x24, 0x35, 0xb5, 0x8e, 0xa6, 0xd9, 0x81, 0xf7 } },
+        { { 0x24, 0x1d, 0x81, 0x2d, 0x95, 0x5a, 0x1d, 0x0b, 0x7c, 0xf2, 0x75, 0xfd, 0x14, 0x23, 0xaf, 0xa8, 0x11, 0xc9, 0x07, 0x03, 0x76, 0xb7, 0xb7, 0x4e, 0x40, 0xd6, 0xfb, 0x0d, 0x3a, 0x9f, 0xa1, 0x19 },
+          { 0x09, 0xa8, 0xe9, 0x80, 0xa1, 0xe2, 0x9d, 0xb1, 0x9e, 0xa3, 0x0d, 0x78, 0x43, 0xb1, 0xfa, 0x0b, 0x4f, 0xae, 0x5d, 0xdb, 0xf8, 0xe4, 0x4d, 0xa1, 0x88, 0x5e, 0x24, 0xc9, 0x8c, 0x74, 0x42, 0x5e } },
+        { { 0x14, 0x04, 0x44, 0x50, 0x9f, 0xc6, 0x3a, 0xf6, 0x9f, 0xd8, 0xfd, 0xe2, 0x50, 0xd5, 0xe7, 0x40, 0x32, 0x9e, 0xce, 0x11, 0x52, 0x42, 0x83, 0xbd, 0x7e, 0x4b, 0xf0, 0x32, 0xe0, 0x92, 0xde, 0xf3 },
+          { 0x08, 0x2a, 0xc1, 0xdd, 0xfe, 0x15, 0x26, 0x10, 0x85, 0x32, 0x9b, 0xb0, 0x5e, 0x73, 0xbe, 0xed, 0x7b, 0x19, 0xe4, 0x2e, 0x8c, 0x07, 0x6d, 0xfb, 0xac, 0xbf, 0xe8, 0xe3, 0xc6, 0x61, 0x8e, 0xcc } },
+        { { 0x3c, 0x4d, 0x8e, 0x8e, 0x1e, 0x1c, 0x42, 0x43, 0x49, 0x75, 0xb2, 0x45, 0xe3, 0xec, 0xbf, 0xcc, 0x5c, 0x93, 0xaf, 0xd9, 0x3b, 0x8e, 0x61, 0xe8, 0x8f, 0x41, 0xaf, 0x5a, 0xa4, 0x74, 0xe7, 0x6b },
+          { 0x20, 0x22, 0x06, 0x5d, 0x92, 0x1a, 0x25, 0x03, 0x4f, 0x04, 0xe1, 0xac, 0x71, 0x3e, 0x18, 0xad, 0xbc, 0xdc, 0x4a, 0xc4, 0x68, 0x15, 0x00, 0x1e, 0x90, 0x1c, 0x3e, 0xe5, 0x8f, 0xb6, 0x22, 0x6c } },
+        { { 0x3b, 0xfb, 0x51, 0x9b, 0xb8, 0xe2, 0x0f, 0x8e, 0x5f, 0xf3, 0x05, 0x00, 0x9f, 0xac, 0xa5, 0xef, 0x63, 0x28, 0x6b, 0xd0, 0xa1, 0x60, 0x04, 0x80, 0x7f, 0x6a, 0x33, 0x00, 0x54, 0x36, 0x00, 0x5a },
+          { 0x25, 0xb4, 0xf9, 0x73, 0x63, 0xd3, 0xd8, 0x03, 0x17, 0x90, 0xa0, 0x65, 0xcd, 0x1a, 0x5c, 0x71, 0xa9, 0xa1, 0x7f, 0x87, 0xed, 0x4f, 0xba, 0x39, 0xd8, 0xd8, 0xa5, 0x06, 0x22, 0xa7, 0x97, 0x6f } },
+        { { 0x21, 0x92, 0xcb, 0xa3, 0x1f, 0x44, 0xad, 0x2a, 0xa6, 0x49, 0xa8, 0xe8, 0xf1, 0x0b, 0xfd, 0x62, 0x9a, 0x83, 0x88, 0xc9, 0x16, 0x59, 0x4d, 0xc0, 0xf0, 0x67, 0xca, 0xd2, 0x7f, 0x60, 0x66, 0xcc },
+          { 0x32, 0xaf, 0xf5, 0xd5, 0x9b, 0x9a, 0x8c, 0x84, 0x26, 0xc4, 0xed, 0x33, 0x3f, 0x30, 0x95, 0x3a, 0xe8, 0x0e, 0xbe, 0xc4, 0xb1, 0xa4, 0x37, 0xd2, 0x4e, 0x19, 0x3d, 0x06, 0xc7, 0x0c, 0xa2, 0xcc } }
+    },
+    {
+        { { 0x26, 0x99, 0x1d, 0x3c, 0xc1, 0x17, 0x3f, 0x27, 0x3e, 0x98, 0xe0, 0xd7, 0x5a, 0xda, 0xf9, 0xd1, 0xb8, 0xc5, 0x9d, 0x06, 0x4e, 0x8a, 0x1d, 0xa1, 0x83, 0x44, 0x5b, 0x2b, 0xf1, 0x3b, 0x6b, 0xa4 },
+          { 0x25, 0x0e, 0x2f, 0x11, 0x19, 0xb8, 0x01, 0x99, 0x0e, 0xef, 0xed, 0xe8, 0x4a, 0x89, 0x3a, 0x97, 0x22, 0x42, 0xc7, 0xe3, 0x61, 0x70, 0x2b, 0xbb, 0x69, 0xa8, 0xa7, 0x69, 0x8c, 0xe3, 0x52, 0xf8 } },
+        { { 0x36, 0x64, 0xf1, 0xdf, 0xd7, 0xa5, 0xc0, 0x91, 0x5a, 0x06, 0x58, 0xe7, 0xe5, 0x33, 0xb7, 0xda, 0xf7, 0xa8, 0xe3, 0xb1, 0x62, 0xed, 0x29, 0x0e, 0x3a, 0xb1, 0x73, 0xac, 0x4b, 0x65, 0xe2, 0x1d },
+          { 0x24, 0x4a, 0x61, 0x18, 0x3e, 0xa2, 0xe1, 0xc5, 0xcb, 0xcf, 0x18, 0x77, 0x72, 0x8e, 0x2c, 0x7e, 0x0c, 0x53, 0x58, 0xd1, 0x6c, 0xc7, 0x3e, 0x17, 0xa0, 0xfe, 0x07, 0xbd, 0x13, 0xd7, 0xa2, 0xc2 } },
+        { { 0x0c, 0x92, 0xd5, 0x02, 0xf6, 0xb6, 0x7b, 0xe5, 0x07, 0xd1, 0x0c, 0xdb, 0x88, 0x87, 0x0b, 0xc6, 0x33, 0x6d, 0x16, 0x33, 0x9e, 0xc0, 0xbe, 0x4e, 0x26, 0x78, 0x69, 0x1a, 0xc4, 0xec, 0x41, 0xcd },
+          { 0x22, 0x9f, 0xde, 0x3c, 0xff, 0x69, 0xde, 0x5c, 0x2c, 0x20, 0x7a, 0x93, 0x5f, 0x48, 0x87, 0xe6, 0x60, 0x50, 0x49, 0xe9, 0xc9, 0x79, 0x69, 0xdc, 0xd1, 0x0d, 0x75, 0x62, 0x4f, 0x04, 0x6e, 0xaa } },
+        { { 0x3c, 0x2b, 0x2b, 0xae, 0xc7, 0x2a, 0xf2, 0x61, 0x2f, 0x86, 0x7d, 0x38, 0x03, 0x6c, 0x0f, 0xe6, 0xe8, 0xe0, 0xb3, 0x0e, 0x90, 0x3c, 0xa3, 0x14, 0xdf, 0x64, 0x9b, 0x64, 0x1f, 0xa9, 0x7e, 0x89 },
+          { 0x1a, 0x2e, 0xac, 0x73, 0x46, 0x2f, 0x37, 0x45, 0x2e, 0x22, 0xe7, 0xb4, 0x34, 0xec, 0x12, 0x2d, 0x29, 0x7d, 0xce, 0x03, 0x5f, 0xee, 0x06, 0x82, 0xa4, 0xf5, 0xe1, 0x4a, 0x25, 0xa9, 0x4c, 0xd6 } },
+        { { 0x14, 0xf6, 0x13, 0x57, 0xf8, 0x84, 0xe6, 0x55, 0x6e, 0xa4, 0x8a, 0x27, 0x64, 0xe7, 0x62, 0x89, 0x32, 0x2c, 0xcb, 0xb8, 0x1f, 0x50, 0xa1, 0x65, 0xd6, 0x9c, 0xbc, 0xf6, 0x77, 0x27, 0x94, 0xde },
+          { 0x33, 0x54, 0x1a, 0x71, 0x89, 0xde, 0xd6, 0x57, 0xa7, 0xf1, 0x23, 0x74, 0x5e, 0x8f, 0x4e, 0xf6, 0x16, 0xd4, 0x84, 0x7a, 0xe5, 0xc2, 0xa0, 0xf3, 0x0e, 0x67, 0xc6, 0xb8, 0x23, 0xee, 0x12, 0x1c } },
+        { { 0x10, 0x30, 0xca, 0x64, 0x38, 0xa4, 0x6e, 0x1d, 0x88, 0x86, 0x5b, 0x74, 0xaa, 0x99, 0xb9, 0xd4, 0xb6, 0x08, 0xb6, 0x83, 0x7d, 0x4c, 0xcb, 0x8c, 0x23, 0xa8, 0x24, 0xf4, 0x9e, 0xef, 0xf7, 0xf0 },
+          { 0x28, 0xee, 0x88, 0xcd, 0x03, 0x09, 0x72, 0x89, 0xe6, 0x41, 0xda, 0xc1, 0xcb, 0xb2, 0x16, 0x00, 0x83, 0x74, 0xf1, 0x64, 0x38, 0x78, 0xc4, 0xd9, 0x4b, 0x8a, 0xb8, 0xde, 0xbd, 0x5a, 0x15, 0x1e } },
+        { { 0x3e, 0x19, 0x9c, 0xc6, 0xd4, 0x12, 0x3f, 0xa6, 0xd6, 0x32, 0x69, 0x6c, 0xec, 0x9a, 0x85, 0xd6, 0xe7, 0xe8, 0xe5, 0xbc, 0x38, 0xf6, 0x7c, 0xd0, 0x1b, 0xbb, 0x43, 0xbf, 0x48, 0x72, 0xba, 0xbd },
+          { 0x3e, 0x3f, 0xea, 0xa7, 0x11, 0xd3, 0x13, 0xa5, 0xc1, 0x0a, 0x3a, 0xac, 0x76, 0xd3, 0x2a, 0x86, 0x21, 0xb0, 0x2e, 0x90, 0x58, 0x3d, 0x30, 0xd4, 0xb6, 0x02, 0x0e, 0x7c, 0x10, 0x63, 0x8d, 0x90 } },
+        { { 0x29, 0xca, 0x20, 0x83, 0xd4, 0x05, 0x87, 0x16, 0xed, 0x0c, 0xd2, 0x1b, 0xe8, 0x59, 0x80, 0x06, 0x6d, 0x9e, 0x30, 0xf0, 0xcd, 0xcb, 0xcb, 0xeb, 0x32, 0x1a, 0x10, 0x84, 0xe0, 0x71, 0x1b, 0x5b },
+          { 0x3b, 0xd0, 0x97, 0x88, 0x80, 0x65, 0xc3, 0x36, 0xc7, 0xee, 0x1a, 0x8f, 0x0d, 0xb1, 0x22, 0xe7, 0xc4, 0x51, 0x0d, 0xff, 0xd6, 0x69, 0xa2, 0x81, 0x24, 0x03, 0xf3, 0xeb, 0x09, 0x6a, 0xde, 0x3b } }
+    },
+    {
+        { { 0x0b, 0x6f, 0x8d, 0xdf, 0x4d, 0x05, 0xe2, 0x9a, 0xbe, 0x68, 0x6b, 0x82, 0x93, 0xc5, 0xef, 0xf7, 0x52, 0xaa, 0x03, 0xe6, 0xd1, 0xb2, 0x84, 0xc7, 0xc2, 0x24, 0xf6, 0x46, 0xbc, 0x8e, 0xa2, 0x6a },
+          { 0x13, 0xef, 0x6e, 0x77, 0x1d, 0xfc, 0x1b, 0x0f, 0xa4, 0xb0, 0x31, 0x73, 0xb2, 0x1d, 0x6b, 0x27, 0x38, 0x8b, 0x13, 0x00, 0xdc, 0x34, 0x2b, 0x66, 0x76, 0xd2, 0x44, 0xe9, 0x38, 0x5a, 0x79, 0x46 } },
+        { { 0x0d, 0x5f, 0xf2, 0x36, 0x3e, 0x02, 0x06, 0x0c, 0x36, 0xac, 0x20, 0x41, 0xab, 0x41, 0x6a, 0xdd, 0x11, 0xe3, 0x56, 0xe1, 0xd1, 0xd3, 0xc3, 0x99, 0x48, 0xbe, 0x8c, 0xdc, 0xad, 0x5f, 0x7e, 0xfb },
+          { 0x3f, 0xdc, 0x79, 0xe1, 0x92, 0x2c, 0x22, 0x1c, 0x63, 0x8a, 0x98, 0x35, 0xb9, 0x13, 0xc1, 0x8e, 0x82, 0xd0, 0x06, 0x15, 0x8e, 0x24, 0xe1, 0x8d, 0x0f, 0x79, 0x70, 0xd7, 0xe5, 0x19, 0x13, 0x0b } },
+        { { 0x27, 0x57, 0x55, 0x83, 0xeb, 0xbe, 0x82, 0x92, 0x19, 0x08, 0x8c, 0x46, 0x64, 0x52, 0x93, 0x82, 0x09, 0xb8, 0x7e, 0x5a, 0x06, 0x3e, 0x19, 0x12, 0xd5, 0x98, 0xb2, 0xdd, 0x05, 0xad, 0x71, 0x86 },
+          { 0x35, 0xfd, 0xe8, 0xf3, 0x30, 0x76, 0x0e, 0x93, 0x75, 0xf2, 0xd8, 0xe9, 0x6e, 0xeb, 0x79, 0x30, 0x09, 0x2c, 0x2c, 0x86, 0x3f, 0x33, 0xbc, 0x57, 0x2e, 0xae, 0xb8, 0xa1, 0x00, 0x2d, 0x8e, 0x33 } },
+        { { 0x23, 0x25, 0x06, 0xdd, 0x6e, 0xc5, 0x0d, 0x1a, 0xed, 0xaa, 0x2e, 0xd9, 0x5f, 0x42, 0xdd, 0x66, 0x95, 0x60, 0x49, 0xd4, 0x68, 0xee, 0x69, 0x52, 0xe4, 0x82, 0xdd, 0x11, 0xc8, 0xca, 0x15, 0xa2 },
+          { 0x29, 0x52, 0x95, 0x77, 0xc4, 0x24, 0x68, 0x3e, 0x8d, 0x1a, 0xcd, 0x23, 0x14, 0xb9, 0xf4, 0x07, 0x5b, 0x50, 0x81, 0xb3, 0x3a, 0x74, 0x95, 0x9a, 0x60, 0x7f, 0xc8, 0xd0, 0x04, 0x74, 0xb4, 0xcb } },
+        { { 0x12, 0x52, 0xa9, 0xda, 0xed, 0xa1, 0xd9, 0x62, 0x4d, 0xae, 0x81, 0xc2, 0x2d, 0xcd, 0xdf, 0x79, 0x41, 0x1a, 0x9d, 0x8d, 0x8d, 0xcb, 0x20, 0x66, 0xfe, 0x18, 0x3a, 0x52, 0xbb, 0xdf, 0x8d, 0x0e },
+          { 0x2a, 0xc9, 0x6e, 0x5f, 0xbb, 0xb0, 0xb9, 0x59, 0xdc, 0xc2, 0x52, 0xbe, 0x73, 0xb8, 0x4d, 0x8c, 0x68, 0xae, 0x50, 0xc9, 0xf6, 0x3e, 0x8e, 0xa0, 0x30, 0x92, 0x23, 0x2d, 0x57, 0xe3, 0x7b, 0x02 } },
+        { { 0x36, 0xdb, 0xde, 0xce, 0x8a, 0x7a, 0x2c, 0x98, 0x72, 0xd3, 0xf4, 0x50, 0xed, 0xd8, 0xfd, 0x47, 0x11, 0x17, 0xef, 0x2f, 0xcd, 0xe2, 0x59, 0xf8, 0x1b, 0xa7, 0x18, 0x3e, 0x83, 0x1c, 0x48, 0xb8 },
+          { 0x07, 0x30, 0xdb, 0xf9, 0xdc, 0x53, 0xe0, 0xf8, 0x66, 0x50, 0x80, 0xde, 0xae, 0x3e, 0x63, 0xe8, 0xf4, 0x82, 0xa9, 0xba, 0xf6, 0xca, 0x88, 0x54, 0x7f, 0x3c, 0x2b, 0x21, 0x40, 0x90, 0x8e, 0x0c } },
+        { { 0x03, 0x7f, 0x8e, 0x78, 0xad, 0x79, 0x98, 0x38, 0x75, 0xdd, 0xce, 0xc6, 0xda, 0xbf, 0xe9, 0x19, 0x68, 0x55, 0x83, 0xfd, 0x75, 0x17, 0xfe, 0x88, 0x18, 0x34, 0x7f, 0x08, 0x3b, 0x5c, 0xc9, 0xef },
+          { 0x30, 0x93, 0x93, 0xd4, 0xe1, 0xf6, 0xd6, 0x20, 0x72, 0x84, 0x25, 0xbc, 0x59, 0x03, 0xea, 0x56, 0x9a, 0x86, 0x62, 0xba, 0x82, 0x0d, 0x9d, 0x64, 0x6a, 0xa6, 0x67, 0x72, 0xb8, 0xaf, 0xff, 0x4a } },
+        { { 0x20, 0x7a, 0xc3, 0xd9, 0x74, 0x6f, 0x2c, 0xed, 0xaf, 0x2c, 0x6e, 0xaa, 0x68, 0x23, 0x3b, 0xdd, 0x3a, 0x2f, 0x9e, 0x11, 0x3c, 0x96, 0x63, 0xe1, 0x21, 0xe5, 0x3a, 0x5d, 0xa8, 0xa8, 0x57, 0x3a },
+          { 0x0d, 0x35, 0xef, 0xac, 0x15, 0x8c, 0xea, 0xef, 0x85, 0x56, 0x1d, 0xea, 0xac, 0x05, 0x2d, 0x8d, 0xaf, 0xf3, 0xb2, 0x7d, 0x6d, 0xa8, 0x59, 0x7b, 0x96, 0xec, 0x3a, 0xfb, 0x9f, 0x6c, 0x8d, 0x23 } }
+    },
+    {
+        { { 0x0b, 0xa7, 0x80, 0x2c, 0x19, 0x25, 0xf1, 0x47, 0x58, 0x0a, 0xe9, 0x5d, 0xd7, 0xda, 0x35, 0x40, 0xc5, 0xe8, 0x6f, 0xd4, 0x40, 0xe9, 0xdf, 0xd7, 0x73, 0x70, 0x98, 0x96, 0x45, 0x21, 0x0f, 0x05 },
+          { 0x05, 0xba, 0x30, 0x7c, 0xbd, 0xab, 0x23, 0x90, 0x3f, 0x62, 0x7a, 0x1f, 0xa6, 0x3b, 0xae, 0xdc, 0x93, 0xcb, 0x8c, 0xcd, 0x5c, 0x99, 0x6c, 0x60, 0x2b, 0x4d, 0x3f, 0x5d, 0xe5, 0xf9, 0x83, 0x7a } },
+        { { 0x12, 0x02, 0xba, 0xad, 0x46, 0x60, 0x8e, 0xb8, 0xc1, 0xbc, 0x62, 0xf8, 0x30, 0xcb, 0x79, 0x31, 0xb1, 0x8e, 0x92, 0xd1, 0x94, 0x59, 0x30, 0x88, 0xed, 0xef, 0x02, 0x62, 0xc7, 0x35, 0xc8, 0x25 },
+          { 0x0c, 0x88, 0x18, 0xe4, 0xc1, 0x48, 0xf2, 0xda, 0xc5, 0xd6, 0xf1, 0x6b, 0xe0, 0xd2, 0x68, 0x8c, 0xca, 0x83, 0x7d, 0x09, 0x1e, 0xc7, 0xf1, 0x62, 0xfd, 0xbd, 0xc5, 0x74, 0x08, 0xbe, 0x37, 0x1b } },
+        { { 0x16, 0x46, 0x1a, 0xca, 0xf5, 0x67, 0xca, 0x54, 0x70, 0x68, 0x9d, 0x42, 0xc6, 0xd7, 0x61, 0x4c, 0x22, 0xb7, 0xd3, 0x56, 0xc1, 0x2d, 0xff, 0x1b, 0xe9, 0xb4, 0xb8, 0x36, 0x50, 0xea, 0x50, 0x64 },
+          { 0x28, 0xcc, 0x20, 0x9a, 0x4d, 0x47, 0xa8, 0x3f, 0x56, 0x76, 0xfa, 0x0e, 0xd6, 0x43, 0xb0, 0x81, 0xe5, 0x9e, 0x10, 0x0e, 0xd8, 0xc7, 0x9c, 0xa6, 0x01, 0xe8, 0x1b, 0xef, 0x59, 0x86, 0x55, 0xe5 } },
+        { { 0x0c, 0x13, 0xda, 0x03, 0x36, 0xad, 0xbf, 0x09, 0x98, 0xff, 0x8d, 0xa1, 0x4b, 0xd3, 0x3e, 0xa9, 0x1d, 0x8b, 0x61, 0x9d, 0x4a, 0x52, 0x6d, 0x54, 0x74, 0x26, 0x44, 0x6a, 0xd1, 0xb0, 0xe3, 0x52 },
+          { 0x0e, 0x7c, 0x0d, 0xbe, 0x11, 0x99, 0xdb, 0x28, 0xe2, 0xcd, 0x0b, 0x37, 0x3b, 0x05, 0x11, 0xef, 0x38, 0xa7, 0x82, 0x18, 0x2c, 0x30, 0x57, 0x56, 0x55, 0x11, 0x6d, 0x93, 0x0c, 0x77, 0x6a, 0x6d } },
+        { { 0x16, 0xa3, 0xde, 0x64, 0xa5, 0x26, 0x8f, 0x59, 0x49, 0xa5, 0xbf, 0x3f, 0x7d, 0x61, 0x75, 0x90, 0xa6, 0xb7, 0xf8, 0x8b, 0xd0, 0x42, 0x1f, 0xb9, 0xab, 0xee, 0xf2, 0x98, 0x54, 0x07, 0xd5, 0x6d },
+          { 0x19, 0x9c, 0x4d, 0x1a, 0xfb, 0x1d, 0x64, 0x3f, 0xd9, 0x88, 0x9e, 0x31, 0x93, 0x6a, 0x79, 0xef, 0x58, 0x0d, 0x89, 0x6c, 0xd6, 0x2b, 0xf4, 0x53, 0x5c, 0x6e, 0xdb, 0xf2, 0xa9, 0xcf, 0x48, 0x7d } },
+        { { 0x04, 0x73, 0xd4, 0x72, 0xef, 0xb9, 0xe0, 0xd7, 0x0b, 0xa8, 0x9d, 0xc8, 0xde, 0x1f, 0x11, 0x9c, 0x60, 0xfa, 0x96, 0xc1, 0x07, 0xb5, 0x82, 0x75, 0xfb, 0x7a, 0xad, 0xf9, 0x44, 0x75, 0x28, 0x95 },
+          { 0x3b, 0xe4, 0x71, 0x75, 0xdb, 0xac, 0x56, 0x3a, 0x5b, 0xea, 0xe8, 0xe5, 0x47, 0x48, 0x31, 0x41, 0x8b, 0x59, 0xa4, 0x8c, 0xd6, 0x3a, 0xad, 0x2d, 0x79, 0x3d, 0x03, 0xcd, 0x83, 0x7c, 0xdc, 0xf2 } },
+        { { 0x32, 0x04, 0xfd, 0xdd, 0xc9, 0x57, 0xae, 0x47, 0x95, 0x75, 0x36, 0xb2, 0xf8, 0xae, 0xd3, 0x0b, 0x00, 0xef, 0x5d, 0x64, 0xce, 0xaa, 0x80, 0x36, 0xae, 0xb5, 0x1c, 0xc8, 0x16, 0x5c, 0xe7, 0xbf },
+          { 0x22, 0xb0, 0x4a, 0x0b, 0x00, 0x10, 0x89, 0x31, 0x62, 0xf3, 0x97, 0x95, 0x8f, 0x33, 0x8e, 0x54, 0x2e, 0xdf, 0x8b, 0xf0, 0xca, 0xdc, 0xa4, 0xee, 0xfe, 0x2b, 0x3c, 0xa7, 0x50, 0xe3, 0x4f, 0xe0 } },
+        { { 0x3d, 0x44, 0x17, 0x58, 0xfd, 0x1b, 0x49, 0x4f, 0xe2, 0x25, 0x09, 0x07, 0x47, 0x2c, 0x93, 0x30, 0xae, 0xc1, 0x18, 0x6e, 0xc8, 0x35, 0x6a, 0xa1, 0xd0, 0x97, 0x53, 0xe7, 0xce, 0xe0, 0x26, 0x96 },
+          { 0x37, 0x89, 0xb4, 0xa6, 0x93, 0x11, 0xa9, 0x47, 0x94, 0x0c, 0x68, 0x96, 0xa6, 0xa9, 0x03, 0xcf, 0xcd, 0x62, 0x73, 0x60, 0x09, 0x36, 0x07, 0xda, 0xf4, 0xbf, 0xf4, 0x70, 0xa1, 0x7d, 0xd9, 0x11 } }
+    },
+    {
+        { { 0x0b, 0xb9, 0x68, 0x3b, 0x5f, 0x51, 0x43, 0xa2, 0xbd, 0x9f, 0x50, 0x5f, 0xf2, 0xf5, 0x2c, 0x7c, 0xba, 0xe5, 0x77, 0xc0, 0x53, 0x40, 0xb8, 0x37, 0x3f, 0x76, 0x7c, 0xbc, 0x2a, 0x58, 0xde, 0x0f },
+          { 0x13, 0x31, 0x08, 0xa6, 0x84, 0x4b, 0xfb, 0x78, 0x37, 0xbc, 0x81, 0x94, 0x46, 0xcc, 0x29, 0xf3, 0x3e, 0x89, 0xbc, 0x35, 0xc0, 0xe1, 0x8d, 0x7c, 0x36, 0x35, 0x7f, 0xe8, 0x14, 0xe9, 0x3f, 0xce } },
+        { { 0x12, 0xc7, 0x00, 0x86, 0x3b, 0xf8, 0xb1, 0x21, 0x15, 0xe4, 0xc1, 0x59, 0x58, 0x67, 0xea, 0xa9, 0x52, 0x2f, 0x6f, 0x35, 0x1f, 0x21, 0xa9, 0x5b, 0xe5, 0x64, 0x0f, 0x14, 0x72, 0x46, 0xf1, 0x88 },
+          { 0x0a, 0xce, 0x3e, 0x63, 0xbf, 0x24, 0x07, 0x9c, 0x35, 0x1f, 0x61, 0xd6, 0xee, 0x8f, 0x25, 0x12, 0x36, 0xc8, 0x80, 0xaf, 0x7f, 0x64, 0x85, 0x17, 0x12, 0x73, 0x64, 0xfe, 0x08, 0xf8, 0x9c, 0xda } },
+        { { 0x0e, 0x06, 0xf1, 0x17, 0x43, 0x24, 0x27, 0x2a, 0x2d, 0xf4, 0xb1, 0x08, 0xa9, 0x94, 0xcd, 0x21, 0x33, 0x4e, 0x97, 0x3b, 0xce, 0x14, 0x18, 0x9c, 0x1c, 0x97, 0x31, 0x50, 0x12, 0x29, 0xec, 0x19 },
+          { 0x02, 0xcf, 0x36, 0x74, 0xf1, 0xa3, 0xf6, 0x7c, 0x61, 0x2c, 0x27, 0xba, 0x8e, 0x1a, 0x42, 0xa9, 0x25, 0x5e, 0x55, 0x5b, 0xbe, 0x97, 0xd7, 0x26, 0x37, 0xb1, 0xfe, 0xa8, 0x30, 0x4b, 0xf4, 0xfa } },
+        { { 0x36, 0x7e, 0x3a, 0xf5, 0x4f, 0xc9, 0x87, 0x0d, 0x63, 0xb8, 0xfa, 0x3b, 0x31, 0xb4, 0x64, 0x36, 0xef, 0x72, 0xa3, 0xe5, 0xe1, 0xbf, 0x41, 0x91, 0x81, 0x9a, 0x3e, 0xdd, 0x1d, 0x67, 0x2f, 0x7b },
+          { 0x26, 0x53, 0xaf, 0xe9, 0xd9, 0xfe, 0x62, 0x42, 0xb6, 0x1d, 0xe8, 0xcd, 0xe9, 0xab, 0x42, 0x53, 0xb6, 0x02, 0x2c, 0x25, 0x6c, 0x6c, 0x9b, 0xd0, 0x22, 0xf3, 0xb8, 0x27, 0xa2, 0xee, 0xcd, 0x66 } },
+        { { 0x36, 0x80, 0x20, 0x67, 0x67, 0x89, 0x92, 0xf2, 0x4b, 0x25, 0x3d, 0x00, 0xf8, 0x6b, 0x6a, 0x0a, 0xcc, 0x33, 0x14, 0x02, 0x19, 0x58, 0xf2, 0xfb, 0xe2, 0x8d, 0xa9, 0x2e, 0x8b, 0x93, 0x16, 0x20 },
+          { 0x22, 0x58, 0x53, 0xe9, 0x8d, 0x86, 0x16, 0x28, 0xdf, 0x98, 0x6c, 0x5a, 0x55, 0x35, 0x27, 0xe9, 0xdc, 0x55, 0xac, 0x9f, 0xcb, 0x69, 0x74, 0xfb, 0xc5, 0x4a, 0xac, 0x6e, 0xde, 0x8e, 0xf0, 0xd9 } },
+        { { 0x07, 0x6f, 0xd0, 0x20, 0xa8, 0xb8, 0xc2, 0x9b, 0x4f, 0x99, 0x6f, 0xd6, 0x9e, 0x39, 0xbd, 0x09, 0x8e, 0x58, 0xb3, 0x5c, 0x18, 0x46, 0x00, 0x02, 0xc7, 0x9a, 0x31, 0x68, 0x38, 0x26, 0x85, 0xe8 },
+          { 0x19, 0x60, 0x2c, 0x65, 0x26, 0x41, 0x65, 0xac, 0x42, 0x50, 0xa9, 0xc2, 0x27, 0x38, 0x1f, 0x65, 0x85, 0x85, 0xf3, 0x66, 0x09, 0x8a, 0xe7, 0x2b, 0x8e, 0x01, 0x05, 0x15, 0xdc, 0xf5, 0xd3, 0xa9 } },
+        { { 0x1d, 0xa3, 0x20, 0x17, 0xa1, 0xba, 0x9d, 0xeb, 0x85, 0xb3, 0x59, 0x7a, 0x34, 0x6a, 0x65, 0x77, 0x0e, 0xa5, 0xc6, 0x30, 0xed, 0x0c, 0x06, 0x1a, 0x7b, 0x13, 0x2c, 0x82, 0x5c, 0x07, 0x0e, 0x17 },
+          { 0x33, 0x7d, 0xf3, 0xe4, 0x7b, 0x60, 0xd7, 0x38, 0xb4, 0x9d, 0x62, 0xb5, 0x31, 0x3c, 0xa1, 0x8e, 0x30, 0xb1, 0x53, 0xe0, 0xae, 0xe7, 0xf6, 0xf9, 0x49, 0x79, 0x94, 0x3c, 0xa1, 0x11, 0x4b, 0x88 } },
+        { { 0x3a, 0x23, 0x1d, 0xff, 0x52, 0x65, 0xf0, 0x7b, 0x7c, 0xfe, 0x5a, 0x3d, 0xb2, 0xc8, 0x75, 0x4a, 0x11, 0x2d, 0x60, 0x51, 0x84, 0xc5, 0x09, 0xda, 0x51, 0x8c, 0x2e, 0x90, 0x66, 0x11, 0x56, 0x04 },
+          { 0x08, 0xe4, 0x07, 0x00, 0x91, 0x15, 0x08, 0x46, 0x3f, 0x15, 0xf2, 0xb1, 0x3e, 0xf2, 0xc2, 0x58, 0x1b, 0xde, 0xb2, 0xc6, 0xba, 0x67, 0xed, 0x90, 0xb4, 0x4a, 0x9d, 0xb9, 0xed, 0xe0, 0xbf, 0xe3 } }
+    },
+    {
+        { { 0x30, 0x25, 0x9a, 0xee, 0xb0, 0x95, 0xe1, 0x7f, 0xca, 0xc0, 0x8d, 0xc9, 0x05, 0xb6, 0xec, 0xe8, 0x78, 0x9b, 0x8d, 0xba, 0x4f, 0x8f, 0xfe, 0x1a, 0x84, 0xa4, 0x1e, 0xb7, 0x34, 0xf4, 0x32, 0x21 },
+          { 0x06, 0xbc, 0x74, 0xf9, 0xb1, 0x66, 0xe5, 0x1f, 0x87, 0x1b, 0xe2, 0x91, 0x67, 0x9c, 0x9b, 0x2c, 0xe9, 0x0b, 0x2a, 0xff, 0xd3, 0xd9, 0xcb, 0x80, 0xc1, 0xf1, 0xfc, 0x18, 0x24, 0x0c, 0x50, 0xf8 } },
+        { { 0x0a, 0x23, 0x83, 0x13, 0x84, 0x10, 0xc6, 0x28, 0xad, 0xa1, 0x06, 0xca, 0xec, 0x5a, 0x03, 0xa6, 0x29, 0x2f, 0x70, 0xb8, 0xcf, 0xe5, 0x68, 0x7d, 0xb5, 0x1f, 0x72, 0x56, 0xe1, 0xb1, 0x26, 0xb6 },
+          { 0x23, 0x0e, 0xc4, 0xb9, 0x9c, 0x67, 0x70, 0x1c, 0xef, 0xfb, 0xb6, 0x0d, 0xa9, 0x7c, 0x31, 0x84, 0xf6, 0x06, 0xf0, 0x52, 0x93, 0xf0, 0x14, 0x1e, 0xf1, 0xfc, 0x2a, 0xcc, 0x7b, 0x5e, 0xef, 0x69 } },
+        { { 0x1d, 0x1e, 0x8a, 0x6f, 0x23, 0xd3, 0xa7, 0xdc, 0xc2, 0x6d, 0xa8, 0x77, 0x99, 0x91, 0xef, 0x2a, 0xa3, 0x58, 0x9d, 0xf9, 0xaf, 0x4e, 0xad, 0x4e, 0xb1, 0x5a, 0x6a, 0xab, 0x87, 0xaf, 0x12, 0x6c },
+          { 0x24, 0xd5, 0x2a, 0x0c, 0xdb, 0x64, 0x4d, 0x42, 0xe7, 0x25, 0x5e, 0x2f, 0x71, 0xdd, 0x8b, 0x67, 0xf2, 0xd4, 0x9c, 0xc0, 0xe1, 0xed, 0xc0, 0x6f, 0xa9, 0x5d, 0x05, 0x1f, 0x92, 0x33, 0x6b, 0xcc } },
+        { { 0x3a, 0x7d, 0x8a, 0x8d, 0x49, 0x19, 0x6e, 0xeb, 0xe9, 0xc1, 0x4e, 0xc3, 0x9a, 0x32, 0x26, 0xc8, 0x38, 0xbe, 0x3f, 0xf4, 0x98, 0x13, 0x77, 0xbb, 0xa5, 0x7f, 0x1f, 0xc0, 0x87, 0x9b, 0xfe, 0xd4 },
+          { 0x36, 0x4c, 0x71, 0x3f, 0x19, 0x37, 0x4a, 0x02, 0xba, 0x75, 0xbc, 0x50, 0x6d, 0xb6, 0x50, 0xac, 0x3e, 0xfa, 0xac, 0xa1, 0x4f, 0xa0, 0xbd, 0x73, 0xb6, 0x58, 0x19, 0xba, 0x76, 0xfb, 0xfa, 0xbe } },
+        { { 0x3c, 0xe7, 0x73, 0xf1, 0x69, 0xc4, 0x70, 0x01, 0x0b, 0x4e, 0xb2, 0x99, 0x66, 0xf3, 0x70, 0x1b, 0x4f, 0xe2, 0x3e, 0xc3, 0x4f, 0x4a, 0x4b, 0xee, 0xb9, 0x19, 0x61, 0x30, 0x66, 0xc6, 0x6e, 0xc0 },
+          { 0x1c, 0x61, 0x6e, 0xca, 0x99, 0xd9, 0x2d, 0xbc, 0x98, 0xb1, 0xc1, 0x71, 0x6d, 0x6f, 0x95, 0xfc, 0xf8, 0xad, 0x00, 0xc9, 0xf2, 0xb3, 0xdc, 0x90, 0x52, 0xcc, 0x03, 0x5e, 0xa6, 0xfc, 0x64, 0x7f } },
+        { { 0x17, 0x6a, 0x37, 0x0d, 0x52, 0x86, 0xfd, 0x9a, 0xdb, 0xb6, 0x98, 0x24, 0x49, 0x31, 0xf6, 0xb6, 0x42, 0x3d, 0x9d, 0x50, 0x55, 0xfe, 0x2d, 0xa3, 0x6c, 0xd4, 0x0a, 0xef, 0xd4, 0x74, 0x1b, 0x63 },
+          { 0x0a, 0xc8, 0x34, 0x38, 0x11, 0xbe, 0x1d, 0x58, 0x59, 0x94, 0xe0, 0xa1, 0x3e, 0x87, 0x79, 0xba, 0x4b, 0xfb, 0xfd, 0xe4, 0x47, 0xa2, 0x61, 0x8d, 0x4d, 0xca, 0x66, 0xe3, 0x8d, 0x37, 0xab, 0xfe } },
+        { { 0x36, 0x93, 0xef, 0x38, 0x3f, 0x97, 0x56, 0x0b, 0xa5, 0x75, 0xd3, 0x66, 0x45, 0xf8, 0x36, 0xd3, 0x1c, 0xbd, 0xaf, 0xf1, 0xd3, 0x46, 0xa5, 0x8b, 0xbc, 0x76, 0x1c, 0x09, 0x46, 0xe8, 0x48, 0xcb },
+          { 0x29, 0x03, 0x1d, 0x63, 0xdc, 0xf4, 0x16, 0x7e, 0xf1, 0x7b, 0xe2, 0x58, 0x17, 0xb5, 0x30, 0x0b, 0xa7, 0x3f, 0x31, 0x6a, 0x27, 0x8a, 0x6a, 0xf4, 0x41, 0xee, 0x0e, 0x17, 0x28, 0x65, 0x08, 0xcb } },
+        { { 0x1b, 0x95, 0x0f, 0x5a, 0x65, 0x00, 0x07, 0x0f, 0xff, 0xa9, 0x1a, 0x9e, 0xcb, 0x72, 0xc0, 0x40, 0xe7, 0x7c, 0x1e, 0x64, 0x01, 0xdd, 0x3d, 0x34, 0x94, 0x1e, 0xa6, 0x9a, 0x8e, 0x13, 0x7c, 0x13 },
+          { 0x09, 0x87, 0x28, 0xa8, 0x73, 0xe3, 0xa6, 0x76, 0x59, 0x26, 0xca, 0x03, 0x53, 0x62, 0x0e, 0x8c, 0x22, 0x90, 0xbd, 0x18, 0x3d, 0xb3, 0x5d, 0xa8, 0x26, 0x0e, 0x87, 0x74, 0xa3, 0x10, 0xde, 0x36 } }
+    },
+    {
+        { { 0x18, 0x65, 0x6f, 0x5b, 0xe9, 0x0e, 0x87, 0x5e, 0x05, 0x7f, 0x3a, 0xc3, 0xc6, 0xb9, 0xc4, 0x76, 0xb4, 0xef, 0xbf, 0x38, 0xc1, 0x69, 0x0b, 0xda, 0x8c, 0x4c, 0x4b, 0xcc, 0xf5, 0xb1, 0xf5, 0xf6 },
+          { 0x37, 0xea, 0xe8, 0xb1, 0x04, 0xab, 0x7e, 0xdc, 0x06, 0xc1, 0x47, 0x58, 0xcd, 0x27, 0xc1, 0xd2, 0x85, 0xc3, 0x2f, 0x91, 0x4f, 0x71, 0x54, 0x5e, 0x2f, 0xe3, 0xde, 0x38, 0xee, 0xcb, 0x6a, 0x8b } },
+        { { 0x07, 0xf5, 0xe2, 0xeb, 0x51, 0x30, 0x27, 0x0c, 0x50, 0xa5, 0xea, 0x7d, 0xe8, 0xe0, 0xf8, 0x37, 0xc1, 0xd1, 0x11, 0x21, 0x07, 0x39, 0x43, 0x4c, 0xcd, 0x5a, 0x31, 0x93, 0x0e, 0x35, 0x30, 0xab },
+          { 0x2c, 0xc4, 0x9c, 0xd1, 0xce, 0x08, 0x18, 0xc1, 0xdf, 0x4b, 0x8e, 0xea, 0x34, 0xd0, 0x44, 0x7e, 0x7f, 0x9a, 0x96, 0xd4, 0x86, 0xef, 0x45, 0x65, 0x71, 0x0f, 0x11, 0x42, 0xd5, 0xd6, 0x03, 0xb2 } },
+        { { 0x01, 0x75, 0xb5, 0x00, 0xe7, 0x59, 0x1d, 0x97, 0x22, 0xec, 0x7d, 0x4a, 0xcd, 0x63, 0xfc, 0xbb, 0xcb, 0xa2, 0x4e, 0x41, 0x16, 0x07, 0x22, 0x91, 0x1d, 0xe2, 0x4e, 0xc1, 0xe0, 0x81, 0xca, 0x9f },
+          { 0x1d, 0x20, 0x1b, 0x79, 0x67, 0xf4, 0x1e, 0xc4, 0x17, 0x29, 0xf7, 0x73, 0x68, 0xa4, 0x5a, 0x39, 0xe0, 0x0d, 0x3a, 0xea, 0x23, 0xd3, 0x12, 0x4d, 0x44, 0xce, 0x80, 0xa2, 0x3d, 0x25, 0x6d, 0x0e } },
+        { { 0x39, 0x65, 0x27, 0xbb, 0xab, 0xb7, 0x98, 0xf6, 0x36, 0x2c, 0x1b, 0x34, 0xed, 0xb8, 0x3c, 0x5f, 0xde, 0x4d, 0xb6, 0x22, 0x1a, 0x1c, 0x42, 0xd3, 0xb6, 0x49, 0xbd, 0x1e, 0x7f, 0xe0, 0xdd, 0x8f },
+          { 0x03, 0x97, 0x63, 0x64, 0x9d, 0x5a, 0x0e, 0x3c, 0x7c, 0x37, 0x70, 0xd6, 0x25, 0x2d, 0x05, 0x91, 0xf4, 0x34, 0xc9, 0xb1, 0xe9, 0x18, 0x88, 0x4c, 0xf9, 0xce, 0xb9, 0x17, 0xb0, 0xba, 0xeb, 0x07 } },
+        { { 0x19, 0x5c, 0x6d, 0x25, 0x58, 0xf1, 0x92, 0x66, 0x41, 0x86, 0xd9, 0xeb, 0x21, 0x27, 0xc3, 0x4b, 0x5a, 0x7a, 0x49, 0x15, 0xc1, 0x0f, 0x6a, 0x01, 0x16, 0xf2, 0xf7, 0x47, 0xea, 0x8c, 0xcc, 0x08 },
+          { 0x07, 0x90, 0x53, 0x99, 0x28, 0xa5, 0xcf, 0x1b, 0x57, 0xf8, 0xa3, 0x22, 0x5a, 0xbb, 0x01, 0x51, 0x5c, 0xf2, 0x05, 0x71, 0xd2, 0xed, 0xc6, 0x52, 0xf0, 0x97, 0x36, 0x76, 0x4c, 0xe9, 0x9e, 0x54 } },
+        { { 0x36, 0x0d, 0x16, 0x52, 0xfc, 0x7c, 0x57, 0x6f, 0xe9, 0xd2, 0x28, 0xae, 0x18, 0x31, 0x63, 0x25, 0x96, 0x3d, 0xd5, 0x6a, 0xe4, 0xa1, 0x97, 0xb0, 0x69, 0xfa, 0xaf, 0xac, 0x3b, 0xfc, 0xfc, 0x53 },
+          { 0x07, 0xa1, 0xdc, 0x65, 0xdc, 0x15, 0x84, 0x9f, 0xac, 0x4b, 0x42, 0x7b, 0xb1, 0x2f, 0x77, 0x21, 0x34, 0x9a, 0x64, 0xb2, 0x15, 0xbd, 0x4f, 0xea, 0xb9, 0x9c, 0xf7, 0xad, 0x03, 0xff, 0xb2, 0xa1 } },
+        { { 0x25, 0xca, 0x40, 0x96, 0x73, 0x3e, 0x65, 0x8d, 0xb2, 0xfc, 0x96, 0x4f, 0x0f, 0x4a, 0x21, 0xda, 0x15, 0x56, 0x91, 0x97, 0xad, 0x5b, 0xcf, 0x37, 0x64, 0x6b, 0xec, 0xbd, 0x84, 0x77, 0x3e, 0xd5 },
+          { 0x1c, 0x48, 0x9b, 0x9f, 0x7b, 0xce, 0x12, 0x66, 0xb3, 0x67, 0xa5, 0xaa, 0xf1, 0x47, 0xe6, 0x62, 0xbd, 0x39, 0x10, 0xfe, 0xcd, 0xa7, 0x91, 0x4d, 0x16, 0x95, 0x00, 0x76, 0xe6, 0xd1, 0x3c, 0xa6 } },
+        { { 0x1f, 0xee, 0xa5, 0x44, 0x6f, 0x5e, 0x40, 0xe4, 0xcf, 0x71, 0x2d, 0xba, 0x0a, 0x24, 0xb6, 0x29, 0x1e, 0xee, 0x87, 0x1c, 0x77, 0x81, 0x58, 0x23, 0xa8, 0x58, 0x84, 0x10, 0xbf, 0x8a, 0xf3, 0xe8 },
+          { 0x3b, 0x8c, 0xfc, 0x47, 0xea, 0x86, 0x7f, 0x4e, 0x7d, 0x45, 0x8e, 0xb3, 0xaa, 0x66, 0x28, 0xf2, 0x56, 0x77, 0xee, 0xda, 0xf2, 0xf1, 0x0a, 0x8a, 0x5e, 0x60, 0xfe, 0x30, 0x6d, 0xf5, 0x43, 0x0e } }
+    },
+    {
+        { { 0x04, 0x0c, 0x7a, 0x8a, 0x43, 0x16, 0x03, 0xb1, 0x6f, 0x7c, 0x2d, 0xef, 0x1b, 0x28, 0xef, 0x1e, 0x2b, 0xdb, 0xd8, 0xd9, 0x92, 0xfd, 0x11, 0xac, 0x5b, 0x2d, 0x90, 0x07, 0x2e, 0x36, 0xcf, 0xe2 },
+          { 0x0d, 0x8c, 0x7a, 0x2e, 0x21, 0x8d, 0x2a, 0x79, 0x0f, 0xd4, 0x5b, 0xf0, 0x3b, 0x12, 0xef, 0x1b, 0xaa, 0xe0, 0x46, 0x78, 0x5d, 0x56, 0xd1, 0x67, 0x70, 0x4e, 0x9a, 0xb7, 0x9b, 0x71, 0x03, 0x53 } },
+        { { 0x0f, 0xa8, 0x99, 0xe6, 0x81, 0x78, 0xc7, 0x13, 0x3d, 0x31, 0xd7, 0x6d, 0x22, 0x74, 0xb3, 0xe8, 0x81, 0x14, 0x4a, 0x43, 0xaf, 0x4a, 0xf4, 0xf7, 0xf6, 0x4f, 0x47, 0xba, 0x4d, 0x99, 0x4b, 0xef },
+          { 0x27, 0x5b, 0xfb, 0x61, 0x7e, 0x8d, 0x48, 0x38, 0xf2, 0xee, 0x82, 0xba, 0x30, 0x64, 0xae, 0x52, 0x95, 0x82, 0xb9, 0x5f, 0xfa, 0xa3, 0x70, 0x6f, 0x16, 0x41, 0x16, 0x9a, 0x3d, 0x95, 0x2b, 0x34 } },
+        { { 0x28, 0x65, 0x65, 0x99, 0xa9, 0xb4, 0x55, 0xc5, 0x31, 0xb5, 0x79, 0x8a, 0xe4, 0xa0, 0xd0, 0x80, 0x5f, 0x85, 0x01, 0xb1, 0x90, 0x2c, 0xe7, 0x19, 0x6b, 0x49, 0x66, 0x68, 0xb9, 0x2e, 0xa5, 0x7a },
+          { 0x38, 0x69, 0xcd, 0x5c, 0x19, 0xdf, 0xf1, 0x3e, 0x98, 0x69, 0x98, 0x6f, 0x38, 0x84, 0xed, 0x49, 0x38, 0xba, 0xcf, 0x16, 0x22, 0xb3, 0x58, 0x30, 0x00, 0x6c, 0x7b, 0xff, 0xcb, 0x13, 0xcc, 0xd0 } },
+        { { 0x3f, 0xdd, 0x7a, 0x3d, 0x49, 0x7c, 0x3c, 0xc7, 0x00, 0x13, 0x57, 0x07, 0x80, 0x06, 0x94, 0x0e, 0x54, 0x13, 0x41, 0x13, 0x86, 0x02, 0x97, 0xc2, 0xc1, 0xd0, 0x0f, 0x36, 0x04, 0xd0, 0x2a, 0x31 },
+          { 0x00, 0x1e, 0x13, 0x1c, 0x46, 0x4f, 0xba, 0x3b, 0x0b, 0xc9, 0xb2, 0x94, 0x96, 0x91, 0xa6, 0x0c, 0x00, 0x86, 0x06, 0xe2, 0x7d, 0xc5, 0x71, 0x15, 0x95, 0x9e, 0x9d, 0x39, 0xde, 0xed, 0x98, 0xda } },
+        { { 0x31, 0x08, 0xdc, 0xdb, 0xf7, 0x80, 0x9f, 0x06, 0x69, 0xa9, 0xa7, 0xa4, 0xe1, 0x1f, 0x2d, 0x62, 0x0d, 0x56, 0x2a, 0x4c, 0xb2, 0xe3, 0x14, 0xe1, 0xcb, 0x32, 0x7c, 0xc5, 0x2c, 0x7d, 0xa2, 0xce },
+          { 0x2e, 0x3e, 0x50, 0x30, 0x20, 0xcd, 0xf9, 0x64, 0x8d, 0xe7, 0x32, 0xa6, 0x8a, 0xbd, 0x04, 0xdb, 0xeb, 0x22, 0x55, 0xb6, 0x51, 0xec, 0x99, 0x00, 0xe6, 0x50, 0x5f, 0x8f, 0x92, 0xba, 0xeb, 0xfd } },
+        { { 0x29, 0x2f, 0x15, 0xdf, 0x42, 0xcb, 0xd6, 0x64, 0xeb, 0xcb, 0xdc, 0xac, 0x47, 0x15, 0x29, 0xe4, 0x42, 0x98, 0x66, 0x5d, 0x23, 0x41, 0x4e, 0x85, 0x39, 0x62, 0x36, 0x5b, 0x7f, 0x6f, 0x1c, 0xfb },
+          { 0x0b, 0xfa, 0xba, 0x0f, 0xb3, 0xac, 0x7e, 0x05, 0xe6, 0x2b, 0x5d, 0x02, 0xc8, 0xfd, 0x1e, 0xb4, 0x7e, 0xd4, 0xc8, 0xcd, 0x3e, 0x99, 0x80, 0xd5, 0x4e, 0x7a, 0x97, 0x61, 0x6b, 0x27, 0x11, 0x58 } },
+        { { 0x27, 0x9e, 0x16, 0x1f, 0xe3, 0xd3, 0x31, 0xf1, 0x6b, 0xba, 0x09, 0x4a, 0xcf, 0x5a, 0x92, 0x3f, 0xbc, 0xdd, 0x6d, 0x9e, 0x78, 0xd0, 0x84, 0xa9, 0xca, 0x60, 0xf0, 0xf0, 0x10, 0x86, 0x61, 0x62 },
+          { 0x11, 0xa8, 0x25, 0xee, 0x8a, 0x32, 0x7a, 0xc8, 0xba, 0x0e, 0x4f, 0x2b, 0xb9, 0x8d, 0x4f, 0xb8, 0x07, 0x31, 0x91, 0xd6, 0x62, 0x75, 0x41, 0x14, 0x1c, 0x8a, 0xd7, 0xb7, 0xb1, 0x30, 0x07, 0x15 } },
+        { { 0x00, 0x7f, 0x37, 0x95, 0xc8, 0x9d, 0xbb, 0x0d, 0x5b, 0x00, 0xe9, 0x78, 0x4c, 0xac, 0x1b, 0xa6, 0x37, 0xd6, 0x97, 0x90, 0xdd, 0x0a, 0x00, 0x79, 0xba, 0x01, 0xf2, 0x46, 0x81, 0x19, 0x09, 0x2b },
+          { 0x2b, 0xc0, 0x0a, 0x86, 0xce, 0x3c, 0x76, 0x39, 0xf1, 0xdc, 0x62, 0x85, 0xc8, 0xb8, 0xdc, 0x3f, 0x61, 0x18, 0x9c, 0xf9, 0x81, 0xf5, 0xe8, 0x2d, 0xda, 0x12, 0xe4, 0x31, 0xdf, 0x12, 0xab, 0x69 } }
+    },
+    {
+        { { 0x1f, 0xe3, 0xa7, 0xeb, 0xeb, 0xb2, 0x0b, 0xbb, 0xc8, 0x0e, 0x57, 0x38, 0xc7, 0x48, 0xe3, 0xe7, 0x51, 0xb8, 0x43, 0xc5, 0x89, 0x51, 0x7d, 0xc6, 0xe9, 0xe9, 0xad, 0x05, 0x06, 0x88, 0x88, 0xa8 },
+          { 0x05, 0x4a, 0xb9, 0x6a, 0x8c, 0xd6, 0x12, 0x58, 0xe1, 0x95, 0xd1, 0x6a, 0x8f, 0x41, 0xbc, 0x56, 0xa5, 0xb9, 0xbc, 0x45, 0xbd, 0x82, 0xc3, 0x2e, 0x47, 0x19, 0x6d, 0x95, 0x8d, 0x69, 0x48, 0x26 } },
+        { { 0x10, 0x9f, 0x75, 0x3c, 0x17, 0x5c, 0xe4, 0xf6, 0x6b, 0x47, 0xac, 0xb8, 0xf2, 0x57, 0xe3, 0x8f, 0x33, 0x23, 0xb1, 0x3b, 0x2f, 0xb9, 0x3e, 0x0d, 0x97, 0x56, 0x14, 0x0d, 0xd2, 0x02, 0xe4, 0x61 },
+          { 0x3e, 0x69, 0x94, 0xb6, 0x83, 0xdd, 0xc1, 0x03, 0x1c, 0xe8, 0xfb, 0x30, 0xa9, 0x86, 0x0d, 0xb2, 0x96, 0x84, 0x41, 0x59, 0x65, 0x22, 0x87, 0x40, 0x76, 0x44, 0x0e, 0xf2, 0x46, 0xa8, 0x35, 0xf0 } },
+        { { 0x07, 0x08, 0xd4, 0xa9, 0x37, 0xc1, 0xa5, 0x88, 0x08, 0x2c, 0xde, 0x10, 0x0c, 0x15, 0x62, 0x06, 0x1d, 0xea, 0x27, 0x48, 0xbe, 0xd4, 0x78, 0x41, 0x5a, 0xe1, 0x8d, 0x99, 0x7c, 0x7d, 0x5c, 0xd7 },
+          { 0x35, 0xb9, 0xf9, 0xde, 0xf7, 0x84, 0xeb, 0x1d, 0xf4, 0x80, 0x37, 0xd3, 0x08, 0x57, 0x3e, 0x02, 0xc8, 0xd8, 0xc6, 0x9b, 0x22, 0x4b, 0x9f, 0x50, 0x7b, 0xd1, 0xb6, 0xf2, 0xe2, 0x5d, 0x4d, 0x87 } },
+        { { 0x0e, 0x0d, 0x9a, 0x88, 0x0a, 0x25, 0x85, 0x37, 0xf9, 0xbb, 0xb1, 0xd1, 0x16, 0x8a, 0xab, 0xe8, 0x3b, 0xd7, 0x15, 0x28, 0x74, 0xc1, 0xe5, 0x07, 0x6b, 0x93, 0x3c, 0x38, 0x6d, 0x5b, 0xf7, 0x6b },
+          { 0x06, 0xa5, 0x68, 0x25, 0xfe, 0xad, 0x23, 0xcc, 0x16, 0xc8, 0xd8, 0xa6, 0x7b, 0xb7, 0x40, 0x10, 0x95, 0xd6, 0x71, 0xee, 0x43, 0x59, 0x9c, 0xd1, 0xd1, 0x42, 0xc3, 0x81, 0x60, 0x60, 0xfa, 0x8e } },
+        { { 0x03, 0xcb, 0xf7, 0xb6, 0x8e, 0x62, 0xee, 0xad, 0x4c, 0xf7, 0x28, 0x1e, 0x73, 0x1a, 0xbf, 0xcb, 0x42, 0xb3, 0x44, 0x45, 0x49, 0x81, 0xe8, 0x87, 0x55, 0xfc, 0xd3, 0x60, 0xd7, 0x3f, 0x71, 0xf3 },
+          { 0x2d, 0xa0, 0x5a, 0x40, 0xcc, 0xfb, 0xd9, 0xaa, 0xa6, 0x27, 0xc9, 0xc8, 0xeb, 0x48, 0xc6, 0xff, 0x7a, 0x6d, 0x7d, 0x4e, 0xbd, 0x1f, 0x44, 0xbb, 0xf6, 0x7b, 0x2a, 0xc0, 0x8d, 0x5d, 0x39, 0xf5 } },
+        { { 0x21, 0x07, 0x1e, 0x03, 0x3f, 0x34, 0x50, 0xb2, 0xca, 0xb4, 0x29, 0x79, 0x9f, 0x30, 0xad, 0x37, 0x88, 0x33, 0x43, 0x39, 0xd5, 0x1a, 0x1e, 0x48, 0xd8, 0xcf, 0x34, 0x2d, 0x9a, 0x90, 0x2c, 0x3e },
+          { 0x0a, 0xa3, 0xa3, 0x63, 0x81, 0x69, 0x84, 0x47, 0xe2, 0x41, 0x32, 0xd0, 0x1f, 0xc0, 0x10, 0x55, 0xfc, 0xc8, 0xb1, 0xc5, 0x35, 0x0b, 0xd8, 0xbc, 0x01, 0xc8, 0x34, 0x24, 0xbb, 0xf8, 0x56, 0x25 } },
+        { { 0x04, 0x72, 0x80, 0xcb, 0xed, 0x23, 0x10, 0x5a, 0x39, 0x02, 0x74, 0xd0, 0xf0, 0x28, 0xed, 0xac, 0x1a, 0xc6, 0xfc, 0x7d, 0x72, 0xae, 0xfd, 0x3d, 0x76, 0x50, 0xce, 0x7c, 0xf7, 0x2d, 0xab, 0x75 },
+          { 0x0a, 0x1c, 0x14, 0xf5, 0x08, 0xc5, 0x26, 0xe0, 0x9f, 0xd6, 0xdf, 0xae, 0xcf, 0x0e, 0x5e, 0xd0, 0xeb, 0x0b, 0x5d, 0x21, 0xcd, 0xe6, 0x2c, 0x86, 0x9d, 0x35, 0x25, 0x56, 0x9a, 0x3a, 0xcc, 0xf2 } },
+        { { 0x1f, 0x56, 0x5f, 0xd4, 0xf2, 0x1a, 0x60, 0x25, 0x9f, 0xaa, 0x28, 0xba, 0x24, 0x90, 0x66, 0x5c, 0x46, 0x65, 0xb9, 0xde, 0x0d, 0xe9, 0x61, 0xfe, 0xb9, 0xd8, 0x51, 0x00, 0xc5, 0xbf, 0xe7, 0x75 },
+          { 0x00, 0x08, 0xa2, 0x89, 0xdd, 0x3f, 0x50, 0x9d, 0xd0, 0x89, 0x70, 0x72, 0xce, 0xc1, 0x60, 0xb0, 0x90, 0x3b, 0x68, 0x31, 0xee, 0xf4, 0xab, 0xc3, 0xd1, 0x66, 0xf6, 0x6c, 0x3b, 0xc5, 0xec, 0xfe } }
+    },
+    {
+        { { 0x1b, 0x61, 0x0a, 0x5b, 0xa4, 0xa4, 0x8d, 0x70, 0x08, 0x2c, 0xf4, 0x20, 0x55, 0xdc, 0x68, 0x9e, 0x00, 0x00, 0x08, 0x44, 0xe3, 0x8c, 0xcc, 0x9f, 0x4a, 0x91, 0x98, 0x52, 0x4a, 0x1e, 0x23, 0x49 },
+          { 0x11, 0x3f, 0x04, 0xc5, 0xb2, 0xd0, 0x3f, 0x14, 0xf1, 0xfd, 0x2d, 0xe0, 0x67, 0x77, 0x5e, 0x38, 0xe9, 0x37, 0xa9, 0xad, 0x09, 0x85, 0xb0, 0x61, 0xad, 0xa1, 0xcb, 0x5c, 0x20, 0xfe, 0xd5, 0xe1 } },
+        { { 0x22, 0xed, 0x42, 0xc6, 0xdd, 0x98, 0x65, 0x97, 0x2a, 0xe3, 0xc1, 0x55, 0xca, 0xd2, 0x50, 0xfd, 0x16, 0x79, 0x5b, 0x7b, 0x1c, 0x7f, 0xea, 0xd8, 0x08, 0xd1, 0xf5, 0xa8, 0xc1, 0xbf, 0x74, 0x0a },
+          { 0x06, 0x48, 0x6d, 0x07, 0xbb, 0x69, 0xc2, 0xef, 0x56, 0x0d, 0x28, 0xc5, 0x14, 0xca, 0x10, 0xc9, 0xba, 0x89, 0x72, 0x83, 0xd0, 0x90, 0x0b, 0xa8, 0x8d, 0xd0, 0x4a, 0x45, 0x46, 0xd1, 0x15, 0x5d } },
+        { { 0x21, 0x35, 0xa5, 0xc6, 0x4d, 0x5f, 0xa2, 0xbe, 0x22, 0x06, 0xa1, 0xbc, 0xec, 0xba, 0x36, 0xa2, 0xc4, 0x53, 0xf7, 0xb6, 0x76, 0x8f, 0x25, 0x9a, 0x74, 0x19, 0x25, 0x1c, 0xf5, 0xee, 0xc8, 0xd9 },
+          { 0x3a, 0xb8, 0x91, 0xb4, 0x37, 0x62, 0xb3, 0x3e, 0xeb, 0x2a, 0xd1, 0x56, 0x9b, 0x84, 0xbc, 0x86, 0xa6, 0x16, 0xf2, 0xb7, 0xb9, 0x7a, 0x26, 0x3d, 0x46, 0x23, 0x92, 0x04, 0x2f, 0x04, 0x3a, 0xe4 } },
+        { { 0x16, 0x7b, 0x00, 0x32, 0xf2, 0x85, 0x46, 0x02, 0x9b, 0x87, 0xb9, 0x6a, 0xfa, 0x2f, 0x83, 0x39, 0x6c, 0x85, 0x28, 0x1a, 0xc7, 0x03, 0x30, 0x1f, 0x00, 0x29, 0xf5, 0x5f, 0xa7, 0x7f, 0x61, 0xad },
+          { 0x24, 0x16, 0x5c, 0x5f, 0x56, 0xd5, 0x6c, 0x06, 0x60, 0xcd, 0x87, 0xeb, 0x0c, 0xc3, 0x55, 0x0c, 0x4e, 0xa5, 0xa2, 0xff, 0xb4, 0x13, 0x3b, 0x56, 0x5b, 0xbd, 0x8a, 0x89, 0x68, 0x55, 0xf8, 0x28 } },
+        { { 0x19, 0xa0, 0x95, 0x0e, 0xcf, 0x41, 0xc3, 0x7d, 0x37, 0x3e, 0x54, 0x5e, 0x32, 0x3b, 0xab, 0x21, 0xbc, 0x34, 0xd6, 0x1c, 0x42, 0x4e, 0x78, 0xc6, 0x8e, 0x0d, 0x92, 0xc1, 0x25, 0x18, 0x64, 0xcd },
+          { 0x3d, 0x93, 0xd3, 0xf6, 0xc8, 0xb1, 0x6d, 0x10, 0xc6, 0xdf, 0xa0, 0x04, 0x8f, 0x93, 0xe5, 0x0d, 0xb3, 0xf3, 0x8f, 0x41, 0x40, 0x58, 0xfe, 0x20, 0x6a, 0x34, 0x0a, 0xaf, 0x32, 0xc6, 0x98, 0x7e } },
+        { { 0x33, 0x2d, 0x82, 0x6f, 0x87, 0x2f, 0xc9, 0xa3, 0x16, 0x28, 0x16, 0x36, 0xe2, 0x90, 0xc8, 0xf8, 0xfb, 0x26, 0xfa, 0x0e, 0x8c, 0x8c, 0xad, 0x73, 0x63, 0xe4, 0x60, 0xae, 0xc9, 0x1b, 0xab, 0x06 },
+          { 0x14, 0x44, 0x1e, 0xfc, 0xed, 0x7c, 0x07, 0x28, 0x2a, 0xdf, 0xa3, 0x78, 0xcb, 0x35, 0x48, 0xba, 0x7c, 0x54, 0x71, 0xb9, 0x2c, 0x4e, 0xe2, 0x14, 0x38, 0x19, 0xdc, 0x24, 0xd7, 0x33, 0xb7, 0x1c } },
+        { { 0x16, 0x88, 0xd2, 0xb6, 0x8c, 0xcd, 0x9c, 0x4d, 0xa1, 0x25, 0x15, 0x21, 0x10, 0x82, 0xf4, 0x0f, 0xcd, 0xec, 0x27, 0x4c, 0xd7, 0x70, 0x7d, 0x97, 0x6e, 0x04, 0x50, 0xbd, 0xc8, 0x8c, 0x18, 0xe7 },
+          { 0x3b, 0x0c, 0x78, 0x16, 0x31, 0x38, 0xbf, 0x7a, 0x67, 0x3d, 0x57, 0xdf, 0x91, 0xfe, 0x75, 0x10, 0xd5, 0x2a, 0xd4, 0x41, 0xe8, 0x1f, 0x95, 0x63, 0x42, 0xa0, 0xfa, 0xda, 0x4a, 0x33, 0x7a, 0xb9 } },
+        { { 0x17, 0xea, 0xf5, 0xc3, 0xa0, 0xda, 0xf1, 0xf5, 0x4a, 0xf1, 0xfe, 0xfa, 0xd8, 0x6c, 0xb5, 0x93, 0x45, 0xc7, 0x95, 0xbb, 0x49, 0x67, 0xdb, 0x4a, 0x94, 0x1e, 0x89, 0x68, 0x27, 0x70, 0x80, 0x70 },
+          { 0x39, 0x7d, 0xcb, 0xa5, 0xf5, 0x2f, 0x5d, 0x9e, 0x9d, 0x74, 0xb0, 0x41, 0x61, 0x40, 0x48, 0xa6, 0xed, 0x28, 0xc9, 0x86, 0xcb, 0x9b, 0x1a, 0x2d, 0x72, 0xba, 0x46, 0x40, 0xd7, 0x2f, 0x05, 0x90 } }
+    },
+    {
+        { { 0x04, 0x30, 0x1c, 0xd1, 0x68, 0x3c, 0x8d, 0x1b, 0x21, 0x80, 0xd2, 0xcc, 0xe3, 0xf3, 0x57, 0x0c, 0x8e, 0x3f, 0xb1, 0xf5, 0xbc, 0x79, 0x19, 0xc1, 0x9a, 0xe7, 0x0f, 0x3b, 0x05, 0xa5, 0x28, 0x35 },
+          { 0x05, 0x7c, 0x29, 0xfe, 0x13, 0xde, 0x5d, 0x76, 0xbb, 0xa8, 0x6a, 0xdb, 0x82, 0xaa, 0x02, 0x15, 0x73, 0x0e, 0x64, 0x2a, 0x7f, 0xf6, 0xac, 0x7d, 0x7a, 0xe9, 0xce, 0x62, 0x63, 0x93, 0x9e, 0xce } },
+        { { 0x11, 0x06, 0x54, 0xb5, 0x38, 0x72, 0xf2, 0x75, 0x55, 0x21, 0x54, 0x07, 0xda, 0xf0, 0xa5, 0x5e, 0xf3, 0xd0, 0x04, 0x99, 0x41, 0xec, 0xfe, 0x68, 0xe9, 0x0b, 0xe5, 0xaa, 0x6b, 0xc5, 0x68, 0x8d },
+          { 0x33, 0x39, 0x83, 0xfe, 0x0f, 0x84, 0x58, 0xc9, 0xec, 0xae, 0xaf, 0xbe, 0x5f, 0x53, 0x38, 0xcc, 0xf9, 0xd7, 0x67, 0x79, 0xb7, 0xdd, 0xae, 0x1c, 0x54, 0x0e, 0x86, 0x74, 0xa1, 0xfd, 0xf6, 0x3d } },
+        { { 0x3a, 0x6c, 0x64, 0xfb, 0xe9, 0x1a, 0x49, 0x0c, 0x5d, 0xc9, 0xf8, 0x29, 0x06, 0xc5, 0xf0, 0xea, 0x6a, 0xe1, 0x75, 0xef, 0x84, 0xd5, 0xff, 0x3c, 0x52, 0xf4, 0xda, 0xad, 0x95, 0xba, 0xfb, 0xdc },
+          { 0x05, 0xbd, 0xaa, 0x41, 0xfa, 0x66, 0xf3, 0x17, 0x15, 0xf0, 0xf1, 0x56, 0x83, 0xbd, 0x4b, 0x11, 0x8b, 0x10, 0x3e, 0x6c, 0x9b, 0x2d, 0xc8, 0x4d, 0x1a, 0xda, 0xe9, 0x08, 0xb3, 0x66, 0x3c, 0x08 } },
+        { { 0x38, 0xd3, 0x1f, 0x62, 0xb3, 0x32, 0x14, 0x3a, 0x31, 0xec, 0xed, 0x19, 0xb2, 0x9b, 0x9d, 0xb2, 0xab, 0x7a, 0x8e, 0x4d, 0xaf, 0xfd, 0x99, 0x41, 0xd6, 0xe4, 0x35, 0xe9, 0xfc, 0xa6, 0x33, 0x46 },
+          { 0x14, 0x2b, 0xdd, 0xc8, 0x6a, 0x9d, 0x5d, 0x4e, 0x12, 0xde, 0x9b, 0xf4, 0x2a, 0xac, 0x93, 0x97, 0x1e, 0xce, 0xf8, 0x88, 0x3a, 0xcb, 0xb6, 0xbd, 0xde, 0xee, 0xdf, 0x81, 0xe8, 0x7b, 0x20, 0x96 } },
+        { { 0x3d, 0xb9, 0xd3, 0x97, 0xb2, 0xbe, 0x69, 0x6d, 0xa4, 0xd3, 0x9b, 0x19, 0x78, 0x6c, 0xb1, 0xb1, 0xf2, 0x03, 0xc6, 0x01, 0x01, 0x75, 0x4c, 0xea, 0xdf, 0x43, 0x9c, 0xcf, 0x53, 0x5c, 0x31, 0xbf },
+          { 0x3c, 0x1c, 0x90, 0xc5, 0x35, 0x0e, 0x95, 0x4c, 0x6b, 0xea, 0xf9, 0x4f, 0x23, 0x44, 0x41, 0x9c, 0x94, 0xb6, 0x3c, 0x7b, 0xf0, 0x6f, 0xdc, 0x62, 0xfb, 0xbf, 0xb3, 0x42, 0x80, 0xa3, 0x87, 0xab } },
+        { { 0x00, 0x9c, 0xd7, 0x76, 0x72, 0x89, 0xd6, 0x75, 0xcc, 0x65, 0xc2, 0xd6, 0x49, 0x2b, 0xfe, 0x13, 0xdd, 0x7d, 0x78, 0x16, 0x5b, 0xb8, 0x67, 0xf3, 0xda, 0x5a, 0x3a, 0x70, 0xee, 0x94, 0x47, 0x17 },
+          { 0x1e, 0xff, 0xfc, 0x15, 0xb9, 0x16, 0xd4, 0x59, 0xb4, 0x58, 0x67, 0x23, 0xa8, 0x4e, 0x6c, 0xc8, 0xf1, 0x0d, 0x8d, 0x8d, 0x39, 0xba, 0x69, 0x36, 0x89, 0x6e, 0xcd, 0xc1, 0x14, 0x20, 0x3d, 0x9e } },
+        { { 0x3c, 0x64, 0x92, 0xa7, 0x1b, 0x39, 0x79, 0xf4, 0x39, 0x80, 0x20, 0x44, 0x4e, 0x86, 0xbc, 0xaa, 0xff, 0xfa, 0x2e, 0x1f, 0x13, 0x5e, 0xb7, 0x96, 0x14, 0xb8, 0xf8, 0xb5, 0x60, 0xdc, 0xaa, 0x90 },
+          { 0x1d, 0x5c, 0x54, 0x1a, 0x89, 0xb6, 0x74, 0xe0, 0xa7, 0xee, 0xa0, 0xee, 0xac, 0x39, 0xc9, 0x8c, 0xd2, 0x50, 0x15, 0xb6, 0x74, 0x2c, 0x44, 0xb2, 0xeb, 0xd6, 0xf3, 0x9f, 0x83, 0x78, 0xce, 0x30 } },
+        { { 0x36, 0x6f, 0x58, 0x10, 0xc6, 0x43, 0x8d, 0x55, 0x94, 0x68, 0xa8, 0x75, 0xb9, 0xd8, 0x12, 0x6d, 0x7b, 0xc5, 0x30, 0xda, 0x94, 0xe2, 0x6a, 0xa3, 0x22, 0xff, 0xaf, 0x31, 0xd3, 0x24, 0xad, 0xb1 },
+          { 0x28, 0x60, 0xb3, 0xed, 0x61, 0x27, 0x19, 0xd2, 0x5b, 0xec, 0xbe, 0x0a, 0x81, 0x12, 0x25, 0x96, 0x6b, 0x5c, 0x03, 0x44, 0x83, 0x4c, 0xe9, 0x57, 0xc9, 0xf6, 0x71, 0x84, 0x7a, 0xad, 0x9d, 0x9a } }
+    },
+    {
+        { { 0x3b, 0xf6, 0x32, 0x49, 0x4b, 0xc7, 0x0e, 0x71, 0x47, 0x4b, 0xd7, 0x62, 0x91, 0x6d, 0x8e, 0xed, 0x44, 0x6d, 0x1d, 0xf1, 0x3c, 0x99, 0xc8, 0xbb, 0x75, 0x2d, 0x1f, 0xb8, 0xa1, 0x11, 0x65, 0xfb },
+          { 0x36, 0x7c, 0xa8, 0x21, 0xb7, 0xca, 0xf2, 0xea, 0xd7, 0x2f, 0x3a, 0x24, 0x25, 0x5a, 0xb8, 0x08, 0xa4, 0x63, 0xa1, 0x3a, 0x48, 0x8b, 0xdb, 0xc0, 0xb3, 0xfc, 0x9b, 0xff, 0x73, 0x6a, 0x51, 0x81 } },
+        { { 0x19, 0x67, 0xa1, 0x8a, 0x27, 0x34, 0x8a, 0xe4, 0x9c, 0xf7, 0xfc, 0x50, 0xac, 0x84, 0x2e, 0x1b, 0x6a, 0x67, 0x75, 0x6b, 0x72, 0x4e, 0xee, 0x11, 0xee, 0x58, 0x15, 0xa5, 0x37, 0xeb, 0xae, 0x1c },
+          { 0x00, 0x74, 0xc8, 0x21, 0x23, 0xb4, 0x38, 0xea, 0x9d, 0x2b, 0xb5, 0x08, 0x4a, 0x10, 0x3a, 0xfc, 0xb1, 0x28, 0xe4, 0x62, 0x5a, 0x86, 0x90, 0x35, 0x7f, 0xba, 0xab, 0x44, 0x0c, 0x99, 0x03, 0x4b } },
+        { { 0x17, 0xde, 0x07, 0xe6, 0x23, 0xc5, 0x1c, 0xc8, 0x57, 0xd1, 0xca, 0xb4, 0xb8, 0x0d, 0xb7, 0x03, 0x6c, 0x61, 0x32, 0x38, 0x8e, 0x9c, 0x50, 0x61, 0xac, 0x5a, 0x4a, 0x83, 0x5c, 0x45, 0x5c, 0xdd },
+          { 0x0e, 0x41, 0xae, 0x9d, 0x6b, 0x3d, 0xab, 0x16, 0x4d, 0x56, 0x2a, 0x46, 0xf2, 0x76, 0xa2, 0x83, 0x0b, 0x18, 0xb8, 0xe1, 0xe9, 0xe8, 0xdd, 0x28, 0xcd, 0xdf, 0xbb, 0x10, 0x95, 0x5d, 0xc1, 0x65 } },
+        { { 0x10, 0x3a, 0x02, 0x53, 0x57, 0x2b, 0x6d, 0x96, 0xe5, 0x3a, 0xaa, 0x92, 0x1f, 0x92, 0x94, 0x9a, 0xce, 0x4c, 0x6f, 0xc0, 0xf7, 0x78, 0xe8, 0xba, 0x12, 0xdd, 0x42, 0xba, 0xda, 0xa4, 0xf2, 0xe1 },
+          { 0x34, 0x37, 0x64, 0x55, 0xf2, 0x72, 0xe8, 0xa9, 0x20, 0x1b, 0xd0, 0x43, 0x9f, 0x79, 0x4a, 0x64, 0xe1, 0xd0, 0xdd, 0x9d, 0x32, 0x0e, 0x5e, 0x70, 0x49, 0x76, 0x31, 0x4f, 0x99, 0x1f, 0xf5, 0x35 } },
+        { { 0x3d, 0xd7, 0xaa, 0x6b, 0x1f, 0x30, 0x6b, 0x1f, 0x5b, 0x58, 0x2a, 0x25, 0x90, 0xc0, 0x39, 0x8b, 0xcd, 0xb2, 0xde, 0x03, 0xfb, 0xa7, 0x39, 0x03, 0x04, 0x18, 0x9e, 0x34, 0x64, 0xe5, 0x3f, 0x38 },
+          { 0x24, 0x4e, 0xf8, 0x48, 0x33, 0x5b, 0x08, 0x61, 0xc1, 0xff, 0x95, 0x3e, 0xf2, 0x9b, 0xfa, 0x5c, 0x85, 0x36, 0xcd, 0x72, 0x52, 0x70, 0x9b, 0x6d, 0xd7, 0xaf, 0x98, 0x51, 0xb0, 0x07, 0x3a, 0x71 } },
+        { { 0x1f, 0x44, 0x6e, 0xd3, 0x0b, 0xa4, 0x8c, 0xe4, 0x2e, 0x3f, 0x23, 0x78, 0x4f, 0xfc, 0x49, 0xb6, 0x33, 0xd5, 0xe2, 0x4e, 0x8c, 0x64, 0x75, 0x3a, 0x84, 0xf2, 0x1c, 0xc6, 0x54, 0x00, 0xd8, 0xc2 },
+          { 0x20, 0x1b, 0x4e, 0x67, 0xf3, 0x9c, 0x51, 0xf7, 0x8b, 0x14, 0x5d, 0x2d, 0x6f, 0xff, 0x3c, 0xe1, 0xf2, 0x90, 0x69, 0x8f, 0x75, 0x46, 0xc8, 0xe1, 0xe3, 0x8e, 0x10, 0xea, 0x81, 0xdc, 0x5b, 0x8c } },
+        { { 0x10, 0xc6, 0xd1, 0x9f, 0x35, 0x4d, 0x68, 0x08, 0x9b, 0xf8, 0x0d, 0x3f, 0x61, 0xb0, 0xa3, 0xa7, 0x21, 0x9f, 0xb8, 0x17, 0xf9, 0x9b, 0x1c, 0xd2, 0x3e, 0x93, 0x85, 0x6c, 0xb9, 0xdd, 0x00, 0xad },
+          { 0x0d, 0x62, 0x59, 0x3b, 0x5f, 0x5b, 0x88, 0x74, 0xb0, 0x7c, 0x5f, 0x54, 0x2f, 0xd1, 0xf0, 0x79, 0x65, 0xcf, 0x1f, 0x41, 0x2f, 0x1a, 0xd9, 0x4c, 0x44, 0xb5, 0x9e, 0x22, 0x1f, 0x69, 0x62, 0x48 } },
+        { { 0x3c, 0xe2, 0xd4, 0x78, 0xbe, 0xf9, 0xb4, 0xbc, 0xf9, 0xa8, 0x61, 0x41, 0x70, 0xc5, 0x00, 0x81, 0x10, 0x0d, 0x43, 0x5f, 0xad, 0xb6, 0x4f, 0x5f, 0x28, 0xcf, 0x91, 0x35, 0x63, 0xbe, 0xd3, 0x9b },
+          { 0x09, 0x61, 0xc0, 0x36, 0xea, 0xba, 0x2b, 0x26, 0x4e, 0x14, 0xd4, 0x4a, 0xf3, 0x73, 0xee, 0x16, 0xc5, 0xbd, 0xe0, 0xc6, 0xa1, 0x52, 0x76, 0xca, 0x7e, 0x1e, 0x1e, 0x86, 0x2f, 0x38, 0x84, 0x55 } }
+    },
+    {
+        { { 0x1d, 0x30, 0x84, 0x50, 0x1b, 0x94, 0x9d, 0x6f, 0x66, 0xc9, 0x92, 0x82, 0xe5, 0xe1, 0xd9, 0xab, 0x7b, 0xa4, 0xac, 0x07, 0xfa, 0x9e, 0xa4, 0x2f, 0x59, 0xa5, 0xdb, 0xbf, 0x88, 0xdd, 0x2d, 0x3d },
+          { 0x24, 0xc8, 0x01, 0xf8, 0x48, 0x0c, 0xc9, 0x0c, 0x4b, 0xb8, 0x37, 0x6f, 0x2c, 0x66, 0x28, 0x3d, 0xb9, 0x72, 0xbb, 0xec, 0xa3, 0xce, 0xc4, 0x62, 0xd1, 0x5a, 0xb9, 0x81, 0x03, 0x22, 0x59, 0xc4 } },
+        { { 0x37, 0x46, 0x2e, 0x3a, 0x29, 0xc1, 0x42, 0x14, 0x1d, 0xd4, 0xca, 0xed, 0xac, 0xeb, 0xd9, 0x50, 0xd9, 0x2b, 0x3d, 0x6b, 0x77, 0xc8, 0xc7, 0x5d, 0xb8, 0x41, 0x21, 0x0c, 0x24, 0x45, 0x6e, 0xc4 },
+          { 0x08, 0x5e, 0xe7, 0xea, 0x5c, 0x69, 0x2b, 0x39, 0x00, 0x8a, 0x0d, 0xf4, 0xb9, 0xd0, 0xd7, 0xcd, 0xce, 0xd1, 0x88, 0x7a, 0x63, 0xbc, 0xa7, 0xdd, 0xf2, 0x53, 0x03, 0x14, 0x65, 0x9a, 0xab, 0x63 } },
+        { { 0x2f, 0x23, 0x74, 0xae, 0xb7, 0x96, 0x5c, 0x74, 0xc0, 0xbd, 0x92, 0x69, 0x29, 0xed, 0x07, 0x83, 0x3b, 0x6b, 0xdd, 0x8a, 0x83, 0xb3, 0x3f, 0x56, 0x06, 0x5a, 0x2d, 0xe8, 0x86, 0x55, 0xe4, 0xf3 },
+          { 0x37, 0xca, 0x97, 0x24, 0xed, 0x3f, 0xd1, 0xa1, 0x54, 0x45, 0xae, 0x49, 0x24, 0x4c, 0x40, 0xcd, 0xec, 0x69, 0x1a, 0xfa, 0x67, 0x48, 0xac, 0xc7, 0x7b, 0x9a, 0x61, 0x33, 0xf2, 0x74, 0xa6, 0x72 } },
+        { { 0x1a, 0xd1, 0x0e, 0xc0, 0x16, 0xf6, 0xa5, 0xcf, 0x3a, 0x53, 0x9a, 0x71, 0x53, 0x7f, 0x88, 0x69, 0x73, 0xc2, 0x84, 0x9c, 0xca, 0x39, 0x7f, 0xca, 0x13, 0x0f, 0x5d, 0xd8, 0x98, 0xfa, 0x4e, 0x9b },
+          { 0x05, 0x6a, 0x73, 0x32, 0xd7, 0xdc, 0x98, 0xc8, 0x3d, 0x82, 0xec, 0x10, 0xe9, 0x50, 0xc6, 0x13, 0x45, 0xb2, 0xc8, 0x36, 0xcf, 0xd1, 0x1e, 0x46, 0xcd, 0x2d, 0x99, 0xd6, 0x2f, 0x18, 0x98, 0x05 } },
+        { { 0x07, 0x6c, 0x03, 0x3e, 0xe0, 0xda, 0x9d, 0x2d, 0x22, 0xcc, 0x3d, 0xe9, 0x34, 0x63, 0x48, 0x50, 0xff, 0xdc, 0xb3, 0xe0, 0xa6, 0x29, 0x9a, 0x6c, 0xd0, 0x2a, 0xf5, 0x57, 0x58, 0x6a, 0x63, 0xed },
+          { 0x06, 0xc0, 0x46, 0xc3, 0x08, 0xbf, 0x33, 0xb4, 0x7a, 0xa4, 0x54, 0x9a, 0x47, 0x80, 0x02, 0x61, 0xd8, 0xfe, 0x8b, 0x51, 0xbc, 0xfd, 0xa7, 0xbd, 0x21, 0xda, 0x8e, 0xe6, 0x17, 0x80, 0xcf, 0x85 } },
+        { { 0x17, 0xe8, 0xf7, 0xb2, 0x81, 0xc9, 0x15, 0xc5, 0x5b, 0x79, 0xf7, 0xa3, 0x32, 0x4f, 0x26, 0x51, 0x6c, 0x49, 0x3a, 0xdd, 0x86, 0x7a, 0xed, 0x44, 0xa7, 0xf9, 0xa3, 0x9e, 0xc2, 0xa3, 0x25, 0xda },
+          { 0x2c, 0x7d, 0xb1, 0x78, 0xc2, 0x96, 0x24, 0x52, 0x51, 0x0c, 0xde, 0x1c, 0x4e, 0x28, 0xf8, 0xf9, 0x6e, 0xc6, 0xf5, 0x85, 0xbc, 0x60, 0x5e, 0x9a, 0x1b, 0x4d, 0x45, 0x97, 0xfa, 0xbe, 0x04, 0x38 } },
+        { { 0x31, 0xc5, 0x98, 0xe6, 0xc3, 0x83, 0x70, 0xdb, 0x19, 0x85, 0x6f, 0xdf, 0xd4, 0xca, 0xd7, 0xc9, 0x51, 0xb9, 0xaf, 0x0c, 0x17, 0x39, 0xc8, 0x44, 0xdf, 0xb7, 0xd5, 0x57, 0x51, 0x8c, 0xd9, 0xc3 },
+          { 0x31, 0x6a, 0x97, 0x55, 0x4f, 0x04, 0x27, 0x1a, 0x3b, 0x65, 0x0f, 0xe9, 0x15, 0x34, 0xa3, 0x88, 0x74, 0x71, 0xcc, 0xd0, 0xce, 0x37, 0xc0, 0xfe, 0x48, 0x09, 0xa5, 0x27, 0x4b, 0x07, 0x38, 0xad } },
+        { { 0x01, 0xd0, 0xfb, 0x4b, 0xa8, 0x2f, 0xb2, 0x28, 0x12, 0xb5, 0x8f, 0x8a, 0x82, 0x22, 0xf1, 0x82, 0x07, 0x8b, 0x84, 0x6b, 0xde, 0x82, 0x72, 0x5a, 0x79, 0xd4, 0xf7, 0x03, 0x18, 0x51, 0x38, 0xb0 },
+          { 0x1d, 0xb8, 0xb1, 0x9f, 0x40, 0x85, 0x48, 0xb2, 0x3b, 0xc1, 0xf2, 0xd3, 0x65, 0xa6, 0x72, 0x8d, 0x75, 0x37, 0x08, 0x19, 0xba, 0x40, 0x96, 0x93, 0x97, 0x77, 0x2b, 0xf9, 0xda, 0x59, 0x3c, 0x0c } }
+    },
+    {
+        { { 0x20, 0x91, 0xb4, 0x6f, 0x18, 0xbd, 0x94, 0x19, 0x9d, 0x75, 0xa7, 0x97, 0x9b, 0x31, 0x29, 0x45, 0x18, 0x17, 0x43, 0x7d, 0x47, 0xa8, 0x63, 0xd7, 0x6c, 0xd6, 0xa4, 0xfd, 0x39, 0xf7, 0xc9, 0x9a },
+          { 0x07, 0x72, 0x07, 0xf9, 0x44, 0x50, 0x9a, 0x0d, 0x50, 0x88, 0x0e, 0x71, 0xad, 0x12, 0xa7, 0x0a, 0x0b, 0xec, 0x37, 0x14, 0xe5, 0x74, 0xf6, 0x40, 0x69, 0x44, 0xb4, 0xeb, 0xe7, 0x4b, 0x42, 0x66 } },
+        { { 0x16, 0x28, 0xb3, 0xd5, 0xf1, 0x6b, 0xe6, 0xb9, 0x48, 0x0a, 0xa0, 0x65, 0x93, 0xcb, 0xdc, 0x0a, 0xaf, 0x8d, 0x79, 0x13, 0x38, 0x8b, 0xaa, 0xc2, 0xc5, 0xb1, 0x52, 0xa1, 0x8c, 0x59, 0x21, 0x53 },
+          { 0x1f, 0x62, 0x5c, 0x21, 0x5d, 0xdc, 0x19, 0xf7, 0x7b, 0xa2, 0xd3, 0x24, 0x58, 0xbc, 0x1d, 0x9f, 0x04, 0x2e, 0xe0, 0x87, 0x0e, 0x6c, 0xef, 0x89, 0x41, 0x4d, 0x78, 0x6e, 0xdb, 0x9f, 0x9c, 0xce } },
+        { { 0x11, 0x45, 0x77, 0x56, 0x09, 0x29, 0xd3, 0xf1, 0x07, 0x7d, 0xec, 0xfd, 0x4f, 0x4a, 0xe0, 0xf3, 0x8f, 0x42, 0x81, 0xb8, 0x23, 0x1d, 0x34, 0xb2, 0xa9, 0x8c, 0xbe, 0x08, 0x10, 0x86, 0x3f, 0x67 },
+          { 0x31, 0x20, 0x6d, 0x50, 0x2d, 0x50, 0x7c, 0x8c, 0x87, 0xc8, 0x03, 0xbb, 0x5b, 0x60, 0x61, 0xeb, 0x76, 0xfc, 0xc4, 0xdd, 0x33, 0x31, 0xa6, 0x17, 0xda, 0x89, 0xfa, 0x35, 0x1e, 0xe7, 0xfa, 0x31 } },
+        { { 0x36, 0x15, 0x03, 0x07, 0x92, 0xd6, 0x12, 0xef, 0x4c, 0x3d, 0x64, 0xe7, 0x17, 0xc2, 0x3f, 0x0c, 0x2b, 0x0b, 0x27, 0x79, 0xbb, 0xda, 0x0d, 0xe7, 0x73, 0xfd, 0xaa, 0xbb, 0x29, 0xf8, 0x51, 0xb1 },
+          { 0x36, 0x4d, 0xdd, 0xbe, 0x5c, 0x9a, 0xbf, 0x01, 0x67, 0x8f, 0x18, 0x1b, 0x67, 0xb5, 0xb3, 0x66, 0xae, 0x9f, 0xa3, 0xd4, 0x6e, 0x50, 0xa5, 0x03, 0x5b, 0x5c, 0x45, 0x51, 0xcc, 0x04, 0x95, 0x72 } },
+        { { 0x2b, 0x11, 0xcc, 0xf2, 0xf8, 0x19, 0xaf, 0x6f, 0x57, 0x68, 0x04, 0x68, 0x8d, 0x8b, 0x1e, 0xf9, 0xca, 0x8f, 0xae, 0x99, 0xcf, 0x39, 0x9c, 0x08, 0xa1, 0x99, 0x85, 0xc3, 0xe6, 0x5e, 0x5f, 0x69 },
+          { 0x17, 0xe1, 0x45, 0xba, 0xdb, 0x10, 0x28, 0x7a, 0x6a, 0x81, 0x98, 0x16, 0xf5, 0x91, 0xb5, 0x29, 0xf9, 0xc5, 0x95, 0x04, 0xaf, 0xb5, 0xe5, 0x1f, 0xf4, 0x48, 0x11, 0xcf, 0xe5, 0x8f, 0xa8, 0x32 } },
+        { { 0x3e, 0xb2, 0xa1, 0x6b, 0x62, 0x5a, 0x1f, 0xec, 0xbc, 0xf1, 0xa2, 0xca, 0x1c, 0x3a, 0x7b, 0x0c, 0x34, 0x40, 0x64, 0x87, 0x89, 0x66, 0x14, 0x42, 0x85, 0x03, 0x60, 0x0d, 0x3d, 0xf1, 0xaf, 0xe4 },
+          { 0x1c, 0x4b, 0x4e, 0xaf, 0x7e, 0x78, 0xfb, 0x38, 0x21, 0x6f, 0x1c, 0x6f, 0xb9, 0x65, 0x49, 0x3a, 0xe3, 0xd9, 0x41, 0x69, 0xb4, 0xea, 0xf0, 0x4c, 0xaf, 0x3c, 0xa5, 0x41, 0xa1, 0xa6, 0xe1, 0xeb } },
+        { { 0x34, 0xe4, 0x50, 0x70, 0x47, 0x45, 0x17, 0x9d, 0x81, 0x57, 0x1a, 0xf5, 0xf9, 0x27, 0xc0, 0x07, 0xa8, 0x03, 0xca, 0xae, 0xb6, 0x40, 0xd4, 0x81, 0x35, 0xff, 0x28, 0x89, 0x0b, 0xae, 0x48, 0xda },
+          { 0x37, 0xd1, 0xce, 0x87, 0x79, 0x6e, 0x39, 0xe5, 0x1d, 0x89, 0x72, 0xfd, 0xcb, 0xa5, 0x3e, 0x8a, 0x83, 0xa2, 0x8e, 0x2f, 0xd5, 0xb8, 0xd8, 0x95, 0x3d, 0xfe, 0x34, 0xf8, 0x43, 0x16, 0xd5, 0xcc } },
+        { { 0x04, 0x6b, 0xf0, 0x21, 0xa0, 0x19, 0x2f, 0x5f, 0x05, 0x4a, 0x07, 0x88, 0xd7, 0x1a, 0xab, 0x16, 0xee, 0x86, 0x91, 0x36, 0x79, 0xe1, 0x17, 0x49, 0xeb, 0x0e, 0x3e, 0x29, 0xb6, 0x10, 0xda, 0x9d },
+          { 0x06, 0xa9, 0x71, 0xde, 0x51, 0xc2, 0xdb, 0x34, 0x57, 0xb4, 0xe7, 0xb9, 0x98, 0x6a, 0x52, 0xc5, 0xbb, 0x9b, 0xb1, 0x1f, 0x66, 0xc2, 0x82, 0x3a, 0x2d, 0x25, 0xef, 0x14, 0xd2, 0xbe, 0xa3, 0x65 } }
+    },
+    {
+        { { 0x29, 0x35, 0xee, 0x47, 0x0d, 0x5b, 0x7d, 0xc5, 0xf7, 0x2f, 0x63, 0xeb, 0x3a, 0x04, 0xc9, 0xde, 0xcc, 0xf7, 0x27, 0xf4, 0x67, 0x53, 0x09, 0x42, 0x6d, 0xc7, 0x01, 0x7d, 0x99, 0xe7, 0x7f, 0xc7 },
+          { 0x2c, 0x4d, 0x66, 0x79, 0x2c, 0x2e, 0x7a, 0x1b, 0xcd, 0x9e, 0xcb, 0x57, 0xe3, 0xf7, 0x26, 0x79, 0xda, 0x44, 0x6d, 0x2b, 0xc3, 0xd7, 0x5c, 0xb4, 0x5f, 0x8d, 0x04, 0xb6, 0xcf, 0xa6, 0xb7, 0x06 } },
+        { { 0x08, 0xa2, 0x60, 0xb5, 0xae, 0x60, 0x59, 0xac, 0x98, 0x0d, 0x6e, 0x32, 0x10, 0x67, 0x62, 0x9f, 0xff, 0x50, 0x8d, 0x58, 0x5d, 0x2b, 0x24, 0x62, 0xf1, 0xde, 0x00, 0x65, 0xe3, 0xcd, 0xe0, 0x66 },
+          { 0x01, 0xee, 0xf3, 0x96, 0x47, 0x5b, 0xa9, 0x73, 0x6d, 0xfe, 0x22, 0x75, 0x94, 0xda, 0x0f, 0x25, 0x5b, 0x3d, 0x00, 0xfd, 0x94, 0x3c, 0x0b, 0xda, 0x94, 0xbd, 0x79, 0x93, 0x3d, 0x33, 0xab, 0x60 } },
+        { { 0x1e, 0x14, 0xfe, 0x8d, 0x40, 0xab, 0xaa, 0x75, 0x65, 0xb0, 0x86, 0x09, 0x14, 0x9b, 0x6d, 0x5d, 0xc6, 0xb5, 0xe2, 0x80, 0x87, 0x0b, 0x4f, 0x44, 0xd6, 0xdc, 0x74, 0xaa, 0x6e, 0x5c, 0xf5, 0xda },
+          { 0x30, 0xff, 0x80, 0xc4, 0xa7, 0x06, 0xfd, 0x85, 0xc3, 0x57, 0x8c, 0xe3, 0x1d, 0x81, 0xdb, 0x46, 0x76, 0xf0, 0x18, 0x2b, 0x9e, 0x57, 0x52, 0x26, 0xc4, 0xcb, 0x4a, 0x35, 0x34, 0xc9, 0x80, 0x25 } },
+        { { 0x2b, 0x75, 0xd0, 0x78, 0xe0, 0xa1, 0xb5, 0x8f, 0x15, 0xae, 0x09, 0xe2, 0x92, 0xd7, 0xcd, 0xda, 0x26, 0xa1, 0xeb, 0xc9, 0x6d, 0xa7, 0x56, 0x1f, 0xb0, 0x68, 0xe7, 0x05, 0x80, 0x0e, 0xdf, 0x1f },
+          { 0x3d, 0x63, 0x6f, 0xf1, 0x66, 0xdc, 0x58, 0xf1, 0x84, 0x84, 0x28, 0xc5, 0x0e, 0x68, 0x99, 0xf9, 0xe4, 0xb4, 0x6d, 0xd4, 0x96, 0xf3, 0x01, 0x21, 0x73, 0x16, 0xbc, 0xa6, 0xda, 0x80, 0x2a, 0x1a } },
+        { { 0x09, 0x4a, 0x47, 0x47, 0xc4, 0x37, 0x25, 0xe6, 0x01, 0x09, 0x54, 0x30, 0x55, 0x9d, 0x1a, 0x98, 0x57, 0x79, 0x1d, 0x52, 0x87, 0x0b, 0xcc, 0x73, 0x74, 0xb6, 0xc9, 0x38, 0xc8, 0x75, 0x28, 0xe6 },
+          { 0x30, 0x6a, 0xe3, 0x7c, 0x28, 0x21, 0x37, 0xb6, 0x63, 0xa5, 0x6a, 0x67, 0x49, 0xe2, 0x47, 0x28, 0xf3, 0xdc, 0x9d, 0x3e, 0xdf, 0x93, 0xcd, 0x47, 0x99, 0x8a, 0x62, 0x3c, 0x15, 0x8d, 0x1d, 0x56 } },
+        { { 0x16, 0x4a, 0xaf, 0x01, 0xff, 0xf4, 0xa2, 0xf2, 0x1a, 0x1c, 0xe9, 0x09, 0x7c, 0xe6, 0xfb, 0x71, 0x3f, 0x31, 0x3d, 0x0a, 0x56, 0x52, 0x2e, 0x67, 0xa4, 0x4f, 0xbf, 0x22, 0x66, 0xfd, 0xcf, 0xf7 },
+          { 0x23, 0x5d, 0xd2, 0x14, 0x6f, 0x89, 0x93, 0x7c, 0xbd, 0x10, 0xa6, 0x39, 0x57, 0x94, 0x2b, 0x85, 0x3e, 0x61, 0x2f, 0x65, 0x31, 0x2d, 0xe8, 0x87, 0x82, 0x9b, 0x36, 0xbb, 0xb8, 0x9d, 0x99, 0x97 } },
+        { { 0x33, 0xa9, 0x29, 0x58, 0x28, 0x84, 0x00, 0x74, 0x7c, 0xe6, 0x4a, 0x8e, 0x5b, 0xba, 0xce, 0x51, 0x04, 0xb0, 0xad, 0x32, 0x11, 0x1b, 0x9b, 0xed, 0xbd, 0x03, 0x3f, 0x1d, 0xc7, 0x33, 0xce, 0xd5 },
+          { 0x17, 0xd4, 0x9f, 0x75, 0x3e, 0x93, 0x98, 0x32, 0x57, 0x6a, 0x34, 0x55, 0x66, 0x01, 0x11, 0x6c, 0xd5, 0x84, 0xd1, 0x63, 0x99, 0x10, 0xa4, 0x7a, 0xe1, 0x6e, 0x91, 0x27, 0xac, 0x61, 0xb4, 0x1e } },
+        { { 0x1c, 0xb2, 0xda, 0xfe, 0x1b, 0x4a, 0x11, 0x21, 0x32, 0xfb, 0xdd, 0xa1, 0xf8, 0x52, 0x78, 0xb7, 0x74, 0xa8, 0xaa, 0x6d, 0xb3, 0xa9, 0xce, 0x2e, 0xe1, 0x3d, 0x5f, 0xe0, 0xc5, 0xdc, 0x18, 0x92 },
+          { 0x1b, 0x05, 0x42, 0x5c, 0x98, 0x3e, 0x09, 0xc2, 0x2a, 0x9b, 0x36, 0x33, 0x71, 0xe4, 0x97, 0x3b, 0x18, 0x34, 0xe2, 0x8b, 0xf3, 0x1e, 0x37, 0xe5, 0xe9, 0x7c, 0xaa, 0x7f, 0xd3, 0x5f, 0x0b, 0x41 } }
+    },
+    {
+        { { 0x0a, 0x9d, 0xd3, 0x4a, 0x17, 0x3d, 0xc0, 0x5f, 0x30, 0x9a, 0x46, 0xd2, 0xe9, 0x5f, 0x82, 0x77, 0x63, 0x46, 0x69, 0x48, 0x87, 0xa1, 0x5e, 0x84, 0xb2, 0x37, 0x64, 0xde, 0xb0, 0xa3, 0x57, 0x1f },
+          { 0x26, 0x23, 0x46, 0x7a, 0x1c, 0xe5, 0x04, 0x08, 0x13, 0x82, 0x95, 0xea, 0x3c, 0xea, 0x0f, 0xac, 0x7f, 0x41, 0x38, 0x6b, 0x81, 0xf8, 0x7e, 0x69, 0xa8, 0x34, 0x8e, 0x1a, 0x06, 0x7d, 0x74, 0x52 } },
+        { { 0x15, 0x2e, 0x75, 0xf2, 0x07, 0xf0, 0x87, 0xb8, 0x6c, 0x59, 0x22, 0xf6, 0xa3, 0x9a, 0x7e, 0xfd, 0xfa, 0x38, 0x33, 0xfb, 0x04, 0x98, 0xcb, 0xfe, 0x7c, 0xc2, 0x0f, 0x94, 0xba, 0x5b, 0xca, 0xbb },
+          { 0x19, 0x9e, 0x44, 0x41, 0x50, 0xf1, 0x64, 0x46, 0xf3, 0xd9, 0xc3, 0x4e, 0x58, 0x28, 0xbb, 0xf4, 0x4b, 0x88, 0x6d, 0x79, 0x30, 0xfd, 0xcd, 0x07, 0x74, 0xeb, 0x43, 0x9a, 0x92, 0xd2, 0xa0, 0xd4 } },
+        { { 0x13, 0xe4, 0x02, 0x88, 0xa5, 0x80, 0x8d, 0x1f, 0x98, 0x2a, 0x2e, 0xea, 0xf8, 0x5f, 0xa1, 0x36, 0x87, 0x52, 0xf8, 0x28, 0x67, 0x36, 0xef, 0x35, 0x1c, 0x08, 0xdf, 0x14, 0xe5, 0x47, 0xe2, 0xd0 },
+          { 0x01, 0xa9, 0x2f, 0x23, 0x5b, 0x4c, 0x3c, 0x78, 0x92, 0xd2, 0x09, 0xaf, 0x91, 0xe2, 0x90, 0xe3, 0xc9, 0xe9, 0x64, 0xbe, 0x84, 0x9f, 0xfa, 0x6c, 0xca, 0x89, 0x02, 0x3f, 0xca, 0x72, 0x0a, 0x3d } },
+        { { 0x05, 0xb4, 0x7f, 0x14, 0xc0, 0x0b, 0xb9, 0x1f, 0xb9, 0xcc, 0xa1, 0x34, 0xf6, 0x9d, 0xeb, 0x91, 0xb7, 0x6d, 0x6d, 0x27, 0x59, 0xf0, 0x13, 0x1e, 0xec, 0x1d, 0xff, 0xab, 0x38, 0x53, 0x40, 0x77 },
+          { 0x13, 0xfb, 0xac, 0x72, 0x44, 0xb4, 0xee, 0x59, 0x15, 0x28, 0x66, 0xa3, 0x06, 0xe4, 0x6c, 0xeb, 0xf3, 0x25, 0x15, 0x26, 0x19, 0x11, 0x6d, 0xb1, 0xcc, 0x3a, 0xc7, 0xff, 0x28, 0x4d, 0xdb, 0x2f } },
+        { { 0x19, 0x2e, 0xf6, 0x6d, 0xc0, 0x80, 0x13, 0xc4, 0x0a, 0x9a, 0xb8, 0x3c, 0xb8, 0x0c, 0x4a, 0xf1, 0x5c, 0x3e, 0xf8, 0x97, 0x5b, 0x74, 0x2e, 0x67, 0x81, 0x89, 0x7b, 0x15, 0x7f, 0x59, 0x40, 0x44 },
+          { 0x17, 0x86, 0x49, 0x39, 0x7d, 0x8d, 0xc7, 0xd9, 0xe4, 0xaa, 0x72, 0x4e, 0x78, 0xb3, 0xb3, 0x59, 0x56, 0x1d, 0xc9, 0x1c, 0x9a, 0x37, 0xca, 0x2a, 0x64, 0x98, 0xa8, 0x5d, 0x41, 0x82, 0x65, 0xde } },
+        { { 0x0b, 0x72, 0xc7, 0x09, 0x93, 0x09, 0x3e, 0x08, 0x98, 0xb1, 0x58, 0x73, 0x63, 0x53, 0x69, 0xf9, 0x9f, 0x04, 0x55, 0x0d, 0xe0, 0x01, 0x5c, 0x7f, 0x15, 0xd1, 0x3d, 0xa0, 0x0e, 0x6f, 0xcf, 0x19 },
+          { 0x3b, 0x1a, 0x9f, 0x68, 0x53, 0x95, 0x5e, 0x18, 0x73, 0xef, 0x3d, 0xd1, 0x7a, 0x80, 0x4c, 0x18, 0x35, 0x47, 0xcb, 0x49, 0x0c, 0x91, 0x56, 0xeb, 0x61, 0x43, 0xc9, 0x68, 0xc1, 0xdd, 0x1e, 0x59 } },
+        { { 0x0a, 0x66, 0x96, 0xaf, 0x1c, 0x67, 0xf3, 0x98, 0x69, 0x2f, 0x3f, 0xf7, 0x12, 0x84, 0x8e, 0x2a, 0xb3, 0x75, 0x12, 0x92, 0x03, 0x1d, 0x9b, 0xbc, 0x0c, 0x96, 0x78, 0x94, 0x70, 0x14, 0x3a, 0xee },
+          { 0x2d, 0x72, 0x4d, 0x71, 0xaa, 0xf4, 0x77, 0x37, 0x53, 0xdb, 0x19, 0xc5, 0xbd, 0xbc, 0x8e, 0x48, 0xe5, 0x8f, 0xde, 0x17, 0x83, 0x97, 0x03, 0x10, 0x4d, 0xb8, 0x49, 0xf6, 0xec, 0x42, 0x88, 0xfc } },
+        { { 0x0c, 0x65, 0xb2, 0x76, 0xd9, 0xab, 0x07, 0x12, 0xbe, 0x3b, 0xc1, 0xec, 0xb4, 0xe7, 0xb7, 0xed, 0xa3, 0x42, 0x2b, 0x5f, 0x3d, 0xfa, 0xd3, 0x2c, 0xe4, 0x71, 0xb1, 0xf3, 0x92, 0xf3, 0x5d, 0xbe },
+          { 0x21, 0x25, 0xcf, 0x76, 0xbd, 0x94, 0xbf, 0x9b, 0x82, 0x2e, 0xb9, 0xa6, 0xb6, 0xd5, 0x63, 0xdb, 0xb1, 0xad, 0xc2, 0xcd, 0xeb, 0x48, 0xaf, 0x43, 0x8d, 0x1a, 0x25, 0xe8, 0xaa, 0xa5, 0x21, 0x4a } }
+    },
+    {
+        { { 0x26, 0x22, 0x8c, 0x60, 0x64, 0xb3, 0xb0, 0x10, 0x76, 0x08, 0x5d, 0xd5, 0x03, 0x53, 0x5c, 0xe5, 0x24, 0x56, 0xae, 0xa1, 0x1a, 0x85, 0x3a, 0x0a, 0x95, 0x2e, 0xf0, 0xbe, 0xa6, 0x8a, 0x09, 0xff },
+          { 0x35, 0xcf, 0x5e, 0xc1, 0x66, 0x6b, 0x13, 0xe8, 0xb7, 0x72, 0x4a, 0xe1, 0x15, 0x39, 0x74, 0xab, 0x26, 0x78, 0x81, 0x7e, 0x92, 0x9c, 0x18, 0xbe, 0xe9, 0x01, 0x4c, 0x1a, 0x67, 0xf2, 0x04, 0xb9 } },
+        { { 0x14, 0xa3, 0x92, 0x09, 0xa9, 0x87, 0x7e, 0x62, 0x64, 0x42, 0x49, 0xa1, 0xcc, 0x51, 0xf7, 0x98, 0x27, 0xaa, 0xdc, 0x56, 0x9a, 0xbd, 0x50, 0x7e, 0xf6, 0xb0, 0x71, 0xdf, 0xe4, 0xaf, 0x86, 0x7f },
+          { 0x33, 0x22, 0xb6, 0xcc, 0x86, 0xe9, 0x39, 0x60, 0x43, 0x78, 0x5f, 0x65, 0x37, 0xc7, 0x42, 0x27, 0x04, 0xa1, 0x24, 0x62, 0xa0, 0x07, 0xa7, 0x9b, 0x0d, 0x6d, 0xff, 0x94, 0xd6, 0xd9, 0xf2, 0xd0 } },
+        { { 0x1d, 0x91, 0x5a, 0x5f, 0xda, 0x10, 0x81, 0x4f, 0xba, 0x6e, 0x16, 0x6b, 0xc2, 0x6d, 0x7f, 0xe0, 0x86, 0x68, 0x1a, 0x13, 0x14, 0x22, 0x37, 0xe6, 0x61, 0x7f, 0x66, 0x39, 0xb7, 0x04, 0x55, 0x14 },
+          { 0x2c, 0xba, 0x61, 0xde, 0x6f, 0x03, 0x38, 0xd4, 0xad, 0xa3, 0x76, 0xdc, 0x22, 0x70, 0x24, 0x59, 0xbc, 0x7d, 0x55, 0xce, 0xd2, 0xb7, 0x3c, 0x45, 0x38, 0x28, 0x3b, 0x12, 0x9e, 0xcf, 0x1a, 0xfa } },
+        { { 0x38, 0xc7, 0x72, 0xc3, 0x93, 0x6c, 0x8f, 0xba, 0x93, 0x95, 0xcd, 0x0d, 0x11, 0xce, 0xaa, 0x14, 0x3f, 0x73, 0x86, 0x1a, 0xb9, 0xd4, 0x13, 0x97, 0xff, 0x43, 0x35, 0x71, 0x1e, 0x01, 0x6e, 0x99 },
+          { 0x09, 0x3b, 0xc4, 0x64, 0xac, 0x7e, 0xa9, 0xb1, 0xbd, 0x93, 0xed, 0xf7, 0xc4, 0x14, 0xb3, 0xed, 0x8f, 0xb8, 0x6f, 0xdc, 0x61, 0x36, 0x85, 0x3d, 0x7a, 0x3d, 0xde, 0xb1, 0x06, 0xe4, 0xb3, 0x30 } },
+        { { 0x0b, 0x00, 0xf0, 0xef, 0x73, 0xc1, 0xc8, 0xe0, 0x59, 0xf4, 0x05, 0x52, 0x13, 0xa2, 0x4c, 0xbd, 0x2e, 0x6b, 0x1e, 0x6d, 0xf6, 0xa5, 0x7c, 0x01, 0x39, 0xbd, 0xdd, 0x39, 0x8d, 0xc7, 0x05, 0x6b },
+          { 0x19, 0x93, 0x8a, 0x84, 0x90, 0x75, 0xed, 0xfc, 0x6b, 0x3f, 0x63, 0x79, 0x6c, 0xa9, 0x3a, 0x38, 0x20, 0x14, 0x35, 0x57, 0xb9, 0xe3, 0xb4, 0xf3, 0x14, 0x71, 0x37, 0x04, 0x5d, 0x69, 0x5c, 0xd3 } },
+        { { 0x0a, 0xd5, 0xc0, 0x4b, 0xe1, 0xe5, 0x72, 0xb9, 0xab, 0x8e, 0x5e, 0x1c, 0x2f, 0xf8, 0xf3, 0x7c, 0x04, 0xa2, 0xba, 0x95, 0xfd, 0x30, 0x3b, 0x95, 0xd3, 0x2c, 0x43, 0xe5, 0x52, 0x52, 0x73, 0x6b },
+          { 0x1a, 0xa4, 0xb8, 0xda, 0x47, 0x1b, 0x7c, 0x19, 0x2f, 0xd3, 0xd0, 0xff, 0x85, 0x5a, 0x8e, 0x31, 0x9d, 0x3d, 0xeb, 0x93, 0x92, 0x5a, 0xd0, 0xe3, 0x7b, 0x62, 0xd8, 0xad, 0x40, 0xc4, 0xec, 0xb3 } },
+        { { 0x0d, 0xe9, 0x69, 0x39, 0x3c, 0x73, 0x30, 0x8d, 0x01, 0xb6, 0x54, 0x86, 0xa9, 0xe0, 0x6e, 0xa8, 0x0d, 0x56, 0xa0, 0x9e, 0x72, 0x73, 0x4f, 0x09, 0xf1, 0xc7, 0x3a, 0xdf, 0xb8, 0x4b, 0xe4, 0x92 },
+          { 0x33, 0xe4, 0x33, 0xe9, 0xe9, 0x0a, 0x91, 0xdb, 0xc1, 0x43, 0xe4, 0x67, 0x1a, 0xfa, 0x8d, 0xea, 0x65, 0x9d, 0xbe, 0x16, 0x2b, 0xc8, 0x09, 0x33, 0x73, 0xe8, 0x82, 0x89, 0x89, 0xba, 0xea, 0x13 } },
+        { { 0x2e, 0x30, 0x28, 0x2d, 0xab, 0x76, 0x5b, 0x0d, 0x73, 0xc7, 0x54, 0xde, 0xbd, 0x1b, 0x17, 0xb7, 0xb5, 0x4c, 0x8e, 0x74, 0x3d, 0xf4, 0xef, 0x93, 0x77, 0x21, 0x35, 0x81, 0xec, 0x25, 0x97, 0x70 },
+          { 0x3c, 0x6e, 0x4c, 0xf5, 0xde, 0xee, 0xf9, 0x53, 0x36, 0xae, 0xcf, 0x49, 0x28, 0x6f, 0xf7, 0x79, 0x30, 0x18, 0x1a, 0x31, 0x35, 0x05, 0xfa, 0x89, 0x52, 0xf3, 0xd1, 0x83, 0x1c, 0xb5, 0x97, 0x32 } }
+    },
+    {
+        { { 0x0c, 0x56, 0x0c, 0xe0, 0xdc, 0xcc, 0x98, 0x8f, 0x99, 0xe1, 0xf0, 0x84, 0xe9, 0x7e, 0xe4, 0xfa, 0xfd, 0xf4, 0xa4, 0x3d, 0xd9, 0x5e, 0x89, 0xa0, 0x32, 0x52, 0xe9, 0x0b, 0x78, 0x5e, 0x1a, 0x00 },
+          { 0x21, 0x43, 0x27, 0x7a, 0x98, 0xfb, 0x0f, 0xb9, 0x9b, 0x01, 0xc0, 0x34, 0x76, 0xa3, 0x53, 0xe8, 0xd4, 0x49, 0x11, 0xda, 0xa9, 0x10, 0x5b, 0x21, 0x22, 0x24, 0x58, 0xdf, 0xfa, 0x0f, 0x40, 0x43 } },
+        { { 0x11, 0x82, 0x2c, 0xe4, 0x50, 0xec, 0xbc, 0x4e, 0xac, 0xba, 0x8e, 0x2d, 0x3f, 0xee, 0xc1, 0xe8, 0xa1, 0x46, 0xb8, 0xc8, 0x70, 0x2e, 0xb6, 0x08, 0xa0, 0x39, 0x8e, 0x91, 0x60, 0x19, 0xc6, 0x6c },
+          { 0x26, 0x0a, 0x45, 0x20, 0x35, 0xfb, 0x9a, 0x44, 0xed, 0x1d, 0x89, 0x68, 0x23, 0x6d, 0xae, 0xf7, 0xd0, 0xbc, 0x31, 0xf1, 0xf9, 0x46, 0x69, 0x9f, 0x25, 0x55, 0xd7, 0x25, 0x3d, 0x1d, 0xcd, 0x64 } },
+        { { 0x27, 0x6d, 0x8b, 0x64, 0xf4, 0xa4, 0xf8, 0xfa, 0x36, 0xc9, 0xb9, 0x41, 0xf6, 0xe7, 0x41, 0xc9, 0x9a, 0x67, 0xc7, 0x6e, 0x8a, 0x9b, 0xf1, 0xa1, 0x88, 0x1f, 0x21, 0xb9, 0xa1, 0x46, 0x01, 0x64 },
+          { 0x00, 0x17, 0x52, 0xe4, 0x6a, 0x2f, 0xf2, 0xd9, 0xc8, 0x32, 0x2e, 0x22, 0xb3, 0xca, 0x2f, 0xb7, 0x44, 0xc9, 0xba, 0xb0, 0x21, 0x56, 0x09, 0x28, 0xa6, 0xaa, 0x75, 0x98, 0xa8, 0x61, 0x8f, 0xf8 } },
+        { { 0x3f, 0x4e, 0xa5, 0xa3, 0x09, 0xa3, 0xcc, 0xf8, 0x69, 0x97, 0x1f, 0x25, 0x39, 0x4b, 0xed, 0x0f, 0xd5, 0x7d, 0x7b, 0x32, 0xe5, 0x9b, 0xb9, 0x7b, 0x36, 0xbc, 0x99, 0x5d, 0xf9, 0x87, 0xf3, 0x5f },
+          { 0x27, 0x6c, 0x15, 0x36, 0x00, 0x4a, 0xdf, 0x0f, 0xef, 0xa4, 0x4a, 0xa8, 0x8a, 0xbe, 0xbc, 0xa2, 0x0d, 0x47, 0x05, 0x82, 0x85, 0x83, 0x5d, 0xe9, 0x7d, 0x3e, 0x41, 0xaf, 0x76, 0x9d, 0xb6, 0x83 } },
+        { { 0x04, 0xde, 0x50, 0xaa, 0x4b, 0x11, 0xf7, 0x33, 0x48, 0x4c, 0x43, 0x47, 0x99, 0x60, 0xd5, 0x4b, 0x34, 0x7f, 0x57, 0xc8, 0x98, 0xf9, 0x77, 0x13, 0x12, 0xa3, 0xf1, 0x28, 0xd2, 0x23, 0x78, 0x59 },
+          { 0x27, 0x88, 0x12, 0x54, 0xb6, 0xf5, 0x28, 0x89, 0xa4, 0x9d, 0xf7, 0xa3, 0x2d, 0x11, 0x36, 0xcb, 0x89, 0x96, 0x07, 0xe6, 0xf6, 0xde, 0x65, 0x60, 0xc0, 0x0a, 0xc2, 0xd4, 0x7c, 0xec, 0x87, 0x5a } },
+        { { 0x22, 0x21, 0x55, 0xce, 0xab, 0x68, 0x03, 0x84, 0xe8, 0x09, 0xdb, 0x92, 0xd8, 0x6e, 0x38, 0xbd, 0x2a, 0x2d, 0x2e, 0x29, 0x22, 0x42, 0xe2, 0x11, 0x2d, 0x99, 0x37, 0x81, 0x53, 0xf9, 0xd6, 0x82 },
+          { 0x38, 0xd3, 0x34, 0xfd, 0xf8, 0x45, 0x58, 0x34, 0x08, 0xde, 0xf6, 0xe2, 0x2f, 0xe7, 0xe3, 0xad, 0x79, 0x9b, 0x58, 0x15, 0xd8, 0x0a, 0xd2, 0x41, 0x24, 0x8e, 0xe5, 0x88, 0xd8, 0xf8, 0xc9, 0x65 } },
+        { { 0x39, 0xf0, 0x6f, 0x84, 0x97, 0x21, 0x82, 0x34, 0x33, 0x8d, 0x09, 0x90, 0xae, 0x87, 0x3b, 0x8d, 0x00, 0x1e, 0x42, 0x68, 0x37, 0x8b, 0x98, 0xf1, 0xbf, 0xf8, 0x9f, 0xe1, 0x56, 0x1e, 0x8b, 0xe1 },
+          { 0x1a, 0xca, 0x0a, 0x3f, 0x6d, 0xb1, 0x0f, 0xb8, 0xd3, 0xbe, 0x7a, 0x1d, 0xbf, 0x56, 0x52, 0xda, 0xc5, 0x9e, 0x4e, 0x72, 0x92, 0xca, 0xdf, 0x52, 0x25, 0x54, 0x09, 0xcf, 0xa5, 0x60, 0x05, 0xa3 } },
+        { { 0x1c, 0x3d, 0x27, 0x21, 0x86, 0xe9, 0x4c, 0xb4, 0x9a, 0xbd, 0x55, 0x35, 0xa7, 0x63, 0xb2, 0x6f, 0x51, 0xfc, 0xd6, 0x80, 0x7c, 0x0f, 0x55, 0x22, 0x1f, 0x7f, 0xa6, 0x9d, 0x66, 0x63, 0xc0, 0x06 },
+          { 0x2c, 0x0c, 0x71, 0xee, 0xdc, 0x49, 0x8c, 0xb9, 0xcf, 0x55, 0xda, 0x67, 0xc1, 0x75, 0xa7, 0x3d, 0x92, 0x0e, 0x6a, 0xc2, 0xba, 0x52, 0xbf, 0x15, 0xab, 0xbc, 0x7b, 0x24, 0x1b, 0x9d, 0xdd, 0x68 } }
+    },
+    {
+        { { 0x3d, 0x49, 0x61, 0x21, 0x8f, 0x73, 0xf6, 0x71, 0x07, 0x33, 0xe6, 0x39, 0x98, 0xa2, 0xff, 0x21, 0x5f, 0x3b, 0xf0, 0x07, 0xd3, 0xe5, 0x14, 0xf5, 0x56, 0x74, 0xa3, 0x1a, 0x7b, 0xf6, 0xab, 0x92 },
+          { 0x25, 0x90, 0x5f, 0xc1, 0x0a, 0x09, 0xc2, 0x5e, 0x06, 0x5a, 0xe1, 0xb7, 0x7b, 0xed, 0x77, 0x8c, 0x7a, 0x5e, 0xb4, 0xeb, 0x2d, 0xbf, 0x59, 0x3f, 0xc1, 0xb7, 0x03, 0x49, 0xdc, 0xde, 0x3f, 0xdf } },
+        { { 0x36, 0xec, 0x28, 0xd7, 0x1b, 0x16, 0xb3, 0x40, 0xea, 0xda, 0x2d, 0x8e, 0xda, 0xbb, 0x46, 0x1c, 0xf7, 0x82, 0x01, 0xa6, 0xf3, 0x78, 0xf0, 0x33, 0x10, 0x9c, 0xdc, 0xdc, 0xc4, 0x5f, 0xd8, 0xee },
+          { 0x3d, 0xaf, 0xf2, 0xe9, 0x5d, 0x08, 0xed, 0x76, 0xb4, 0x1e, 0x36, 0xa2, 0x5b, 0x9f, 0xbd, 0x9d, 0xfd, 0xf3, 0x8d, 0x79, 0x23, 0x88, 0x12, 0x2f, 0x39, 0xb2, 0x35, 0xf6, 0xe4, 0x87, 0x1f, 0x1a } },
+        { { 0x34, 0xbc, 0xf8, 0xc3, 0xb6, 0x47, 0x3f, 0xc5, 0x24, 0xdb, 0x91, 0x9e, 0xaa, 0xe5, 0x12, 0xfa, 0xcd, 0x88, 0xe7, 0x52, 0x0a, 0xcf, 0xea, 0x0d, 0xe3, 0x26, 0x97, 0x5e, 0x8e, 0xa9, 0x4b, 0x2f },
+          { 0x2e, 0x33, 0xb2, 0x64, 0x06, 0x90, 0xe4, 0x6c, 0xf8, 0xad, 0x4d, 0xdb, 0x8b, 0x53, 0x14, 0xbb, 0xf3, 0x19, 0x2e, 0x87, 0x51, 0x91, 0xef, 0xe6, 0x66, 0xeb, 0xd7, 0xdd, 0x25, 0xaf, 0xfc, 0x99 } },
+        { { 0x3f, 0x22, 0xcd, 0x6e, 0x28, 0x3e, 0xbd, 0x5e, 0x77, 0xe7, 0xbf, 0x64, 0x5b, 0xd6, 0xd4, 0x65, 0x4a, 0x9f, 0x59, 0x61, 0xa3, 0x1b, 0xe3, 0x7a, 0x8b, 0x48, 0x2e, 0xfe, 0x60, 0xef, 0x4a, 0x71 },
+          { 0x2d, 0xe4, 0x34, 0x2e, 0x3b, 0x69, 0x67, 0xea, 0x84, 0x39, 0x02, 0xee, 0x20, 0xfc, 0xd4, 0xb3, 0xa5, 0xc4, 0xef, 0x19, 0x80, 0x06, 0x39, 0xc4, 0xb3, 0x04, 0x59, 0xe0, 0x3e, 0xd4, 0x42, 0x07 } },
+        { { 0x25, 0x86, 0xc4, 0xc8, 0xe2, 0xe8, 0xed, 0xdb, 0x0f, 0x8a, 0x97, 0xd3, 0x36, 0xdf, 0xcc, 0x76, 0x82, 0x9a, 0x10, 0xad, 0xcb, 0x59, 0xbd, 0x7f, 0xe7, 0x75, 0x28, 0xa7, 0x74, 0x99, 0xda, 0x29 },
+          { 0x22, 0x7e, 0x6f, 0x63, 0xf8, 0x73, 0x5b, 0xf6, 0xc3, 0xc5, 0xba, 0x61, 0x9b, 0x9c, 0x2f, 0x44, 0xea, 0x4e, 0x28, 0x82, 0x10, 0x01, 0xcc, 0xfa, 0x86, 0xb1, 0xac, 0xe0, 0x8a, 0xf7, 0x17, 0xdb } },
+        { { 0x0c, 0x49, 0x38, 0xde, 0xfe, 0xd2, 0xc6, 0x1a, 0xb8, 0x49, 0x36, 0x86, 0xdf, 0x6a, 0x06, 0x90, 0xc6, 0xdd, 0x61, 0x7d, 0xb5, 0xe7, 0x62, 0x2e, 0xae, 0x7f, 0xd3, 0x42, 0xd8, 0x4e, 0x31, 0x6b },
+          { 0x13, 0x3e, 0x9d, 0x79, 0x56, 0xc1, 0xe7, 0x80, 0x26, 0x97, 0xa2, 0x30, 0x66, 0x42, 0x17, 0xd5, 0xe7, 0xaa, 0x4f, 0xaa, 0xe7, 0xf6, 0x08, 0xaf, 0x03, 0x64, 0x93, 0x10, 0x56, 0xb8, 0xf1, 0x93 } },
+        { { 0x3f, 0x6a, 0x8c, 0x1b, 0x36, 0x73, 0xb3, 0x10, 0xba, 0x28, 0x4c, 0xa7, 0x22, 0xf4, 0x94, 0xfb, 0x3b, 0x00, 0x68, 0xe2, 0x70, 0x41, 0xf9, 0xaa, 0xdc, 0x8d, 0x2e, 0x3e, 0x8d, 0x95, 0x1f, 0x76 },
+          { 0x11, 0x03, 0x04, 0x06, 0xc3, 0xb2, 0xc9, 0xb8, 0x01, 0x01, 0x76, 0x53, 0x53, 0xb6, 0x22, 0x7a, 0x46, 0xcf, 0x3e, 0xeb, 0x26, 0x51, 0xd4, 0xac, 0xd1, 0x23, 0xa1, 0xb3, 0x43, 0xe4, 0x61, 0xe2 } },
+        { { 0x31, 0x62, 0x2a, 0x8c, 0x6d, 0x65, 0x20, 0x68, 0x29, 0xb5, 0xc4, 0x39, 0x53, 0xfe, 0x25, 0x06, 0x07, 0x88, 0xe3, 0xad, 0x81, 0xe4, 0x3d, 0x16, 0xbf, 0xba, 0xd6, 0xea, 0x2a, 0x62, 0xee, 0x43 },
+          { 0x02, 0x9a, 0x71, 0x8d, 0xf2, 0xd8, 0x53, 0x99, 0x28, 0x25, 0xa4, 0xa8, 0x39, 0x39, 0x5b, 0xd4, 0x97, 0xfa, 0xd4, 0x70, 0xfe, 0x37, 0xc4, 0xe9, 0x3d, 0x89, 0xd6, 0xeb, 0xf8, 0x87, 0x34, 0xc2 } }
+    },
+    {
+        { { 0x05, 0x80, 0xe8, 0x51, 0xa8, 0x5e, 0xc9, 0xa7, 0x74, 0x23, 0xe9, 0xd1, 0x82, 0x16, 0x33, 0x62, 0x6b, 0x8d, 0x78, 0x7b, 0xee, 0xa2, 0x39, 0x16, 0x0e, 0xd6, 0x54, 0x3e, 0xb6, 0x05, 0x51, 0x51 },
+          { 0x1e, 0xef, 0x16, 0x0d, 0x5a, 0x0a, 0x70, 0x5a, 0x13, 0x07, 0xf7, 0x75, 0xcf, 0xbf, 0x8f, 0x7c, 0x39, 0xa4, 0xf4, 0xad, 0xc0, 0x32, 0x1c, 0x02, 0x6e, 0xd6, 0x70, 0x1f, 0x8e, 0x5d, 0x4b, 0xe4 } },
+        { { 0x18, 0x43, 0x94, 0x2a, 0xf8, 0x3a, 0xd1, 0xed, 0x41, 0x05, 0x2c, 0x5c, 0x92, 0xab, 0x17, 0x4f, 0xdc, 0xe6, 0xa0, 0xb0, 0xc3, 0x4f, 0x65, 0x14, 0x72, 0x84, 0x71, 0xc4, 0x2e, 0xa7, 0xd5, 0x95 },
+          { 0x38, 0x7f, 0x34, 0xe3, 0xd8, 0xda, 0xa0, 0x87, 0x29, 0x7e, 0xd8, 0xcc, 0x79, 0xa6, 0x8c, 0xdf, 0xdb, 0xdf, 0xb5, 0x19, 0x9e, 0x2a, 0x26, 0x54, 0x08, 0x8d, 0x59, 0xec, 0x84, 0x9b, 0x06, 0x9a } },
+        { { 0x10, 0x08, 0x1a, 0x34, 0x32, 0x83, 0x81, 0x76, 0x6b, 0xbb, 0x29, 0xa5, 0x46, 0x93, 0x6a, 0x3a, 0x03, 0xa5, 0x65, 0xb7, 0x12, 0x5f, 0xdf, 0x60, 0xf3, 0xa6, 0xce, 0x10, 0xe6, 0x06, 0x4b, 0x54 },
+          { 0x3d, 0x94, 0x71, 0xc9, 0xf9, 0x99, 0xb2, 0x4e, 0x19, 0xa3, 0x07, 0xc0, 0x5e, 0xe6, 0x90, 0x23, 0x2c, 0x53, 0xdf, 0x45, 0x0d, 0xc7, 0xa6, 0x59, 0xbe, 0x80, 0x34, 0x4e, 0x54, 0x17, 0x17, 0x98 } },
+        { { 0x16, 0x9c, 0xba, 0x97, 0xeb, 0x4a, 0x00, 0xa4, 0x5c, 0xe7, 0x3c, 0xa2, 0xd8, 0x5c, 0x06, 0x1a, 0xd9, 0x78, 0x1e, 0x2f, 0x60, 0x86, 0x65, 0x1d, 0x36, 0xb2, 0x72, 0xf5, 0x58, 0x0c, 0xf9, 0x30 },
+          { 0x36, 0xa3, 0xe4, 0xcb, 0x4f, 0xee, 0xa3, 0x71, 0xd0, 0x9e, 0x72, 0x35, 0x0f, 0xbf, 0xfa, 0xe4, 0xfe, 0xc7, 0x32, 0xab, 0xfc, 0x47, 0xfe, 0xe5, 0x4a, 0xc1, 0x65, 0x31, 0x5c, 0xfc, 0x55, 0xa3 } },
+        { { 0x24, 0xb5, 0x22, 0xc1, 0xe6, 0x7b, 0x94, 0x59, 0x7c, 0xd6, 0x7d, 0xc4, 0x9b, 0xb7, 0x3f, 0x73, 0x80, 0x77, 0x34, 0xa0, 0x45, 0x71, 0x99, 0x80, 0x1a, 0x29, 0x97, 0xd0, 0xd1, 0x3e, 0xf9, 0xc9 },
+          { 0x11, 0xff, 0x5d, 0xf7, 0x90, 0x4f, 0x91, 0xb5, 0x50, 0xc8, 0x8d, 0x54, 0xa1, 0x8e, 0x60, 0xe8, 0x02, 0xff, 0xd5, 0x6d, 0xa6, 0xcb, 0xb6, 0x79, 0xfb, 0x34, 0xf3, 0x2a, 0x37, 0x3f, 0x7a, 0x23 } },
+        { { 0x14, 0xad, 0x74, 0x68, 0x52, 0xc6, 0xa3, 0xdb, 0xfe, 0xd9, 0xf8, 0x54, 0x06, 0x6f, 0xfe, 0x8b, 0x94, 0x46, 0x3c, 0x89, 0xda, 0x2f, 0xf7, 0xe5, 0x6b, 0x26, 0xe7, 0xc8, 0x8c, 0xaf, 0xcf, 0xd4 },
+          { 0x33, 0xf6, 0xfb, 0xf2, 0xea, 0x13, 0x78, 0x32, 0xdc, 0x1b, 0x38, 0xde, 0xd6, 0x0c, 0x5a, 0x25, 0xb0, 0xaf, 0x8d, 0x11, 0xcc, 0xb7, 0xcc, 0x24, 0xf9, 0x03, 0x6b, 0x84, 0xef, 0xff, 0x9b, 0xda } },
+        { { 0x1c, 0x1f, 0xcd, 0x66, 0x3d, 0x52, 0xbe, 0xf3, 0x37, 0x0d, 0xee, 0xce, 0x63, 0x14, 0xdc, 0xc3, 0x85, 0x4d, 0x54, 0xa9, 0x4f, 0xab, 0xd9, 0xa0, 0xb3, 0x78, 0x0e, 0xba, 0x02, 0x7a, 0x9c, 0x3c },
+          { 0x3c, 0x11, 0x44, 0x5e, 0x9e, 0xc9, 0xbe, 0xe3, 0x80, 0xd8, 0x04, 0x63, 0x09, 0x54, 0x60, 0xf0, 0x73, 0xa6, 0xcb, 0xfe, 0x9b, 0x28, 0x48, 0x84, 0x7f, 0xf9, 0xbc, 0x37, 0x89, 0xc7, 0xb6, 0xc4 } },
+        { { 0x07, 0x3c, 0x61, 0x3d, 0xcf, 0xf7, 0xe7, 0xb0, 0x79, 0x01, 0xd7, 0x0d, 0x7d, 0xcc, 0x4d, 0xc9, 0x45, 0x64, 0xee, 0xa1, 0x18, 0x0f, 0xd6, 0x51, 0xbd, 0xab, 0x19, 0x52, 0x47, 0x5a, 0xdb, 0xc2 },
+          { 0x1a, 0x34, 0x79, 0x82, 0xee, 0x78, 0x38, 0xf1, 0x2f, 0xf9, 0x63, 0xb2, 0x7d, 0xc5, 0x86, 0x7b, 0xe0, 0x2b, 0x2c, 0xfe, 0x03, 0x40, 0x2c, 0x5d, 0xa1, 0xb8, 0xc8, 0x74, 0x38, 0x5e, 0xfa, 0x53 } }
+    },
+    {
+        { { 0x07, 0xac, 0x28, 0xc4, 0x05, 0x60, 0x76, 0xea, 0x9c, 0xac, 0x31, 0x0f, 0xc2, 0x29, 0x00, 0x83, 0x00, 0xe1, 0x10, 0x5b, 0x65, 0xd9, 0x83, 0x6f, 0xc2, 0xd8, 0x6a, 0x23, 0xf6, 0x8a, 0xeb, 0xe0 },
+          { 0x0f, 0x6e, 0x2e, 0xbf, 0x6c, 0x2d, 0x9c, 0xf4, 0x19, 0x08, 0x43, 0x86, 0xad, 0xb2, 0xfe, 0xe2, 0xef, 0xfa, 0xdc, 0x52, 0x18, 0x43, 0x04, 0xc3, 0x1e, 0x7c, 0x64, 0x00, 0x3d, 0x4b, 0x74, 0xe0 } },
+        { { 0x1a, 0x76, 0xf7, 0x98, 0xef, 0xfe, 0xe8, 0x2d, 0x20, 0xcd, 0x59, 0x7e, 0xb6, 0x60, 0x88, 0xbd, 0x3f, 0x58, 0xd3, 0x66, 0xff, 0x0b, 0xa1, 0xf4, 0x9f, 0xeb, 0x23, 0x78, 0xba, 0x1f, 0x18, 0x7f },
+          { 0x20, 0xf6, 0x5e, 0x0c, 0xfa, 0x22, 0xc0, 0x79, 0xd1, 0x33, 0x0c, 0xeb, 0xb8, 0xff, 0x56, 0x02, 0x25, 0xf9, 0x07, 0x46, 0xc4, 0x38, 0x56, 0xf0, 0xf8, 0x9a, 0xbd, 0x22, 0xba, 0xee, 0x51, 0xcb } },
+        { { 0x18, 0xcb, 0xae, 0xeb, 0x75, 0x53, 0x72, 0xc3, 0xba, 0x78, 0x49, 0xbf, 0x4c, 0x12, 0xc3, 0xac, 0x19, 0x6e, 0xc3, 0x37, 0x8b, 0x17, 0xe7, 0xc2, 0xe3, 0xb2, 0x96, 0x93, 0xb6, 0xec, 0x18, 0x44 },
+          { 0x30, 0xd4, 0x0c, 0xe4, 0x9f, 0x77, 0xb4, 0x20, 0x03, 0x21, 0x65, 0xe8, 0x1e, 0x38, 0xf4, 0xd8, 0x9a, 0x5d, 0xc2, 0x72, 0xb5, 0xed, 0x9e, 0xb4, 0x8f, 0xf0, 0x7b, 0x12, 0xc8, 0x78, 0xe8, 0x6e } },
+        { { 0x04, 0x47, 0x1f, 0x87, 0x39, 0xb9, 0xc5, 0xb2, 0xff, 0xf2, 0xff, 0x8d, 0x19, 0x72, 0xb4, 0x52, 0x18, 0x46, 0x6f, 0xa0, 0x77, 0x11, 0xd0, 0xe7, 0x4c, 0xe5, 0xfd, 0x9c, 0x13, 0x8c, 0xc5, 0x64 },
+          { 0x08, 0x20, 0x5e, 0x56, 0xfb, 0x68, 0x59, 0x3d, 0x7b, 0x38, 0x4b, 0x6e, 0x6e, 0xa6, 0x98, 0x8c, 0xf5, 0xb1, 0xe6, 0x37, 0x7a, 0x46, 0xb4, 0xab, 0xa2, 0x46, 0x67, 0xa5, 0xb4, 0x50, 0x48, 0xf9 } },
+        { { 0x21, 0x39, 0x84, 0x69, 0x3f, 0x68, 0x36, 0xa5, 0x1d, 0x15, 0xc4, 0x04, 0x49, 0x97, 0x04, 0x4b, 0x7a, 0xa3, 0x36, 0x80, 0x7a, 0x21, 0xbc, 0x0f, 0xf7, 0xfd, 0x8e, 0x38, 0x88, 0xc1, 0xe2, 0xcf },
+          { 0x01, 0x64, 0xf6, 0x27, 0xcb, 0x39, 0x6b, 0x3c, 0x97, 0xba, 0xdb, 0x19, 0xbc, 0xac, 0x6a, 0x84, 0xbe, 0xc5, 0xa1, 0x08, 0xda, 0xe9, 0x44, 0xde, 0x57, 0xba, 0x8e, 0x02, 0x36, 0xda, 0xcd, 0x7e } },
+        { { 0x38, 0x2b, 0xbd, 0x1a, 0x00, 0x4a, 0xc4, 0x1a, 0x22, 0x14, 0x14, 0x60, 0x85, 0x83, 0x94, 0x3c, 0xf5, 0xb8, 0xd9, 0x06, 0x68, 0xb8, 0xfa, 0x17, 0x5d, 0x05, 0x00, 0x1f, 0x0c, 0xad, 0x3e, 0x14 },
+          { 0x29, 0x2e, 0x3f, 0x3e, 0xfc, 0x45, 0x88, 0x6d, 0xb2, 0xca, 0x54, 0x62, 0x14, 0x5c, 0x31, 0xec, 0x90, 0x90, 0xdb, 0xb2, 0xf7, 0x1b, 0xaf, 0x26, 0x70, 0x92, 0xca, 0x47, 0xde, 0x0a, 0x64, 0xd8 } },
+        { { 0x2c, 0xfd, 0x56, 0xbd, 0xf1, 0x25, 0x53, 0x90, 0x02, 0xc1, 0x0f, 0x14, 0x89, 0x52, 0xab, 0xb5, 0xfd, 0x9d, 0xb1, 0x7a, 0x3b, 0xea, 0x88, 0x61, 0x37, 0x39, 0xfa, 0xb1, 0x04, 0x6f, 0xd1, 0x74 },
+          { 0x3a, 0xfb, 0x0e, 0xfa, 0x68, 0x38, 0x4d, 0xbd, 0x43, 0x75, 0x8e, 0x72, 0x6a, 0xfa, 0xc6, 0x9e, 0x9c, 0xdf, 0x49, 0x61, 0xd9, 0x5a, 0x43, 0x6a, 0x31, 0x19, 0xd6, 0xff, 0xde, 0xec, 0x95, 0xe5 } },
+        { { 0x24, 0x0d, 0x94, 0xe0, 0x4c, 0xd2, 0x22, 0x7a, 0xc9, 0xe1, 0xc9, 0x86, 0xc2, 0x56, 0xfc, 0x2a, 0x66, 0x0b, 0xbe, 0x1e, 0x64, 0xf0, 0x4b, 0x50, 0x88, 0x73, 0x5f, 0xc1, 0x8f, 0x48, 0xe1, 0xa8 },
+          { 0x34, 0xc4, 0xe3, 0xf9, 0xbc, 0x1f, 0xe5, 0x96, 0x12, 0xda, 0x26, 0xa8, 0x36, 0x9a, 0x03, 0xeb, 0x9d, 0x11, 0x45, 0x3b, 0x46, 0xee, 0x19, 0xde, 0xb9, 0x93, 0x17, 0x04, 0x1b, 0x4e, 0xe5, 0xa4 } }
+    },
+    {
+        { { 0x24, 0x64, 0x47, 0x91, 0xab, 0x90, 0x57, 0xb8, 0xfc, 0xc6, 0x4a, 0xaa, 0x9d, 0x43, 0xc8, 0x4c, 0x16, 0xe2, 0x5c, 0x2a, 0x78, 0xbf, 0x91, 0x62, 0x83, 0x46, 0x8f, 0x3c, 0xd2, 0xbf, 0x4b, 0x97 },
+          { 0x02, 0x26, 0xfe, 0xa3, 0xad, 0xdb, 0x62, 0x6c, 0x0b, 0x2a, 0xf4, 0xd1, 0x3e, 0x28, 0x85, 0x50, 0xc0, 0xea, 0xad, 0xfd, 0xa5, 0xd7, 0x31, 0xeb, 0xe2, 0xc9, 0x59, 0x13, 0x75, 0xa4, 0x54, 0xe5 } },
+        { { 0x36, 0xf6, 0x23, 0x27, 0x51, 0xf9, 0xe0, 0x16, 0x9c, 0x11, 0x71, 0x9e, 0xee, 0x3f, 0x05, 0xef, 0x06, 0x44, 0xb2, 0xa2, 0x03, 0x7e, 0x23, 0x0b, 0x93, 0xbe, 0x95, 0x4c, 0xc6, 0x22, 0xb7, 0x94 },
+          { 0x38, 0x04, 0xa8, 0x91, 0xf6, 0xb6, 0x1a, 0xff, 0xee, 0xd9, 0xe5, 0x4a, 0xc9, 0xfc, 0x59, 0x66, 0x62, 0x61, 0x1f, 0x6b, 0x75, 0xb6, 0x79, 0x61, 0xca, 0x64, 0x71, 0x45, 0x90, 0xbc, 0x33, 0xa0 } },
+        { { 0x32, 0x16, 0x71, 0x75, 0x50, 0xfc, 0x85, 0xf6, 0xf1, 0x6d, 0x46, 0x28, 0xee, 0xca, 0xb3, 0x97, 0xac, 0xca, 0xdc, 0xfa, 0x7b, 0xd7, 0xf4, 0xb0, 0x12, 0xf7, 0x6c, 0xf9, 0x7f, 0xf6, 0x96, 0xcd },
+          { 0x16, 0x99, 0x52, 0x71, 0x27, 0x55, 0x63, 0x28, 0x75, 0x4c, 0x75, 0x6a, 0x5a, 0x61, 0x97, 0x8a, 0x3e, 0xf7, 0x71, 0x18, 0x73, 0x4c, 0x83, 0x23, 0x90, 0x87, 0xee, 0x0d, 0x3a, 0x6a, 0x07, 0xfe } },
+        { { 0x3c, 0x90, 0x44, 0xf6, 0x53, 0x1c, 0xe9, 0xd2, 0x75, 0xc9, 0x97, 0xa7, 0xfd, 0x86, 0xbd, 0x99, 0x90, 0xc1, 0x5c, 0x57, 0x73, 0x46, 0xdb, 0xb4, 0x9c, 0x29, 0x10, 0x42, 0x1a, 0x67, 0xfc, 0x9b },
+          { 0x16, 0x00, 0xfe, 0x4b, 0x04, 0xa2, 0xd3, 0xcf, 0x3c, 0xf8, 0x3a, 0x8f, 0x27, 0x07, 0xd6, 0xc7, 0x29, 0xaa, 0x42, 0xbf, 0xec, 0xaf, 0xcb, 0x81, 0xd2, 0xbb, 0x18, 0xc4, 0x49, 0xd2, 0x04, 0x30 } },
+        { { 0x07, 0x8b, 0xc7, 0x86, 0xaf, 0x91, 0x1e, 0x18, 0x60, 0x59, 0x82, 0xb6, 0xab, 0xff, 0x8e, 0x21, 0x18, 0x60, 0xc0, 0x8f, 0x58, 0xf5, 0x59, 0x49, 0xf6, 0xe2, 0xd9, 0xb4, 0xe8, 0x2e, 0x27, 0x95 },
+          { 0x18, 0x08, 0xa6, 0x86, 0xf9, 0x70, 0x58, 0x45, 0x70, 0x9e, 0x5c, 0xb2, 0xe6, 0x33, 0xe9, 0x29, 0xa7, 0x21, 0xb4, 0x41, 0xd1, 0xd8, 0xf3, 0x2c, 0x35, 0x96, 0xa2, 0x1d, 0x02, 0xbe, 0x94, 0x0f } },
+        { { 0x2a, 0x94, 0xb1, 0x5e, 0x37, 0x41, 0x7f, 0x2b, 0xa2, 0x14, 0x5b, 0x6b, 0x86, 0x72, 0x95, 0x8b, 0xfe, 0x25, 0x24, 0x02, 0x40, 0xda, 0xa1, 0xb9, 0x85, 0x19, 0x3e, 0x1a, 0xd4, 0x7f, 0x2e, 0xfe },
+          { 0x2f, 0xa3, 0x87, 0x37, 0xde, 0x8c, 0xbd, 0x65, 0x12, 0xe6, 0x5b, 0x4f, 0xed, 0x8d, 0x3d, 0x0c, 0xd6, 0x13, 0x0d, 0xeb, 0x62, 0x93, 0x76, 0xfc, 0x45, 0xe2, 0x59, 0x9c, 0x20, 0xda, 0xd2, 0x4b } },
+        { { 0x06, 0x20, 0x7f, 0x6b, 0x5a, 0xc0, 0x7c, 0x87, 0x5c, 0xf1, 0x7f, 0x70, 0x65, 0x6a, 0xbf, 0xbf, 0xdf, 0x1a, 0xe3, 0xc7, 0x9a, 0x25, 0x33, 0x6b, 0x2b, 0x0d, 0x24, 0x3f, 0x04, 0x7f, 0x36, 0xbf },
+          { 0x03, 0xbf, 0x74, 0xfa, 0xc9, 0xf1, 0xbb, 0x7d, 0x4b, 0x04, 0x23, 0x26, 0x75, 0x9e, 0x78, 0x51, 0x5e, 0x89, 0x86, 0xce, 0xc9, 0x21, 0xca, 0x11, 0x9b, 0x13, 0xc6, 0x89, 0xbe, 0x74, 0x23, 0x0a } },
+        { { 0x1d, 0x14, 0xc9, 0xb7, 0x0f, 0xb8, 0x39, 0x45, 0x51, 0x04, 0x82, 0x70, 0xcc, 0x0e, 0xd7, 0x7e, 0xba, 0xb0, 0x5d, 0xbf, 0xf6, 0x48, 0x05, 0xaf, 0x7f, 0x37, 0x1c, 0x86, 0x27, 0x0e, 0x01, 0x5b },
+          { 0x1b, 0x86, 0x12, 0x6f, 0xdd, 0xda, 0x9c, 0xea, 0xab, 0x43, 0xcf, 0x09, 0x70, 0xe3, 0x64, 0xa1, 0x6b, 0xa5, 0x0a, 0x7c, 0x83, 0xdf, 0x2a, 0xa9, 0xf6, 0xb6, 0x84, 0xeb, 0x0c, 0x36, 0x6c, 0x7b } }
+    },
+    {
+        { { 0x3e, 0xfa, 0x1e, 0x28, 0x08, 0x9a, 0x92, 0xeb, 0xfa, 0xa2, 0x9a, 0xf5, 0x4e, 0x31, 0xcc, 0xa2, 0xe2, 0xd8, 0x1f, 0x15, 0xd7, 0xb8, 0x70, 0x77, 0xc7, 0x0b, 0x00, 0x76, 0xce, 0x30, 0x01, 0x5b },
+          { 0x16, 0x22, 0x17, 0xc2, 0x8f, 0xb9, 0xb1, 0x55, 0xcf, 0xff, 0x47, 0x05, 0x5d, 0xed, 0x26, 0xf4, 0xda, 0xc4, 0x4f, 0xd2, 0xf1, 0x6a, 0xc6, 0xb1, 0x87, 0xe6, 0xcd, 0xea, 0x46, 0x5f, 0x64, 0x29 } },
+        { { 0x18, 0xf8, 0x09, 0xa1, 0x28, 0xfb, 0x47, 0x0e, 0x2e, 0xeb, 0xd1, 0x71, 0xc4, 0x98, 0x28, 0x4a, 0x36, 0x59, 0xef, 0x4b, 0xf5, 0x3a, 0x6b, 0x0c, 0xa1, 0x87, 0x5b, 0xba, 0xff, 0x42, 0xb2, 0x5b },
+          { 0x18, 0x15, 0xba, 0x68, 0x1f, 0x77, 0xf0, 0x3b, 0x79, 0x7b, 0x4a, 0x73, 0x59, 0x60, 0xdd, 0xb3, 0x7f, 0x68, 0x02, 0xe9, 0x37, 0xbb, 0xb2, 0xe8, 0xf9, 0x94, 0xf7, 0xaa, 0x2a, 0xd4, 0xd0, 0xdc } },
+        { { 0x17, 0x23, 0x36, 0x73, 0xc2, 0xe3, 0x1c, 0x6b, 0x0d, 0x1e, 0x3f, 0x99, 0x10, 0x44, 0x8e, 0x0f, 0x4d, 0x6e, 0x70, 0x57, 0x28, 0xf4, 0xb0, 0x01, 0xb6, 0xf6, 0x98, 0x00, 0x74, 0xaa, 0x83, 0x31 },
+          { 0x1a, 0x47, 0xc0, 0xad, 0x24, 0xdb, 0x69, 0x5f, 0x60, 0xf8, 0x2a, 0x8a, 0x0c, 0x36, 0x3e, 0x44, 0x9d, 0xbc, 0x19, 0xe4, 0x3b, 0x5c, 0x98, 0x82, 0x91, 0x70, 0xe7, 0xf1, 0x40, 0xc1, 0xe9, 0x89 } },
+        { { 0x0e, 0xe9, 0x59, 0x9a, 0x7f, 0x13, 0x34, 0x20, 0x1a, 0x1b, 0x5b, 0x9d, 0x5c, 0x27, 0x82, 0x24, 0x8d, 0x56, 0xb1, 0xe8, 0x35, 0xb0, 0x8a, 0x2a, 0xc0, 0x3e, 0x6d, 0x29, 0x86, 0x3d, 0xad, 0x6d },
+          { 0x3c, 0x45, 0x73, 0xd1, 0x69, 0x89, 0x4d, 0x2e, 0x56, 0x96, 0xc6, 0xfc, 0x94, 0xf1, 0x91, 0x6b, 0x9f, 0xfd, 0x1c, 0xbb, 0x6a, 0x61, 0x50, 0x59, 0x64, 0xf1, 0xee, 0x37, 0x4a, 0x16, 0x20, 0x24 } },
+        { { 0x34, 0xf7, 0x3d, 0xb6, 0x07, 0xb6, 0x87, 0x4a, 0xcb, 0xb1, 0x59, 0x38, 0x5c, 0xa0, 0x7c, 0xc0, 0xc4, 0x2c, 0x36, 0x68, 0xf2, 0x87, 0xa2, 0xf7, 0x48, 0x73, 0x58, 0x6d, 0xed, 0xa6, 0x54, 0x4d },
+          { 0x15, 0xed, 0x1e, 0x64, 0xff, 0x2a, 0xb5, 0x9f, 0x69, 0x2e, 0x86, 0x5b, 0x4b, 0x89, 0x4a, 0x31, 0x3a, 0xde, 0xa0, 0xbb, 0x92, 0x45, 0xb2, 0xa9, 0xa1, 0xf5, 0x2a, 0x0c, 0x46, 0x93, 0xcc, 0x0b } },
+        { { 0x34, 0xc1, 0x79, 0x68, 0x1b, 0xb0, 0xc5, 0x99, 0x29, 0x53, 0x52, 0xec, 0x36, 0xaf, 0xa4, 0x11, 0x4a, 0x0d, 0x76, 0xa6, 0x6a, 0xa8, 0xf0, 0xac, 0x81, 0x85, 0x5a, 0xc2, 0x9b, 0x35, 0x04, 0x54 },
+          { 0x2f, 0xe6, 0x72, 0x2d, 0x68, 0xed, 0x04, 0x77, 0x7f, 0x21, 0x6b, 0xb0, 0x6a, 0xa9, 0x14, 0x34, 0x37, 0x39, 0xfb, 0x2f, 0xa7, 0x75, 0xc8, 0xf7, 0xfe, 0xdb, 0x8d, 0x37, 0xfc, 0xfe, 0xf0, 0xdf } },
+        { { 0x2d, 0xb9, 0xe4, 0x99, 0x5b, 0x04, 0xdc, 0xf3, 0x6b, 0xea, 0xd1, 0x6c, 0x53, 0x7b, 0xbb, 0x2c, 0x05, 0xbe, 0xb3, 0xf6, 0x38, 0x54, 0xad, 0xd4, 0xc4, 0xd6, 0xf4, 0x03, 0xa9, 0x91, 0x83, 0xf4 },
+          { 0x35, 0x14, 0x13, 0x66, 0x64, 0xce, 0xaa, 0x27, 0x7a, 0x2f, 0xef, 0x86, 0xaf, 0x3f, 0x24, 0x50, 0xde, 0x4f, 0x08, 0xa4, 0xd7, 0x2e, 0xd1, 0x55, 0x77, 0xc5, 0x61, 0xc1, 0x19, 0xda, 0x89, 0xe8 } },
+        { { 0x2e, 0xf8, 0x52, 0x0e, 0x57, 0x70, 0xc8, 0xcc, 0x96, 0x6d, 0x42, 0x4f, 0xc2, 0x05, 0x92, 0x64, 0xc5, 0x86, 0x91, 0x6b, 0x2c, 0x28, 0x1d, 0x2f, 0x29, 0x7a, 0x5b, 0x82, 0x55, 0x3a, 0x29, 0xf6 },
+          { 0x0e, 0xab, 0x35, 0x46, 0x49, 0x8d, 0xc7, 0xe6, 0x80, 0x01, 0xd4, 0x8a, 0x23, 0xa6, 0x08, 0x52, 0xd1, 0x30, 0x17, 0x7d, 0x16, 0x1a, 0xaf, 0x16, 0x21, 0xe6, 0x9e, 0xf6, 0x51, 0xf8, 0xda, 0xbc } }
+    },
+    {
+        { { 0x1f, 0xce, 0x8b, 0x03, 0x07, 0xa7, 0xa1, 0x6b, 0xb9, 0x6d, 0xdd, 0xb3, 0x3c, 0x41, 0x9d, 0xd0, 0xf8, 0xca, 0x85, 0x6c, 0xb8, 0x7a, 0x8a, 0xbe, 0xb7, 0x13, 0xc2, 0xd4, 0xe0, 0xb0, 0xc5, 0x2b },
+          { 0x14, 0x8e, 0x70, 0x96, 0x39, 0x74, 0xac, 0x58, 0x2a, 0xe8, 0x01, 0x42, 0x2a, 0xc6, 0x2b, 0x5a, 0xa2, 0x16, 0x6c, 0xf6, 0xbc, 0x26, 0x71, 0x8a, 0xf2, 0x3f, 0xff, 0x5b, 0xda, 0x5e, 0x5f, 0x83 } },
+        { { 0x26, 0x33, 0x13, 0x25, 0x54, 0xc3, 0x15, 0x2d, 0x83, 0xc5, 0xb7, 0xa4, 0xbd, 0xbb, 0x80, 0x11, 0x72, 0xa7, 0x52, 0xed, 0x4f, 0x55, 0x9f, 0x2a, 0x5f, 0x88, 0xf0, 0x63, 0xaf, 0x6e, 0x01, 0xa8 },
+          { 0x14, 0x58, 0x51, 0xb2, 0x43, 0xaf, 0x28, 0x6c, 0xa7, 0x50, 0x70, 0xcc, 0x3a, 0x2b, 0x90, 0x2f, 0xf6, 0x8d, 0x9a, 0xf6, 0xcc, 0xdd, 0xc2, 0x64, 0x97, 0xd1, 0xe2, 0xd8, 0x70, 0xb8, 0x85, 0x2f } },
+        { { 0x2a, 0x0e, 0xe3, 0xf7, 0x2c, 0xb5, 0xb9, 0x35, 0x32, 0x64, 0x87, 0x79, 0x57, 0xfc, 0x07, 0x95, 0x86, 0x28, 0x0d, 0xef, 0xab, 0x16, 0x0e, 0x9e, 0x18, 0x93, 0x27, 0xeb, 0x17, 0x30, 0x07, 0x90 },
+          { 0x1b, 0xef, 0xcc, 0xab, 0xf8, 0x67, 0x03, 0x57, 0x07, 0xe0, 0x3f, 0x68, 0xc2, 0x41, 0xd6, 0x8a, 0x58, 0x8a, 0x8b, 0xed, 0xbb, 0x53, 0x00, 0x2d, 0x08, 0x05, 0xf4, 0xe5, 0xc2, 0x64, 0xf1, 0xb8 } },
+        { { 0x3d, 0x7c, 0xc2, 0x56, 0xad, 0xb8, 0x5c, 0x02, 0x39, 0xe0, 0x38, 0x26, 0xa8, 0x39, 0x0c, 0x77, 0x51, 0x6b, 0x74, 0xb3, 0xdd, 0xdd, 0xb8, 0x1d, 0xa3, 0x89, 0x36, 0x70, 0x6d, 0xd8, 0xfa, 0x5b },
+          { 0x03, 0x8d, 0x85, 0x16, 0xa4, 0x27, 0xef, 0x14, 0xcb, 0x32, 0x0f, 0x7f, 0xa9, 0xbd, 0x2b, 0x39, 0x46, 0x77, 0xf0, 0xe1, 0x43, 0x13, 0x99, 0xa2, 0x88, 0x14, 0x98, 0xac, 0xdb, 0x60, 0x0a, 0xb1 } },
+        { { 0x34, 0xfa, 0xc3, 0x39, 0x55, 0x6b, 0x31, 0x2f, 0xde, 0x60, 0x02, 0x2f, 0x65, 0x8a, 0x32, 0x41, 0x45, 0x6d, 0x97, 0xed, 0x8e, 0xc7, 0xcd, 0xdc, 0xa9, 0x1a, 0xb7, 0xa2, 0x17, 0x56, 0xcc, 0xb7 },
+          { 0x03, 0x09, 0x31, 0x50, 0x50, 0x97, 0xce, 0xfd, 0xd7, 0x13, 0xec, 0x71, 0x0f, 0x0e, 0x72, 0x73, 0x41, 0xa3, 0xd8, 0xee, 0xb3, 0x67, 0x10, 0xbc, 0xef, 0xa0, 0x9c, 0xa7, 0x63, 0xd5, 0x98, 0x25 } },
+        { { 0x3d, 0x9f, 0x70, 0x59, 0xb4, 0x24, 0x8a, 0x76, 0x1f, 0x3c, 0xf5, 0x6c, 0x11, 0x48, 0x97, 0x67, 0x61, 0x81, 0x12, 0xce, 0x56, 0xeb, 0x41, 0xb4, 0x85, 0x7b, 0x2e, 0x72, 0xb0, 0x71, 0x04, 0xcd },
+          { 0x10, 0x77, 0xd9, 0x25, 0xa0, 0xb6, 0x76, 0xeb, 0x04, 0x73, 0xcd, 0x5a, 0x91, 0xfb, 0x8c, 0xc8, 0xb3, 0x91, 0xee, 0xd5, 0x27, 0xbc, 0x3e, 0xb8, 0x6b, 0x8e, 0x54, 0xfc, 0xfa, 0x83, 0x61, 0x40 } },
+        { { 0x0b, 0xea, 0x8e, 0x2a, 0xf3, 0x0b, 0x74, 0x25, 0x53, 0x72, 0x22, 0x91, 0xc9, 0xaf, 0x69, 0x3c, 0x91, 0x67, 0x56, 0xad, 0xfa, 0xbe, 0x95, 0x69, 0xbf, 0xf2, 0xab, 0xa9, 0x36, 0x14, 0x6a, 0x3d },
+          { 0x01, 0x8e, 0xea, 0x24, 0xda, 0x82, 0xe1, 0xf0, 0x35, 0x01, 0x8b, 0xf7, 0x6b, 0xed, 0x3f, 0x6a, 0xeb, 0x26, 0x81, 0x66, 0x25, 0x2c, 0xb8, 0x1c, 0x80, 0xfb, 0xa5, 0x5a, 0x1c, 0x14, 0xc5, 0xc0 } },
+        { { 0x02, 0xd2, 0xc2, 0xc7, 0x62, 0x72, 0x5d, 0x5f, 0x85, 0xf8, 0x5e, 0x6b, 0xa3, 0x6f, 0x6c, 0x85, 0x83, 0x53, 0x78, 0xba, 0x00, 0x8f, 0x6c, 0x5c, 0x2c, 0x95, 0x54, 0xdc, 0x2f, 0xf4, 0x5b, 0x46 },
+          { 0x0c, 0x76, 0xc0, 0x6e, 0xc2, 0xfd, 0xb8, 0x1e, 0xf0, 0xd7, 0x69, 0xbd, 0xf5, 0x3b, 0xc0, 0xb1, 0x0a, 0xc1, 0xab, 0xa8, 0x3f, 0xa4, 0x28, 0x39, 0x98, 0x02, 0x82, 0xb2, 0x92, 0x6d, 0x4a, 0x60 } }
+    },
+    {
+        { { 0x02, 0x3e, 0x42, 0xf1, 0xae, 0x50, 0xeb, 0x86, 0x8e, 0x53, 0x3b, 0x8b, 0x26, 0x6a, 0x8f, 0x79, 0x72, 0xd3, 0xf3, 0x4c, 0x2c, 0x24, 0x5c, 0x96, 0xe9, 0x23, 0x29, 0x6d, 0x4b, 0x5e, 0x65, 0x09 },
+          { 0x25, 0x9c, 0x59, 0x56, 0x24, 0x2e, 0xce, 0x60, 0xf7, 0x3f, 0xca, 0xad, 0x74, 0x5e, 0x74, 0x8a, 0x65, 0xf9, 0x8d, 0xd6, 0x83, 0x86, 0x59, 0xc1, 0x05, 0x2a, 0x56, 0x3f, 0xc4, 0x49, 0xd5, 0x17 } },
+        { { 0x1a, 0xd1, 0x22, 0x10, 0x0f, 0x24, 0x2a, 0x58, 0xfe, 0x2f, 0x65, 0xe1, 0x63, 0x9b, 0x1a, 0x66, 0xf9, 0x0a, 0x9b, 0x81, 0x57, 0xb2, 0x1e, 0xd7, 0x86, 0x40, 0x2e, 0xba, 0xf0, 0x5a, 0xaf, 0x4e },
+          { 0x1f, 0x1d, 0x68, 0x48, 0x6e, 0xc9, 0x69, 0xaa, 0x10, 0x2f, 0x32, 0x03, 0xae, 0x73, 0x90, 0xbd, 0x99, 0x97, 0x32, 0x71, 0xe0, 0xc3, 0xc9, 0x41, 0x77, 0xd4, 0x84, 0xdb, 0x1c, 0xb1, 0xd3, 0xf0 } },
+        { { 0x3d, 0x55, 0xb9, 0x37, 0x60, 0x7d, 0xb6, 0x6c, 0xcd, 0x22, 0xb3, 0xb5, 0x8b, 0x9f, 0x6d, 0x0c, 0xec, 0x39, 0x51, 0xd4, 0x21, 0x59, 0x7e, 0x16, 0x76, 0xfa, 0x8d, 0x64, 0xb4, 0x1e, 0x59, 0x75 },
+          { 0x1f, 0x0d, 0x4b, 0x4e, 0x59, 0x52, 0x90, 0x0c, 0x34, 0x31, 0x0a, 0xab, 0x03, 0xb0, 0x25, 0xe0, 0xa7, 0x64, 0xdd, 0x38, 0xc9, 0xa4, 0x6c, 0x11, 0x14, 0x6a, 0x4a, 0x9a, 0x07, 0x69, 0xb0, 0x5d } },
+        { { 0x37, 0xae, 0x68, 0x0f, 0xae, 0x2c, 0xb5, 0x77, 0xe1, 0x9c, 0xf2, 0xe3, 0x9c, 0x5f, 0x89, 0x99, 0x3c, 0x74, 0xc8, 0x25, 0xc1, 0xac, 0xc4, 0x34, 0x36, 0x20, 0x3c, 0x27, 0x32, 0xf0, 0xd8, 0xc4 },
+          { 0x34, 0x0e, 0xc5, 0x9a, 0x14, 0x02, 0x26, 0xf3, 0x54, 0xdf, 0x09, 0xf7, 0x7e, 0xde, 0x4f, 0x8a, 0xfb, 0xb5, 0x9d, 0x78, 0xe3, 0x8e, 0x6e, 0xec, 0xd4, 0x9a, 0x13, 0x93, 0x22, 0x27, 0x26, 0xf2 } },
+        { { 0x28, 0x02, 0x2a, 0x2b, 0xf7, 0x7b, 0xf6, 0xc9, 0x53, 0x1d, 0x76, 0x6c, 0xd5, 0xe4, 0xc8, 0xcc, 0x01, 0x90, 0x71, 0x43, 0x24, 0xf6, 0xba, 0xb1, 0xda, 0x79, 0x69, 0xaf, 0xc7, 0xc2, 0x71, 0x39 },
+          { 0x17, 0xb9, 0x98, 0xed, 0xd2, 0x03, 0xf9, 0xf6, 0x8d, 0x68, 0x84, 0xe8, 0x52, 0x44, 0x0e, 0xd2, 0x82, 0x2b, 0x12, 0xb4, 0x48, 0x99, 0xf7, 0x97, 0x70, 0xb6, 0x3b, 0xbf, 0x55, 0xb7, 0x4e, 0x6b } },
+        { { 0x10, 0xd1, 0x67, 0x0c, 0x8a, 0x06, 0xf6, 0x02, 0xfb, 0x06, 0x86, 0x45, 0x20, 0xda, 0x9c, 0x5b, 0x73, 0xbd, 0x62, 0xa8, 0x38, 0x15, 0x10, 0xdc, 0x4d, 0x37, 0xae, 0xa3, 0xc9, 0xc6, 0x7d, 0xd6 },
+          { 0x34, 0x83, 0xee, 0x68, 0x66, 0xa0, 0x16, 0x86, 0xad, 0xd9, 0x84, 0x92, 0xed, 0x55, 0xbd, 0x03, 0xe8, 0x48, 0xee, 0x9e, 0x4c, 0xb0, 0xc3, 0xf3, 0x62, 0x42, 0x40, 0x06, 0x09, 0x06, 0x89, 0x89 } },
+        { { 0x31, 0x98, 0x07, 0x9e, 0x22, 0x3f, 0xe3, 0xbb, 0x43, 0x0d, 0x5b, 0xf5, 0x82, 0x6a, 0xe2, 0x51, 0xf5, 0xde, 0x47, 0x4e, 0xe3, 0x76, 0xdb, 0x76, 0x5b, 0xe0, 0x9c, 0x2b, 0x14, 0xe1, 0x5c, 0xa9 },
+          { 0x17, 0x28, 0x4c, 0x88, 0x57, 0xc9, 0x24, 0xc0, 0xd1, 0x53, 0xed, 0x64, 0x30, 0xd4, 0x15, 0x48, 0x7b, 0xfe, 0x03, 0x5c, 0x75, 0xcf, 0x0d, 0xc3, 0x9a, 0x75, 0x7e, 0xcd, 0xb2, 0xe5, 0xef, 0x79 } },
+        { { 0x26, 0x68, 0xbf, 0xfd, 0xf7, 0xa6, 0xd2, 0x3b, 0x5c, 0xa6, 0x60, 0x9c, 0x58, 0x99, 0x8d, 0x2d, 0x21, 0xba, 0x27, 0x24, 0x7a, 0xb2, 0x58, 0xd0, 0x4e, 0x31, 0x1a, 0xc1, 0xf9, 0xfa, 0xd0, 0x70 },
+          { 0x18, 0x61, 0xa4, 0xc0, 0x02, 0x28, 0x5d, 0xc4, 0x44, 0x32, 0x59, 0x2e, 0xeb, 0x32, 0xba, 0x01, 0xff, 0xca, 0xf6, 0xc6, 0xb0, 0x98, 0xb7, 0xdf, 0x7b, 0x9e, 0x64, 0xee, 0x7b, 0x0b, 0x03, 0x14 } }
+    },
+    {
+        { { 0x29, 0x89, 0x37, 0xeb, 0x47, 0x2d, 0x72, 0x08, 0x35, 0x68, 0x17, 0x7d, 0x46, 0xcd, 0xc6, 0x4e, 0x92, 0x9f, 0x6b, 0x7b, 0x15, 0x5d, 0x4a, 0xb3, 0x2e, 0xee, 0x24, 0x31, 0x77, 0xec, 0x2a, 0xbc },
+          { 0x0d, 0xcb, 0xb8, 0x9b, 0xe4, 0x6a, 0xf3, 0xa3, 0xa0, 0x1a, 0xc1, 0xf4, 0x41, 0xd6, 0xfd, 0xd4, 0xad, 0x4a, 0xd0, 0xb1, 0x77, 0xbd, 0x07, 0x7e, 0xb4, 0x75, 0x56, 0xcd, 0x5b, 0x86, 0xa0, 0x09 } },
+        { { 0x29, 0xae, 0x80, 0xb1, 0x46, 0x5f, 0x6c, 0x4a, 0x1f, 0x00, 0xd7, 0x6d, 0x88, 0xd4, 0x08, 0x77, 0x01, 0xbb, 0xe5, 0x64, 0xcc, 0x58, 0x63, 0x7b, 0xe5, 0xff, 0x4e, 0xe5, 0xbb, 0x1e, 0x54, 0x39 },
+          { 0x3a, 0x74, 0x27, 0xde, 0xa0, 0xc3, 0x41, 0x59, 0xff, 0xd8, 0xf9, 0xd7, 0x82, 0xd7, 0x5a, 0x3b, 0x31, 0xe3, 0x18, 0xc8, 0x97, 0x23, 0x05, 0xaa, 0xe4, 0x46, 0xfa, 0xaf, 0xf8, 0x21, 0x72, 0x60 } },
+        { { 0x27, 0xc3, 0x91, 0xb2, 0xba, 0x77, 0x7c, 0xbc, 0xd2, 0x7d, 0xa5, 0xbd, 0x2c, 0x1f, 0x57, 0xf0, 0xc5, 0x63, 0x08, 0xda, 0x77, 0x44, 0xcb, 0x38, 0xfb, 0x89, 0xae, 0x91, 0xa7, 0xa6, 0x14, 0x7e },
+          { 0x15, 0x32, 0x2b, 0xfb, 0x59, 0x97, 0x5c, 0x96, 0xf3, 0xcb, 0x25, 0xcd, 0xe4, 0x84, 0x61, 0x57, 0x8c, 0x21, 0x25, 0xee, 0x1b, 0x49, 0x3a, 0x67, 0xc8, 0xe1, 0x65, 0x8c, 0x9e, 0x19, 0x82, 0x02 } },
+        { { 0x31, 0x7a, 0x71, 0x6d, 0x8d, 0x7f, 0xf3, 0x9a, 0x88, 0xa3, 0xe8, 0x39, 0x83, 0x1a, 0x60, 0x58, 0x2a, 0x58, 0x45, 0xa6, 0x27, 0x34, 0x58, 0x3b, 0xd8, 0xdb, 0x4b, 0x64, 0x28, 0xd6, 0x0f, 0xa9 },
+          { 0x16, 0xa8, 0x65, 0x23, 0xdb, 0x94, 0x62, 0x51, 0xb1, 0xfc, 0x02, 0x0c, 0xb0, 0xfa, 0xc2, 0x53, 0xa5, 0xee, 0xf0, 0xef, 0x7e, 0xf1, 0xdd, 0x67, 0x80, 0xea, 0xad, 0x9d, 0x3b, 0x40, 0xea, 0x6f } },
+        { { 0x1b, 0xb8, 0x23, 0xc8, 0xf5, 0xc5, 0xad, 0x3f, 0xe2, 0x31, 0xab, 0xcd, 0x7d, 0x8d, 0x8a, 0xac, 0x06, 0x8f, 0x46, 0x54, 0xac, 0x4d, 0x3b, 0x86, 0x17, 0x09, 0x40, 0x62, 0xe3, 0xc8, 0x56, 0x64 },
+          { 0x22, 0x79, 0x79, 0x7c, 0xa3, 0xe8, 0x19, 0x92, 0x91, 0xd3, 0xef, 0x38, 0xca, 0x15, 0x1d, 0x71, 0x8d, 0x4d, 0x62, 0xa3, 0xa3, 0x06, 0xa4, 0xfd, 0xbc, 0x48, 0xb3, 0x28, 0x1f, 0x1a, 0x36, 0x82 } },
+        { { 0x15, 0x47, 0x80, 0x08, 0x1e, 0x33, 0x6d, 0xdd, 0x8d, 0x1f, 0x2a, 0xe0, 0xa8, 0x3e, 0x6b, 0x6b, 0xe7, 0x8a, 0x8d, 0x4b, 0x9b, 0x91, 0xc0, 0x18, 0xd0, 0x58, 0xb4, 0x35, 0x1f, 0x5d, 0xea, 0xbb },
+          { 0x17, 0x26, 0xf5, 0x48, 0xbd, 0x96, 0x86, 0x16, 0x79, 0xc4, 0xdf, 0xb0, 0x0e, 0x55, 0x2b, 0x99, 0xf8, 0x82, 0x56, 0x9e, 0xdd, 0x1b, 0xd5, 0x3e, 0x12, 0x34, 0xb5, 0xf8, 0xe7, 0x90, 0xe4, 0x88 } },
+        { { 0x08, 0x7e, 0x65, 0x2a, 0x6b, 0xbe, 0x4f, 0x42, 0x31, 0x6c, 0xee, 0x16, 0x8f, 0x7a, 0xed, 0x32, 0x9d, 0x88, 0xd4, 0xb9, 0xc7, 0xe6, 0x5e, 0x2c, 0x4d, 0xb9, 0xdd, 0x39, 0x6b, 0x2f, 0xd5, 0x30 },
+          { 0x05, 0x60, 0x7a, 0xdf, 0x3a, 0xc8, 0xf1, 0x46, 0xee, 0x78, 0x07, 0x13, 0xad, 0x43, 0x98, 0x33, 0x07, 0x6f, 0x53, 0x9f, 0x0a, 0xd9, 0x3f, 0x42, 0x58, 0x00, 0x6f, 0x80, 0x0e, 0x22, 0xf0, 0x9b } },
+        { { 0x36, 0xa7, 0xed, 0x45, 0x35, 0x13, 0xb8, 0x0b, 0x57, 0x8b, 0x69, 0xca, 0x27, 0x06, 0x93, 0xcf, 0x96, 0x11, 0x64, 0x90, 0x77, 0x32, 0xf4, 0x35, 0x8a, 0x96, 0xbb, 0xfc, 0xe2, 0x91, 0x44, 0x89 },
+          { 0x2c, 0x23, 0x2e, 0x38, 0xbe, 0x68, 0x1d, 0x6f, 0xb0, 0x4e, 0x65, 0x49, 0xbc, 0x43, 0x92, 0x96, 0xd4, 0xdc, 0x07, 0x0b, 0x93, 0x30, 0xad, 0x73, 0xe5, 0xba, 0xc4, 0x50, 0xec, 0xb9, 0x4a, 0x01 } }
+    },
+    {
+        { { 0x1c, 0x87, 0xc2, 0xc2, 0x3d, 0x70, 0xd7, 0x46, 0x20, 0xbe, 0x43, 0x02, 0x45, 0xda, 0x7c, 0xd0, 0xdc, 0x02, 0x8e, 0x34, 0x8b, 0xed, 0x2b, 0xa3, 0x95, 0x09, 0x57, 0x5e, 0x3b, 0x27, 0x8f, 0xdf },
+          { 0x3e, 0xea, 0x06, 0x1f, 0xfe, 0x99, 0x83, 0x8f, 0xad, 0x26, 0x60, 0x30, 0x1a, 0xf3, 0xc5, 0x8e, 0xa4, 0x01, 0xb7, 0x39, 0x9b, 0x3a, 0x5a, 0x51, 0x4e, 0xf4, 0x68, 0x3d, 0x1b, 0x37, 0xb6, 0x02 } },
+        { { 0x3b, 0xdf, 0x30, 0xad, 0x0c, 0xe8, 0xad, 0x7c, 0xab, 0x40, 0x98, 0x10, 0x2d, 0x59, 0x43, 0xfb, 0x04, 0x7f, 0x77, 0xa6, 0x86, 0x9f, 0xde, 0x72, 0xe0, 0xb2, 0xe0, 0x66, 0xb3, 0x47, 0x95, 0x57 },
+          { 0x36, 0x6e, 0x1f, 0x6e, 0x9f, 0x05, 0xd0, 0xc3, 0xc8, 0x42, 0x4b, 0x6a, 0x78, 0x65, 0x82, 0x8f, 0x22, 0xc3, 0xee, 0xb2, 0xaf, 0xe4, 0x66, 0x55, 0xc5, 0xcb, 0xda, 0xbb, 0x9a, 0x22, 0x02, 0xf0 } },
+        { { 0x3e, 0xb0, 0x27, 0xe7, 0x31, 0x26, 0x38, 0xe9, 0x11, 0x96, 0xf3, 0x87, 0xb5, 0x40, 0xab, 0xf2, 0x0f, 0x13, 0xdc, 0x61, 0xb8, 0xf8, 0x36, 0x6c, 0xe5, 0x04, 0x11, 0x10, 0x2d, 0xfc, 0x8e, 0x5c },
+          { 0x2b, 0x81, 0x72, 0x51, 0x8e, 0xef, 0x5e, 0x81, 0x99, 0xfd, 0x8c, 0xf6, 0x55, 0xb9, 0xfd, 0xc3, 0x24, 0x9c, 0xbb, 0xb3, 0x35, 0x7c, 0x65, 0x16, 0x0d, 0x43, 0x7d, 0x4d, 0xe8, 0x27, 0x2b, 0x76 } },
+        { { 0x27, 0x21, 0x11, 0x23, 0x6f, 0x88, 0x94, 0x4f, 0xda, 0x4a, 0xaf, 0x69, 0xcf, 0xc5, 0x64, 0x82, 0x7f, 0x8e, 0x27, 0x37, 0x25, 0xa0, 0x71, 0x20, 0xd6, 0x62, 0xe1, 0xef, 0x06, 0xf6, 0xb5, 0x60 },
+          { 0x29, 0x2f, 0x98, 0x2a, 0x16, 0xac, 0x61, 0x30, 0x28, 0x5d, 0x52, 0x69, 0x30, 0xb3, 0x46, 0x96, 0xca, 0x79, 0x68, 0xdd, 0x3e, 0xc8, 0x7b, 0x47, 0x30, 0x81, 0x51, 0x08, 0x75, 0xdb, 0x03, 0x21 } },
+        { { 0x11, 0xf9, 0x99, 0x62, 0xbc, 0xe1, 0x4a, 0x4d, 0xfc, 0x38, 0x4f, 0x12, 0xfa, 0xb2, 0xf9, 0x1b, 0xb9, 0xe7, 0x9f, 0x6c, 0x70, 0x96, 0xd3, 0x68, 0x6f, 0x3a, 0x8c, 0xde, 0x8e, 0x9b, 0x0d, 0x99 },
+          { 0x35, 0x9e, 0xf7, 0x69, 0x87, 0x53, 0x2a, 0xc3, 0x57, 0x1f, 0x86, 0x95, 0x0f, 0x8f, 0x4d, 0x08, 0x5d, 0x42, 0x0f, 0xea, 0x8d, 0xb7, 0x97, 0xc4, 0xf1, 0x64, 0x22, 0x16, 0x24, 0x7e, 0xa4, 0xa3 } },
+        { { 0x1d, 0x83, 0xbb, 0x3e, 0x40, 0x72, 0xd2, 0x57, 0x29, 0xd0, 0x0c, 0x41, 0xbd, 0x74, 0x7f, 0x41, 0x88, 0x76, 0xf0, 0xd3, 0xbf, 0x78, 0x83, 0x96, 0xe4, 0xfc, 0xd1, 0x66, 0xe8, 0x15, 0x5d, 0x42 },
+          { 0x29, 0x0e, 0x41, 0xf3, 0x64, 0xe7, 0x4a, 0xa2, 0x1e, 0xb8, 0x97, 0x1e, 0xee, 0x48, 0x84, 0x21, 0xf4, 0x96, 0x5f, 0xad, 0x19, 0x8b, 0xb8, 0x39, 0x24, 0x54, 0x69, 0x2d, 0x0c, 0xf8, 0xf6, 0xed } },
+        { { 0x0c, 0x25, 0x5a, 0xf5, 0xdf, 0x4e, 0x27, 0x51, 0xc6, 0xb6, 0x4a, 0xb7, 0xb1, 0x83, 0xf5, 0x3c, 0x91, 0x5d, 0xc7, 0x58, 0x7f, 0x47, 0x47, 0x39, 0x49, 0x19, 0x12, 0x64, 0x79, 0x3c, 0xa7, 0xeb },
+          { 0x12, 0xfc, 0xc9, 0x99, 0xd8, 0x8d, 0xd3, 0xa4, 0x41, 0x60, 0x0c, 0x3a, 0x48, 0xd6, 0x23, 0x9b, 0xd1, 0x22, 0x16, 0xea, 0x95, 0xd1, 0x87, 0xe9, 0x07, 0xf3, 0x41, 0x4a, 0x10, 0x4f, 0x0c, 0xc3 } },
+        { { 0x18, 0x1c, 0xf3, 0xa1, 0xfc, 0xce, 0x97, 0x8a, 0x1f, 0xcb, 0xc1, 0xca, 0x11, 0x3b, 0xa0, 0x7a, 0x00, 0x0c, 0x92, 0xee, 0xe9, 0x87, 0x71, 0x93, 0x1f, 0x04, 0x54, 0xd1, 0x4a, 0x15, 0x41, 0x0c },
+          { 0x12, 0xa3, 0x73, 0x9b, 0x81, 0x51, 0x62, 0x08, 0xbd, 0x73, 0x9f, 0xb2, 0xc0, 0x18, 0x1a, 0x10, 0x4c, 0x4d, 0x02, 0xd0, 0x71, 0x22, 0xf3, 0x1c, 0xbc, 0xff, 0x8b, 0x4f, 0x38, 0x68, 0x1b, 0x59 } }
+    },
+    {
+        { { 0x04, 0xa7, 0xd9, 0x4a, 0xfe, 0xab, 0x87, 0x48, 0x08, 0xa4, 0xbc, 0xba, 0xa6, 0xc3, 0xe0, 0x20, 0x69, 0xff, 0x2b, 0xae, 0x51, 0xab, 0xe0, 0xb7, 0xb8, 0x9b, 0xd9, 0x6e, 0x17, 0xc7, 0xd6, 0xee },
+          { 0x17, 0xcd, 0xd0, 0xdb, 0x75, 0xc6, 0xfc, 0x6b, 0x79, 0x25, 0x2c, 0xba, 0x29, 0xee, 0x44, 0x41, 0xcb, 0xc2, 0x07, 0xb5, 0x74, 0x5c, 0x7a, 0x20, 0xbb, 0x2e, 0x18, 0xba, 0x0b, 0x77, 0x7f, 0xb6 } },
+        { { 0x03, 0xca, 0xfd, 0xcd, 0xf8, 0x41, 0xf4, 0xa1, 0x42, 0x65, 0x72, 0xf5, 0xda, 0x2c, 0x1d, 0x18, 0xf7, 0x77, 0xdb, 0x49, 0x79, 0x8e, 0x5e, 0xdb, 0xd7, 0x07, 0x04, 0x96, 0x41, 0xf4, 0x54, 0xd4 },
+          { 0x0f, 0x7a, 0x3c, 0xbc, 0x23, 0xe9, 0xe8, 0xfc, 0x66, 0x0c, 0x38, 0x85, 0x60, 0x3a, 0x18, 0x30, 0x47, 0xa0, 0xd7, 0x9b, 0x1b, 0xd1, 0x7d, 0x30, 0xbd, 0x39, 0x58, 0x67, 0x59, 0x18, 0xc8, 0x45 } },
+        { { 0x0e, 0x80, 0x6f, 0x53, 0xc3, 0x8a, 0x15, 0xd2, 0x62, 0xb1, 0x08, 0x27, 0x23, 0xe5, 0x81, 0x11, 0x0c, 0x92, 0xd5, 0xea, 0x42, 0xeb, 0xc1, 0xb5, 0x61, 0x9b, 0xe9, 0xb5, 0xcd, 0xd0, 0xd2, 0xb5 },
+          { 0x2d, 0xec, 0xcd, 0x2a, 0xd2, 0x3a, 0x3f, 0x56, 0xb2, 0x29, 0x6f, 0x38, 0xe6, 0x6a, 0x85, 0x40, 0xf6, 0xda, 0x93, 0x57, 0x10, 0x94, 0xa1, 0x25, 0x81, 0x22, 0x96, 0x04, 0x01, 0x8c, 0xaa, 0x90 } },
+        { { 0x0d, 0x7e, 0x60, 0x10, 0x86, 0xf3, 0xf4, 0xa8, 0xcc, 0xc0, 0x51, 0x21, 0xfe, 0xb1, 0x9b, 0x72, 0x1b, 0x65, 0x18, 0x69, 0x43, 0x49, 0xe1, 0xde, 0x44, 0xa3, 0x84, 0x71, 0x15, 0xfd, 0xc1, 0x87 },
+          { 0x19, 0xad, 0x1d, 0x7d, 0xf7, 0xd7, 0x1b, 0x1e, 0x72, 0xe2, 0xbc, 0x35, 0x81, 0x88, 0x1b, 0xcb, 0x2a, 0x7b, 0x26, 0xb8, 0x80, 0x49, 0x31, 0x84, 0xbf, 0x9a, 0x49, 0x3a, 0xbd, 0xa4, 0xf6, 0x24 } },
+        { { 0x1a, 0xd5, 0x24, 0x3f, 0xe0, 0x23, 0xba, 0x16, 0xa1, 0x03, 0xfa, 0x50, 0xb2, 0xd6, 0x52, 0xb2, 0xf0, 0x95, 0x22, 0xc2, 0x5f, 0x83, 0x49, 0xfd, 0xb7, 0x3f, 0x33, 0xde, 0xbf, 0xc6, 0x13, 0xed },
+          { 0x39, 0x24, 0x8c, 0x8b, 0x26, 0xc7, 0x34, 0x57, 0x17, 0x24, 0xb0, 0x3a, 0xbc, 0x59, 0x07, 0x5d, 0xef, 0xbd, 0xc6, 0xa3, 0xf5, 0x58, 0x82, 0xd2, 0xb8, 0x8b, 0xb5, 0xaa, 0x7f, 0xbd, 0xbc, 0x6b } },
+        { { 0x27, 0xed, 0x6a, 0x97, 0x43, 0x29, 0x81, 0x75, 0x92, 0x46, 0xb9, 0x3c, 0xbc, 0xa5, 0x5c, 0x80, 0x2a, 0x6d, 0x0c, 0x6a, 0xd0, 0x9d, 0x72, 0xbb, 0x4c, 0x95, 0x44, 0x36, 0x18, 0xd4, 0xdc, 0xf2 },
+          { 0x38, 0xb6, 0xf3, 0x9d, 0x5c, 0x97, 0x25, 0xb8, 0x82, 0xca, 0xef, 0xac, 0x02, 0x84, 0x71, 0x36, 0x8c, 0x9a, 0x57, 0xbe, 0x4e, 0xc7, 0x17, 0xe3, 0x52, 0xf2, 0xd6, 0x1d, 0xe8, 0x30, 0xc7, 0xb8 } },
+        { { 0x2d, 0x24, 0x5c, 0x96, 0x7d, 0x58, 0xc4, 0xfb, 0xf6, 0xa4, 0xf0, 0x5a, 0x8e, 0xe4, 0xf0, 0xcd, 0xe2, 0x4d, 0x7e, 0x52, 0x4e, 0xf0, 0x74, 0x27, 0x3b, 0x52, 0xca, 0x00, 0xe1, 0xf0, 0xe2, 0x74 },
+          { 0x35, 0x6c, 0x0f, 0xbd, 0x11, 0x79, 0xfc, 0x56, 0x0f, 0x88, 0x34, 0x73, 0x15, 0x7d, 0xe7, 0x9e, 0x84, 0xfb, 0x82, 0x0f, 0x21, 0x73, 0xe1, 0x8c, 0xd3, 0x56, 0x3d, 0xac, 0x8c, 0x59, 0x3a, 0xf0 } },
+        { { 0x2d, 0x07, 0x8d, 0x09, 0x2b, 0x7d, 0xd9, 0x13, 0x4a, 0x93, 0xe5, 0x2b, 0xa4, 0x76, 0xa1, 0x08, 0xbe, 0xf9, 0xee, 0x3c, 0xcc, 0xb4, 0xda, 0x86, 0xf5, 0x92, 0xb3, 0x1d, 0x70, 0x7b, 0xdb, 0xbc },
+          { 0x28, 0xd7, 0x3b, 0xc6, 0xbe, 0xc3, 0xb0, 0xda, 0x5e, 0x18, 0x27, 0x9d, 0x78, 0x2f, 0x8b, 0x24, 0x4e, 0x28, 0x68, 0xd2, 0x14, 0xe5, 0x49, 0xdc, 0x16, 0x60, 0xe9, 0xd3, 0xf7, 0x65, 0xcb, 0xd1 } }
+    },
+    {
+        { { 0x03, 0x88, 0x38, 0x29, 0xa0, 0x4c, 0x4d, 0xc1, 0x6f, 0x43, 0x92, 0x31, 0x65, 0xa2, 0x60, 0x5e, 0x60, 0x1c, 0x29, 0x7b, 0x1b, 0x67, 0xff, 0x42, 0x9d, 0x67, 0xc7, 0x17, 0x1b, 0x27, 0x83, 0x0a },
+          { 0x01, 0x53, 0xe3, 0x59, 0xa9, 0x0c, 0x86, 0x41, 0x9d, 0x3b, 0x10, 0x83, 0xe9, 0x58, 0xfe, 0x70, 0x1a, 0x5b, 0x4a, 0x93, 0xaf, 0x23, 0x5e, 0xdc, 0x5b, 0x57, 0xfa, 0xd5, 0x8b, 0xb0, 0x26, 0x17 } },
+        { { 0x34, 0xf1, 0x3a, 0x35, 0x02, 0x26, 0x0d, 0x60, 0xb4, 0x03, 0xb5, 0xa3, 0xb5, 0x33, 0x9d, 0xbc, 0x16, 0x4e, 0x01, 0xb3, 0xda, 0x3b, 0x7f, 0xf7, 0xc8, 0x6a, 0xa7, 0x88, 0x9e, 0x4f, 0x5a, 0x3d },
+          { 0x08, 0x7f, 0x47, 0x7d, 0x2a, 0x01, 0x33, 0x29, 0xb3, 0x8c, 0xa0, 0x8a, 0x85, 0xc7, 0xb5, 0x44, 0x81, 0xb2, 0xbb, 0xb7, 0x20, 0x84, 0xeb, 0xc6, 0xef, 0x00, 0x26, 0x19, 0xd6, 0xcf, 0xbf, 0xd7 } },
+        { { 0x16, 0x9c, 0x3d, 0xe2, 0x8b, 0xca, 0xb4, 0xf0, 0xf2, 0x89, 0x48, 0xeb, 0xa0, 0xab, 0x2e, 0xf9, 0xc8, 0x6f, 0x6d, 0x6d, 0x4e, 0x49, 0xba, 0x18, 0x98, 0xa4, 0xbd, 0x0a, 0xf6, 0x53, 0x06, 0x06 },
+          { 0x2b, 0xe6, 0x4e, 0x89, 0x3f, 0xe4, 0x65, 0xd6, 0x1f, 0x99, 0xaa, 0x0d, 0x54, 0x8b, 0x7e, 0x59, 0x15, 0xfb, 0x97, 0x93, 0xdb, 0x5e, 0x94, 0x33, 0x69, 0x29, 0x57, 0x07, 0x85, 0xb0, 0x87, 0x56 } },
+        { { 0x25, 0xb7, 0xa6, 0x0a, 0xb5, 0xa3, 0xa7, 0x89, 0xa1, 0x42, 0xc0, 0x69, 0xa4, 0x04, 0xd7, 0x25, 0x5f, 0xe5, 0xbd, 0x6a, 0xd7, 0x31, 0xf7, 0xa5, 0xd7, 0xf4, 0x21, 0xc8, 0x2b, 0x43, 0x12, 0xb2 },
+          { 0x39, 0x6c, 0xcc, 0xab, 0x19, 0x36, 0xe8, 0x27, 0x36, 0x4c, 0xf8, 0x4f, 0xde, 0x82, 0x91, 0x52, 0xe9, 0x49, 0xf8, 0xcc, 0x6e, 0x88, 0xce, 0x06, 0xfb, 0x3e, 0xdc, 0x4c, 0x7c, 0x22, 0x76, 0xeb } },
+        { { 0x3b, 0x43, 0x46, 0xf9, 0xf6, 0x7f, 0xb0, 0x9c, 0x5d, 0x36, 0x08, 0xc9, 0x57, 0x70, 0xf2, 0xea, 0x6b, 0xd4, 0xe8, 0x2e, 0x73, 0x8e, 0x31, 0xf1, 0xd6, 0xea, 0xe2, 0x03, 0x89, 0x34, 0x08, 0xe7 },
+          { 0x39, 0x4b, 0x8a, 0x86, 0x79, 0x47, 0x5b, 0x35, 0x4e, 0x53, 0x6d, 0xcc, 0x31, 0x6d, 0x23, 0x4c, 0xc1, 0x82, 0x81, 0x72, 0x33, 0xa9, 0x69, 0x88, 0xec, 0x23, 0xd7, 0x44, 0xc3, 0x4e, 0x20, 0x09 } },
+        { { 0x29, 0xd9, 0x94, 0x59, 0xbb, 0x28, 0x63, 0xcc, 0x4b, 0x10, 0x5e, 0xb1, 0xda, 0x91, 0x3e, 0xd7, 0x1f, 0xaf, 0xff, 0x67, 0x61, 0xd2, 0xfe, 0xb1, 0x79, 0x2e, 0xc8, 0xd6, 0x91, 0xb2, 0x6d, 0xf1 },
+          { 0x10, 0xf9, 0x4c, 0xfb, 0xfe, 0xd7, 0x5a, 0x0e, 0x6a, 0x3f, 0x3f, 0x42, 0x75, 0xd5, 0x78, 0xc9, 0x79, 0x8c, 0xdc, 0x16, 0xf9, 0xa7, 0x95, 0xe9, 0x59, 0x86, 0xa3, 0xf7, 0xec, 0xd4, 0xce, 0xbd } },
+        { { 0x21, 0x9a, 0xf7, 0xfc, 0x99, 0x11, 0x83, 0x8a, 0x61, 0x29, 0x0c, 0x8c, 0x41, 0x40, 0x57, 0xc4, 0xe1, 0x12, 0xb0, 0x6b, 0x1e, 0x93, 0xd6, 0xbf, 0x30, 0xf9, 0x4d, 0x79, 0xb4, 0x8b, 0x70, 0x29 },
+          { 0x08, 0x34, 0xb7, 0x5f, 0xb9, 0xf0, 0x3b, 0x26, 0xe8, 0x34, 0x65, 0xe3, 0x7b, 0x21, 0x74, 0x89, 0xb3, 0xfc, 0x53, 0xfc, 0x2d, 0xd0, 0x99, 0x56, 0xdb, 0x87, 0x5d, 0x26, 0x3b, 0xd2, 0xf1, 0xb4 } },
+        { { 0x11, 0xe0, 0xbd, 0x3f, 0x57, 0xf9, 0x8e, 0x70, 0x19, 0xd3, 0xe6, 0x36, 0x7a, 0x0f, 0x1b, 0x38, 0x94, 0x0b, 0xf0, 0x67, 0x55, 0x72, 0xaf, 0x8f, 0x5e, 0x82, 0xd5, 0xb0, 0x7f, 0x0d, 0x41, 0xa1 },
+          { 0x18, 0x40, 0xaa, 0x30, 0x75, 0xfe, 0x74, 0xa3, 0x47, 0x4a, 0xb3, 0x4d, 0x24, 0x00, 0xf4, 0x39, 0xe9, 0x9d, 0x66, 0x6a, 0xdb, 0x52, 0x0b, 0x38, 0x4e, 0xaa, 0xc6, 0x85, 0x1b, 0xdd, 0xb1, 0xf6 } }
+    },
+    {
+        { { 0x00, 0x33, 0xd7, 0xfd, 0xd7, 0xc9, 0x54, 0x5c, 0x78, 0xc0, 0x73, 0xaf, 0xfa, 0x39, 0x04, 0x3a, 0xb5, 0x9e, 0xc2, 0xd9, 0xd3, 0x8e, 0x93, 0xb5, 0x79, 0x9b, 0xd2, 0x11, 0x55, 0xc1, 0x1b, 0x13 },
+          { 0x08, 0x1a, 0xd1, 0x58, 0x83, 0xa7, 0x39, 0x78, 0x4a, 0xf9, 0x9a, 0xef, 0x8c, 0x43, 0x89, 0x7f, 0x8e, 0xb3, 0x60, 0xde, 0x2b, 0x71, 0x95, 0xd0, 0xfc, 0xf4, 0xf0, 0xed, 0xf4, 0x60, 0xfd, 0xba } },
+        { { 0x2b, 0xda, 0xfa, 0xa6, 0x73, 0x09, 0x01, 0xb2, 0xf5, 0xc4, 0x8b, 0x2d, 0xfa, 0x22, 0x19, 0xc4, 0x28, 0x37, 0xb2, 0x0a, 0xc0, 0xb5, 0xec, 0xe2, 0x32, 0xce, 0x31, 0xe4, 0xff, 0xbb, 0xf6, 0x24 },
+          { 0x31, 0x65, 0x2b, 0x15, 0x16, 0x65, 0x1e, 0x65, 0x8c, 0x7e, 0x51, 0xf8, 0x97, 0xef, 0x87, 0xc7, 0x01, 0x76, 0xd4, 0x2e, 0xa7, 0x39, 0x24, 0xe0, 0x2f, 0x71, 0xb1, 0xa0, 0xb1, 0x61, 0x7c, 0xe8 } },
+        { { 0x02, 0x3f, 0xa9, 0xa9, 0x3c, 0xef, 0x0d, 0xd9, 0xa7, 0x59, 0x2b, 0x98, 0x59, 0x93, 0x4f, 0x15, 0xe8, 0x4a, 0xb2, 0xfd, 0x80, 0xb6, 0x67, 0x07, 0x47, 0x0a, 0x72, 0xef, 0x1a, 0x06, 0xd4, 0x92 },
+          { 0x15, 0x07, 0x90, 0x70, 0x68, 0x37, 0xbc, 0x45, 0xb3, 0xe3, 0x1f, 0x5f, 0x05, 0xb2, 0x85, 0x16, 0x50, 0xc1, 0xba, 0x74, 0x63, 0x3d, 0xb7, 0x9d, 0xd9, 0xd7, 0x8c, 0xf3, 0x83, 0xe5, 0x74, 0x30 } },
+        { { 0x38, 0x98, 0x40, 0xa4, 0xd9, 0x2b, 0xd3, 0x51, 0x59, 0x08, 0x67, 0x6c, 0xe4, 0x31, 0x04, 0x8c, 0x27, 0xa9, 0x25, 0x98, 0x35, 0xb6, 0x5c, 0x86, 0x0a, 0xb6, 0xc7, 0xaf, 0x5e, 0xab, 0xfe, 0x23 },
+          { 0x3c, 0xaa, 0x4b, 0x20, 0xdc, 0xdf, 0x66, 0x03, 0x45, 0x19, 0xdc, 0x8e, 0xe5, 0x24, 0xfc, 0x65, 0x30, 0x4a, 0xb6, 0x93, 0xf5, 0x25, 0x2e, 0x39, 0x02, 0x8e, 0x90, 0xa6, 0xf3, 0xb9, 0x92, 0x58 } },
+        { { 0x0a, 0x52, 0x7c, 0xb8, 0x01, 0x6b, 0x49, 0x48, 0xb1, 0xf7, 0x5f, 0x17, 0x4b, 0x20, 0x46, 0x5c, 0xf4, 0xd3, 0x07, 0x88, 0x03, 0x4f, 0x8e, 0x33, 0x10, 0x2a, 0x97, 0xeb, 0xdd, 0xbd, 0xee, 0xc9 },
+          { 0x25, 0xe6, 0x6c, 0x29, 0x91, 0x07, 0x3b, 0x17, 0x92, 0x5e, 0x7e, 0xc3, 0x32, 0x70, 0x4c, 0xd0, 0xa4, 0x92, 0x2d, 0x73, 0xb1, 0x31, 0xca, 0x2f, 0xa7, 0x78, 0x17, 0xb7, 0x0f, 0x0f, 0xbb, 0x58 } },
+        { { 0x3a, 0x3a, 0xc7, 0xc9, 0x6b, 0xe3, 0x7b, 0x7b, 0x95, 0xbe, 0x52, 0x4d, 0xf9, 0x3e, 0x3c, 0xac, 0x7f, 0xd9, 0x8e, 0x48, 0xaa, 0x69, 0x94, 0x51, 0x01, 0x65, 0xe0, 0x09, 0x93, 0x44, 0x10, 0x8c },
+          { 0x37, 0xac, 0x65, 0x6f, 0x18, 0x18, 0xff, 0x17, 0xed, 0x98, 0x36, 0xda, 0xe6, 0x44, 0x0d, 0x7e, 0x9e, 0x3e, 0xaf, 0xec, 0x0d, 0x95, 0xea, 0x25, 0x02, 0xdc, 0xc9, 0x0d, 0xf9, 0x21, 0x9b, 0x1b } },
+        { { 0x07, 0x07, 0x19, 0x27, 0x5a, 0xa7, 0x80, 0xa3, 0x47, 0x05, 0x61, 0x73, 0x57, 0x5b, 0xd2, 0xe4, 0x99, 0xbd, 0xfd, 0xe9, 0x18, 0x12, 0x96, 0xf6, 0x33, 0x8e, 0x0c, 0x96, 0x2c, 0x9f, 0x16, 0xda },
+          { 0x23, 0x67, 0xa7, 0xf6, 0x41, 0x51, 0xab, 0x27, 0x06, 0x9c, 0x98, 0x71, 0x3d, 0xb8, 0xe6, 0xe6, 0x9a, 0x4b, 0x0d, 0xb3, 0x49, 0xc1, 0x54, 0xe9, 0x7c, 0xe7, 0x0f, 0x44, 0x11, 0xba, 0x1a, 0xa8 } },
+        { { 0x19, 0x52, 0xa1, 0x2c, 0xed, 0x76, 0x9e, 0xb1, 0xb5, 0x1c, 0x2b, 0x2d, 0x64, 0x1a, 0x07, 0xf5, 0xd3, 0xd6, 0x18, 0x23, 0x97, 0x7c, 0x08, 0xec, 0x34, 0xec, 0x0e, 0xab, 0x45, 0x12, 0x76, 0xa2 },
+          { 0x28, 0x1b, 0x84, 0xd0, 0xfe, 0xc8, 0x89, 0x25, 0x10, 0x15, 0x73, 0x33, 0x06, 0xbb, 0xba, 0xf7, 0xb0, 0x13, 0x68, 0x8f, 0xc5, 0x16, 0xdd, 0xe0, 0x02, 0x73, 0xb8, 0xbf, 0x67, 0x30, 0xc3, 0xf2 } }
+    },
+    {
+        { { 0x2d, 0x05, 0xdf, 0xcf, 0x4e, 0x88, 0x1f, 0x87, 0x53, 0xce, 0x64, 0xa1, 0x80, 0x66, 0xa3, 0xf5, 0x99, 0xc2, 0x66, 0xb7, 0x9b, 0x0c, 0xd3, 0x50, 0x8d, 0x55, 0xd8, 0xe4, 0x4c, 0xc2, 0x34, 0xe4 },
+          { 0x1f, 0x5f, 0x59, 0xe0, 0xc7, 0xfb, 0x45, 0x7a, 0x1c, 0x57, 0xb0, 0x55, 0x63, 0x37, 0x3b, 0xc0, 0xd8, 0x23, 0x08, 0xc7, 0x61, 0x48, 0xc6, 0x90, 0x4d, 0x2f, 0x1b, 0xd4, 0xe4, 0x14, 0xa0, 0xdb } },
+        { { 0x2f, 0xa8, 0x0a, 0x9d, 0x3b, 0xe8, 0xcb, 0x15, 0xe4, 0x3c, 0xe2, 0x91, 0x1a, 0xfa, 0x61, 0x48, 0xc5, 0x8e, 0x22, 0x98, 0x04, 0x95, 0x59, 0x3a, 0xe3, 0x57, 0xa2, 0x0b, 0x5a, 0x49, 0x73, 0x03 },
+          { 0x13, 0xf6, 0x56, 0x14, 0xa4, 0x70, 0x08, 0x72, 0x4e, 0x0c, 0x1e, 0x19, 0xc3, 0x0c, 0x46, 0xb0, 0x01, 0xc7, 0x90, 0xb9, 0xa2, 0x36, 0xc7, 0xa6, 0x2e, 0x87, 0x09, 0x03, 0x8c, 0xc2, 0x33, 0x8f } },
+        { { 0x18, 0xbb, 0x42, 0x7b, 0x71, 0xe7, 0x83, 0xd7, 0xe6, 0xb3, 0xda, 0x93, 0x3b, 0xf0, 0x14, 0x33, 0xa8, 0x51, 0xc6, 0x6d, 0x5a, 0x3e, 0x17, 0xc0, 0x4f, 0x02, 0xb4, 0xdf, 0xf4, 0x7c, 0x62, 0x5a },
+          { 0x38, 0xd7, 0x12, 0x5b, 0xbe, 0x64, 0x7f, 0x23, 0xb9, 0x24, 0xbe, 0x5f, 0x1c, 0xd8, 0x17, 0x3c, 0x27, 0x0a, 0x60, 0x22, 0xec, 0xce, 0xdf, 0x73, 0xfb, 0x25, 0xac, 0x7b, 0xc1, 0xf7, 0xb2, 0xb7 } },
+        { { 0x23, 0x36, 0x31, 0x22, 0x9d, 0x52, 0x0a, 0x3a, 0xd4, 0x97, 0xd6, 0xc5, 0x03, 0x7b, 0xcb, 0x35, 0x53, 0xe4, 0xe5, 0xd9, 0x52, 0x2e, 0xbd, 0x45, 0xbe, 0x17, 0x7e, 0x6f, 0xf1, 0x33, 0x78, 0x9c },
+          { 0x21, 0x79, 0x25, 0xf7, 0x24, 0x98, 0x4b, 0x5d, 0x15, 0x89, 0x07, 0x6b, 0x7d, 0x5b, 0x18, 0x81, 0x3a, 0xed, 0x6e, 0x0f, 0x95, 0x9d, 0x7a, 0xd5, 0xbe, 0xe8, 0x91, 0xd5, 0x45, 0x54, 0xb7, 0x16 } },
+        { { 0x20, 0x43, 0xf6, 0x46, 0x52, 0xe9, 0x50, 0xeb, 0xbf, 0x82, 0x11, 0x67, 0x44, 0x1f, 0x82, 0x67, 0xa6, 0x83, 0x64, 0xbb, 0xff, 0xf3, 0x17, 0x3c, 0x20, 0xe9, 0x52, 0x4d, 0xc3, 0xfd, 0xd7, 0x95 },
+          { 0x0f, 0xe1, 0xad, 0xa7, 0x70, 0x44, 0x2b, 0x72, 0x50, 0x02, 0x20, 0x82, 0xbe, 0xed, 0x66, 0xde, 0xe3, 0x00, 0x7f, 0xa3, 0xcd, 0xbb, 0xae, 0x6d, 0xee, 0xca, 0x3a, 0xd1, 0x98, 0xfd, 0xff, 0xde } },
+        { { 0x20, 0x82, 0xb8, 0x4f, 0x0e, 0xf3, 0x13, 0xcb, 0xc9, 0x88, 0xde, 0xc4, 0xd8, 0x88, 0x76, 0x0f, 0x26, 0xb1, 0x65, 0xa0, 0x04, 0x1d, 0xa4, 0xe9, 0x1e, 0x94, 0xc5, 0xca, 0x43, 0x92, 0x53, 0x66 },
+          { 0x37, 0xa6, 0x06, 0x17, 0x12, 0x10, 0x34, 0xbc, 0xc4, 0x57, 0x5f, 0x89, 0x88, 0x5e, 0xd3, 0xaf, 0xa8, 0x66, 0x4b, 0x26, 0x54, 0x3d, 0xdd, 0x2a, 0x30, 0xe6, 0xa0, 0x6a, 0x45, 0x44, 0x8a, 0xa4 } },
+        { { 0x2d, 0x9c, 0x13, 0xf1, 0x8a, 0x39, 0xa3, 0xe8, 0x44, 0x87, 0x1e, 0xe0, 0x28, 0x5c, 0xe3, 0xae, 0x22, 0xd5, 0xa2, 0x5f, 0xea, 0xd8, 0xe3, 0x61, 0x57, 0xfe, 0xe8, 0x5a, 0x26, 0x26, 0x9e, 0x7c },
+          { 0x24, 0x2f, 0xa7, 0x20, 0x4a, 0xec, 0xc1, 0xc0, 0xf7, 0x13, 0x06, 0x39, 0xec, 0x7c, 0x9a, 0x55, 0xa3, 0x20, 0xbf, 0x2c, 0x91, 0xcb, 0x60, 0x2d, 0xa2, 0x3e, 0xc4, 0x10, 0xe4, 0xe6, 0x22, 0x11 } },
+        { { 0x2b, 0xc3, 0x0c, 0x9f, 0x30, 0x4b, 0xdd, 0x22, 0x99, 0xbd, 0xb5, 0xd3, 0x5d, 0x8b, 0x5f, 0x48, 0x06, 0x2a, 0x8f, 0x50, 0xca, 0x76, 0x09, 0x7a, 0x7f, 0xc7, 0x9e, 0x46, 0x8f, 0xcf, 0x7a, 0xad },
+          { 0x1e, 0x74, 0xef, 0x47, 0xde, 0x56, 0x12, 0x95, 0x24, 0x29, 0xca, 0x11, 0x1b, 0xc7, 0xcb, 0x8d, 0x44, 0xf0, 0x44, 0x80, 0x1d, 0xe6, 0xd9, 0x00, 0x3b, 0xcb, 0x8f, 0x07, 0xdd, 0x7a, 0x63, 0xcd } }
+    },
+    {
+        { { 0x3d, 0xd2, 0x95, 0x44, 0xe9, 0x3f, 0x7d, 0xaa, 0xc4, 0x19, 0x3a, 0xa2, 0x96, 0x08, 0x5f, 0x9f, 0xd8, 0x3f, 0x5e, 0x70, 0x2d, 0x64, 0xa7, 0xed, 0x74, 0x8b, 0x6b, 0x83, 0x8c, 0xbe, 0xe7, 0x8d },
+          { 0x21, 0xd3, 0x57, 0x76, 0xe8, 0x40, 0x1a, 0xfd, 0x8d, 0x43, 0x5f, 0xbf, 0x9b, 0x69, 0x25, 0x42, 0x37, 0x29, 0xfa, 0x3e, 0x63, 0x0e, 0xec, 0xa2, 0x58, 0x1a, 0x72, 0x93, 0x21, 0x5f, 0xc8, 0x37 } },
+        { { 0x10, 0xb0, 0xe7, 0x8f, 0x05, 0xe7, 0x45, 0xbd, 0xef, 0xda, 0x18, 0x78, 0xa7, 0xb2, 0x6f, 0xdf, 0x41, 0x9b, 0x18, 0xd0, 0x9f, 0xcc, 0x8e, 0xee, 0xe7, 0xe1, 0xe0, 0xea, 0x0c, 0xc4, 0xa6, 0xb2 },
+          { 0x3e, 0xbb, 0x75, 0x19, 0xcd, 0xd2, 0xd0, 0x79, 0xfe, 0x09, 0xd1, 0x5f, 0xe1, 0x1c, 0x23, 0x5f, 0x60, 0x15, 0xc0, 0x0c, 0x95, 0x87, 0x74, 0x7d, 0xb7, 0xff, 0x74, 0xed, 0xb1, 0x64, 0xd9, 0x06 } },
+        { { 0x25, 0x7b, 0x2e, 0xfa, 0x57, 0x7b, 0x2e, 0x88, 0xf0, 0xff, 0xfa, 0x9a, 0xa9, 0x6e, 0x8e, 0xbc, 0x51, 0xff, 0xd7, 0x61, 0x8c, 0x99, 0x35, 0xf2, 0x5a, 0xd0, 0xec, 0x45, 0x8e, 0xd6, 0x92, 0x19 },
+          { 0x35, 0xca, 0xd8, 0x9a, 0x34, 0x14, 0x72, 0xce, 0x22, 0x1c, 0x5c, 0xe0, 0xde, 0x3c, 0x86, 0x39, 0xc9, 0x79, 0x04, 0x35, 0x7e, 0x6d, 0xad, 0xe7, 0xb9, 0x24, 0x04, 0x96, 0x6e, 0xa0, 0xa2, 0x6a } },
+        { { 0x3c, 0x5f, 0x6a, 0x45, 0x37, 0xe3, 0xa3, 0x17, 0x50, 0xa9, 0xdb, 0x74, 0x90, 0x83, 0xac, 0x6d, 0x16, 0xcd, 0x3f, 0x46, 0x82, 0xa1, 0x2a, 0x55, 0x7e, 0xf7, 0x0e, 0x6b, 0x7f, 0x91, 0x30, 0x3b },
+          { 0x37, 0xa1, 0xe6, 0x2f, 0x18, 0x70, 0xf4, 0xb5, 0xe1, 0xd9, 0x9b, 0x3f, 0x72, 0x21, 0x16, 0x97, 0x47, 0x91, 0xdc, 0xec, 0x25, 0xf6, 0x2d, 0xcf, 0x58, 0xc7, 0x47, 0xa9, 0xf2, 0x74, 0x38, 0x18 } },
+        { { 0x12, 0xbc, 0x90, 0x97, 0x04, 0x85, 0x9e, 0x72, 0xcc, 0xd6, 0x08, 0xa9, 0xa3, 0x67, 0x1e, 0xcb, 0xaf, 0x75, 0x8f, 0x0d, 0xda, 0x4f, 0xd5, 0xb9, 0xbc, 0xe4, 0xf9, 0xfa, 0xce, 0xbc, 0x0d, 0x06 },
+          { 0x0f, 0x92, 0x6c, 0x39, 0x22, 0x17, 0xea, 0x6d, 0x32, 0xde, 0x8d, 0x69, 0xb9, 0x05, 0xe8, 0x9a, 0xe8, 0xcd, 0x24, 0x1c, 0x2b, 0xa1, 0x01, 0x7b, 0xb2, 0xc1, 0x08, 0xa1, 0x6d, 0x8f, 0x32, 0x76 } },
+        { { 0x20, 0xbe, 0x44, 0xd5, 0x28, 0xe6, 0xb6, 0x8a, 0xd2, 0x25, 0xe8, 0x9a, 0x6a, 0xcd, 0x4b, 0x5c, 0xcf, 0x68, 0x7b, 0x03, 0x2d, 0xf4, 0x12, 0x14, 0x43, 0x6d, 0x1d, 0xb7, 0xf8, 0x93, 0x7d, 0xba },
+          { 0x0f, 0xee, 0x33, 0xcb, 0x0b, 0x41, 0xe4, 0x4d, 0xbd, 0xc2, 0xef, 0xa5, 0x2d, 0x50, 0x5d, 0x34, 0xfd, 0x88, 0x9e, 0xb2, 0x7a, 0xb2, 0x07, 0xea, 0xac, 0xa9, 0x0b, 0x91, 0x8c, 0x8b, 0x16, 0x8f } },
+        { { 0x22, 0x01, 0xc6, 0x00, 0x76, 0x93, 0x33, 0x69, 0xd0, 0x64, 0x9a, 0x00, 0x01, 0x67, 0xb5, 0xb5, 0xbd, 0xb1, 0xbd, 0xc8, 0x32, 0xb3, 0xed, 0x23, 0xc9, 0x45, 0xa7, 0xef, 0x42, 0x70, 0x9f, 0x7c },
+          { 0x18, 0xeb, 0x7b, 0xf2, 0xa9, 0x37, 0xfd, 0xd1, 0xe1, 0x76, 0xea, 0xc5, 0x81, 0x58, 0x31, 0x05, 0xaf, 0xc8, 0x4f, 0x33, 0x04, 0x15, 0x60, 0x03, 0x33, 0x7c, 0x7c, 0x0b, 0x8c, 0x01, 0xd9, 0x4d } },
+        { { 0x1a, 0x79, 0x29, 0xab, 0x0a, 0x31, 0x12, 0x9b, 0xa2, 0x77, 0x01, 0x1c, 0xde, 0x55, 0xe7, 0xaf, 0xb9, 0x70, 0x42, 0x60, 0xfe, 0x56, 0x28, 0x7b, 0x68, 0x4c, 0xc7, 0xad, 0x82, 0xf0, 0xe1, 0xcc },
+          { 0x13, 0x73, 0xdc, 0xb2, 0x8d, 0x30, 0x0d, 0x32, 0xa9, 0x5c, 0x8c, 0xea, 0x13, 0x08, 0x01, 0xa3, 0x97, 0xa3, 0xd4, 0x1f, 0xa5, 0x9e, 0xe6, 0xac, 0x06, 0xb5, 0x4b, 0x52, 0x00, 0x19, 0x9c, 0x46 } }
+    }
+};
+
+#else
+
+const uint8_t FP_ONE[32] = {
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd
+};
+
+const uint8_t PALLAS_B[32] = {
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x74, 0xc2, 0xa5, 0x4b, 0x4f, 0x49, 0x82, 0xf3, 0xa1, 0xa5, 0x5e, 0x68, 0xff, 0xff, 0xff, 0xed
+};
+
+const uint8_t SWU_Z[32] = {
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xf6, 0x57, 0x13, 0x31, 0xe3, 0xa2, 0x99, 0x9b, 0x1d, 0x2d, 0xf0, 0x24, 0x00, 0x00, 0x00, 0x34
+};
+
+const uint8_t SWU_THETA[32] = {
+    0x29, 0x7a, 0x13, 0x3b, 0x8b, 0x69, 0x56, 0x2f, 0x3f, 0x45, 0x40, 0x18, 0x99, 0x80, 0xa2, 0xac, 0x99, 0xef, 0x26, 0x12, 0xd0, 0x70, 0xf1, 0xaa, 0x97, 0xda, 0xb5, 0xad, 0x64, 0x0e, 0x0f, 0xd1
+};
+
+const uint8_t ISO_A[32] = {
+    0x1c, 0x6d, 0x4f, 0x08, 0x71, 0x37, 0xf0, 0xdc, 0x49, 0xf6, 0x3f, 0xf5, 0xda, 0x11, 0x45, 0xbb, 0x93, 0x09, 0x02, 0x52, 0xcf, 0x12, 0x21, 0x08, 0x7f, 0xc5, 0xd2, 0x90, 0x77, 0xbb, 0x08, 0xde
+};
+
+const uint8_t ISO_B[32] = {
+    0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0x5a, 0xa6, 0xde, 0xc3, 0x54, 0x33, 0xe1, 0x33, 0x9b, 0xf7, 0xf2, 0x24, 0x78, 0xff, 0xff, 0xec, 0x3d
+};
+
+const uint8_t ISOGENY_CONSTANTS[13][32] = {
+    { 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x0a, 0xc6, 0xc4, 0xe8, 0xb8, 0xfc, 0x2b, 0xc6, 0xe0, 0x37, 0xa0, 0x1c, 0x71, 0xc7, 0x1d },
+    { 0x33, 0x18, 0x3c, 0x98, 0x13, 0x32, 0xcc, 0x59, 0x05, 0xde, 0xe7, 0x6e, 0x88, 0x3f, 0x5c, 0xa7, 0x50, 0x1f, 0x41, 0xcf, 0xd2, 0x5e, 0xc1, 0xf0, 0x4c, 0x6e, 0x64, 0xf2, 0x32, 0x3d, 0x5c, 0xee },
+    { 0x3f, 0xaf, 0x24, 0x19, 0x81, 0x96, 0x22, 0x4d, 0x32, 0x60, 0xd1, 0xc7, 0x39, 0x4f, 0x73, 0xd9, 0x12, 0x6b, 0x79, 0xab, 0x78, 0xc7, 0x15, 0x2f, 0x6a, 0x3e, 0xe7, 0x79, 0x9d, 0xf5, 0x63, 0x76 },
+    { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe9, 0x85, 0x7a, 0x8f, 0x27, 0xad, 0xa1, 0x85, 0x1f, 0x6e, 0xeb, 0x22, 0xcb, 0x38, 0xe3, 0x8d, 0x91 },
+    { 0x0b, 0xda, 0x21, 0x58, 0xac, 0xc9, 0x2f, 0x21, 0x34, 0xd6, 0x22, 0xe2, 0xca, 0x3a, 0x41, 0xe0, 0xe1, 0x2b, 0x21, 0x6a, 0x24, 0x3a, 0x01, 0xb1, 0x7f, 0xa5, 0x36, 0x08, 0xc4, 0x28, 0x44, 0x57 },
+    { 0x37, 0x78, 0xce, 0xb0, 0xaa, 0xd5, 0x9e, 0x24, 0x50, 0x36, 0x20, 0x03, 0x0b, 0x61, 0x37, 0xe1, 0x76, 0x2a, 0x4b, 0x7c, 0xcb, 0x2d, 0xef, 0x32, 0xa6, 0x0b, 0x71, 0xc1, 0xa8, 0xe1, 0x7d, 0x58 },
+    { 0x2a, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xbc, 0x70, 0x75, 0x40, 0x50, 0xac, 0xa7, 0x17, 0xca, 0xaf, 0x22, 0xd9, 0xb4, 0x25, 0xed, 0x0a },
+    { 0x19, 0x8c, 0x1e, 0x4c, 0x09, 0x99, 0x66, 0x2c, 0x82, 0xef, 0x73, 0xb7, 0x44, 0x1f, 0xae, 0x53, 0xa8, 0x0f, 0xa0, 0xe7, 0xe9, 0x2f, 0x60, 0xf8, 0x26, 0x37, 0x32, 0x79, 0x19, 0x1e, 0xae, 0x77 },
+    { 0x29, 0x82, 0x2f, 0x08, 0x30, 0x7b, 0xd3, 0x1b, 0x0e, 0x0d, 0xab, 0xda, 0x7c, 0xcd, 0xfe, 0x1b, 0x87, 0x60, 0xf3, 0x2b, 0x49, 0x9d, 0xb7, 0xb0, 0x64, 0xb4, 0x68, 0xa1, 0x98, 0x83, 0xc2, 0x03 },
+    { 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x68, 0x05, 0xfa, 0x29, 0x22, 0x8d, 0x90, 0x93, 0x3b, 0xee, 0x9a, 0xdd, 0x15, 0x84, 0xbd, 0xa1, 0xbb },
+    { 0x31, 0xc7, 0x32, 0x05, 0x03, 0x2d, 0xc6, 0xb1, 0xcf, 0x41, 0x34, 0x54, 0x2f, 0x57, 0x62, 0xd1, 0x62, 0xe3, 0xfe, 0x9d, 0x3a, 0xfd, 0x7f, 0x18, 0x0c, 0x0e, 0x69, 0x83, 0xa6, 0x3c, 0x66, 0x83 },
+    { 0x26, 0x6a, 0x6c, 0x12, 0x00, 0x80, 0xda, 0x6c, 0xf0, 0xa2, 0x60, 0x09, 0x22, 0x23, 0xa7, 0xa4, 0x1d, 0xf1, 0xb0, 0x7e, 0x4e, 0xef, 0xdb, 0x60, 0xbf, 0xc7, 0xf3, 0x6a, 0xfa, 0xa4, 0x78, 0x06 },
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x21, 0x33, 0xaa, 0xce, 0x8e, 0x79, 0x75, 0xd8, 0xdc, 0x6d, 0x4c, 0xcf, 0xb0, 0x00, 0x00, 0x08, 0x70 }
+};
+
+const aff_p_t SPEND_AUTH_GEN_TABLE[PALLAS_FB_TEETH][8] = {
+    {
+        { { 0x10, 0x88, 0xa0, 0xc6, 0x32, 0xc1, 0x0d, 0x0b, 0x8a, 0x4b, 0x3d, 0x04, 0x35, 0xfe, 0x21, 0x7d, 0x8f, 0x66, 0xe9, 0xe5, 0x3a, 0xfc, 0x5a, 0x4a, 0x49, 0x0f, 0x24, 0x8c, 0x0a, 0xbc, 0x86, 0x98 },
+          { 0x0c, 0xfb, 0xbe, 0x1e, 0xfe, 0x9c, 0x58, 0x0b, 0x79, 0xd2, 0x5b, 0x84, 0x1a, 0x7b, 0x96, 0x1d, 0x24, 0xec, 0xf6, 0xed, 0x2f, 0x7b, 0x5e, 0x04, 0xe6, 0x90, 0x0a, 0xcd, 0x3d, 0xe4, 0x4a, 0x97 } },
+        { { 0x34, 0x4a, 0x85, 0xc4, 0x64, 0x27, 0x8d, 0xc3, 0x82, 0x3c, 0x81, 0x78, 0xf7, 0xe2, 0xd7, 0xbf, 0x50, 0xc7, 0x58, 0xfe, 0xd4, 0x89, 0xc8, 0xf8, 0x5a, 0x0a, 0x7a, 0xb8, 0xc6, 0xd6, 0xd7, 0x81 },
+          { 0x3a, 0x70, 0x30, 0xe9, 0xac, 0x05, 0x7d, 0xab, 0xab, 0x19, 0xd2, 0x0b, 0x55, 0xf3, 0x1c, 0x2d, 0x45, 0xc4, 0xfe, 0x66, 0xc5, 0xb9, 0x3e, 0xd3, 0x76, 0x3f, 0x33, 0x7d, 0xef, 0xef, 0x33, 0xa2 } },
+        { { 0x3e, 0x37, 0x05, 0x30, 0x93, 0xaf, 0x1f, 0x0e, 0xa7, 0x90, 0x59, 0x82, 0x4a, 0x7e, 0xc6, 0xc9, 0xf0, 0xbd, 0xce, 0x72, 0xd8, 0xfb, 0x33, 0x94, 0x1e, 0xbd, 0xae, 0x56, 0xb2, 0xce, 0x08, 0xda },
+          { 0x06, 0xba, 0x88, 0x24, 0x0b, 0x05, 0x41, 0x8c, 0x92, 0xf7, 0x79, 0x14, 0xd5, 0x76, 0x08, 0x69, 0x91, 0x54, 0x13, 0xd1, 0xa9, 0x4a, 0x29, 0x92, 0xbb, 0x90, 0x83, 0x08, 0x94, 0x5b, 0xcf, 0xa4 } },
+        { { 0x3b, 0xf5, 0xbe, 0x56, 0xd9, 0xf0, 0x1c, 0x66, 0x57, 0x81, 0xc1, 0x54, 0x53, 0x8d, 0x18, 0x59, 0x2c, 0xa2, 0xfd, 0x0c, 0x09, 0xab, 0x4b, 0xf5, 0x86, 0x27, 0xef, 0xfb, 0xe5, 0x0d, 0xa2, 0xb6 },
+          { 0x37, 0xac, 0xed, 0x6b, 0x75, 0xa8, 0x21, 0x78, 0xc0, 0xa0, 0xd3, 0x11, 0x19, 0x31, 0x74, 0x81, 0x9d, 0x53, 0x99, 0x67, 0xbc, 0x9d, 0x45, 0x1f, 0xcc, 0x36, 0x61, 0xaa, 0x46, 0x02, 0x84, 0xb9 } },
+        { { 0x3f, 0xd5, 0xcb, 0xd1, 0x21, 0xba, 0x65, 0xf3, 0xaf, 0x63, 0xf7, 0x01, 0x4b, 0x1f, 0xab, 0xb2, 0x03, 0x99, 0x8f, 0x42, 0x31, 0x52, 0x23, 0xdd, 0xaf, 0xa2, 0xb5, 0x8d, 0xf5, 0x63, 0x0c, 0x1d },
+          { 0x0c, 0xa0, 0x2a, 0x18, 0x3a, 0xe5, 0xaf, 0xc5, 0x2d, 0x31, 0x81, 0x26, 0x29, 0x77, 0xbf, 0x30, 0x3a, 0x1a, 0x90, 0xe3, 0xb4, 0xb2, 0x6b, 0x9c, 0x83, 0x88, 0x4a, 0xcf, 0xc1, 0x59, 0x86, 0xbf } },
+        { { 0x38, 0x19, 0x66, 0xdb, 0x46, 0x39, 0xe8, 0xc4, 0x1b, 0x19, 0xa8, 0x93, 0x0b, 0xd6, 0xc1, 0x32, 0xcf, 0xfc, 0x65, 0xb3, 0x75, 0xc8, 0x2e, 0x15, 0x6e, 0xa6, 0x16, 0xa9, 0x07, 0x8b, 0x60, 0x6b },
+          { 0x3a, 0xa1, 0xd2, 0xca, 0x85, 0x03, 0xa4, 0x87, 0xde, 0xcd, 0x71, 0x86, 0x3d, 0xad, 0x0f, 0x6c, 0xd4, 0x07, 0xc4, 0xec, 0xd1, 0xd7, 0x95, 0x9c, 0xe9, 0xaf, 0xf8, 0x1a, 0x40, 0xab, 0x5f, 0x72 } },
+        { { 0x35, 0x67, 0xe5, 0xc8, 0xa1, 0x59, 0x65, 0xdd, 0xa8, 0x44, 0xce, 0xb1, 0xf2, 0xe7, 0x2f, 0xd0, 0xd6, 0x23, 0xad, 0x12, 0xb3, 0x6c, 0x8f, 0x1b, 0xd4, 0x5e, 0xfb, 0xb2, 0xdf, 0x7e, 0x41, 0xc0 },
+          { 0x02, 0x67, 0xf6, 0xc1, 0x71, 0xa1, 0x94, 0x22, 0xb3, 0x9e, 0xc2, 0x4b, 0xe1, 0xb2, 0x5b, 0x5c, 0x1b, 0xf1, 0x66, 0xd8, 0x54, 0x86, 0x37, 0xc4, 0xf4, 0xa8, 0x5f, 0xa8, 0x27, 0x89, 0xf5, 0x2a } },
+        { { 0x0d, 0xef, 0x81, 0xac, 0x04, 0xc4, 0xfa, 0x1a, 0x67, 0xb0, 0x13, 0xaf, 0xef, 0xdc, 0xda, 0x82, 0x3e, 0xdb, 0xf9, 0x38, 0x74, 0x45, 0x6c, 0xef, 0xa6, 0xdb, 0xf0, 0x84, 0x24, 0xa5, 0x62, 0x53 },
+          { 0x0b, 0x62, 0x01, 0x04, 0xf4, 0x86, 0xfb, 0x29, 0xe0, 0xf8, 0x44, 0xf5, 0xe9, 0x37, 0x57, 0x64, 0x95, 0xa4, 0x1a, 0x8b, 0x6f, 0xd2, 0x88, 0x7d, 0xaa, 0xe0, 0x7d, 0x9a, 0x37, 0x0a, 0x4e, 0x57 } }
+    },
+    {
+        { { 0x0b, 0x20, 0xa8, 0x88, 0x4c, 0xe4, 0xdf, 0xb7, 0x36, 0xed, 0x18, 0x76, 0xd5, 0x63, 0xed, 0x28, 0x0a, 0x60, 0xf5, 0x1c, 0xfc, 0x2b, 0x3a, 0x7c, 0x46, 0x5b, 0x8f, 0xe4, 0xba, 0xd5, 0x9a, 0xd1 },
+          { 0x34, 0x54, 0xcd, 0x60, 0x8b, 0x8f, 0xab, 0x9c, 0xe0, 0x31, 0x90, 0x5f, 0x85, 0x8f, 0xfd, 0x50, 0x46, 0x07, 0x2f, 0xc2, 0x62, 0x10, 0x9b, 0x92, 0x37, 0x90, 0x1b, 0xfd, 0xde, 0x41, 0x2b, 0x2f } },
+        { { 0x1a, 0xd5, 0xe0, 0xbb, 0xc3, 0x65, 0xbf, 0xf6, 0x8c, 0xb2, 0x81, 0x0f, 0xca, 0x03, 0xcc, 0x1f, 0xf9, 0xf3, 0x93, 0x5b, 0xae, 0xf8, 0x9c, 0xd0, 0xfd, 0x46, 0x0f, 0xe4, 0xf2, 0xbc, 0x62, 0xf5 },
+          { 0x18, 0x08, 0xfd, 0xc2, 0x50, 0x18, 0xfd, 0x02, 0x92, 0xcb, 0x1c, 0x7f, 0xbc, 0x1a, 0x79, 0x0b, 0x73, 0x68, 0x4d, 0x24, 0x40, 0x6a, 0x28, 0x41, 0xff, 0x1b, 0xc2, 0x54, 0xcb, 0xa1, 0x4e, 0x39 } },
+        { { 0x32, 0xfc, 0x21, 0x3e, 0xd9, 0x55, 0x1a, 0xe8, 0xe6, 0x94, 0x11, 0x12, 0x7d, 0x2e, 0xfe, 0xfd, 0x8b, 0x42, 0x6b, 0x90, 0xfd, 0xcf, 0xc7, 0xb5, 0x3b, 0xa7, 0x47, 0x4b, 0x83, 0x6e, 0x69, 0xaf },
+          { 0x17, 0xd2, 0xfd, 0x05, 0xf6, 0x19, 0x9a, 0xbf, 0x94, 0x5b, 0xfc, 0xd4, 0xff, 0x9e, 0x73, 0x78, 0x7e, 0xdc, 0x62, 0x5b, 0xc4, 0x55, 0xf6, 0x16, 0x60, 0xe3, 0x0e, 0x84, 0x35, 0xa7, 0x05, 0x19 } },
+        { { 0x0f, 0x5c, 0xce, 0x69, 0x4b, 0xb4, 0xca, 0xf0, 0x05, 0xdc, 0x94, 0x7f, 0xf7, 0xf9, 0x30, 0x38, 0x0b, 0x45, 0xf3, 0x9a, 0xe2, 0xfc, 0x67, 0xe5, 0x78, 0x17, 0xe0, 0x77, 0xe4, 0xf4, 0x08, 0xfa },
+          { 0x21, 0xc5, 0x64, 0x7e, 0x3e, 0x5d, 0x6f, 0x34, 0x05, 0x69, 0x5c, 0x51, 0xf4, 0x99, 0xa8, 0x74, 0xac, 0x59, 0x7b, 0xa0, 0xf5, 0x59, 0xbe, 0x16, 0x2b, 0x0a, 0x11, 0x93, 0x27, 0x97, 0x17, 0x5b } },
+        { { 0x16, 0xfe, 0x38, 0x8f, 0x26, 0x73, 0xbc, 0x5e, 0xd0, 0xa3, 0x2a, 0xde, 0x9e, 0x11, 0x42, 0x78, 0x22, 0x71, 0x48, 0x2d, 0x4c, 0xca, 0xb6, 0x19, 0x52, 0x42, 0x52, 0x70, 0x21, 0xe5, 0x93, 0x92 },
+          { 0x08, 0x15, 0x0c, 0x96, 0x7e, 0xb7, 0x02, 0xed, 0xbb, 0x1f, 0x1a, 0x3e, 0x0b, 0x7f, 0x2f, 0x99, 0xb9, 0x7b, 0xd5, 0x43, 0x88, 0x57, 0x25, 0x9f, 0x2a, 0x5f, 0x37, 0xb6, 0x6e, 0x7c, 0x08, 0x20 } },
+        { { 0x3a, 0x35, 0x3a, 0x32, 0x3a, 0x9a, 0xaa, 0xa4, 0x52, 0x2c, 0xba, 0xd9, 0xca, 0x63, 0x8c, 0x72, 0x99, 0x83, 0xe8, 0x5e, 0xe9, 0x1b, 0xdd, 0x86, 0xc7, 0xb9, 0x0d, 0x5c, 0x2f, 0xc5, 0xaf, 0xf0 },
+          { 0x26, 0x2d, 0x7a, 0x0a, 0x80, 0x32, 0xc8, 0xad, 0xef, 0xed, 0x52, 0xac, 0x7a, 0x7d, 0x95, 0x6d, 0xd8, 0x10, 0x3e, 0xb6, 0xac, 0x12, 0x27, 0x18, 0x56, 0x21, 0xa2, 0xf6, 0xf3, 0x06, 0x24, 0x74 } },
+        { { 0x0e, 0x1b, 0xaa, 0xee, 0xf8, 0xac, 0x07, 0xe0, 0x57, 0x12, 0x30, 0x1d, 0x7e, 0xae, 0x7a, 0x8f, 0x51, 0xce, 0xd1, 0x34, 0xa0, 0x75, 0xe0, 0xeb, 0xbd, 0x1d, 0xc4, 0xc4, 0x10, 0x3f, 0x1b, 0xe3 },
+          { 0x23, 0x46, 0xe1, 0x0d, 0x59, 0x6d, 0x5d, 0xb4, 0xec, 0xa6, 0x25, 0xee, 0xb4, 0x92, 0x25, 0x2b, 0x0d, 0x00, 0x81, 0xb4, 0x09, 0x5f, 0x96, 0xba, 0x41, 0x01, 0x2f, 0x84, 0x64, 0xe9, 0xd8, 0x57 } },
+        { { 0x1d, 0xd0, 0x2c, 0x49, 0x40, 0x3e, 0x68, 0x74, 0xbc, 0x4f, 0xec, 0x67, 0xd2, 0xea, 0xb7, 0x52, 0x1b, 0x2f, 0xe0, 0x4e, 0x1d, 0x7a, 0x6a, 0x0b, 0x04, 0x77, 0x08, 0x26, 0x2f, 0xb4, 0xdc, 0x0c },
+          { 0x14, 0x6d, 0x40, 0xb8, 0x14, 0xa2, 0xa6, 0x7c, 0x9f, 0xe0, 0x37, 0xf9, 0x58, 0x7a, 0xb5, 0xde, 0x47, 0x05, 0x0b, 0x07, 0xbf, 0xbb, 0x11, 0x95, 0x9d, 0x80, 0xb2, 0x19, 0x9e, 0x38, 0x05, 0x41 } }
+    },
+    {
+        { { 0x3f, 0xe5, 0x12, 0x1e, 0x85, 0x59, 0xc1, 0xf1, 0x13, 0xcc, 0xc1, 0xf6, 0xfe, 0x7c, 0xc9, 0x07, 0x38, 0xcb, 0xc4, 0x41, 0x24, 0x2f, 0x69, 0xe2, 0x91, 0x32, 0x8d, 0x92, 0x2a, 0x34, 0x69, 0xaf },
+          { 0x36, 0xf7, 0xac, 0x6d, 0x16, 0x79, 0xd6, 0x5f, 0xfa, 0xb7, 0xcd, 0xb8, 0x6b, 0x78, 0x5e, 0x3d, 0x88, 0xe3, 0x4b, 0x49, 0x9f, 0x7d, 0x87, 0x26, 0xf1, 0x25, 0x82, 0xf8, 0xa9, 0x51, 0x0d, 0xe9 } },
+        { { 0x2c, 0x28, 0xf9, 0xab, 0xd2, 0xc2, 0x33, 0x76, 0x12, 0xe2, 0x48, 0xa6, 0x0b, 0x87, 0x5c, 0xad, 0x77, 0x14, 0x51, 0x45, 0x80, 0x58, 0xa5, 0xc9, 0x61, 0xd6, 0x8e, 0x6c, 0xd6, 0xcb, 0x32, 0xc9 },
+          { 0x3c, 0x98, 0x53, 0x65, 0x9b, 0x44, 0xae, 0x07, 0xe2, 0x54, 0x82, 0x6b, 0x2b, 0xcf, 0xb9, 0x17, 0x52, 0x99, 0xf3, 0x80, 0x4f, 0x39, 0x78, 0x35, 0x56, 0x20, 0xcd, 0x07, 0x98, 0x98, 0x6d, 0x04 } },
+        { { 0x22, 0x02, 0x23, 0x9c, 0xf1, 0xce, 0xad, 0xdd, 0x57, 0x27, 0xc6, 0x1c, 0x68, 0xb0, 0xe1, 0x66, 0xa7, 0x3d, 0xf6, 0xc7, 0xd4, 0xe6, 0x52, 0xcc, 0x1e, 0xe3, 0x1b, 0xcc, 0x72, 0xbb, 0x9b, 0xb6 },
+          { 0x22, 0x2b, 0x71, 0x2b, 0x20, 0xc5, 0xfb, 0x03, 0x35, 0x29, 0xff, 0xb6, 0xdd, 0x96, 0xf9, 0x2e, 0x75, 0xc5, 0xd6, 0x7d, 0xbb, 0x30, 0xa9, 0xf6, 0xf9, 0x13, 0x0a, 0x8e, 0x25, 0xe3, 0x14, 0x3f } },
+        { { 0x08, 0x9b, 0xd5, 0x8f, 0x5e, 0xec, 0xfa, 0x8b, 0x84, 0x49, 0x10, 0xc5, 0xea, 0xb1, 0x90, 0xf5, 0x61, 0x69, 0xa6, 0xdf, 0x27, 0x25, 0x1f, 0x7c, 0x9c, 0xee, 0x56, 0x78, 0x0c, 0xdd, 0x13, 0xb5 },
+          { 0x05, 0xf0, 0xd9, 0x6e, 0x6c, 0xd4, 0x30, 0x48, 0x41, 0x6d, 0x01, 0xf1, 0x4e, 0x76, 0x0b, 0x20, 0xe9, 0x23, 0x62, 0x02, 0x60, 0x49, 0xbb, 0xa7, 0xc9, 0x40, 0x66, 0xc0, 0x5e, 0xfa, 0xf4, 0x42 } },
+        { { 0x02, 0xad, 0x64, 0xd1, 0xc9, 0xc5, 0x69, 0x4e, 0x3a, 0x9d, 0xf9, 0x3c, 0xde, 0x94, 0x7f, 0x67, 0xe1, 0xbb, 0x8b, 0x2b, 0x3e, 0x97, 0x2b, 0x9c, 0x36, 0xdb, 0x75, 0x33, 0xf5, 0x78, 0xaf, 0x3b },
+          { 0x27, 0x59, 0x49, 0x8c, 0x92, 0xcf, 0xc9, 0x05, 0x0a, 0x2b, 0x4d, 0x51, 0xa8, 0x10, 0xf8, 0x08, 0xa3, 0xd9, 0x4d, 0xa3, 0xfb, 0x1a, 0x12, 0x36, 0x49, 0x4e, 0x27, 0xf4, 0x46, 0xdd, 0x99, 0x6a } },
+        { { 0x3c, 0x79, 0x56, 0xc4, 0x1a, 0x86, 0xe4, 0xb7, 0xdc, 0xed, 0x5b, 0x21, 0xd4, 0x42, 0xf5, 0x75, 0x65, 0x9c, 0xca, 0x24, 0xc6, 0xd5, 0xe8, 0x8f, 0xa6, 0x60, 0xbc, 0xd9, 0x69, 0x93, 0x74, 0x3a },
+          { 0x0e, 0xc8, 0xd8, 0x24, 0xe2, 0x7d, 0xe9, 0x79, 0x38, 0xe9, 0x8c, 0x5f, 0xd2, 0x91, 0xb2, 0xee, 0x05, 0x2c, 0x94, 0x11, 0x7a, 0xaa, 0x06, 0xa7, 0x48, 0x1d, 0x5b, 0xee, 0xcb, 0xcc, 0x37, 0x2c } },
+        { { 0x13, 0xa6, 0x19, 0x0f, 0x4c, 0x73, 0x8f, 0x95, 0x52, 0xc1, 0x6d, 0x39, 0x60, 0x20, 0xe0, 0xbc, 0xf2, 0x12, 0xa8, 0x51, 0x0e, 0x1b, 0xfd, 0x32, 0xc7, 0x72, 0xf2, 0xf4, 0xe2, 0xf2, 0xbe, 0x52 },
+          { 0x28, 0xdb, 0x09, 0x22, 0xfd, 0x8b, 0xad, 0x15, 0xba, 0xaa, 0x4e, 0x05, 0x21, 0xb3, 0xf6, 0xec, 0xed, 0x92, 0x5d, 0xc9, 0x42, 0x55, 0x68, 0xbe, 0x7d, 0x65, 0xca, 0x6c, 0x46, 0xaa, 0x4c, 0xf3 } },
+        { { 0x0c, 0x03, 0x6b, 0x0f, 0x5a, 0x78, 0x38, 0xf5, 0xa0, 0x62, 0x00, 0xbf, 0xba, 0x97, 0x5a, 0x18, 0x4b, 0x53, 0xa1, 0x3e, 0x3d, 0xc9, 0x8b, 0xa7, 0xc6, 0x60, 0x59, 0xf1, 0x20, 0xaa, 0xc6, 0xdf },
+          { 0x39, 0x20, 0x94, 0xfd, 0xf3, 0x69, 0x59, 0x71, 0x5c, 0x9b, 0xdf, 0x28, 0x92, 0xe1, 0x21, 0x29, 0xc3, 0xe0, 0x0c, 0xb2, 0xcb, 0x20, 0x7b, 0x7b, 0xe2, 0xe8, 0x5d, 0x63, 0x6d, 0xce, 0x46, 0xdd } }
+    },
+    {
+        { { 0x0e, 0xa0, 0xb7, 0xa9, 0xe1, 0x25, 0x57, 0x88, 0x6a, 0x28, 0x27, 0x54, 0x85, 0x2d, 0xd1, 0x18, 0xd8, 0x54, 0x8e, 0xb7, 0x0f, 0x25, 0x94, 0x12, 0x3f, 0xa7, 0xb2, 0xad, 0x13, 0x09, 0x08, 0x9f },
+          { 0x05, 0xa5, 0x48, 0x2f, 0xde, 0x0c, 0x3b, 0xa9, 0xd5, 0x2a, 0xda, 0x6c, 0x9c, 0xf2, 0xcc, 0x1c, 0xde, 0x68, 0x79, 0xb0, 0x90, 0x93, 0x39, 0xa6, 0x21, 0x82, 0xf4, 0x74, 0xe2, 0x03, 0xe4, 0xeb } },
+        { { 0x3b, 0xa6, 0xc9, 0x40, 0x66, 0xd5, 0xfb, 0x65, 0xf0, 0x2a, 0x7b, 0xf0, 0x51, 0xe5, 0x34, 0x59, 0xd1, 0x05, 0xae, 0x92, 0x3d, 0xe5, 0x84, 0x7b, 0x1c, 0xb7, 0x62, 0x6a, 0x87, 0x5f, 0xe3, 0x20 },
+          { 0x26, 0x5b, 0xe3, 0x89, 0xc6, 0x37, 0xbc, 0x3f, 0xd5, 0xd6, 0x02, 0x50, 0x8d, 0xb3, 0x19, 0x58, 0x07, 0xd0, 0x31, 0xeb, 0xe1, 0xf1, 0x3d, 0xda, 0xe5, 0xf8, 0xf0, 0x61, 0xb4, 0xdc, 0x61, 0xc5 } },
+        { { 0x09, 0x01, 0x3e, 0xb8, 0xf4, 0xa3, 0xb1, 0x3f, 0x46, 0x93, 0x1e, 0x47, 0xfe, 0xe4, 0x1f, 0x6e, 0x72, 0xb1, 0xdb, 0x3f, 0xf1, 0xdd, 0xf1, 0xb6, 0xdc, 0xaf, 0xab, 0xf7, 0x3d, 0x36, 0x56, 0xac },
+          { 0x21, 0x1d, 0x8c, 0x1d, 0x2b, 0x9c, 0x3f, 0xa9, 0x88, 0xc3, 0x7c, 0xf9, 0xe1, 0xb3, 0x02, 0xe5, 0x59, 0xfa, 0x08, 0xb8, 0xd4, 0x6a, 0xde, 0xc6, 0x80, 0xdc, 0x6c, 0x59, 0x82, 0xba, 0xea, 0xf9 } },
+        { { 0x31, 0xa8, 0x7d, 0x06, 0x0b, 0xb2, 0xc4, 0xc0, 0x86, 0x5c, 0x10, 0xff, 0x78, 0xda, 0xb3, 0xfb, 0x7b, 0x57, 0xfd, 0xd7, 0x05, 0x23, 0x22, 0xc2, 0xa3, 0x38, 0xd4, 0x52, 0xf4, 0x58, 0x7a, 0xb3 },
+          { 0x3a, 0xd3, 0x50, 0xb7, 0x05, 0xc6, 0xb4, 0x23, 0x82, 0x45, 0x59, 0x9f, 0xd8, 0xe7, 0x27, 0xb4, 0xbc, 0xbb, 0x62, 0x44, 0x64, 0xca, 0xf6, 0x26, 0x4f, 0x49, 0xd0, 0x33, 0x42, 0xe9, 0xf0, 0xa6 } },
+        { { 0x22, 0x04, 0x41, 0x2a, 0x1e, 0x30, 0x6b, 0x6b, 0xb0, 0xd1, 0x30, 0x11, 0x9f, 0xc6, 0x6d, 0x6e, 0x88, 0x7c, 0xad, 0x64, 0x4b, 0x87, 0x2c, 0xed, 0x2d, 0xdb, 0xca, 0x28, 0xa1, 0xbb, 0x76, 0xc3 },
+          { 0x11, 0xd2, 0xe8, 0x74, 0x2f, 0x29, 0x93, 0x5f, 0x26, 0x1c, 0xe0, 0x13, 0xc6, 0xd7, 0xef, 0x36, 0xbe, 0xa9, 0xda, 0xc6, 0x80, 0x24, 0xed, 0x28, 0x4e, 0x17, 0xee, 0x95, 0x34, 0x8f, 0xf1, 0x9a } },
+        { { 0x11, 0xee, 0x46, 0xdc, 0x3e, 0xc1, 0xcf, 0x8c, 0xe0, 0xd6, 0x59, 0x20, 0xdf, 0x93, 0x01, 0x63, 0xe7, 0x72, 0xaa, 0xd8, 0x18, 0xc5, 0x47, 0x57, 0xf2, 0xa0, 0x1d, 0x60, 0xd1, 0x1e, 0x35, 0x57 },
+          { 0x27, 0x83, 0xe5, 0xf2, 0x0f, 0xae, 0x5f, 0x03, 0x0c, 0x04, 0xf0, 0x9d, 0xd2, 0xff, 0x98, 0xcf, 0xfa, 0x29, 0x9b, 0xcd, 0x7c, 0xba, 0x8d, 0x06, 0x87, 0x2f, 0x31, 0x5a, 0x22, 0xe6, 0x8a, 0xe1 } },
+        { { 0x37, 0x57, 0xda, 0x3d, 0xee, 0xab, 0xe8, 0xb3, 0x91, 0x55, 0xff, 0x5e, 0xfa, 0xae, 0xbf, 0x32, 0xb2, 0x0f, 0x52, 0x85, 0x3a, 0x94, 0xf0, 0x88, 0x75, 0xfc, 0xa5, 0x42, 0xe0, 0xb0, 0x10, 0x4d },
+          { 0x1f, 0x83, 0x69, 0x07, 0xa2, 0x7e, 0xd6, 0x1a, 0x65, 0x24, 0x4e, 0xe6, 0x65, 0xbc, 0x1d, 0x88, 0x06, 0x38, 0xc1, 0x38, 0xf9, 0xe2, 0x46, 0x3a, 0x7b, 0x58, 0x1f, 0x21, 0x5d, 0xe2, 0x47, 0xa4 } },
+        { { 0x23, 0x1b, 0x71, 0x68, 0x52, 0xc9, 0xd6, 0x65, 0xbc, 0x96, 0x7a, 0x56, 0x35, 0x76, 0x3f, 0xc9, 0x59, 0x21, 0xe7, 0xaa, 0xcf, 0xa3, 0x35, 0x25, 0x7c, 0x94, 0xf5, 0x50, 0xab, 0x88, 0x5a, 0xae },
+          { 0x1f, 0xbb, 0x6e, 0xbe, 0x8d, 0x49, 0x73, 0x53, 0x1c, 0x0c, 0xd5, 0x10, 0x79, 0x25, 0x15, 0x17, 0x18, 0x07, 0x66, 0x13, 0x74, 0x75, 0x75, 0x67, 0x31, 0x97, 0x44, 0x75, 0xec, 0x5b, 0x4a, 0xe1 } }
+    },
+    {
+        { { 0x2e, 0x4c, 0x9c, 0xfa, 0x93, 0x18, 0xc0, 0x8e, 0x47, 0xfa, 0x5e, 0x68, 0x1b, 0x7f, 0x3a, 0x33, 0xd2, 0xf0, 0x4f, 0x60, 0x71, 0x20, 0x1d, 0x33, 0x72, 0xfe, 0x44, 0xd6, 0x06, 0x52, 0x36, 0x8a },
+          { 0x34, 0x7d, 0x05, 0x15, 0x5a, 0x15, 0x6b, 0xc5, 0x90, 0xc8, 0xbe, 0xff, 0xb2, 0x2f, 0x72, 0xdb, 0xc1, 0xe3, 0x3b, 0x98, 0x43, 0x72, 0xdb, 0x66, 0xed, 0x2c, 0xf7, 0x9a, 0x2d, 0x44, 0x77, 0x70 } },
+        { { 0x12, 0x41, 0xc3, 0xb1, 0x99, 0x57, 0xa3, 0x8e, 0xcb, 0x6b, 0x12, 0x1b, 0xce, 0xdf, 0x61, 0x52, 0xd8, 0x24, 0x53, 0x79, 0x38, 0x7b, 0x21, 0x46, 0x02, 0x81, 0xb0, 0x95, 0xa7, 0x5d, 0x93, 0x9e },
+          { 0x08, 0x8a, 0x29, 0x0c, 0xe3, 0xbf, 0xc5, 0xd0, 0xc4, 0xf4, 0x88, 0x95, 0x40, 0x96, 0xb8, 0xf2, 0x2b, 0xc1, 0x9c, 0xa0, 0xdf, 0x9f, 0x0f, 0xd1, 0x69, 0xd2, 0xe0, 0x7b, 0xd0, 0xb3, 0x90, 0x91 } },
+        { { 0x36, 0x59, 0x25, 0x25, 0x23, 0xcd, 0x99, 0x7b, 0xa0, 0xd5, 0x95, 0x70, 0x6b, 0x1b, 0x37, 0x81, 0x11, 0xa2, 0x70, 0x12, 0x34, 0xdf, 0x47, 0x42, 0x5b, 0x49, 0x9a, 0x8d, 0xd3, 0x96, 0xf0, 0x66 },
+          { 0x24, 0x7b, 0x4c, 0xbd, 0x13, 0x77, 0x4a, 0x9c, 0x88, 0x0c, 0xc1, 0x38, 0x25, 0x0f, 0x2d, 0x31, 0x5a, 0xf8, 0xba, 0xf3, 0x10, 0xba, 0xd4, 0x5e, 0x77, 0xd8, 0xe0, 0xfc, 0x54, 0x36, 0xaa, 0x66 } },
+        { { 0x39, 0xcd, 0xb7, 0xf1, 0xb8, 0x96, 0x63, 0x18, 0x95, 0xcd, 0xb6, 0xa0, 0x15, 0x09, 0xf9, 0x93, 0xf3, 0x4b, 0x57, 0x4b, 0x4a, 0xda, 0xc7, 0x7d, 0xa5, 0x30, 0xa3, 0xcc, 0x6e, 0xaa, 0x4d, 0xf7 },
+          { 0x23, 0xd4, 0xe7, 0x5f, 0x83, 0x23, 0xc4, 0x03, 0xc6, 0xf4, 0xc2, 0x94, 0x74, 0x23, 0x01, 0xc0, 0x5c, 0x14, 0x0a, 0x87, 0xf2, 0x8a, 0xa1, 0x13, 0x16, 0xca, 0x6f, 0x31, 0xbb, 0xcc, 0xac, 0x5f } },
+        { { 0x2b, 0xbc, 0x45, 0x2b, 0xa4, 0x7f, 0x19, 0x06, 0x24, 0x12, 0x68, 0x5b, 0xf2, 0x18, 0x58, 0x65, 0x56, 0x35, 0x18, 0xb2, 0x80, 0xcd, 0xfc, 0x60, 0xf8, 0x5c, 0x28, 0x26, 0xb0, 0x0a, 0x45, 0xf9 },
+          { 0x31, 0xfd, 0x4f, 0x8c, 0xd8, 0x7b, 0x2b, 0x27, 0x3d, 0xfd, 0x32, 0xda, 0xbf, 0x34, 0xce, 0x73, 0x4c, 0x49, 0x2a, 0xe7, 0x17, 0x67, 0xf8, 0xa8, 0x54, 0x33, 0x27, 0x49, 0x09, 0x63, 0xd8, 0xf0 } },
+        { { 0x23, 0x66, 0xda, 0xfb, 0xc2, 0xb4, 0xcc, 0x2a, 0xca, 0xbe, 0x16, 0x84, 0x00, 0xc8, 0x21, 0xd7, 0x05, 0x03, 0xb4, 0xf4, 0xc2, 0x9e, 0x95, 0xa8, 0x01, 0xbc, 0x1c, 0x43, 0xde, 0x65, 0x29, 0x25 },
+          { 0x2f, 0x99, 0xff, 0x21, 0x9e, 0x96, 0x8d, 0x66, 0x24, 0xa4, 0x7c, 0x16, 0xa0, 0x02, 0x07, 0x1f, 0x53, 0x00, 0xfd, 0xcb, 0x8c, 0x47, 0xb7, 0x69, 0xad, 0x67, 0x1c, 0xb6, 0x38, 0x4c, 0x6a, 0xb1 } },
+        { { 0x31, 0x06, 0xaf, 0x1b, 0x7b, 0xc4, 0xe7, 0xda, 0x3a, 0x6f, 0xec, 0x49, 0x66, 0xbc, 0x9a, 0x3b, 0xf6, 0xb8, 0xbb, 0x07, 0xa2, 0x1f, 0x6f, 0x1b, 0x04, 0x24, 0x54, 0x49, 0xac, 0xc2, 0xd2, 0x06 },
+          { 0x04, 0xc7, 0x6f, 0xfb, 0x68, 0xf4, 0x05, 0x6d, 0x51, 0x8a, 0x83, 0xa7, 0xb9, 0xf4, 0xe0, 0xf5, 0xaf, 0xd7, 0xf4, 0xf7, 0x98, 0x3b, 0xf8, 0xcb, 0x63, 0x5b, 0x0a, 0xb1, 0x15, 0x22, 0x4e, 0x8a } },
+        { { 0x2d, 0xd2, 0x04, 0x71, 0x64, 0x8e, 0xa2, 0x6e, 0x7f, 0x61, 0x53, 0xe5, 0x70, 0x9f, 0xf7, 0x74, 0x22, 0x1b, 0x35, 0xff, 0x37, 0x75, 0xde, 0x31, 0xfc, 0x4c, 0x2e, 0x61, 0xf0, 0x83, 0x78, 0x63 },
+          { 0x2d, 0x44, 0x67, 0x55, 0x72, 0xe3, 0x1b, 0xf7, 0xee, 0x91, 0x50, 0x98, 0x3b, 0x9e, 0xcb, 0x45, 0xdb, 0x01, 0x2e, 0xea, 0xcd, 0xec, 0xb8, 0x8f, 0x42, 0xea, 0xe6, 0xb0, 0xa9, 0xfc, 0x44, 0x24 } }
+    },
+    {
+        { { 0x04, 0xdd, 0x25, 0x5e, 0xe1, 0x7c, 0xc3, 0x3b, 0x57, 0x25, 0x7b, 0x1e, 0xb7, 0x33, 0x34, 0xcb, 0xef, 0x09, 0x82, 0x47, 0xa6, 0xdd, 0x33, 0x5c, 0x06, 0xf0, 0xd0, 0x12, 0xfc, 0x89, 0x54, 0x34 },
+          { 0x16, 0x5a, 0x28, 0x79, 0xe2, 0x99, 0x35, 0x46, 0x83, 0x8f, 0x04, 0xd3, 0xe5, 0xee, 0x81, 0x1b, 0x48, 0x31, 0x7e, 0xe4, 0x9d, 0x1a, 0x94, 0x26, 0x46, 0x84, 0x06, 0x4a, 0x19, 0xf2, 0x04, 0x5d } },
+        { { 0x1c, 0xa6, 0x1d, 0x0f, 0xb7, 0xae, 0x67, 0xa0, 0x66, 0xd7, 0xbd, 0xee, 0xff, 0x85, 0x49, 0x9f, 0x7d, 0x41, 0x09, 0x0c, 0xa7, 0xf1, 0x34, 0x87, 0x87, 0xef, 0xe2, 0x4b, 0xd8, 0x06, 0x2e, 0xe6 },
+          { 0x33, 0x57, 0x83, 0x68, 0xc3, 0x00, 0xf4, 0x3a, 0x77, 0x6c, 0xa9, 0x72, 0xf9, 0xb7, 0x14, 0x17, 0x5c, 0x55, 0xbf, 0xda, 0xc3, 0xa4, 0x4c, 0xba, 0xa8, 0xe5, 0x18, 0x49, 0xde, 0xbb, 0xab, 0x69 } },
+        { { 0x14, 0xc9, 0xee, 0x7e, 0x8a, 0xa5, 0x23, 0x8d, 0x69, 0xce, 0x7d, 0x86, 0xb7, 0xcd, 0xbc, 0x05, 0x65, 0x11, 0xd1, 0x38, 0xa8, 0x0e, 0x59, 0xdf, 0xc9, 0xb2, 0xa5, 0xa3, 0x04, 0xc3, 0xff, 0xcb },
+          { 0x29, 0x8e, 0xac, 0xe7, 0xb7, 0x31, 0x81, 0x07, 0xa1, 0xec, 0x98, 0xc9, 0x9b, 0x72, 0x55, 0x94, 0xba, 0x99, 0xc2, 0xd7, 0x5c, 0x70, 0xfb, 0x3d, 0x5f, 0xdf, 0xed, 0x15, 0x39, 0x39, 0x89, 0x69 } },
+        { { 0x20, 0x12, 0xa6, 0xf7, 0xf7, 0xaa, 0xc5, 0x88, 0x4f, 0xae, 0xa8, 0x51, 0xeb, 0xbb, 0x03, 0xaf, 0xa7, 0x1a, 0x75, 0xd9, 0x82, 0xa6, 0x57, 0x48, 0xef, 0x26, 0xd1, 0xfc, 0xaa, 0xaa, 0x8e, 0xde },
+          { 0x29, 0xdf, 0x72, 0x90, 0x82, 0x6b, 0x8a, 0x69, 0xf1, 0x2f, 0xcc, 0x92, 0x6a, 0x53, 0x89, 0x4d, 0xd3, 0x4f, 0xe0, 0x0e, 0xf8, 0xa0, 0xef, 0xfc, 0x9b, 0x22, 0x35, 0x02, 0xbd, 0xf7, 0x28, 0x33 } },
+        { { 0x18, 0xd8, 0x07, 0xa6, 0x10, 0x6a, 0x24, 0x89, 0x8d, 0xbb, 0xeb, 0x70, 0xdf, 0xf8, 0x4b, 0x8a, 0xcd, 0x16, 0x52, 0xb2, 0x78, 0x6d, 0xaf, 0x25, 0x0b, 0x69, 0x80, 0x30, 0xb7, 0x75, 0x07, 0x2a },
+          { 0x30, 0x5b, 0x32, 0x4b, 0x9c, 0x96, 0x19, 0x9f, 0xba, 0xa3, 0x35, 0xef, 0x86, 0x2a, 0xa5, 0x82, 0x4a, 0xa4, 0x8c, 0x11, 0x74, 0x15, 0xd8, 0xea, 0x51, 0x0a, 0x9e, 0x1f, 0xce, 0xca, 0x7d, 0x85 } },
+        { { 0x21, 0x47, 0x5d, 0x56, 0xe8, 0xbf, 0xb6, 0x74, 0xa8, 0xe3, 0xab, 0xb3, 0x6f, 0x16, 0x06, 0xa4, 0x32, 0xe6, 0x2f, 0x85, 0x07, 0x06, 0xce, 0x8f, 0x4b, 0x94, 0x11, 0x3b, 0x08, 0x79, 0x97, 0x5d },
+          { 0x31, 0xf6, 0xe6, 0x2e, 0x83, 0x08, 0x1e, 0xb9, 0xc5, 0x20, 0x86, 0xd9, 0x25, 0xcc, 0x8f, 0x51, 0xaa, 0x27, 0x47, 0x9b, 0xe0, 0x26, 0x8e, 0xd9, 0xce, 0xcd, 0x61, 0x99, 0x79, 0x57, 0xcc, 0xd4 } },
+        { { 0x1b, 0x73, 0xcb, 0x97, 0x0b, 0xa1, 0x08, 0xa4, 0x9f, 0x51, 0x75, 0x76, 0x7b, 0x73, 0x7a, 0x54, 0x9e, 0x37, 0xa6, 0xa0, 0x5b, 0x5d, 0x6e, 0xfb, 0x22, 0x9c, 0x8e, 0x73, 0x1a, 0xa2, 0x6c, 0x68 },
+          { 0x22, 0x71, 0x41, 0x79, 0xd9, 0xf4, 0xbd, 0x1c, 0xe4, 0x35, 0x25, 0x95, 0x5a, 0xb7, 0x92, 0xe5, 0xbf, 0x9e, 0x29, 0x36, 0x41, 0x36, 0xd4, 0x97, 0xea, 0xcc, 0x47, 0xc0, 0x44, 0x7f, 0x1c, 0x17 } },
+        { { 0x03, 0x41, 0xd0, 0xe8, 0x3f, 0xe9, 0x14, 0xde, 0x01, 0x89, 0x0f, 0x76, 0x94, 0xc2, 0x86, 0x11, 0x78, 0x86, 0xee, 0xe9, 0xff, 0x7a, 0x8f, 0x00, 0x1c, 0xf4, 0x8e, 0xac, 0x8e, 0xd9, 0x25, 0x93 },
+          { 0x0e, 0x22, 0x98, 0xad, 0xf2, 0x2a, 0xb8, 0x44, 0x6a, 0x44, 0x6d, 0xcb, 0x2c, 0xd7, 0xf5, 0x23, 0x4d, 0x69, 0x3c, 0xbe, 0x83, 0xcc, 0x7f, 0x5b, 0xe6, 0xa8, 0x9f, 0xaa, 0x62, 0x89, 0x6f, 0x8a } }
+    },
+    {
+        { { 0x00, 0x14, 0x69, 0x99, 0x9d, 0xad, 0xbc, 0x20, 0x6e, 0x7c, 0x8c, 0xab, 0xc8, 0xa6, 0x7f, 0x53, 0x64, 0x03, 0x5b, 0x88, 0x88, 0xd3, 0x87, 0x59, 0x90, 0x30, 0xd7, 0x6b, 0x92, 0xb6, 0xb7, 0x42 },
+          { 0x3b, 0xae, 0xa5, 0x27, 0x8c, 0x3b, 0x49, 0x8d, 0x82, 0x5c, 0x6c, 0x30, 0x52, 0x30, 0xf5, 0xd4, 0x25, 0xec, 0x71, 0xc6, 0x83, 0xe7, 0x06, 0xf4, 0x5a, 0xae, 0x72, 0x8b, 0xf7, 0xf9, 0x99, 0x65 } },
+        { { 0x25, 0x83, 0xf9, 0x97, 0x49, 0xa9, 0xd0, 0x20, 0x6a, 0xbd, 0x05, 0x5c, 0x06, 0xcf, 0xcf, 0x9a, 0x66, 0x20, 0x12, 0xde, 0xae, 0xe1, 0x43, 0xe8, 0x51, 0xc5, 0xb6, 0x42, 0x6f, 0xaf, 0x7a, 0x5c },
+          { 0x28, 0xc2, 0xac, 0xdc, 0xe1, 0x4f, 0x69, 0xd2, 0xbc, 0x1e, 0x1b, 0xfa, 0x5d, 0xa2, 0x29, 0x3f, 0x63, 0x1b, 0xad, 0x1d, 0x01, 0x9e, 0x21, 0xef, 0x3e, 0xf3, 0x89, 0x6f, 0xe9, 0xc0, 0xb3, 0x41 } },
+        { { 0x0c, 0x27, 0x91, 0x50, 0x56, 0xd2, 0xd9, 0x95, 0xa6, 0x3e, 0x19, 0x5b, 0x5d, 0xa3, 0x16, 0xca, 0xd3, 0xed, 0x22, 0x3d, 0x42, 0x2f, 0xc2, 0x43, 0x72, 0x54, 0x23, 0x30, 0x96, 0x73, 0x6e, 0xbd },
+          { 0x33, 0x8e, 0xf6, 0x0c, 0x5b, 0x76, 0x58, 0xd1, 0x2f, 0xb5, 0x47, 0x28, 0x54, 0xb9, 0x0c, 0x2a, 0xd5, 0x4c, 0xa9, 0x6f, 0x00, 0xe0, 0x04, 0xbe, 0x14, 0xb8, 0x9f, 0x3f, 0x57, 0x2e, 0x3f, 0x40 } },
+        { { 0x2d, 0x23, 0xa6, 0x12, 0xf6, 0x41, 0x82, 0x81, 0xf3, 0x94, 0xe0, 0x53, 0x9b, 0x9b, 0xad, 0xeb, 0x7e, 0x25, 0xb3, 0xbf, 0x82, 0x5d, 0x29, 0xc4, 0xd3, 0xe3, 0xcf, 0x3f, 0xc8, 0x09, 0x79, 0x82 },
+          { 0x35, 0x39, 0x3b, 0x79, 0x90, 0xc2, 0x57, 0xcc, 0xf5, 0x60, 0x4c, 0x43, 0x50, 0x40, 0xf0, 0x49, 0x8d, 0xe7, 0xd9, 0x29, 0x86, 0x68, 0xac, 0xc8, 0x3d, 0x8b, 0x1b, 0xef, 0xc1, 0x12, 0x8c, 0x7d } },
+        { { 0x2d, 0x6d, 0xa2, 0xc6, 0x16, 0x00, 0xcf, 0xf6, 0x03, 0x41, 0xbf, 0x80, 0xd4, 0x67, 0x6f, 0xd7, 0x0f, 0xaa, 0x1d, 0x37, 0x44, 0x14, 0x54, 0x75, 0x71, 0x8a, 0x07, 0x03, 0x07, 0xb6, 0xc5, 0xf5 },
+          { 0x32, 0x11, 0x31, 0x53, 0x56, 0x75, 0x54, 0x32, 0x99, 0x68, 0x18, 0x0a, 0xc5, 0xa6, 0x67, 0x2e, 0x18, 0xe8, 0x1c, 0x34, 0x2c, 0x7e, 0xc1, 0x4e, 0x22, 0x58, 0x4a, 0x9a, 0xf7, 0x9d, 0xfc, 0x0d } },
+        { { 0x27, 0xaa, 0xe6, 0xb4, 0x4b, 0x0c, 0xb9, 0xaf, 0x8b, 0x38, 0x83, 0xa9, 0xfa, 0x43, 0xde, 0x1c, 0xbe, 0x5b, 0x01, 0xc9, 0x9f, 0x54, 0x2b, 0x20, 0x89, 0x46, 0x5e, 0x9a, 0xd3, 0xe2, 0x4a, 0xa5 },
+          { 0x1c, 0x0b, 0x2b, 0x10, 0xc0, 0x39, 0x4d, 0x5a, 0x13, 0xaf, 0xc3, 0x49, 0x72, 0x57, 0x55, 0x0a, 0xaf, 0x97, 0x0b, 0xfd, 0x6c, 0xc0, 0x05, 0x49, 0x0b, 0x48, 0x63, 0x8a, 0xd4, 0x07, 0xdd, 0x26 } },
+        { { 0x3f, 0x61, 0x9b, 0xee, 0xbe, 0x05, 0xe4, 0xaf, 0x98, 0x3e, 0xa8, 0x3a, 0x74, 0x43, 0xa7, 0x07, 0x54, 0x24, 0xdf, 0x1a, 0xbe, 0xc4, 0x4e, 0x17, 0x85, 0x88, 0x77, 0xd2, 0x9c, 0xf3, 0x8d, 0x32 },
+          { 0x28, 0xf8, 0xb9, 0xff, 0xd8, 0x2b, 0xec, 0x96, 0xf5, 0xe2, 0x1b, 0x00, 0xea, 0x4d, 0x17, 0x54, 0xa4, 0xe0, 0xfd, 0x66, 0x0d, 0x76, 0x09, 0x65, 0x8c, 0x45, 0x9c, 0x23, 0x55, 0x46, 0xda, 0x2c } },
+        { { 0x08, 0x55, 0xf9, 0xde, 0x3f, 0x5e, 0xf1, 0xcf, 0x58, 0x3d, 0x0c, 0x62, 0x7a, 0x69, 0x33, 0x90, 0xd2, 0x01, 0x5e, 0x26, 0x4b, 0xc3, 0x5f, 0x33, 0xb7, 0xa3, 0x02, 0x1d, 0xaa, 0xf1, 0x61, 0xc3 },
+          { 0x16, 0x51, 0x02, 0xff, 0x07, 0xe3, 0xf7, 0xec, 0x8e, 0x33, 0x95, 0x42, 0x69, 0x6a, 0x99, 0x9a, 0xf7, 0x66, 0x42, 0x2a, 0x27, 0x5b, 0x88, 0xfe, 0xc2, 0xfc, 0xf3, 0xd5, 0x3d, 0x10, 0xcb, 0x6b } }
+    },
+    {
+        { { 0x29, 0x27, 0xc1, 0xee, 0x19, 0x97, 0xb0, 0x70, 0x09, 0x7e, 0x4b, 0xf5, 0x79, 0xc5, 0x36, 0xbc, 0x73, 0xf9, 0x6a, 0x4f, 0x13, 0x25, 0x50, 0xe8, 0xb3, 0xdd, 0x99, 0x99, 0x46, 0x21, 0x9c, 0x38 },
+          { 0x03, 0xc6, 0x90, 0x52, 0xdb, 0x46, 0xf0, 0xfe, 0x0f, 0xac, 0x62, 0xe0, 0x3c, 0x87, 0xc4, 0x33, 0xc0, 0x19, 0x0a, 0xcd, 0x43, 0x8d, 0xd0, 0xf8, 0x64, 0xf3, 0x3d, 0xd4, 0x41, 0xef, 0xa4, 0xb1 } },
+        { { 0x3e, 0x30, 0x30, 0x39, 0xde, 0xf5, 0xa0, 0x50, 0x51, 0x77, 0x06, 0x08, 0x68, 0x1e, 0x1d, 0x7e, 0x3c, 0x41, 0x3c, 0xa1, 0xd8, 0x5c, 0xf3, 0xac, 0xd7, 0x6d, 0x1e, 0x95, 0xd1, 0x0b, 0x98, 0x36 },
+          { 0x16, 0x5c, 0x43, 0x7d, 0x04, 0x4d, 0xde, 0xcd, 0x70, 0xa3, 0xd4, 0x95, 0x06, 0x4d, 0x96, 0xe5, 0x6b, 0xb8, 0x33, 0x3c, 0xee, 0x70, 0xc8, 0x04, 0x42, 0xc1, 0x18, 0xd5, 0x40, 0x0b, 0xf9, 0x49 } },
+        { { 0x36, 0x4f, 0x80, 0x56, 0x39, 0xc1, 0x53, 0x07, 0x1f, 0x26, 0x5f, 0x90, 0xce, 0x3f, 0xc8, 0x58, 0x69, 0x45, 0x4a, 0x49, 0xf7, 0x8d, 0x68, 0xb1, 0x49, 0x3d, 0x0d, 0x55, 0xcf, 0x1c, 0xa1, 0x9e },
+          { 0x2d, 0x1e, 0xc9, 0x75, 0xc5, 0xe4, 0x00, 0x0f, 0x17, 0x73, 0xef, 0x1d, 0x9e, 0xfa, 0xa6, 0xfa, 0x07, 0x07, 0x44, 0x60, 0x6e, 0xf8, 0x6c, 0xf8, 0xa2, 0x1e, 0x7d, 0xd6, 0xee, 0xb4, 0xfe, 0xb2 } },
+        { { 0x19, 0x90, 0xdc, 0x54, 0xb8, 0x99, 0x6f, 0xe7, 0xb3, 0x8e, 0x2f, 0xe9, 0xf7, 0x0c, 0x0f, 0xee, 0xc5, 0x0c, 0x4e, 0x04, 0x29, 0xfc, 0x80, 0x88, 0x39, 0xe8, 0x80, 0xda, 0xe8, 0x37, 0x5d, 0xb3 },
+          { 0x0c, 0x31, 0x20, 0x0e, 0xd3, 0x9d, 0x06, 0x99, 0xbd, 0x90, 0x9e, 0xf2, 0x26, 0x66, 0x6e, 0xc6, 0x43, 0x57, 0xfa, 0x61, 0xb4, 0x36, 0x7e, 0x62, 0x4e, 0xb1, 0x49, 0xdf, 0xa6, 0x1c, 0xbd, 0xbf } },
+        { { 0x0d, 0x1b, 0x92, 0x8b, 0x13, 0x3e, 0xcc, 0x22, 0x8d, 0xd6, 0x3e, 0x0b, 0xd4, 0xc3, 0xf7, 0xdc, 0xf6, 0x51, 0xde, 0x76, 0x58, 0x1f, 0x3f, 0x0c, 0x10, 0xb7, 0x3c, 0x52, 0xd7, 0x7a, 0x43, 0xb0 },
+          { 0x17, 0x6d, 0x4f, 0x6d, 0x9e, 0x70, 0xac, 0xce, 0x62, 0x02, 0xf7, 0x24, 0x96, 0x7b, 0xba, 0x63, 0x5a, 0xda, 0x59, 0xc9, 0xd8, 0x5f, 0x46, 0xbe, 0x49, 0xf6, 0xd4, 0xef, 0x3d, 0xe8, 0xba, 0x8f } },
+        { { 0x05, 0xc9, 0x45, 0xa4, 0x3e, 0xed, 0xf3, 0xe8, 0xd9, 0x10, 0xe6, 0x3d, 0x13, 0x09, 0xd3, 0x1d, 0x4d, 0x64, 0xc9, 0x71, 0x58, 0x6c, 0xf4, 0x39, 0x7b, 0xd0, 0x27, 0x4b, 0xd8, 0x79, 0xa5, 0x98 },
+          { 0x35, 0xba, 0x68, 0xf1, 0xfb, 0xf4, 0xe2, 0x47, 0x4b, 0x0c, 0x60, 0x8e, 0x36, 0x8c, 0xbc, 0x04, 0xf3, 0x53, 0x7a, 0x6b, 0xd3, 0x8b, 0xa6, 0xec, 0x5b, 0x73, 0x25, 0x3e, 0xe5, 0x6c, 0x68, 0xa2 } },
+        { { 0x2b, 0x6c, 0xc2, 0x19, 0x4c, 0xae, 0x08, 0xf6, 0xe8, 0x68, 0x69, 0x13, 0x45, 0x97, 0x38, 0x33, 0x24, 0x73, 0x32, 0x39, 0xa0, 0x1d, 0x5e, 0xb5, 0xb3, 0xec, 0x81, 0xd0, 0xe1, 0x70, 0x99, 0xd5 },
+          { 0x2a, 0x90, 0xbd, 0x42, 0xd2, 0xf0, 0xa5, 0x06, 0xe4, 0x6a, 0xbb, 0x6d, 0xe0, 0x3e, 0x87, 0x69, 0xe5, 0xbb, 0xc5, 0x91, 0x82, 0x3e, 0x29, 0x37, 0x21, 0xa7, 0xf2, 0xee, 0x79, 0x59, 0xfd, 0x83 } },
+        { { 0x09, 0xa6, 0x42, 0xaa, 0x0a, 0x43, 0x06, 0x08, 0x21, 0x48, 0x48, 0x0e, 0x8e, 0xbe, 0xde, 0x54, 0xb5, 0x0f, 0x77, 0x6b, 0x30, 0xe0, 0x57, 0xca, 0x32, 0x17, 0x17, 0x03, 0xe7, 0xca, 0x89, 0x6c },
+          { 0x2a, 0xc6, 0xa4, 0x16, 0x0b, 0xf0, 0xb8, 0xc3, 0xc8, 0xf4, 0x22, 0x9c, 0x89, 0x38, 0x4a, 0xc0, 0xbb, 0xfb, 0x4c, 0x33, 0xca, 0x01, 0x47, 0xb3, 0x1a, 0xb2, 0x90, 0x47, 0xcb, 0x3f, 0x9d, 0x37 } }
+    },
+    {
+        { { 0x11, 0xa1, 0x0a, 0xf1, 0xce, 0x8d, 0x05, 0xfe, 0xb6, 0x9f, 0x8a, 0xfc, 0x23, 0x48, 0xcd, 0xcb, 0x4f, 0xd8, 0x61, 0xb9, 0x34, 0xdd, 0x8f, 0xb4, 0x2d, 0x09, 0x77, 0x61, 0xcd, 0x0e, 0xce, 0x17 },
+          { 0x02, 0x78, 0xb2, 0x47, 0x57, 0x85, 0x30, 0xb6, 0x2b, 0x57, 0xee, 0x7f, 0x2e, 0x82, 0xaa, 0xe7, 0xd6, 0x05, 0xcc, 0x14, 0x71, 0x13, 0xb0, 0x0d, 0x97, 0xe4, 0x9a, 0xb3, 0xe3, 0x6f, 0x32, 0xde } },
+        { { 0x12, 0x93, 0xaf, 0x99, 0xfe, 0x05, 0x4f, 0x4b, 0x67, 0x33, 0x76, 0xa1, 0x59, 0xe1, 0xba, 0x67, 0xb6, 0xce, 0x5e, 0x87, 0xfd, 0x7a, 0x0d, 0x78, 0x8e, 0xbc, 0x45, 0xf3, 0x2e, 0xba, 0xcf, 0xa3 },
+          { 0x0e, 0x25, 0x9c, 0xc2, 0xf7, 0xbc, 0x6d, 0xbd, 0x56, 0xca, 0x70, 0xf2, 0xfc, 0x83, 0x8f, 0xde, 0x02, 0xae, 0x49, 0x15, 0x70, 0xf6, 0xcf, 0x83, 0x53, 0xab, 0xb3, 0x47, 0xd3, 0xa0, 0x80, 0x59 } },
+        { { 0x0e, 0x36, 0x19, 0x34, 0x7f, 0x65, 0xa2, 0x9c, 0x1a, 0x86, 0xf1, 0x7b, 0x20, 0xe4, 0x4d, 0xaa, 0x97, 0xe1, 0x70, 0x83, 0xd1, 0x38, 0x29, 0x9d, 0x34, 0x4a, 0xdb, 0xb9, 0x21, 0xad, 0x72, 0x2d },
+          { 0x32, 0xc9, 0x18, 0x71, 0x87, 0x33, 0xbc, 0x56, 0x67, 0x3f, 0xd4, 0xc0, 0x3c, 0x70, 0xd3, 0x54, 0x14, 0x71, 0xe5, 0x1e, 0x7c, 0xfb, 0x62, 0x28, 0x32, 0x82, 0x62, 0xf8, 0x9e, 0xce, 0x71, 0xca } },
+        { { 0x2e, 0x06, 0xee, 0xe7, 0x2c, 0x4b, 0x22, 0x14, 0x8c, 0x79, 0xf6, 0xbe, 0xb6, 0xaa, 0x3c, 0x44, 0xc2, 0x3f, 0x6f, 0x24, 0x4b, 0x79, 0xfa, 0xd8, 0xfa, 0xc6, 0x0e, 0x87, 0xba, 0x4c, 0x8f, 0x11 },
+          { 0x2f, 0x2b, 0x51, 0xcd, 0x5f, 0x16, 0x06, 0x97, 0x05, 0x16, 0xea, 0x1a, 0xef, 0x48, 0xe2, 0xcd, 0xff, 0x48, 0x7d, 0x20, 0xc1, 0xaf, 0x92, 0x94, 0xe9, 0xfa, 0xd8, 0x10, 0x03, 0x7e, 0xf0, 0x05 } },
+        { { 0x1b, 0x66, 0x25, 0xee, 0x78, 0xf2, 0xe9, 0x4b, 0x5f, 0xf0, 0x8f, 0x18, 0x74, 0xa8, 0x0a, 0x72, 0x96, 0x06, 0xfc, 0x9f, 0xcc, 0x1a, 0x80, 0xdc, 0x2d, 0x8a, 0xc6, 0xff, 0xb1, 0xeb, 0x94, 0x85 },
+          { 0x30, 0x4f, 0xf5, 0x2d, 0xba, 0x67, 0xe8, 0xa4, 0x35, 0x6a, 0x4f, 0x6b, 0x76, 0x7f, 0xa9, 0xbb, 0xea, 0x2b, 0xf6, 0xc4, 0xda, 0xe5, 0xf5, 0xa6, 0x6e, 0x02, 0x6d, 0x45, 0x1e, 0x08, 0xb9, 0xf9 } },
+        { { 0x20, 0x79, 0xcd, 0x55, 0x28, 0x25, 0x5b, 0xe4, 0xdf, 0xe3, 0xd0, 0x04, 0x6d, 0xeb, 0xe6, 0xab, 0xe1, 0xe7, 0x05, 0x9a, 0x2d, 0x19, 0x55, 0x5a, 0xc4, 0xeb, 0x64, 0x2d, 0x58, 0x1a, 0xfb, 0xd9 },
+          { 0x2e, 0xe8, 0x68, 0xa5, 0x6a, 0xc2, 0xfc, 0xf0, 0xd4, 0x02, 0xfe, 0xd4, 0x23, 0x76, 0x76, 0xd5, 0x9e, 0x6b, 0x53, 0x51, 0xe5, 0xd3, 0xfc, 0x49, 0x28, 0x87, 0xf6, 0xd1, 0x58, 0x8c, 0x2a, 0x88 } },
+        { { 0x20, 0x25, 0xa6, 0x00, 0xfe, 0xde, 0x1d, 0xfc, 0x24, 0x46, 0xb8, 0xba, 0xb6, 0x50, 0xf8, 0x48, 0xa5, 0xcf, 0x81, 0x8a, 0x41, 0x01, 0x36, 0x76, 0x02, 0x63, 0xb1, 0x13, 0x62, 0x15, 0x72, 0x7b },
+          { 0x32, 0x68, 0x78, 0xb4, 0xf2, 0x63, 0x2f, 0x89, 0x93, 0xc4, 0x3a, 0x0a, 0x62, 0x28, 0x5d, 0x38, 0x90, 0x71, 0xfe, 0x01, 0xe7, 0xf4, 0x33, 0x73, 0xf6, 0x31, 0xa7, 0xbf, 0x83, 0x91, 0xc8, 0x03 } },
+        { { 0x1b, 0x45, 0xd6, 0x8c, 0xd5, 0xf5, 0x7f, 0xc3, 0x12, 0xea, 0x21, 0x8d, 0x20, 0x53, 0xc0, 0xe1, 0x7f, 0x17, 0x9e, 0xef, 0xfd, 0xc9, 0x6c, 0x36, 0xc7, 0x6c, 0x84, 0x34, 0xe2, 0x3e, 0x60, 0x25 },
+          { 0x31, 0xc3, 0xa7, 0x6f, 0xb4, 0x0b, 0x89, 0x1e, 0x7b, 0xc9, 0x80, 0x51, 0x64, 0x33, 0x4e, 0xb8, 0xd3, 0x28, 0xea, 0x1f, 0xc2, 0x07, 0xd7, 0x7a, 0x7c, 0xba, 0x5f, 0x3a, 0x62, 0xc6, 0x4e, 0x81 } }
+    },
+    {
+        { { 0x04, 0x34, 0x3e, 0xf2, 0x83, 0x63, 0x45, 0x54, 0x4b, 0x7e, 0x38, 0x7a, 0x55, 0x7b, 0x28, 0x17, 0xeb, 0xc1, 0xa9, 0xb7, 0xd4, 0xfc, 0x3c, 0x19, 0xff, 0xdc, 0x6b, 0x35, 0x1a, 0xda, 0xe0, 0x42 },
+          { 0x21, 0xfe, 0xa5, 0x90, 0xc0, 0xa5, 0x14, 0xeb, 0xeb, 0x08, 0x44, 0x68, 0xc3, 0x54, 0x6b, 0x2e, 0x36, 0x61, 0x4d, 0x60, 0x71, 0xda, 0xb3, 0x5c, 0x53, 0xc6, 0x1c, 0xa6, 0x03, 0x7f, 0xb3, 0xb6 } },
+        { { 0x09, 0x0c, 0x80, 0xf2, 0x6a, 0x75, 0xbd, 0xbe, 0x7a, 0x47, 0x9b, 0x29, 0xb3, 0x0f, 0xcf, 0x00, 0x19, 0xa2, 0x2a, 0x78, 0xfb, 0x3f, 0xdd, 0x5f, 0x74, 0xbe, 0xdd, 0x01, 0x1c, 0x96, 0x95, 0xd5 },
+          { 0x2c, 0x72, 0xf9, 0x07, 0x9d, 0x3d, 0x34, 0xdf, 0x1c, 0xbb, 0xf7, 0x04, 0x64, 0xd7, 0x4e, 0xc0, 0x21, 0x34, 0xc9, 0x6f, 0xf6, 0x8d, 0x65, 0x0c, 0x9f, 0xc9, 0x0b, 0x71, 0x0c, 0xe4, 0xd2, 0x93 } },
+        { { 0x2a, 0x73, 0x3c, 0x78, 0x80, 0xa9, 0x81, 0x20, 0x52, 0x0c, 0x11, 0xba, 0xf7, 0x8a, 0xcf, 0x1b, 0x58, 0x6c, 0xf4, 0x85, 0xbb, 0xd8, 0x0b, 0xc4, 0x85, 0x5b, 0xb4, 0x87, 0x60, 0xbf, 0xe7, 0x69 },
+          { 0x2c, 0x72, 0x2a, 0x09, 0x12, 0x3a, 0x6a, 0x48, 0x65, 0x9c, 0x71, 0x47, 0x6d, 0xb3, 0x30, 0xb5, 0xeb, 0xaa, 0xdc, 0x0a, 0x30, 0xd8, 0x54, 0x47, 0x55, 0x72, 0x03, 0xcc, 0xbb, 0x26, 0xa5, 0xa2 } },
+        { { 0x0c, 0xc6, 0xe9, 0x3a, 0xab, 0x29, 0x81, 0xf3, 0xe7, 0x0c, 0x35, 0x9f, 0xd5, 0x9e, 0x05, 0x2e, 0x23, 0xbd, 0xbf, 0xe8, 0xec, 0x98, 0x73, 0xfe, 0x88, 0x20, 0x3a, 0x9c, 0xf8, 0x0c, 0xc2, 0x07 },
+          { 0x3b, 0xf7, 0x88, 0x3a, 0x36, 0xbb, 0x0e, 0x19, 0x34, 0x3b, 0x62, 0xde, 0x24, 0x4b, 0xa3, 0xa1, 0x06, 0x5f, 0xb6, 0x77, 0xba, 0xce, 0xf6, 0x5f, 0x0c, 0x5a, 0x81, 0xf8, 0x67, 0x51, 0x0d, 0xe9 } },
+        { { 0x2a, 0xdb, 0xba, 0x1f, 0xe9, 0xc3, 0xa5, 0xb6, 0x44, 0xbe, 0xf0, 0xe6, 0x7e, 0x3b, 0x98, 0xb0, 0xe8, 0x02, 0xde, 0xcb, 0xb1, 0x47, 0x03, 0x89, 0x66, 0x54, 0xaf, 0xd1, 0x4e, 0x20, 0xcc, 0x54 },
+          { 0x0d, 0xda, 0x04, 0x10, 0x60, 0xa2, 0x89, 0x7d, 0x91, 0x38, 0x8c, 0x56, 0xba, 0x67, 0x2d, 0xa1, 0x2b, 0x1c, 0x72, 0xe4, 0x2e, 0x04, 0x70, 0xfa, 0x28, 0xb4, 0xc1, 0x40, 0xa7, 0x50, 0x62, 0xac } },
+        { { 0x30, 0x9c, 0xfc, 0xf7, 0xa7, 0xfd, 0x0a, 0xb6, 0x02, 0xc0, 0x61, 0xaa, 0xc8, 0xd9, 0xf4, 0x3c, 0x02, 0x3d, 0xe9, 0xe8, 0x1f, 0xb3, 0x5a, 0xd0, 0xf4, 0x4b, 0x0f, 0xb3, 0xbd, 0x19, 0x70, 0x4a },
+          { 0x1a, 0x6c, 0x54, 0xba, 0x19, 0x2a, 0x02, 0xdd, 0x0f, 0xbb, 0xdb, 0xb7, 0x07, 0x6a, 0xef, 0xcc, 0x13, 0xd7, 0xd3, 0x89, 0x77, 0x9c, 0x40, 0xbc, 0x57, 0xc0, 0x55, 0x40, 0x32, 0xab, 0xfd, 0xaa } },
+        { { 0x34, 0x7b, 0x8f, 0xdf, 0x50, 0x79, 0x85, 0x08, 0x32, 0xa9, 0xf2, 0x30, 0xe2, 0xfe, 0x64, 0x8c, 0xc4, 0x1e, 0xe6, 0x5c, 0x8b, 0xce, 0xf8, 0xdb, 0xe5, 0xce, 0x8a, 0x67, 0xef, 0xd6, 0x2f, 0xc8 },
+          { 0x20, 0xb8, 0xe4, 0x55, 0x8c, 0xea, 0xf8, 0xfe, 0x50, 0x26, 0x85, 0xc6, 0xc2, 0xe9, 0x7b, 0x31, 0xad, 0xa0, 0x2b, 0x33, 0x31, 0x25, 0x7e, 0xcc, 0x35, 0xe7, 0x0b, 0x66, 0xc1, 0xb0, 0xd0, 0x59 } },
+        { { 0x1b, 0x6e, 0x4b, 0xff, 0x5b, 0xd8, 0x96, 0x06, 0xff, 0x3e, 0xcd, 0x8f, 0xee, 0x1a, 0xe2, 0x4a, 0x1d, 0xbb, 0xe4, 0x7a, 0x48, 0x5e, 0x61, 0x11, 0xf4, 0x69, 0xef, 0x6b, 0x71, 0x99, 0xf1, 0x8d },
+          { 0x04, 0x72, 0x14, 0x38, 0x22, 0x5a, 0x6f, 0x02, 0x48, 0x92, 0x14, 0x83, 0xfc, 0xd1, 0x5d, 0x53, 0xda, 0xaa, 0xfc, 0xe5, 0xa1, 0x0e, 0xfa, 0x31, 0xc8, 0xa8, 0x22, 0x30, 0xa8, 0xbc, 0x08, 0xc0 } }
+    },
+    {
+        { { 0x1b, 0x2b, 0xa8, 0x62, 0x1a, 0x68, 0x6c, 0xba, 0x82, 0x68, 0x02, 0x20, 0x03, 0x61, 0x41, 0x71, 0x9f, 0x15, 0xf6, 0x15, 0x2c, 0xba, 0x70, 0x6c, 0x3e, 0x04, 0xba, 0x58, 0xac, 0x7b, 0x89, 0x2a },
+          { 0x25, 0x35, 0x8b, 0x28, 0xc5, 0x87, 0xac, 0x05, 0x06, 0xd6, 0xe9, 0xc8, 0x74, 0x45, 0x83, 0x9a, 0x56, 0x0c, 0x17, 0x9f, 0x92, 0x0f, 0x75, 0x52, 0x92, 0x25, 0xb6, 0x23, 0x44, 0x7c, 0xe6, 0xc1 } },
+        { { 0x20, 0x79, 0xad, 0xae, 0x2b, 0x8c, 0x07, 0xa7, 0x90, 0xc1, 0x86, 0x9b, 0xdc, 0x83, 0xa8, 0x57, 0xc6, 0x1d, 0x9a, 0x83, 0x1b, 0x47, 0x0b, 0x8f, 0xbc, 0x75, 0x3b, 0x04, 0x31, 0x90, 0x4d, 0x94 },
+          { 0x28, 0xe1, 0x0e, 0x09, 0x83, 0x4d, 0x51, 0xb1, 0xd5, 0xbf, 0xf1, 0xee, 0x0b, 0xd0, 0x01, 0xeb, 0xff, 0xbc, 0x37, 0x28, 0x5a, 0xe7, 0x4a, 0x88, 0x57, 0xa0, 0x93, 0xf6, 0x50, 0x97, 0xdb, 0xa3 } },
+        { { 0x2c, 0xe9, 0x7d, 0xe4, 0xd4, 0x94, 0x3e, 0x29, 0x13, 0xe2, 0xba, 0x49, 0xb3, 0x5a, 0xf3, 0x2d, 0x1d, 0x1e, 0x90, 0x34, 0x9f, 0x4e, 0xe4, 0x22, 0x7d, 0xc4, 0xdf, 0x28, 0x48, 0x41, 0xef, 0x9e },
+          { 0x2b, 0xe2, 0x7c, 0xc5, 0x3d, 0xc6, 0x14, 0x09, 0xf2, 0xfb, 0x91, 0x49, 0x98, 0x4b, 0x8b, 0xdf, 0x71, 0x1a, 0xeb, 0xb0, 0x37, 0xed, 0x87, 0xa0, 0x12, 0xfe, 0xe6, 0x1b, 0x97, 0x72, 0x74, 0xf0 } },
+        { { 0x28, 0x43, 0xfb, 0x66, 0x2d, 0x58, 0x8a, 0x3e, 0x95, 0x3c, 0x38, 0xb2, 0xef, 0x9a, 0xb2, 0x0a, 0x6f, 0x73, 0xe4, 0x8b, 0x43, 0x64, 0xc2, 0xbd, 0x14, 0x01, 0xe3, 0xe9, 0xd5, 0xc7, 0xd4, 0x27 },
+          { 0x30, 0x0d, 0xbd, 0x01, 0xaa, 0x0a, 0xf0, 0x88, 0xd5, 0xf0, 0x4c, 0x35, 0xc3, 0x19, 0xdc, 0xe6, 0xc9, 0x54, 0x56, 0x86, 0x90, 0x7d, 0x14, 0xf4, 0x98, 0xa3, 0xd5, 0xa3, 0x26, 0x03, 0x27, 0x33 } },
+        { { 0x1a, 0x62, 0xcb, 0x9d, 0x4d, 0xe1, 0xdd, 0x1e, 0x9d, 0x61, 0x30, 0xe8, 0x06, 0x52, 0xb3, 0xe1, 0x1d, 0x0c, 0xd0, 0x5c, 0xfe, 0x9c, 0x03, 0x39, 0x53, 0x86, 0x74, 0x65, 0x8a, 0xec, 0xe0, 0xd3 },
+          { 0x38, 0x35, 0x7e, 0x92, 0x6c, 0xb1, 0x69, 0x71, 0x91, 0x56, 0x64, 0x3f, 0xf3, 0x5c, 0x21, 0x47, 0x58, 0x92, 0x65, 0x1d, 0xe9, 0x9f, 0xa7, 0x25, 0x57, 0xfd, 0xeb, 0xfe, 0x8b, 0x1a, 0x62, 0xa0 } },
+        { { 0x1d, 0x36, 0x9b, 0x54, 0x99, 0x5c, 0x9c, 0x0f, 0x95, 0x12, 0x20, 0xd8, 0x42, 0xc1, 0x8b, 0xec, 0x13, 0xe0, 0x43, 0x47, 0x33, 0x86, 0x7d, 0xb6, 0xe1, 0xd0, 0x2a, 0x06, 0x9b, 0x07, 0x43, 0x67 },
+          { 0x0b, 0x4a, 0xf1, 0x4d, 0x39, 0xf5, 0x85, 0xef, 0x9e, 0x40, 0x4c, 0x75, 0x01, 0xde, 0x8e, 0x66, 0x05, 0xe7, 0xed, 0x53, 0x57, 0xba, 0x6f, 0x84, 0xa7, 0x8a, 0x99, 0x45, 0x8f, 0x20, 0x00, 0x1c } },
+        { { 0x08, 0xe1, 0x32, 0x85, 0x1e, 0xe7, 0x0d, 0xc8, 0xb7, 0x15, 0xa1, 0x21, 0xab, 0xfb, 0xa6, 0x6c, 0xdd, 0xe9, 0x76, 0x67, 0x2a, 0xd8, 0x26, 0x94, 0x78, 0x1f, 0xa0, 0xe9, 0x6a, 0x1b, 0xdc, 0x7e },
+          { 0x31, 0xd2, 0xf0, 0x31, 0x99, 0xef, 0xe0, 0xc4, 0x07, 0xf0, 0x51, 0x12, 0xbf, 0x02, 0xa9, 0x8f, 0xe8, 0xde, 0x0e, 0xb6, 0xe1, 0x14, 0xf5, 0x33, 0xbc, 0x2d, 0xc9, 0x49, 0xb7, 0x5d, 0xf1, 0x35 } },
+        { { 0x3d, 0x34, 0x9c, 0x20, 0x3e, 0x83, 0x59, 0xfc, 0x3b, 0x59, 0xfe, 0x7f, 0x40, 0x06, 0x36, 0x10, 0x04, 0x0e, 0xac, 0x8a, 0xd1, 0x1a, 0xed, 0x08, 0x9e, 0x47, 0x10, 0xcf, 0x56, 0x2d, 0xac, 0x1a },
+          { 0x2e, 0x15, 0x97, 0x5d, 0x3d, 0xec, 0x3d, 0x07, 0x06, 0x3b, 0x1c, 0x80, 0x46, 0x18, 0xa5, 0x3b, 0x56, 0x4a, 0x98, 0x78, 0xc5, 0xa3, 0xa9, 0x24, 0x5d, 0xef, 0xa7, 0xa7, 0x53, 0x31, 0x46, 0x01 } }
+    },
+    {
+        { { 0x09, 0x1e, 0x93, 0x9f, 0x93, 0xe3, 0x42, 0xfa, 0x09, 0x01, 0xa6, 0xe6, 0xca, 0x84, 0x91, 0xf0, 0x0d, 0x2e, 0x11, 0xac, 0x02, 0x04, 0xc6, 0xef, 0x66, 0x61, 0x4d, 0xf2, 0xc3, 0xea, 0x1e, 0x3b },
+          { 0x1b, 0x06, 0x1f, 0xfa, 0x16, 0x72, 0x22, 0x1e, 0xba, 0x82, 0x7e, 0x79, 0x35, 0xe0, 0xa3, 0x40, 0xf0, 0x74, 0x61, 0x32, 0x1a, 0x24, 0x7b, 0x9e, 0x72, 0x1d, 0x15, 0x1e, 0x0a, 0xa8, 0x94, 0xc8 } },
+        { { 0x24, 0x1c, 0x17, 0xce, 0xea, 0x72, 0xb3, 0x2a, 0x95, 0x94, 0x01, 0x78, 0xc4, 0xb4, 0xdd, 0xb4, 0x04, 0xc2, 0x34, 0xfd, 0xf3, 0xe4, 0xf5, 0x69, 0x72, 0x92, 0xd7, 0x87, 0x5e, 0x22, 0x85, 0xc6 },
+          { 0x0a, 0x01, 0xe3, 0x31, 0x74, 0x68, 0x57, 0x65, 0x2d, 0xd7, 0xcc, 0x9a, 0x02, 0x4f, 0x6f, 0x88, 0x13, 0x4f, 0xe3, 0xe0, 0xf2, 0xdc, 0xda, 0x93, 0x27, 0xf9, 0x57, 0x4b, 0x3d, 0x02, 0x79, 0xcb } },
+        { { 0x01, 0x6c, 0x36, 0x3c, 0xad, 0xb2, 0xbd, 0x7d, 0xc0, 0xbe, 0x35, 0x3c, 0xdd, 0x3f, 0x32, 0x07, 0xb6, 0xba, 0xcb, 0xf5, 0x02, 0x9c, 0x79, 0xd3, 0x7d, 0xc1, 0x20, 0xf3, 0x7e, 0x08, 0xd9, 0x76 },
+          { 0x30, 0x52, 0x93, 0x1e, 0xc3, 0x28, 0x36, 0x16, 0xe1, 0xef, 0x61, 0xf6, 0xb0, 0x98, 0xba, 0x85, 0x5e, 0x9f, 0x4a, 0x3c, 0xf3, 0xbe, 0x52, 0x86, 0xac, 0x5a, 0xc3, 0xd1, 0x8b, 0xef, 0x60, 0xd1 } },
+        { { 0x13, 0x49, 0x64, 0x92, 0xb1, 0x96, 0x8a, 0x96, 0x49, 0x07, 0xc6, 0x53, 0x47, 0x72, 0x59, 0x5d, 0x7a, 0xfa, 0xdd, 0xb3, 0xc1, 0x24, 0x9a, 0x67, 0xe1, 0x38, 0xea, 0x3e, 0x46, 0xe0, 0x79, 0xa7 },
+          { 0x0d, 0x1b, 0x2c, 0x3f, 0xa1, 0x13, 0x95, 0x0c, 0x96, 0x30, 0xc8, 0x9b, 0x70, 0x3a, 0xb4, 0xcc, 0xbc, 0xe1, 0x30, 0xa3, 0x37, 0x1e, 0x9e, 0x05, 0xd0, 0xa3, 0xc1, 0xe4, 0xc4, 0x8b, 0xbe, 0xc5 } },
+        { { 0x2c, 0x6d, 0x8b, 0x45, 0x51, 0x33, 0xac, 0x7f, 0x67, 0x6d, 0xb4, 0x31, 0x11, 0x45, 0xf5, 0x5b, 0x42, 0x45, 0xc3, 0xb8, 0x1a, 0xb6, 0xc4, 0x66, 0x32, 0x5a, 0x67, 0xdd, 0x2f, 0xce, 0x1a, 0xff },
+          { 0x2b, 0x30, 0x1d, 0xf3, 0x48, 0xdb, 0xa1, 0x2f, 0x7f, 0xa7, 0x83, 0xe4, 0x3d, 0x7b, 0x26, 0x45, 0xd4, 0x7c, 0x60, 0x22, 0x65, 0xc7, 0xb4, 0x2f, 0x53, 0x1d, 0x3f, 0x20, 0x14, 0x5e, 0x8e, 0xa3 } },
+        { { 0x37, 0xda, 0xfd, 0x02, 0x09, 0x62, 0xec, 0xdc, 0x1f, 0x17, 0x80, 0xd3, 0x67, 0x03, 0x3f, 0x0b, 0x7a, 0x39, 0x37, 0xe8, 0x50, 0x76, 0x7c, 0xfd, 0xdb, 0x45, 0xc3, 0xa8, 0x0a, 0xed, 0x43, 0xe6 },
+          { 0x03, 0x7d, 0x3f, 0x2e, 0x9e, 0xdd, 0x63, 0x0f, 0xe5, 0x29, 0xbc, 0xe7, 0x82, 0xde, 0x84, 0x7d, 0x3f, 0x64, 0x86, 0xc3, 0x1a, 0x9a, 0x74, 0x0b, 0x4c, 0xb9, 0xab, 0x6e, 0x9a, 0x4e, 0x24, 0xd8 } },
+        { { 0x1c, 0x12, 0x3b, 0x4a, 0x3f, 0x09, 0x34, 0x41, 0x3e, 0x16, 0xd1, 0xb5, 0xd7, 0x58, 0xa5, 0xe5, 0x00, 0x47, 0x5d, 0x90, 0xc4, 0xdb, 0xef, 0x8d, 0xd0, 0xb1, 0x13, 0x39, 0x47, 0xb8, 0x32, 0x60 },
+          { 0x16, 0x5c, 0x79, 0x5f, 0x42, 0x14, 0xfa, 0x1b, 0xfc, 0xbd, 0xff, 0x4b, 0x3e, 0x80, 0x58, 0x16, 0x51, 0x40, 0xc4, 0xc4, 0x9c, 0xcd, 0x76, 0x9a, 0xc7, 0x09, 0xf0, 0x9e, 0xdf, 0xb4, 0xdc, 0x4b } },
+        { { 0x22, 0x63, 0xe1, 0xff, 0x9c, 0x89, 0xbb, 0x29, 0xf9, 0x17, 0x6a, 0xcf, 0xc2, 0x82, 0xa5, 0xe5, 0xc5, 0x9d, 0x99, 0x0e, 0xab, 0x94, 0x38, 0x55, 0x88, 0x19, 0x22, 0xb4, 0x6a, 0x2f, 0x11, 0x56 },
+          { 0x0b, 0xed, 0x61, 0x11, 0x3f, 0xfe, 0x1a, 0x52, 0x09, 0x09, 0xbd, 0x28, 0x17, 0x86, 0x8c, 0xcf, 0x10, 0x5f, 0x33, 0x1d, 0x1d, 0xf3, 0xd7, 0xaf, 0xa4, 0x58, 0x58, 0x98, 0xcc, 0x5c, 0xe9, 0x14 } }
+    },
+    {
+        { { 0x3c, 0xd1, 0x9f, 0x3b, 0xb3, 0x8f, 0xa4, 0x62, 0xac, 0xf8, 0x9b, 0x3c, 0x81, 0x01, 0xd4, 0x82, 0x99, 0xb3, 0xbf, 0x0b, 0x39, 0xb8, 0x27, 0xea, 0x3b, 0x50, 0xf4, 0x50, 0xc4, 0xd3, 0xef, 0x84 },
+          { 0x30, 0x21, 0x7f, 0x7d, 0x97, 0x02, 0xa0, 0x31, 0x86, 0x31, 0x38, 0xb4, 0xc9, 0x00, 0x72, 0x4f, 0x55, 0x5f, 0x09, 0xc8, 0xe0, 0x2f, 0x6a, 0xaa, 0x2c, 0xc0, 0x43, 0x1d, 0x63, 0x67, 0xff, 0xd1 } },
+        { { 0x09, 0xa7, 0x64, 0x03, 0x55, 0x81, 0xb0, 0x53, 0x29, 0xfd, 0xab, 0xbd, 0x60, 0x93, 0xd3, 0xc2, 0xc8, 0xc1, 0x2c, 0xaa, 0xa9, 0x4b, 0x9d, 0x6c, 0xd9, 0xb9, 0x38, 0xc0, 0x65, 0x68, 0xae, 0x0e },
+          { 0x06, 0x91, 0xb1, 0x54, 0x28, 0x17, 0x16, 0xf9, 0x74, 0x59, 0x2b, 0x94, 0x26, 0x89, 0x36, 0x5e, 0xdb, 0x5f, 0xf1, 0x52, 0x1a, 0x0d, 0x57, 0x3b, 0xdd, 0x23, 0x65, 0x24, 0x93, 0x9a, 0xec, 0x69 } },
+        { { 0x19, 0x53, 0x27, 0xfc, 0x5f, 0x43, 0x66, 0xce, 0xe7, 0x04, 0xce, 0x76, 0xeb, 0x9a, 0xfb, 0xed, 0xc2, 0x0d, 0x75, 0xd6, 0xd5, 0xc0, 0x12, 0x26, 0x95, 0x74, 0x2e, 0xb8, 0xaa, 0x42, 0x60, 0xf0 },
+          { 0x3b, 0xf8, 0x88, 0x7e, 0x34, 0x7a, 0x84, 0x76, 0xda, 0x70, 0x45, 0xdc, 0x89, 0x13, 0x4e, 0x39, 0xb2, 0x3e, 0x23, 0xa5, 0xf3, 0x33, 0x50, 0x57, 0xd2, 0x40, 0x1f, 0xbe, 0xcf, 0x21, 0x25, 0xeb } },
+        { { 0x00, 0x1d, 0xd8, 0x50, 0x9a, 0x8a, 0xd1, 0xdf, 0x01, 0x9d, 0x4f, 0xc3, 0xd4, 0x38, 0xc1, 0xa5, 0x31, 0xce, 0x0e, 0xfd, 0x92, 0xb0, 0x78, 0xb0, 0xd7, 0xd4, 0x52, 0x55, 0x17, 0xce, 0xee, 0x66 },
+          { 0x0f, 0x68, 0xf7, 0xbe, 0xc3, 0xa4, 0x2a, 0x22, 0xe4, 0xf2, 0x69, 0x6c, 0x95, 0x32, 0x12, 0xdf, 0x88, 0xbb, 0xb4, 0xf0, 0xa0, 0x03, 0x59, 0x2d, 0xb4, 0xcc, 0x68, 0x3b, 0xf7, 0x48, 0x15, 0x06 } },
+        { { 0x07, 0x8c, 0x78, 0x25, 0xe2, 0x1f, 0xb9, 0xa4, 0xec, 0x1a, 0xba, 0x97, 0x56, 0xee, 0x69, 0xd2, 0x25, 0x72, 0x0a, 0x8c, 0x59, 0xa0, 0x79, 0x6c, 0x09, 0xb4, 0x33, 0x0f, 0x60, 0x84, 0x99, 0x78 },
+          { 0x28, 0x47, 0x83, 0xf1, 0xc9, 0xe2, 0x37, 0x9a, 0x31, 0x75, 0x77, 0x0b, 0x5a, 0xa3, 0xc0, 0xf9, 0x51, 0x1d, 0x02, 0xae, 0x7c, 0xf3, 0x22, 0x83, 0x74, 0x08, 0xa7, 0xb1, 0xae, 0xf4, 0xe8, 0xe1 } },
+        { { 0x3b, 0xc3, 0x59, 0xd8, 0xe8, 0xe2, 0x52, 0x6f, 0xb1, 0x0d, 0x78, 0x0d, 0x31, 0x82, 0x20, 0xd9, 0x73, 0x76, 0xa7, 0xff, 0x19, 0x14, 0xe0, 0x64, 0x7a, 0xf2, 0xf3, 0x30, 0x1f, 0xfa, 0x07, 0x1a },
+          { 0x35, 0x6e, 0x10, 0x06, 0x53, 0x71, 0x74, 0x88, 0xbd, 0x08, 0xfd, 0x04, 0x15, 0xd7, 0x8c, 0x82, 0xd9, 0x23, 0xbc, 0x1a, 0x27, 0x15, 0xd3, 0x62, 0x8b, 0x37, 0xb9, 0x69, 0x89, 0x80, 0xc0, 0x39 } },
+        { { 0x36, 0xa9, 0xee, 0xb5, 0x9b, 0xa6, 0x45, 0x41, 0x83, 0x46, 0xf7, 0x2e, 0xb3, 0xb8, 0x54, 0x1e, 0xc0, 0xfd, 0xa6, 0x3f, 0xf2, 0x99, 0xee, 0x47, 0x28, 0x24, 0x4f, 0x10, 0xf7, 0x1f, 0x6b, 0x12 },
+          { 0x10, 0x4c, 0x56, 0xa3, 0x78, 0xda, 0x99, 0xe6, 0x63, 0xd4, 0xe9, 0xb4, 0x6e, 0x50, 0x27, 0x21, 0x41, 0x2f, 0x3e, 0x28, 0x4b, 0x68, 0x52, 0xef, 0x49, 0xec, 0xd1, 0xc8, 0xe5, 0x85, 0x4f, 0x7e } },
+        { { 0x3a, 0xdf, 0x6e, 0x9f, 0x9d, 0x9a, 0xd7, 0xb8, 0xd0, 0xc7, 0x72, 0x82, 0x31, 0x71, 0x05, 0x5e, 0xae, 0xe7, 0x27, 0xfe, 0x04, 0xdd, 0x30, 0x5a, 0xf2, 0x86, 0xf3, 0xf3, 0x64, 0xe0, 0xfe, 0x13 },
+          { 0x19, 0x09, 0x8b, 0x69, 0x49, 0x78, 0x57, 0xa3, 0x4f, 0x85, 0xfe, 0xb1, 0x03, 0x41, 0x41, 0x34, 0xf4, 0xb4, 0x9f, 0xf0, 0x49, 0xa8, 0xa1, 0x83, 0x3a, 0xd3, 0x74, 0x5f, 0x47, 0x00, 0x69, 0xba } }
+    },
+    {
+        { { 0x2c, 0x07, 0xf2, 0x46, 0xe3, 0xd3, 0x96, 0xd3, 0x1e, 0x51, 0xb9, 0x05, 0x9a, 0xb1, 0x2c, 0x57, 0x40, 0x26, 0x14, 0x2e, 0x86, 0x28, 0x3c, 0x41, 0xf9, 0xe8, 0x38, 0x9f, 0x81, 0xef, 0x2e, 0x90 },
+          { 0x0c, 0x0b, 0x9b, 0x7c, 0xa1, 0x8b, 0x2c, 0x5b, 0x6e, 0xd0, 0x40, 0x49, 0xda, 0x0a, 0xa3, 0x0f, 0x2e, 0x57, 0x7d, 0x70, 0x81, 0x7e, 0xce, 0xa7, 0xe3, 0x7e, 0x18, 0x61, 0x59, 0x5e, 0x3c, 0xb8 } },
+        { { 0x1e, 0x6c, 0xd4, 0xe9, 0xcc, 0xe4, 0xb7, 0x11, 0x99, 0xd9, 0x6c, 0x66, 0xef, 0x52, 0xd0, 0x87, 0x84, 0x6c, 0xf2, 0xd4, 0x4f, 0xbc, 0x44, 0x25, 0xa0, 0x81, 0x82, 0x25, 0xba, 0x43, 0xef, 0xaa },
+          { 0x36, 0x56, 0xf5, 0x83, 0x77, 0x12, 0xc7, 0x43, 0xe1, 0xbf, 0x5a, 0x5d, 0x3a, 0xe8, 0xd0, 0x9e, 0x9a, 0x41, 0x11, 0xf7, 0x71, 0xdc, 0xdc, 0xe6, 0x8a, 0xd6, 0x93, 0xb7, 0x10, 0xc3, 0xe7, 0x3f } },
+        { { 0x17, 0xeb, 0xf6, 0x97, 0x63, 0xd1, 0x8d, 0xfe, 0x50, 0x1d, 0x1d, 0xb1, 0x60, 0x6a, 0xff, 0x3a, 0x5e, 0xc3, 0x52, 0x55, 0xb5, 0x5b, 0xff, 0xdd, 0xf0, 0x75, 0x78, 0x26, 0x6f, 0xf6, 0xab, 0xee },
+          { 0x33, 0xa7, 0x77, 0xf8, 0xa7, 0xd7, 0xe7, 0xe6, 0xe0, 0x5e, 0x60, 0xb8, 0xdf, 0x0f, 0xd2, 0xa4, 0x28, 0xb2, 0x40, 0x43, 0x84, 0x5b, 0xee, 0x13, 0xaf, 0x0c, 0x19, 0x7a, 0x79, 0x02, 0xd3, 0x4b } },
+        { { 0x1e, 0xb9, 0xb6, 0x13, 0x9f, 0x52, 0xef, 0x90, 0x51, 0x58, 0x45, 0x56, 0xbd, 0x18, 0xf3, 0x9d, 0xb3, 0x0d, 0xfb, 0xf1, 0x0d, 0x29, 0x61, 0x32, 0x8c, 0xcd, 0x5e, 0x65, 0xd0, 0x64, 0x64, 0xfd },
+          { 0x01, 0x9d, 0x14, 0x7e, 0x09, 0xdb, 0xeb, 0x42, 0x00, 0x63, 0x9e, 0xe7, 0xf2, 0x30, 0x9a, 0x5b, 0xc9, 0xa0, 0xef, 0x32, 0x02, 0x46, 0x6b, 0x78, 0xcc, 0xd9, 0x8a, 0x21, 0x81, 0x15, 0xfd, 0xcc } },
+        { { 0x02, 0xde, 0x94, 0xd3, 0x93, 0x5a, 0x60, 0xe5, 0x1d, 0x5f, 0x9b, 0x32, 0xe1, 0x18, 0x71, 0x37, 0x57, 0x5d, 0xc0, 0xe4, 0xa4, 0x4f, 0x80, 0x1d, 0x79, 0x8f, 0x6b, 0xd4, 0x32, 0xca, 0xae, 0x0c },
+          { 0x0d, 0xa9, 0x29, 0xba, 0xf3, 0x2c, 0xf4, 0x7b, 0x02, 0xed, 0x9f, 0x79, 0x1c, 0xc1, 0x5b, 0x91, 0x0b, 0x1e, 0x7e, 0x2a, 0x66, 0x7b, 0x7d, 0x34, 0xae, 0xf1, 0x12, 0x2e, 0xee, 0xf3, 0x2a, 0xe5 } },
+        { { 0x38, 0x79, 0x49, 0x38, 0xb4, 0x74, 0x17, 0x0f, 0xe3, 0x91, 0xc1, 0x7f, 0xa9, 0x54, 0x19, 0xcf, 0x54, 0x97, 0xe2, 0xd0, 0x2a, 0x53, 0xe6, 0x8d, 0xe0, 0x7f, 0x10, 0xce, 0xed, 0x24, 0x20, 0xe8 },
+          { 0x20, 0xac, 0xe2, 0x92, 0x7f, 0x52, 0x3e, 0x31, 0x5e, 0x44, 0x2a, 0x33, 0xea, 0xba, 0x30, 0x5b, 0xa9, 0xfe, 0xad, 0x0c, 0x4d, 0xb4, 0xdd, 0x46, 0x26, 0x9b, 0x5e, 0x2b, 0xfd, 0xff, 0x70, 0x45 } },
+        { { 0x3b, 0x17, 0xc1, 0xa6, 0x28, 0xe6, 0x14, 0xe3, 0x45, 0x04, 0x31, 0xde, 0x3b, 0x49, 0x5c, 0x0c, 0x55, 0x9a, 0x90, 0xa4, 0xff, 0xbb, 0x9b, 0x69, 0x58, 0x25, 0x2f, 0x9f, 0xa8, 0x6e, 0xa0, 0x46 },
+          { 0x25, 0x69, 0x46, 0x86, 0x48, 0x3a, 0x7e, 0x40, 0x79, 0xf4, 0xa1, 0x00, 0x44, 0x46, 0xa4, 0xa6, 0x12, 0x2d, 0x65, 0xae, 0xd0, 0x6c, 0x2b, 0x2a, 0xb8, 0x0b, 0xe0, 0x93, 0x19, 0x73, 0x0b, 0x16 } },
+        { { 0x26, 0xe6, 0x44, 0xab, 0xc5, 0x7c, 0xb9, 0x6e, 0xd4, 0x4d, 0x51, 0xff, 0x42, 0x21, 0x64, 0x6b, 0xc4, 0x44, 0xc3, 0x54, 0x2f, 0xec, 0x68, 0x21, 0x87, 0x8a, 0xb8, 0x5c, 0x47, 0xd3, 0x61, 0x3e },
+          { 0x23, 0xef, 0x03, 0x5c, 0x27, 0x98, 0x74, 0x24, 0x82, 0x2c, 0xbf, 0x71, 0x73, 0x14, 0xa0, 0x32, 0xc1, 0xb3, 0x7b, 0x02, 0x59, 0xcf, 0xc7, 0x21, 0xde, 0xd4, 0xb9, 0xe2, 0x28, 0x4c, 0xc8, 0x07 } }
+    },
+    {
+        { { 0x00, 0x9e, 0x85, 0x0a, 0x35, 0x46, 0x25, 0xee, 0x53, 0xd6, 0xac, 0x69, 0x31, 0xb9, 0x26, 0xea, 0x3e, 0x7a, 0x01, 0x71, 0x97, 0x57, 0x09, 0xc9, 0xd2, 0x07, 0x12, 0x55, 0xf0, 0xc7, 0x59, 0x93 },
+          { 0x04, 0x60, 0xf7, 0xc7, 0xba, 0x7d, 0xae, 0xa5, 0x69, 0xf1, 0x5a, 0xff, 0xdb, 0xb2, 0x88, 0x00, 0x3e, 0x5b, 0x9d, 0xbb, 0x40, 0x85, 0x48, 0xe1, 0xdf, 0x47, 0xc8, 0x4e, 0x12, 0xc8, 0x2a, 0x3d } },
+        { { 0x2a, 0xee, 0x46, 0xe6, 0x2d, 0x42, 0xb6, 0xb4, 0x7e, 0xff, 0x5f, 0x5d, 0x5a, 0x66, 0xe6, 0xcb, 0xb4, 0x54, 0x59, 0x1f, 0x26, 0x72, 0xd0, 0xc0, 0x84, 0x68, 0x36, 0xdd, 0x72, 0x5b, 0x9a, 0xc5 },
+          { 0x20, 0x6f, 0x38, 0x7f, 0xda, 0xcc, 0xf3, 0x05, 0x40, 0x4e, 0x65, 0x0f, 0x82, 0x39, 0x70, 0x2c, 0xab, 0xf0, 0x80, 0xb0, 0x7b, 0x3b, 0x32, 0xba, 0x8b, 0xab, 0x06, 0x6b, 0xad, 0x13, 0x9a, 0x05 } },
+        { { 0x39, 0x9a, 0x8d, 0x15, 0xcf, 0xbc, 0xa1, 0xd6, 0x4e, 0x46, 0x09, 0x66, 0x5f, 0xe2, 0x7e, 0xdb, 0xdc, 0x72, 0xe0, 0xd8, 0xf5, 0x51, 0x0b, 0xc8, 0x9d, 0x3b, 0xdc, 0x1b, 0x2f, 0x40, 0xa1, 0x75 },
+          { 0x19, 0xb9, 0x36, 0xc2, 0x96, 0x40, 0x9e, 0x02, 0xc6, 0xef, 0x53, 0x8e, 0x44, 0x20, 0xf8, 0x27, 0x79, 0x85, 0xe5, 0x06, 0xa9, 0xaa, 0xd4, 0xeb, 0xb6, 0x1b, 0x85, 0x52, 0x9a, 0x40, 0x2d, 0xb7 } },
+        { { 0x23, 0xd9, 0x99, 0x8d, 0xbe, 0xa5, 0xc5, 0xf9, 0x7d, 0xc5, 0xd1, 0xb4, 0x38, 0x49, 0x26, 0x1f, 0x06, 0x33, 0xd7, 0x20, 0x22, 0x19, 0x04, 0x5b, 0x34, 0xe8, 0xbb, 0xd8, 0x82, 0xe0, 0x6f, 0x19 },
+          { 0x3b, 0xf8, 0xb6, 0x36, 0x7b, 0xa1, 0xbc, 0xc1, 0x5c, 0x20, 0x92, 0x25, 0x80, 0x22, 0xb3, 0xc5, 0x5a, 0xb6, 0xbf, 0xe0, 0x80, 0xa6, 0x3d, 0x12, 0x8b, 0x13, 0xf0, 0xfb, 0x48, 0x9e, 0x0c, 0x17 } },
+        { { 0x24, 0xe3, 0x48, 0x75, 0x0e, 0x2b, 0xf3, 0xbd, 0x95, 0x12, 0xcc, 0xe2, 0x51, 0x7f, 0xe4, 0x31, 0xa6, 0x56, 0xbd, 0x18, 0xa0, 0x07, 0xdd, 0xce, 0x83, 0x54, 0xfe, 0x98, 0xca, 0x7c, 0xd3, 0xfa },
+          { 0x2d, 0xd7, 0x4b, 0x0a, 0xd0, 0x78, 0xd4, 0xc3, 0xa5, 0x6f, 0x82, 0xee, 0xed, 0x44, 0x15, 0x23, 0xf3, 0x9a, 0x63, 0x8b, 0x44, 0x34, 0x5c, 0xa1, 0xfd, 0x3d, 0x93, 0xf2, 0x56, 0xf8, 0x22, 0x48 } },
+        { { 0x24, 0xa7, 0x4b, 0xf7, 0x86, 0x13, 0x28, 0x78, 0x86, 0x79, 0xef, 0xaf, 0x93, 0x2d, 0xf2, 0x72, 0xfe, 0xb1, 0xa2, 0x4e, 0x1a, 0xe4, 0x1d, 0xdd, 0x23, 0xe2, 0x82, 0x73, 0xd9, 0xf7, 0x00, 0x0d },
+          { 0x3d, 0x1b, 0x60, 0x87, 0x26, 0x08, 0xf5, 0x27, 0xcf, 0x15, 0x3a, 0xa1, 0xcf, 0x18, 0xb1, 0x55, 0x3c, 0xdf, 0x90, 0x13, 0x7d, 0xc2, 0x25, 0x84, 0xf0, 0x88, 0x52, 0xb9, 0xb6, 0x2a, 0x55, 0x84 } },
+        { { 0x24, 0xb0, 0xef, 0x4d, 0x7f, 0xc6, 0x95, 0x06, 0xe2, 0xa9, 0x9d, 0xe0, 0xa0, 0x5d, 0x05, 0xd3, 0x22, 0xb4, 0x02, 0x14, 0xa6, 0xc7, 0x6c, 0x7a, 0xd7, 0xef, 0x03, 0x70, 0xda, 0xd3, 0x3d, 0x1a },
+          { 0x14, 0x33, 0xca, 0xc3, 0x11, 0x54, 0x77, 0x7b, 0x98, 0xad, 0x40, 0xdb, 0xe2, 0x51, 0xd2, 0x21, 0xb4, 0xe5, 0x68, 0x61, 0x37, 0xea, 0x5c, 0xb7, 0x3f, 0xab, 0x76, 0xdd, 0xbc, 0xa5, 0x91, 0x76 } },
+        { { 0x0b, 0x37, 0x28, 0x12, 0x3b, 0x0f, 0xf8, 0x37, 0xdd, 0xca, 0x5f, 0x2f, 0x60, 0x85, 0xff, 0x26, 0x80, 0x61, 0xe5, 0x33, 0x74, 0x62, 0xc5, 0x51, 0xf7, 0xfb, 0x8e, 0x78, 0xb1, 0x1b, 0x49, 0x94 },
+          { 0x2a, 0x07, 0x6b, 0x0e, 0x80, 0x96, 0x2e, 0x5d, 0xb8, 0xa3, 0x5f, 0x86, 0x3e, 0xfc, 0x2a, 0xec, 0x79, 0x06, 0x22, 0x80, 0x37, 0x9c, 0x8b, 0xb3, 0xca, 0x4f, 0xb5, 0x80, 0xc1, 0x24, 0x4f, 0x3a } }
+    },
+    {
+        { { 0x07, 0x59, 0x35, 0xc0, 0xce, 0xf1, 0xfe, 0xef, 0xac, 0xa9, 0x60, 0xe7, 0xf7, 0x30, 0x27, 0x15, 0xb2, 0x23, 0xe4, 0xe9, 0x28, 0x02, 0x7a, 0x6f, 0x3a, 0xda, 0x9e, 0x7e, 0x6a, 0x8d, 0x43, 0x9b },
+          { 0x02, 0xc7, 0x4a, 0x88, 0xe7, 0xd9, 0x22, 0xa4, 0x1b, 0x34, 0xb1, 0x5c, 0x7c, 0x1a, 0x24, 0x9d, 0x1f, 0xb7, 0x1a, 0xdf, 0xfc, 0x1b, 0xfb, 0xeb, 0x0a, 0x44, 0x1e, 0xd7, 0x8d, 0x6c, 0x9b, 0xfd } },
+        { { 0x2d, 0xfa, 0x2a, 0x51, 0x96, 0xdd, 0x9a, 0x11, 0x84, 0x81, 0xaa, 0x87, 0xdb, 0xb1, 0x39, 0x1a, 0xa2, 0x49, 0x25, 0x91, 0xc0, 0x31, 0x72, 0x0e, 0x9a, 0x45, 0xa9, 0xc0, 0xc6, 0xfe, 0x1d, 0x55 },
+          { 0x2f, 0xa6, 0x6a, 0x39, 0x73, 0x5b, 0x66, 0x6c, 0x1f, 0xa6, 0x93, 0xba, 0x56, 0x32, 0xcd, 0xcf, 0x18, 0x69, 0x24, 0xa5, 0x31, 0x31, 0x2c, 0xb5, 0xb4, 0xcb, 0x88, 0xb3, 0x58, 0xe3, 0x38, 0xc7 } },
+        { { 0x35, 0x07, 0x9a, 0x75, 0x6b, 0xaa, 0x2b, 0xf3, 0x19, 0x51, 0xe4, 0x75, 0xb1, 0x1a, 0x0f, 0xc9, 0xc0, 0xcf, 0x5d, 0xc1, 0x64, 0x05, 0xe0, 0x39, 0x09, 0xec, 0x9b, 0x36, 0xc5, 0x88, 0x09, 0xd0 },
+          { 0x22, 0x78, 0xe7, 0x92, 0x35, 0xc7, 0x40, 0xb4, 0x4a, 0x64, 0x48, 0x96, 0xa3, 0xb5, 0x97, 0x36, 0x97, 0xce, 0xfc, 0xa1, 0x11, 0xb5, 0x5a, 0x52, 0xe1, 0x29, 0xc8, 0x48, 0x75, 0x6c, 0x1b, 0x12 } },
+        { { 0x1c, 0xde, 0x3b, 0x90, 0x2f, 0x72, 0x46, 0x5e, 0x83, 0x37, 0x6b, 0xea, 0xc8, 0x3d, 0xfb, 0x1a, 0x28, 0x5a, 0xc0, 0xdc, 0x82, 0x37, 0x00, 0x29, 0x09, 0x11, 0x32, 0x0f, 0xce, 0x7c, 0x55, 0x17 },
+          { 0x3b, 0x86, 0xe9, 0xab, 0x01, 0x73, 0x93, 0x60, 0x9a, 0xe4, 0x2c, 0xb8, 0xd3, 0x7a, 0x82, 0x3c, 0x53, 0xf1, 0x82, 0xb3, 0xd1, 0xc1, 0xcc, 0x86, 0x08, 0x03, 0xc7, 0x53, 0x8b, 0x55, 0xc3, 0x45 } },
+        { { 0x16, 0xbe, 0xd1, 0xab, 0xe7, 0xd0, 0xc8, 0xff, 0x1b, 0x9c, 0x73, 0x2c, 0x9d, 0xc7, 0xe3, 0xfe, 0x36, 0x4f, 0x60, 0xaf, 0xd5, 0xd0, 0x88, 0xfc, 0x3a, 0x45, 0x1d, 0x4b, 0xa3, 0xb8, 0x2b, 0x97 },
+          { 0x26, 0x17, 0xef, 0xaa, 0xa8, 0x3f, 0xeb, 0x0b, 0xbe, 0x38, 0x13, 0x4e, 0xbd, 0xce, 0x0e, 0xf4, 0x12, 0x93, 0x31, 0xd5, 0xd8, 0x55, 0x5c, 0x4d, 0x25, 0x15, 0xf8, 0xe8, 0xc0, 0x5a, 0x68, 0xbd } },
+        { { 0x1a, 0x17, 0xbb, 0x5d, 0x7a, 0x34, 0xaa, 0xfa, 0xb8, 0x30, 0x6c, 0xd9, 0x28, 0xa5, 0xd2, 0x71, 0x89, 0xaf, 0x6b, 0xb0, 0x9f, 0x49, 0xb9, 0x81, 0x7b, 0x69, 0x39, 0x4f, 0x59, 0x8c, 0x3f, 0xc1 },
+          { 0x02, 0x62, 0xf5, 0x68, 0x88, 0x32, 0xba, 0xf9, 0xd1, 0x01, 0x3b, 0xea, 0xdf, 0x9a, 0x9e, 0x31, 0x4b, 0x39, 0x4b, 0xd5, 0x74, 0x2e, 0x3f, 0x65, 0xfd, 0xff, 0x38, 0x3d, 0xeb, 0xb1, 0xfd, 0x4f } },
+        { { 0x3c, 0xb1, 0x7f, 0x37, 0x57, 0x17, 0x41, 0x6b, 0xd6, 0x2f, 0xaf, 0x05, 0xca, 0xd9, 0x97, 0xc4, 0x81, 0xe1, 0x00, 0x9b, 0x33, 0x8f, 0x13, 0x31, 0x0d, 0x19, 0xd3, 0x41, 0x45, 0x18, 0xd8, 0xf8 },
+          { 0x18, 0xed, 0x23, 0x13, 0x57, 0x37, 0x4c, 0x86, 0x8a, 0x24, 0x08, 0x08, 0x30, 0x59, 0xa3, 0x17, 0x87, 0x35, 0xb2, 0xab, 0xd9, 0xcd, 0xc0, 0x89, 0xbf, 0x93, 0xc3, 0xdd, 0xac, 0xa3, 0x86, 0x03 } },
+        { { 0x15, 0x46, 0x27, 0x3c, 0x97, 0x05, 0xce, 0xed, 0x3a, 0xcf, 0x84, 0x14, 0x31, 0xe4, 0xa6, 0x17, 0x1f, 0x39, 0x49, 0xe7, 0x0b, 0xac, 0x11, 0xbe, 0xca, 0x23, 0x16, 0x1c, 0x3b, 0xe5, 0xf7, 0x93 },
+          { 0x2c, 0x0d, 0x98, 0x0a, 0xc1, 0xc6, 0xff, 0x1b, 0xf8, 0xaa, 0x04, 0x06, 0xef, 0x92, 0xe7, 0x21, 0xb0, 0x4f, 0xfb, 0x84, 0x62, 0x1f, 0xc0, 0xa6, 0xb6, 0x5e, 0xb5, 0x2d, 0xe5, 0x01, 0x98, 0x40 } }
+    },
+    {
+        { { 0x3a, 0x62, 0xd0, 0x58, 0x35, 0x62, 0xd7, 0x44, 0x62, 0x69, 0xd4, 0xc4, 0xa8, 0x24, 0x06, 0x68, 0x1c, 0xc2, 0x49, 0xf1, 0x65, 0xed, 0x0e, 0xc8, 0x7e, 0xa0, 0xa0, 0x0b, 0x0a, 0xc5, 0xa8, 0xcb },
+          { 0x1d, 0xca, 0x97, 0x53, 0xfd, 0x1b, 0x66, 0xd6, 0x5b, 0xda, 0xf6, 0xc6, 0x65, 0x37, 0xa2, 0xf9, 0xfe, 0x30, 0xaa, 0x4d, 0xac, 0x7b, 0x90, 0x48, 0x5e, 0x7e, 0x47, 0x3f, 0x17, 0xe3, 0x2b, 0x3c } },
+        { { 0x00, 0x61, 0x40, 0xa5, 0xe7, 0x27, 0x11, 0xc4, 0x26, 0xcf, 0x23, 0x9c, 0x0e, 0xcd, 0x38, 0x04, 0x08, 0xe6, 0x6c, 0xa7, 0x09, 0xc0, 0x70, 0x8d, 0xa6, 0x38, 0x0c, 0xd9, 0x1f, 0x65, 0x68, 0x10 },
+          { 0x05, 0xa7, 0xe0, 0x37, 0xc9, 0xb5, 0xb5, 0x1c, 0x14, 0xfc, 0x31, 0x9c, 0x77, 0x89, 0x84, 0x60, 0x8c, 0x9b, 0x85, 0x95, 0x2e, 0x27, 0x2a, 0xf6, 0x86, 0xe6, 0x86, 0x1e, 0xad, 0xad, 0xc1, 0xf0 } },
+        { { 0x25, 0x8a, 0xac, 0xc2, 0xaa, 0xa2, 0x58, 0x20, 0x4d, 0xc0, 0xb2, 0x53, 0x4b, 0x0b, 0x12, 0x09, 0x95, 0x35, 0x30, 0x66, 0xb2, 0x79, 0xdc, 0x9b, 0x09, 0x01, 0x6b, 0xe5, 0x0a, 0x3e, 0xa3, 0x1e },
+          { 0x3e, 0xe3, 0x9b, 0x92, 0xb8, 0x53, 0x3d, 0xf7, 0xbc, 0x13, 0x14, 0x37, 0x2d, 0x1d, 0x90, 0xde, 0xda, 0xc9, 0xaf, 0x77, 0xf2, 0x71, 0xdb, 0xfb, 0x0e, 0x45, 0xa9, 0xc2, 0x0c, 0x12, 0x53, 0x0e } },
+        { { 0x16, 0xd1, 0x22, 0xe1, 0x21, 0x09, 0xeb, 0xa6, 0xb9, 0x76, 0x34, 0xa9, 0xa4, 0xd0, 0x49, 0xe6, 0x88, 0x06, 0xce, 0x90, 0xe8, 0x32, 0x91, 0xea, 0x89, 0x3c, 0x06, 0x04, 0x41, 0xff, 0xe7, 0xba },
+          { 0x30, 0x22, 0x4d, 0xc8, 0xd2, 0x5a, 0xc4, 0x1a, 0xcd, 0xc7, 0x7b, 0x83, 0xaf, 0x13, 0x10, 0xd2, 0x6d, 0xd4, 0x9c, 0x4d, 0xd0, 0x88, 0x5c, 0x93, 0x86, 0x36, 0x28, 0x60, 0x1c, 0x48, 0x6b, 0xae } },
+        { { 0x19, 0x52, 0x99, 0x9d, 0x6b, 0x38, 0xc6, 0xcc, 0xc9, 0x49, 0xdf, 0xb2, 0xab, 0x5c, 0xa0, 0xea, 0x59, 0x06, 0x1a, 0x47, 0x29, 0xe6, 0xc2, 0xea, 0xc5, 0xb9, 0xe3, 0x08, 0x1e, 0x1f, 0x0f, 0x55 },
+          { 0x1f, 0xb2, 0xb2, 0x82, 0x13, 0xa9, 0x62, 0xca, 0xe5, 0xd9, 0x88, 0xfc, 0x6a, 0xa0, 0x65, 0xd4, 0xe4, 0x0e, 0x61, 0xd8, 0x5e, 0xf2, 0x99, 0x76, 0xec, 0xd5, 0x95, 0x55, 0x49, 0x18, 0x3d, 0xf8 } },
+        { { 0x1c, 0x51, 0x60, 0x49, 0x2c, 0x53, 0x47, 0x80, 0x12, 0x25, 0x16, 0x55, 0xfc, 0xc2, 0xdd, 0x7a, 0xbc, 0xc1, 0xfd, 0xd5, 0x24, 0x8b, 0x5e, 0x7f, 0xd6, 0xef, 0x3c, 0x3d, 0x6b, 0xfa, 0xa5, 0x03 },
+          { 0x09, 0x6b, 0x02, 0xb9, 0x7a, 0xad, 0xbe, 0x0c, 0xe7, 0xab, 0x66, 0xea, 0xb9, 0x8e, 0x28, 0xda, 0xd5, 0xbb, 0xed, 0x16, 0x8a, 0x27, 0x1e, 0xca, 0xb5, 0x26, 0x3d, 0x4a, 0x3c, 0x5e, 0xcf, 0xed } },
+        { { 0x2f, 0x24, 0xe7, 0x11, 0x88, 0x1b, 0x3f, 0x6a, 0x23, 0xb5, 0xb3, 0x85, 0x27, 0xfb, 0x46, 0xcd, 0x46, 0x17, 0x6f, 0x17, 0xec, 0x7f, 0xe9, 0x40, 0x62, 0x33, 0x60, 0x20, 0x54, 0x74, 0x09, 0x26 },
+          { 0x3c, 0xc7, 0x10, 0x64, 0xde, 0xdb, 0x37, 0x1d, 0xc5, 0x9f, 0x94, 0x9b, 0xc9, 0xb0, 0x3f, 0x2f, 0x82, 0x91, 0x6c, 0x1d, 0x37, 0x13, 0xc9, 0x77, 0x13, 0xf5, 0x5c, 0xf0, 0x53, 0x41, 0x1f, 0x95 } },
+        { { 0x3a, 0x0a, 0x2e, 0xd6, 0x81, 0x3d, 0x0e, 0x57, 0x3d, 0xef, 0x61, 0x41, 0x91, 0x12, 0xdf, 0x6d, 0xc6, 0x41, 0xa6, 0x03, 0xbf, 0x52, 0x8e, 0x6b, 0x1b, 0xc2, 0xb7, 0x72, 0xc5, 0x26, 0x81, 0x57 },
+          { 0x06, 0xee, 0x7f, 0x53, 0x94, 0xe5, 0x0d, 0x2f, 0x55, 0x8d, 0x07, 0x87, 0x80, 0xdc, 0x6b, 0x41, 0xb6, 0x25, 0x5d, 0x01, 0x20, 0xc0, 0x66, 0x4e, 0xbc, 0x10, 0x28, 0x2e, 0xcb, 0x0f, 0xd4, 0xc7 } }
+    },
+    {
+        { { 0x16, 0x9d, 0x77, 0x43, 0x6a, 0x2e, 0x37, 0xd1, 0x2d, 0x62, 0x74, 0x79, 0x5a, 0x2c, 0x3e, 0x74, 0xa9, 0xf3, 0x97, 0xdc, 0xb9, 0xce, 0x30, 0x63, 0xa0, 0x89, 0xbc, 0x3f, 0x50, 0xe6, 0xb2, 0x6b },
+          { 0x1c, 0x93, 0xb2, 0x5d, 0x5a, 0xf4, 0x68, 0xe2, 0x1c, 0x24, 0x15, 0x36, 0x61, 0x22, 0x32, 0x13, 0xdd, 0xfd, 0x1c, 0x7e, 0xe2, 0xf2, 0xbc, 0x82, 0x85, 0x59, 0x87, 0xa2, 0x64, 0xf6, 0xa2, 0x86 } },
+        { { 0x31, 0x81, 0x9f, 0x0c, 0xde, 0x12, 0x4b, 0x52, 0x69, 0xdf, 0x3c, 0x69, 0xa1, 0xf9, 0x1c, 0xa0, 0xc1, 0xff, 0x02, 0xe6, 0x21, 0x8b, 0xe5, 0xbf, 0xed, 0xe1, 0xb7, 0xfe, 0x4e, 0x1d, 0xf5, 0x2a },
+          { 0x0e, 0xf1, 0x5e, 0x7d, 0x53, 0x66, 0x34, 0xbe, 0x12, 0x74, 0x8a, 0x8c, 0x82, 0x3d, 0x3b, 0x84, 0x2e, 0xa8, 0x86, 0xee, 0xbf, 0x24, 0x28, 0xb6, 0x71, 0xe3, 0x47, 0x78, 0x95, 0x78, 0x94, 0xc9 } },
+        { { 0x14, 0xc4, 0x16, 0x42, 0x5a, 0x71, 0xbc, 0x9b, 0x0d, 0xbe, 0xa9, 0xa3, 0x92, 0x0d, 0x30, 0x65, 0xee, 0xfc, 0xc2, 0x5a, 0x66, 0xcf, 0xbe, 0x5e, 0x90, 0xf1, 0x6d, 0x6a, 0x25, 0xdd, 0x25, 0xf5 },
+          { 0x26, 0xa8, 0x11, 0x12, 0xbb, 0xe4, 0x99, 0x7c, 0x6f, 0x2e, 0x9a, 0x05, 0x7e, 0x08, 0x41, 0xc5, 0xf5, 0x36, 0xf7, 0xef, 0x70, 0x8c, 0x27, 0x3c, 0x16, 0x7a, 0x3c, 0x4b, 0xdc, 0x52, 0xbb, 0x17 } },
+        { { 0x33, 0xa1, 0x1d, 0x67, 0x41, 0x5d, 0x1b, 0xda, 0x8d, 0xa8, 0x77, 0x4f, 0x22, 0x5a, 0x96, 0xd1, 0xcd, 0x5f, 0xe1, 0x07, 0xe4, 0x0b, 0xe8, 0xe8, 0xe0, 0x07, 0xd0, 0x73, 0x80, 0xbe, 0xcf, 0x7c },
+          { 0x22, 0x34, 0x65, 0x71, 0x1a, 0x8a, 0x88, 0x7d, 0x1c, 0x94, 0x88, 0x9e, 0x1d, 0x84, 0x51, 0x32, 0x0a, 0x0f, 0x71, 0xe8, 0xd8, 0xc4, 0x73, 0xb4, 0x5a, 0xa5, 0x08, 0xf1, 0x7a, 0x1e, 0x98, 0xf9 } },
+        { { 0x3a, 0x92, 0xf5, 0x03, 0x14, 0x99, 0x7b, 0x8a, 0x51, 0xb4, 0xaa, 0xa7, 0x4e, 0x72, 0x33, 0xd9, 0x83, 0xb4, 0x83, 0x97, 0x20, 0x65, 0x15, 0x50, 0x0c, 0xae, 0xff, 0xd4, 0x14, 0x64, 0xfa, 0x1e },
+          { 0x08, 0xcb, 0x09, 0xea, 0x60, 0x38, 0x3c, 0xb8, 0x82, 0x7e, 0xd0, 0x93, 0x87, 0xab, 0xcb, 0xd5, 0x05, 0xbd, 0xd6, 0xb3, 0xa5, 0x82, 0x2c, 0xc3, 0x23, 0xd5, 0x4c, 0x7f, 0x07, 0xd3, 0xed, 0x24 } },
+        { { 0x23, 0xfa, 0x07, 0x54, 0xb7, 0xed, 0xe9, 0x15, 0xef, 0xa2, 0x74, 0x13, 0x0e, 0x21, 0x9f, 0xb0, 0x4d, 0x34, 0x4d, 0x1e, 0xf5, 0x8f, 0x40, 0x33, 0xa6, 0x1a, 0xd2, 0x99, 0x3b, 0x50, 0xd5, 0x17 },
+          { 0x22, 0x31, 0x0e, 0x8f, 0x68, 0x75, 0x29, 0xa2, 0xff, 0x9d, 0x56, 0x4b, 0x6d, 0x6e, 0x7d, 0xf4, 0xfa, 0x36, 0x2a, 0xd6, 0xb8, 0xea, 0x58, 0xe7, 0x4d, 0x0d, 0xad, 0xe8, 0x96, 0x42, 0xcf, 0x5a } },
+        { { 0x2d, 0xeb, 0x0d, 0x17, 0xc4, 0xb5, 0xd0, 0x93, 0x92, 0xca, 0xdc, 0x67, 0x23, 0x82, 0x61, 0xaf, 0xd5, 0xd6, 0x89, 0x48, 0xfc, 0x40, 0x0f, 0x01, 0x1c, 0xaf, 0xaa, 0x4c, 0x25, 0x7d, 0x49, 0xcf },
+          { 0x1a, 0x41, 0x21, 0x01, 0xf3, 0x97, 0xbb, 0x7e, 0x82, 0x7a, 0x2f, 0xdf, 0x25, 0x8d, 0x7f, 0xd3, 0xeb, 0x83, 0x36, 0x0d, 0x60, 0x25, 0x64, 0x76, 0x03, 0x78, 0xcc, 0xd9, 0xf2, 0xa1, 0xf2, 0xf9 } },
+        { { 0x04, 0x77, 0x7e, 0x53, 0x91, 0x1f, 0x00, 0x04, 0xb0, 0x12, 0x99, 0x39, 0xb5, 0xdf, 0x54, 0x5f, 0xe4, 0x6e, 0xee, 0xe3, 0xdb, 0x19, 0x84, 0xd0, 0x9d, 0x1b, 0xc3, 0x8f, 0xc0, 0x4d, 0x21, 0xae },
+          { 0x0e, 0x76, 0xd1, 0xcd, 0x93, 0xa6, 0xfc, 0x19, 0x8e, 0x41, 0xcd, 0x0c, 0xab, 0xc2, 0x00, 0xf1, 0x4b, 0xc6, 0xcb, 0x61, 0x97, 0xae, 0x6b, 0x0f, 0x14, 0x4b, 0x8a, 0xd4, 0x5f, 0x6b, 0xde, 0xec } }
+    },
+    {
+        { { 0x13, 0x2e, 0xd3, 0x10, 0xeb, 0xf0, 0x17, 0xe0, 0x67, 0x01, 0x38, 0xfd, 0x52, 0xb8, 0xe6, 0xd0, 0x38, 0xd1, 0x34, 0xb2, 0x93, 0xa7, 0x3a, 0xf4, 0xf8, 0x61, 0x23, 0xe9, 0x25, 0x62, 0xbf, 0x40 },
+          { 0x13, 0xda, 0x86, 0x1d, 0x8c, 0x7d, 0x54, 0xa9, 0x22, 0x3d, 0x7a, 0x22, 0x18, 0x8b, 0x5f, 0x4d, 0x79, 0x83, 0x5e, 0x17, 0xba, 0x1d, 0xa1, 0x55, 0xdd, 0x11, 0x9a, 0x63, 0x2a, 0x87, 0x88, 0x7c } },
+        { { 0x29, 0xb3, 0x35, 0x99, 0x00, 0x0f, 0x72, 0xdb, 0x7d, 0x5e, 0x13, 0xb1, 0x04, 0x1a, 0x72, 0x40, 0xfa, 0x45, 0x6a, 0x47, 0x07, 0x99, 0x1a, 0xad, 0x28, 0x73, 0xb0, 0xaf, 0x36, 0x74, 0xbc, 0x67 },
+          { 0x2b, 0xb3, 0x75, 0xc0, 0x45, 0xa1, 0x42, 0xa0, 0xf1, 0xb5, 0xb3, 0x96, 0x5e, 0xc7, 0xf5, 0x53, 0x8b, 0x12, 0x4a, 0x4f, 0xab, 0xd0, 0x07, 0x3b, 0xfd, 0x94, 0x74, 0xd2, 0x52, 0x80, 0x8e, 0x47 } },
+        { { 0x2b, 0x93, 0xda, 0xd7, 0xf7, 0x73, 0xa6, 0xb0, 0x84, 0xab, 0xd7, 0xe7, 0x05, 0x7e, 0x13, 0x50, 0x52, 0x58, 0xc5, 0x21, 0xbc, 0x2b, 0x36, 0x63, 0x04, 0x0a, 0xa0, 0x85, 0xe5, 0x02, 0x4f, 0x7a },
+          { 0x0a, 0x09, 0x78, 0x38, 0xde, 0x72, 0xe9, 0xcb, 0x9c, 0x80, 0x53, 0xc0, 0x68, 0x95, 0x43, 0x83, 0x66, 0x12, 0xcf, 0x31, 0xb0, 0xd1, 0x72, 0xff, 0x89, 0x7b, 0xe2, 0x12, 0x94, 0xec, 0x98, 0xa3 } },
+        { { 0x2e, 0xe0, 0x9a, 0x29, 0x19, 0x0f, 0xe9, 0x73, 0xc3, 0xe2, 0x1a, 0x3e, 0xd8, 0x83, 0x14, 0x5e, 0x5d, 0xe0, 0xc0, 0x44, 0xf3, 0x21, 0x81, 0x77, 0x3a, 0x87, 0x32, 0x55, 0xe6, 0x4d, 0x28, 0x3b },
+          { 0x10, 0x3a, 0x56, 0xf6, 0x35, 0xbb, 0x3d, 0x7c, 0x39, 0x6c, 0xdc, 0x96, 0x8d, 0x2a, 0xd9, 0x52, 0xe7, 0x1a, 0x70, 0xc2, 0xa5, 0x23, 0xb7, 0x51, 0xcb, 0xb7, 0x4e, 0xbb, 0x5c, 0xb8, 0xbd, 0x0e } },
+        { { 0x1b, 0x03, 0x58, 0x6b, 0x3b, 0xa8, 0xb7, 0x0d, 0x9a, 0x8b, 0x38, 0xdf, 0x21, 0xd6, 0x1d, 0x6f, 0x57, 0xda, 0xcb, 0xa2, 0xea, 0xd9, 0x1e, 0xb9, 0x81, 0x23, 0xf8, 0x02, 0x28, 0xdb, 0x6a, 0x1e },
+          { 0x34, 0xca, 0x56, 0x1c, 0x69, 0x0c, 0x49, 0xfb, 0x5b, 0xc0, 0x08, 0xf5, 0x18, 0x45, 0xb3, 0x52, 0xb5, 0x0f, 0x85, 0x69, 0x01, 0x08, 0x77, 0xab, 0xf3, 0xa7, 0x66, 0x3f, 0x2a, 0xc3, 0x79, 0x27 } },
+        { { 0x06, 0x42, 0x37, 0xd4, 0x95, 0x47, 0x6f, 0xcd, 0xba, 0x45, 0x75, 0x06, 0xfe, 0xb3, 0xe2, 0x13, 0x19, 0xdc, 0x9e, 0x1c, 0x69, 0x48, 0xea, 0xae, 0x91, 0xfc, 0x74, 0x70, 0x03, 0x1c, 0x55, 0x10 },
+          { 0x2d, 0xc6, 0x64, 0x97, 0xbb, 0x9f, 0xca, 0x2d, 0x18, 0xc5, 0x30, 0xe4, 0x8a, 0x13, 0xa3, 0xbc, 0x71, 0xf6, 0x9a, 0x34, 0xd2, 0x7a, 0xcd, 0xfc, 0x50, 0x4b, 0x63, 0x5c, 0x46, 0x56, 0xc0, 0x49 } },
+        { { 0x3b, 0x5c, 0xd5, 0x9a, 0x2b, 0x10, 0x91, 0x06, 0xbb, 0x1f, 0xfb, 0xc5, 0x9b, 0xa2, 0x2a, 0x43, 0xfd, 0x36, 0x6d, 0xb4, 0x05, 0xcf, 0xbd, 0x7f, 0x84, 0x56, 0x5f, 0xb9, 0xd3, 0xfd, 0x25, 0x49 },
+          { 0x0d, 0x97, 0x04, 0xee, 0xf5, 0x2a, 0x6d, 0xc0, 0xf4, 0x62, 0xd1, 0xd8, 0x89, 0x1d, 0x66, 0xa1, 0x66, 0x4a, 0xac, 0xf6, 0xe6, 0x61, 0xe3, 0x0f, 0x38, 0xaa, 0x7a, 0xee, 0xc0, 0xac, 0x88, 0xf8 } },
+        { { 0x29, 0xa9, 0x0b, 0x35, 0x6a, 0xc9, 0xa1, 0x54, 0xca, 0x85, 0xd2, 0xd8, 0xfc, 0x25, 0xfa, 0x02, 0x8b, 0x13, 0x22, 0x8d, 0x6c, 0x2a, 0xac, 0xa3, 0x32, 0x0b, 0xb2, 0xe8, 0xc2, 0xb1, 0x43, 0x9a },
+          { 0x01, 0x5c, 0xc3, 0x57, 0x6b, 0xdd, 0xd6, 0x0b, 0xfa, 0x65, 0x19, 0xeb, 0x73, 0x01, 0x3c, 0xe1, 0xda, 0xa5, 0x00, 0x74, 0xf2, 0xea, 0xbb, 0xf0, 0xf8, 0x54, 0x87, 0x12, 0x2a, 0x82, 0xd5, 0xd8 } }
+    },
+    {
+        { { 0x33, 0xc0, 0x65, 0x09, 0x95, 0x9c, 0xbf, 0xac, 0x37, 0xa4, 0xe1, 0x6d, 0x77, 0x58, 0xf3, 0x7b, 0x91, 0xa3, 0x98, 0xd5, 0x2c, 0xdf, 0x46, 0x37, 0xec, 0xef, 0x91, 0x16, 0x80, 0xe4, 0x4e, 0x55 },
+          { 0x1c, 0x97, 0xe9, 0xb9, 0x27, 0x22, 0xaa, 0x6a, 0x03, 0x32, 0xb0, 0x6f, 0x81, 0x2d, 0xff, 0xbc, 0x12, 0x98, 0x3b, 0x0e, 0x4e, 0x77, 0x9d, 0x05, 0x18, 0xc9, 0xcd, 0x94, 0x16, 0x9d, 0x81, 0x66 } },
+        { { 0x3d, 0x4f, 0x31, 0xb1, 0x74, 0xf0, 0x39, 0x7a, 0xe4, 0xef, 0x24, 0xf4, 0xfb, 0xe7, 0x8e, 0xe1, 0x73, 0x5c, 0x7a, 0x3f, 0x15, 0x9e, 0x56, 0x0a, 0xd1, 0xd4, 0xb2, 0x04, 0xee, 0xce, 0x92, 0xeb },
+          { 0x25, 0x0a, 0xbe, 0x61, 0x40, 0x11, 0xbe, 0x99, 0x4f, 0x41, 0x92, 0x7d, 0xb9, 0xd7, 0xbe, 0x0f, 0xfc, 0x1c, 0x13, 0x1e, 0x1c, 0xe8, 0x8a, 0x39, 0xf6, 0x16, 0x91, 0xcf, 0x6a, 0x01, 0x6f, 0x9b } },
+        { { 0x1e, 0x48, 0x49, 0x67, 0x4b, 0x8d, 0x33, 0x9a, 0x83, 0xd8, 0x80, 0x0d, 0x35, 0xf5, 0x76, 0x6a, 0xc5, 0xce, 0x22, 0x89, 0x6c, 0xd5, 0x6d, 0x2c, 0xf4, 0x92, 0xed, 0x52, 0x98, 0xa5, 0x9c, 0x56 },
+          { 0x3f, 0x58, 0x41, 0x21, 0xb2, 0xca, 0x27, 0xc6, 0x2a, 0xe8, 0xfb, 0x0a, 0x58, 0xb3, 0xca, 0x63, 0x08, 0xb4, 0xbb, 0xe0, 0xf9, 0x46, 0xce, 0xe9, 0x0b, 0x44, 0xd5, 0x65, 0xd6, 0xfb, 0x53, 0x6f } },
+        { { 0x10, 0xd7, 0x29, 0x40, 0xe8, 0xc1, 0x3a, 0xa2, 0x35, 0x06, 0x8b, 0x1a, 0xb5, 0xa9, 0x92, 0xba, 0x41, 0x1d, 0x85, 0x55, 0x0b, 0x3a, 0x09, 0x23, 0x93, 0x9d, 0xdd, 0x3f, 0xcc, 0x6f, 0xb1, 0x27 },
+          { 0x22, 0x0b, 0xd2, 0x04, 0xe7, 0x12, 0x7e, 0x75, 0xb1, 0xd7, 0xda, 0xcc, 0xad, 0xd1, 0xef, 0x9f, 0x9c, 0xae, 0x67, 0x87, 0xc5, 0x9e, 0x8b, 0xea, 0xf8, 0xdd, 0x6e, 0xe5, 0xb8, 0xab, 0x3c, 0xe6 } },
+        { { 0x03, 0x75, 0x18, 0x65, 0x27, 0xab, 0x2c, 0x3f, 0x6e, 0x09, 0x20, 0x24, 0xa4, 0xc9, 0xd8, 0x50, 0x32, 0x9a, 0xf0, 0xd7, 0x64, 0xad, 0x0c, 0x6b, 0xa3, 0xce, 0xbb, 0x4b, 0xd4, 0x4e, 0x82, 0x6d },
+          { 0x24, 0xcf, 0xac, 0x8a, 0x5c, 0x3b, 0x50, 0xc0, 0x3e, 0xa6, 0xd3, 0xbe, 0xca, 0x28, 0x99, 0xb9, 0xfa, 0x1b, 0x70, 0xaf, 0xbc, 0x09, 0x40, 0x46, 0xe5, 0x63, 0xfc, 0x27, 0x1b, 0x3a, 0xe0, 0x64 } },
+        { { 0x25, 0x0c, 0x12, 0xfc, 0x18, 0xef, 0x3b, 0x87, 0x9b, 0xd3, 0x16, 0x0d, 0xdb, 0xc4, 0x04, 0xbf, 0x14, 0xcf, 0x9a, 0xea, 0x7c, 0xf7, 0x36, 0x7d, 0x58, 0x6e, 0x46, 0x59, 0x27, 0xc3, 0x37, 0xbd },
+          { 0x11, 0x8e, 0xb5, 0xe7, 0xeb, 0xe1, 0x82, 0xaa, 0xaa, 0xa4, 0x11, 0x8f, 0x44, 0x6b, 0x15, 0xdb, 0x08, 0x56, 0xe9, 0x48, 0xeb, 0x47, 0x5c, 0xb9, 0xda, 0xcc, 0x62, 0x9a, 0x93, 0x79, 0x56, 0x6b } },
+        { { 0x32, 0x2f, 0x81, 0xb3, 0xac, 0xcf, 0x05, 0x32, 0x19, 0x6b, 0x0c, 0xea, 0x36, 0xa4, 0x34, 0x4c, 0x54, 0x15, 0x71, 0xa8, 0x4c, 0x32, 0xf9, 0x1a, 0x82, 0x16, 0xfd, 0x8b, 0x2a, 0x6e, 0xc8, 0x22 },
+          { 0x20, 0xb2, 0xfc, 0x22, 0x23, 0xb5, 0xf7, 0x8a, 0x43, 0x2e, 0x20, 0x36, 0x9a, 0xd4, 0x72, 0xa9, 0xdb, 0x5c, 0x49, 0xc9, 0x2f, 0x93, 0x13, 0x3c, 0x49, 0x8e, 0x3f, 0xd2, 0xe7, 0x9b, 0xbc, 0xdd } },
+        { { 0x02, 0x9a, 0xd2, 0x82, 0xf9, 0x24, 0x75, 0xbf, 0xc5, 0x94, 0x2c, 0x7f, 0x7e, 0xd8, 0xc0, 0xde, 0x57, 0xf0, 0x68, 0x55, 0x09, 0x9a, 0x13, 0xe1, 0x94, 0x98, 0x35, 0xb1, 0x67, 0xde, 0xce, 0x9c },
+          { 0x3c, 0x0b, 0x13, 0x76, 0x18, 0x2e, 0xbe, 0x73, 0x9a, 0x9f, 0x3b, 0x9b, 0xdb, 0x76, 0x05, 0xe6, 0xea, 0xdf, 0xc5, 0x7c, 0x18, 0x35, 0x5e, 0x48, 0x3d, 0x04, 0xa8, 0x55, 0x45, 0xc6, 0xb6, 0x7b } }
+    },
+    {
+        { { 0x19, 0xa4, 0x96, 0x96, 0xc0, 0x73, 0xed, 0xe1, 0x9e, 0xf9, 0x86, 0x3c, 0xc1, 0x4a, 0xc3, 0x58, 0x6c, 0xef, 0x51, 0xc8, 0xec, 0xa7, 0xf6, 0x21, 0xb8, 0x2c, 0x8f, 0xd8, 0x0c, 0x8d, 0xa9, 0x76 },
+          { 0x14, 0x30, 0x60, 0x50, 0x6e, 0xf7, 0x1c, 0x21, 0xd3, 0xd6, 0x37, 0xba, 0x48, 0x23, 0x17, 0x52, 0x3a, 0x12, 0xbe, 0xa4, 0xec, 0xc2, 0xf6, 0x48, 0x9b, 0x45, 0x0e, 0x7e, 0xbb, 0x0f, 0xc8, 0x6d } },
+        { { 0x39, 0x0e, 0x81, 0xa7, 0x76, 0x8d, 0x65, 0x92, 0x62, 0x16, 0x8f, 0xd2, 0x25, 0x8b, 0x0d, 0x0c, 0x3a, 0x85, 0x00, 0xfc, 0xf3, 0xac, 0x29, 0xf5, 0x8d, 0x7c, 0x9e, 0x99, 0x4c, 0x30, 0x46, 0x1c },
+          { 0x30, 0xdd, 0xd9, 0xca, 0xfc, 0x12, 0x64, 0x62, 0x55, 0x07, 0x81, 0x2a, 0xb7, 0x5a, 0xb6, 0xfa, 0x25, 0x8f, 0x40, 0x34, 0x9b, 0x10, 0xbb, 0x5d, 0x8a, 0x58, 0x2d, 0xa8, 0x11, 0xb8, 0x6a, 0xb8 } },
+        { { 0x09, 0x8d, 0x43, 0x5f, 0xb3, 0x59, 0x20, 0x8f, 0xe5, 0xb5, 0xf4, 0x88, 0x43, 0x78, 0xb6, 0xdd, 0x18, 0xb6, 0xb0, 0x1d, 0xeb, 0x1f, 0x6b, 0x9b, 0x98, 0xda, 0xad, 0x02, 0xad, 0x71, 0x91, 0x63 },
+          { 0x3f, 0x2c, 0xe4, 0x00, 0xa0, 0x86, 0x2c, 0xb8, 0x9d, 0xd1, 0x9b, 0x81, 0xfa, 0x64, 0x2c, 0x9b, 0xde, 0x63, 0x4f, 0x8c, 0xbf, 0x34, 0x5b, 0x97, 0xf9, 0x60, 0x69, 0x44, 0x06, 0x95, 0x99, 0x72 } },
+        { { 0x3f, 0xaa, 0x4b, 0x4e, 0x1f, 0x30, 0x55, 0x7c, 0xfc, 0x9e, 0xc4, 0x33, 0xd2, 0x5f, 0x83, 0xc2, 0x48, 0xe0, 0x60, 0x12, 0x76, 0x36, 0x70, 0x0b, 0x86, 0x40, 0x43, 0xb6, 0x00, 0xf8, 0x9b, 0xfa },
+          { 0x33, 0xc6, 0x71, 0x9a, 0x3f, 0x44, 0x2f, 0x24, 0xed, 0xed, 0xff, 0xe1, 0x44, 0xea, 0x08, 0x24, 0xc0, 0x09, 0x96, 0x8d, 0xa4, 0xfc, 0xa9, 0x4d, 0x59, 0x7c, 0x92, 0x4c, 0x99, 0xb1, 0xc0, 0x4e } },
+        { { 0x1c, 0x51, 0xd1, 0xfb, 0xfb, 0xe5, 0xec, 0x1f, 0xc6, 0x99, 0x9a, 0xff, 0xa2, 0x21, 0x2c, 0x59, 0xfa, 0x7e, 0x67, 0xf0, 0xe3, 0x6d, 0xff, 0x63, 0x51, 0xfb, 0x1f, 0x9f, 0x33, 0x8b, 0x76, 0xfd },
+          { 0x21, 0xa9, 0x66, 0x74, 0x0a, 0x8a, 0x43, 0xec, 0xf6, 0x32, 0xf8, 0x59, 0x62, 0xbd, 0x39, 0x0e, 0x70, 0xc1, 0xcc, 0x7e, 0xcf, 0x79, 0x2c, 0xbe, 0x0e, 0x9e, 0xbc, 0x16, 0xa2, 0xaf, 0xe8, 0xe1 } },
+        { { 0x2b, 0x1f, 0x22, 0x07, 0x07, 0x39, 0x4d, 0x85, 0xf2, 0x8f, 0xdb, 0x0f, 0x53, 0x65, 0xfa, 0xe6, 0xe0, 0x88, 0x10, 0x0c, 0x96, 0xac, 0xfa, 0x84, 0x23, 0x9c, 0x4d, 0x3d, 0x81, 0x8a, 0x47, 0xc6 },
+          { 0x1c, 0x9a, 0x0e, 0xee, 0xcf, 0x7c, 0x6d, 0x3a, 0x49, 0x94, 0x00, 0x88, 0xa1, 0xe3, 0x94, 0x53, 0xb6, 0xfd, 0x07, 0x4f, 0x5c, 0x89, 0x9a, 0x88, 0x18, 0xfa, 0x2f, 0x97, 0xaa, 0xf0, 0xe2, 0x45 } },
+        { { 0x35, 0x46, 0xb4, 0x15, 0x8a, 0x5b, 0x44, 0xd1, 0x32, 0x69, 0x33, 0xc8, 0x87, 0xac, 0xae, 0x1e, 0x12, 0x09, 0xf3, 0x23, 0x60, 0xce, 0x19, 0x00, 0x36, 0x42, 0x39, 0x0d, 0x71, 0xdb, 0x81, 0x2e },
+          { 0x35, 0x27, 0xb6, 0x34, 0x75, 0x13, 0x20, 0x58, 0xf1, 0x5e, 0x7d, 0xfc, 0x92, 0x5d, 0xf4, 0x10, 0x39, 0xb6, 0x13, 0x85, 0x86, 0x26, 0x50, 0xd3, 0x06, 0xcf, 0xb9, 0xf4, 0x6b, 0x5c, 0xdd, 0x53 } },
+        { { 0x18, 0x7f, 0xa9, 0x7a, 0xe9, 0xe5, 0x76, 0x33, 0xd8, 0x1c, 0x77, 0xd7, 0x9c, 0x6d, 0xae, 0x1d, 0x33, 0xaa, 0x92, 0x58, 0xad, 0x2c, 0x59, 0xae, 0x32, 0x45, 0xde, 0x83, 0x7d, 0x4c, 0x6e, 0xf2 },
+          { 0x38, 0x68, 0x57, 0x85, 0x0a, 0xbf, 0x21, 0x25, 0xb3, 0xf0, 0x50, 0x53, 0x4d, 0x08, 0x58, 0xca, 0x33, 0xe5, 0xb0, 0x9c, 0xce, 0xa8, 0x01, 0xe1, 0x70, 0xe6, 0x2e, 0xaa, 0xe5, 0xc0, 0xdc, 0xf9 } }
+    },
+    {
+        { { 0x3d, 0x59, 0x66, 0xa3, 0xe4, 0x85, 0xf9, 0x52, 0xce, 0xe0, 0xc5, 0x58, 0x42, 0x46, 0xb0, 0x54, 0x4d, 0xd0, 0x00, 0x0d, 0xf9, 0x5f, 0xa3, 0x1c, 0x0c, 0x92, 0x01, 0x4c, 0xa2, 0x12, 0xc4, 0x1f },
+          { 0x30, 0x4c, 0xbd, 0x08, 0x41, 0x2c, 0xe7, 0x83, 0xde, 0xfa, 0x5c, 0xeb, 0x63, 0x9d, 0xfc, 0xc8, 0x32, 0xd2, 0x52, 0x4e, 0xda, 0x27, 0x99, 0xad, 0x6c, 0x88, 0x1a, 0x66, 0xe9, 0x0e, 0xd9, 0x33 } },
+        { { 0x22, 0xe0, 0x6b, 0xe9, 0x8e, 0x9c, 0xe7, 0x5d, 0xcf, 0x29, 0xa0, 0xe2, 0xe5, 0x79, 0x84, 0x8c, 0x93, 0x93, 0x4f, 0x2d, 0x10, 0xa6, 0xf0, 0xdd, 0x53, 0x0c, 0x2d, 0x2e, 0x11, 0x44, 0x90, 0x3f },
+          { 0x0b, 0x00, 0x64, 0x8c, 0x22, 0x8e, 0xbc, 0x7f, 0x0e, 0x32, 0x7a, 0x5a, 0xc3, 0x24, 0x36, 0x8c, 0x70, 0x1f, 0xf1, 0xf6, 0x1b, 0x01, 0x48, 0xe2, 0x32, 0xf6, 0x9e, 0x27, 0xe9, 0x8c, 0xb1, 0xe0 } },
+        { { 0x34, 0x02, 0xa9, 0xad, 0x72, 0x81, 0x6b, 0x43, 0x0c, 0x37, 0x5b, 0x14, 0x6e, 0x8e, 0xb6, 0x4d, 0x32, 0x52, 0x80, 0xda, 0x76, 0xbb, 0x19, 0xbd, 0x24, 0x00, 0xfb, 0xca, 0x7f, 0x2f, 0x6a, 0xe2 },
+          { 0x17, 0xbd, 0x91, 0x40, 0x23, 0xfe, 0x35, 0x84, 0x88, 0x82, 0xa5, 0x06, 0x93, 0xa3, 0xa3, 0x09, 0xdf, 0x56, 0x20, 0x86, 0xd4, 0x7f, 0x39, 0xf5, 0x7d, 0x99, 0xa5, 0x79, 0x2d, 0x8b, 0x3c, 0x1b } },
+        { { 0x2b, 0x2f, 0x8b, 0xde, 0x40, 0x41, 0x87, 0x66, 0x26, 0xae, 0x79, 0x2a, 0x47, 0x48, 0xba, 0x18, 0x6d, 0x13, 0x72, 0x6f, 0x99, 0xb9, 0xa6, 0x8d, 0x3a, 0x03, 0xfe, 0x40, 0xf0, 0xe9, 0x82, 0xb0 },
+          { 0x1c, 0x07, 0xcb, 0x20, 0x2a, 0x9a, 0xb6, 0x33, 0x7b, 0xf8, 0x11, 0x1d, 0x38, 0x71, 0xa4, 0x15, 0xb4, 0x59, 0xf6, 0x4c, 0x89, 0x16, 0x3d, 0x58, 0xe6, 0xfc, 0xad, 0xac, 0xa6, 0x83, 0x42, 0x79 } },
+        { { 0x30, 0x29, 0x2a, 0x40, 0xf1, 0x05, 0x89, 0xe2, 0xd4, 0x64, 0xd5, 0xb6, 0xc4, 0x48, 0xbc, 0x7b, 0xfe, 0x07, 0x8d, 0x61, 0xfc, 0x27, 0xa1, 0xef, 0x77, 0x75, 0x85, 0x46, 0xd1, 0x7c, 0x35, 0xc3 },
+          { 0x21, 0xaf, 0xe1, 0x8d, 0x6c, 0x42, 0xf0, 0xbb, 0x3d, 0xb7, 0xa7, 0xd0, 0xfc, 0x49, 0x0b, 0x0e, 0x1d, 0x02, 0xa2, 0xb0, 0x67, 0x39, 0x75, 0x29, 0x2c, 0xc1, 0x75, 0xe5, 0x80, 0xcf, 0xc4, 0xcd } },
+        { { 0x30, 0x79, 0xd1, 0x39, 0x61, 0x4a, 0x43, 0x23, 0x05, 0x2e, 0xb7, 0x38, 0x85, 0x20, 0x44, 0x8d, 0x21, 0x3c, 0x25, 0x8e, 0x0b, 0xef, 0x73, 0x5c, 0x40, 0xbe, 0xba, 0xc1, 0x03, 0x46, 0xeb, 0xa4 },
+          { 0x0d, 0xfc, 0x1f, 0x5a, 0xb2, 0x30, 0xed, 0x01, 0x26, 0x51, 0xd6, 0xf0, 0xac, 0x63, 0xa2, 0x30, 0x15, 0x91, 0xfe, 0xd9, 0x97, 0x85, 0x04, 0x02, 0x56, 0xd5, 0x35, 0x31, 0xf7, 0x83, 0xce, 0x7a } },
+        { { 0x20, 0x23, 0x07, 0x1e, 0xfd, 0x69, 0x2c, 0x7d, 0x1e, 0xc0, 0x06, 0xe8, 0x01, 0x46, 0x05, 0xf9, 0x15, 0x17, 0x0f, 0xf3, 0xcd, 0x9a, 0xb0, 0x28, 0xbe, 0x8d, 0x2c, 0x74, 0xf6, 0xf4, 0x05, 0x7d },
+          { 0x01, 0x34, 0x94, 0xd9, 0x23, 0x7b, 0x8f, 0x62, 0x89, 0x78, 0xfc, 0xc5, 0xaf, 0x52, 0xae, 0x3c, 0x98, 0x2f, 0x07, 0xf5, 0x4e, 0x6d, 0xb1, 0x23, 0x62, 0x22, 0xf7, 0x11, 0x31, 0xdf, 0x57, 0x9f } },
+        { { 0x3c, 0x5e, 0xb5, 0x00, 0x41, 0x0a, 0xc0, 0xde, 0xb5, 0x2d, 0x8d, 0x65, 0x6a, 0xc8, 0x24, 0x3e, 0xa9, 0x5e, 0x5f, 0x82, 0x35, 0x2b, 0x1d, 0x8a, 0x6c, 0xe4, 0xf6, 0x35, 0x24, 0x53, 0xf9, 0xb1 },
+          { 0x1e, 0xd5, 0xf3, 0xdf, 0x02, 0xef, 0x8c, 0x87, 0x4c, 0x09, 0xe1, 0xdd, 0x6b, 0x34, 0x42, 0x7e, 0x9b, 0x39, 0xc9, 0x8b, 0xc3, 0xde, 0x01, 0x7a, 0x9c, 0xe7, 0x68, 0xf0, 0xa6, 0x79, 0x8d, 0xb8 } }
+    },
+    {
+        { { 0x33, 0xea, 0x8f, 0x5e, 0x94, 0x8d, 0x14, 0x21, 0xaf, 0x38, 0xe3, 0x4f, 0x90, 0xb3, 0xba, 0x54, 0xc4, 0xcf, 0xe6, 0xb9, 0xc2, 0xec, 0x8f, 0xba, 0xf9, 0x75, 0x5b, 0x20, 0xc7, 0x2a, 0x56, 0x7b },
+          { 0x0d, 0xa9, 0x01, 0x47, 0xb8, 0x5e, 0x67, 0x87, 0x76, 0x53, 0x9b, 0x2b, 0x17, 0x74, 0xcb, 0x4e, 0x91, 0x05, 0x77, 0x3c, 0x0e, 0xd6, 0xbb, 0x8a, 0xb2, 0x2c, 0xee, 0x44, 0x8c, 0x80, 0xb5, 0xf2 } },
+        { { 0x1b, 0x62, 0xc4, 0x01, 0xc1, 0x98, 0x3e, 0xb4, 0x4f, 0x0c, 0xd0, 0xd7, 0x99, 0xdf, 0x9a, 0xf8, 0xd3, 0x79, 0x10, 0x76, 0x15, 0x04, 0xd8, 0x75, 0x78, 0xb0, 0x5c, 0x4e, 0xaa, 0x00, 0x91, 0xca },
+          { 0x2e, 0xd5, 0x60, 0xa8, 0x4d, 0x6e, 0x6e, 0x32, 0x68, 0xa6, 0x4c, 0xc2, 0xdb, 0x70, 0x4c, 0xfe, 0x0f, 0x03, 0xc3, 0x82, 0xaa, 0xf4, 0x78, 0xe9, 0xcf, 0x02, 0x45, 0xd8, 0xdb, 0x0c, 0x4f, 0x06 } },
+        { { 0x17, 0xac, 0xa3, 0x33, 0x43, 0xb9, 0x47, 0xd6, 0x30, 0x39, 0x04, 0xcf, 0xb0, 0x5d, 0x05, 0x46, 0x86, 0xbc, 0xde, 0xd0, 0xfa, 0x40, 0xaf, 0xc9, 0x85, 0x56, 0x12, 0xc6, 0x9d, 0xa9, 0x90, 0x78 },
+          { 0x23, 0xd5, 0xb5, 0x35, 0xc0, 0x32, 0x6a, 0xd5, 0xaf, 0xb7, 0x90, 0x86, 0x63, 0x0a, 0x6a, 0xfe, 0x19, 0xd3, 0x1f, 0x00, 0xdc, 0xec, 0x0f, 0xb9, 0x7c, 0x87, 0xbe, 0x02, 0x61, 0x9c, 0x12, 0x82 } },
+        { { 0x15, 0xea, 0xe1, 0x87, 0x3f, 0x89, 0x4d, 0xf9, 0x60, 0xcb, 0x9e, 0xfb, 0xf7, 0xce, 0x3e, 0x15, 0x98, 0xcd, 0x56, 0xbd, 0xcb, 0x9e, 0x75, 0xce, 0x1c, 0x0e, 0x52, 0xb7, 0x72, 0x4c, 0xfd, 0xb2 },
+          { 0x28, 0x5a, 0xac, 0x54, 0x42, 0x7d, 0x01, 0x06, 0x03, 0xf4, 0x90, 0x09, 0xc7, 0x9a, 0x3d, 0xa1, 0x75, 0xc5, 0x1d, 0x1a, 0x58, 0xd2, 0x12, 0x0b, 0xe9, 0xd6, 0xb7, 0xa0, 0x32, 0x57, 0x13, 0x0d } },
+        { { 0x0d, 0x3b, 0x46, 0x68, 0xef, 0xdf, 0xc8, 0x91, 0xa0, 0x91, 0x03, 0xa2, 0x63, 0x36, 0x35, 0x83, 0xc6, 0x51, 0x28, 0xc3, 0xf6, 0xbe, 0xa9, 0x17, 0xcb, 0x5d, 0x5a, 0x21, 0x32, 0x1c, 0x89, 0x07 },
+          { 0x21, 0x5f, 0x98, 0x26, 0xd9, 0x27, 0xff, 0x93, 0xec, 0xc7, 0x47, 0x0e, 0x7b, 0x3c, 0x21, 0x56, 0x9f, 0x71, 0xf8, 0xb9, 0xdb, 0xbf, 0x1d, 0xc5, 0xf6, 0x49, 0x85, 0x79, 0x59, 0x4e, 0xd2, 0x7f } },
+        { { 0x1d, 0x5a, 0x11, 0x24, 0x47, 0x97, 0x11, 0x9d, 0x8f, 0x21, 0x58, 0x79, 0x49, 0x1d, 0x6e, 0x67, 0x67, 0x03, 0x32, 0x32, 0xfe, 0x19, 0x33, 0x53, 0xc5, 0x7c, 0xb4, 0xe8, 0x1c, 0xc5, 0x97, 0x8e },
+          { 0x33, 0x62, 0xe9, 0xcf, 0x97, 0xfc, 0x27, 0x0f, 0x7f, 0x40, 0x29, 0x4a, 0x46, 0x66, 0xd5, 0xb4, 0x12, 0x52, 0x9a, 0x5c, 0xa0, 0x1e, 0xf7, 0xfe, 0xb7, 0xe6, 0x26, 0x83, 0x2b, 0x99, 0x2b, 0x33 } },
+        { { 0x20, 0x30, 0x74, 0xa1, 0xf9, 0xf8, 0x18, 0xe2, 0x34, 0xe9, 0x3f, 0x7f, 0x92, 0x10, 0x11, 0x03, 0xe4, 0xbb, 0x6a, 0x8b, 0x3e, 0x56, 0x9d, 0x10, 0xc2, 0x1e, 0x90, 0x58, 0x59, 0xb0, 0x19, 0x12 },
+          { 0x0f, 0xfe, 0x9e, 0xc8, 0x61, 0x07, 0x99, 0xf6, 0x0e, 0x76, 0xee, 0x63, 0x1f, 0xf8, 0x52, 0x46, 0x28, 0x07, 0xc9, 0x08, 0x91, 0xed, 0xa5, 0x22, 0xdc, 0x17, 0x24, 0xb7, 0x7d, 0x41, 0xe9, 0xfd } },
+        { { 0x0b, 0x02, 0xd3, 0x1b, 0xbb, 0x07, 0xe5, 0x29, 0xcb, 0xbd, 0xce, 0xd2, 0x22, 0x03, 0xc6, 0x32, 0xf9, 0xf1, 0xb7, 0xd6, 0x3e, 0xe2, 0x45, 0xa2, 0x88, 0x9f, 0xc3, 0xdc, 0xb7, 0xaf, 0xc5, 0xab },
+          { 0x3e, 0x84, 0x21, 0x7d, 0x71, 0xe7, 0xa9, 0x8a, 0x08, 0xef, 0x60, 0x4f, 0xa2, 0xac, 0x5a, 0x7c, 0x28, 0x19, 0x28, 0x2b, 0x5f, 0x05, 0x5d, 0x74, 0x15, 0x3c, 0x77, 0x98, 0x42, 0x25, 0x60, 0xee } }
+    },
+    {
+        { { 0x10, 0xe8, 0xa7, 0x32, 0xf2, 0x72, 0x6d, 0x76, 0xb2, 0xf8, 0xcc, 0x8b, 0xcc, 0xa2, 0xe8, 0x01, 0x2e, 0x56, 0x57, 0x6e, 0x46, 0x18, 0x0c, 0xf1, 0x61, 0xf5, 0xf6, 0x9d, 0x43, 0x22, 0xa2, 0x26 },
+          { 0x09, 0xee, 0xb4, 0xdf, 0x29, 0xee, 0x43, 0xad, 0xf4, 0xe4, 0x5c, 0xac, 0x3f, 0x6d, 0x6d, 0x4a, 0x2d, 0x10, 0x88, 0xe2, 0x09, 0x72, 0xd8, 0xbc, 0xf0, 0x92, 0x95, 0xc7, 0x6a, 0x70, 0x0e, 0x8f } },
+        { { 0x3e, 0x30, 0x97, 0x97, 0xb9, 0x37, 0xa1, 0xe4, 0x0d, 0x67, 0x83, 0xe3, 0x66, 0xeb, 0x1d, 0x0d, 0x77, 0x81, 0xb0, 0x1b, 0x16, 0x15, 0xe9, 0xda, 0x8b, 0xef, 0x94, 0x51, 0x97, 0x7a, 0x93, 0x62 },
+          { 0x1c, 0x37, 0x8d, 0x2a, 0xc1, 0xe5, 0xe1, 0x42, 0x52, 0x00, 0x3a, 0xdc, 0x79, 0xe3, 0x37, 0x4c, 0x32, 0x3d, 0x8f, 0x14, 0xc3, 0x23, 0xdc, 0xb6, 0x14, 0x4d, 0x41, 0x7d, 0x15, 0x8f, 0x10, 0xf6 } },
+        { { 0x12, 0xf4, 0xf4, 0x7d, 0x77, 0xe3, 0x96, 0x35, 0x4c, 0x6a, 0x02, 0x7d, 0x7e, 0x0e, 0xb0, 0xca, 0x8a, 0xaf, 0x77, 0x35, 0xc7, 0x28, 0x7d, 0xce, 0xeb, 0xb0, 0x74, 0x24, 0x80, 0x98, 0xec, 0xcc },
+          { 0x18, 0x1e, 0xcc, 0x44, 0x9e, 0x32, 0xab, 0xd5, 0xf2, 0x64, 0x23, 0x92, 0x5e, 0x41, 0x20, 0xc2, 0x83, 0x6b, 0x32, 0x37, 0x01, 0xf2, 0x4d, 0xdf, 0x7c, 0x22, 0xed, 0x64, 0xd8, 0x86, 0xd0, 0xed } },
+        { { 0x3d, 0x70, 0x31, 0x67, 0xb0, 0x89, 0x84, 0x99, 0x4b, 0x1b, 0x99, 0x70, 0xbb, 0xe0, 0xbe, 0x87, 0xd8, 0x46, 0x74, 0xd8, 0x5f, 0x29, 0x26, 0xf4, 0xd6, 0xb7, 0xc3, 0x1a, 0xc2, 0x36, 0x0e, 0x26 },
+          { 0x1e, 0xc0, 0xe4, 0x1d, 0x64, 0x41, 0xdd, 0x5f, 0x6f, 0x0b, 0x7b, 0xbf, 0x6e, 0x32, 0x2f, 0xe0, 0xb5, 0x6e, 0x05, 0x79, 0xf3, 0xa6, 0x08, 0xdc, 0xb6, 0x9f, 0x05, 0xa1, 0x63, 0x84, 0x92, 0x1c } },
+        { { 0x38, 0xd2, 0xbf, 0xa9, 0x65, 0x4a, 0xf3, 0xc4, 0x13, 0x44, 0xe2, 0xf7, 0xb8, 0x41, 0x9e, 0x4f, 0x6b, 0x0d, 0xd8, 0xfb, 0x16, 0x4e, 0x5e, 0x9e, 0xdc, 0xed, 0x99, 0xcf, 0xa7, 0xa6, 0xa7, 0xc8 },
+          { 0x18, 0x57, 0xa5, 0x3d, 0xc5, 0x40, 0x81, 0x22, 0x74, 0xd9, 0xfd, 0x40, 0x81, 0x93, 0x80, 0x82, 0x95, 0x15, 0x3a, 0x6f, 0x35, 0x90, 0x29, 0xbf, 0x38, 0x5e, 0x7a, 0xa8, 0xa4, 0x26, 0x76, 0x73 } },
+        { { 0x28, 0xae, 0x5d, 0xc8, 0x4f, 0x40, 0x1d, 0x53, 0x95, 0x67, 0x1b, 0xe0, 0x4a, 0x9a, 0xc5, 0xcd, 0x38, 0x13, 0xa4, 0x50, 0xe1, 0xce, 0x37, 0x3d, 0xcd, 0x14, 0x28, 0xba, 0x64, 0x21, 0xcf, 0x71 },
+          { 0x36, 0x70, 0x89, 0xae, 0x5b, 0xf6, 0xc1, 0x35, 0xe3, 0xdc, 0xac, 0x27, 0x21, 0x91, 0xa8, 0x09, 0xa3, 0x2d, 0x6e, 0x2c, 0x6b, 0x44, 0x59, 0x7f, 0x44, 0xcb, 0x97, 0x1a, 0x19, 0xe5, 0x0d, 0x4f } },
+        { { 0x3c, 0x41, 0x03, 0xea, 0x0b, 0x4b, 0x43, 0xa3, 0x30, 0x64, 0x28, 0xb4, 0xc9, 0xf2, 0xc9, 0x9c, 0xb6, 0x5f, 0x14, 0x06, 0x50, 0xfa, 0xae, 0xcb, 0xaa, 0x9f, 0x80, 0x95, 0x8c, 0xf8, 0x29, 0xa7 },
+          { 0x0f, 0xa0, 0x78, 0x35, 0xb8, 0xe8, 0x05, 0x0f, 0x37, 0x35, 0x0a, 0xd8, 0xf0, 0xa9, 0xa3, 0xcf, 0x67, 0x50, 0x55, 0x25, 0x19, 0xc8, 0x7d, 0x9b, 0x18, 0x07, 0x34, 0xc9, 0xe9, 0xe1, 0x4e, 0x52 } },
+        { { 0x3d, 0x56, 0x26, 0x6d, 0x4c, 0xc0, 0x53, 0xb0, 0x57, 0x68, 0xcd, 0xe4, 0x4c, 0xff, 0x30, 0x6d, 0xf4, 0xd2, 0xe3, 0x09, 0xa0, 0x40, 0xaa, 0x57, 0x76, 0x76, 0xef, 0x2c, 0x52, 0xce, 0x17, 0x2a },
+          { 0x37, 0xf1, 0xb3, 0x78, 0x2b, 0x47, 0x1e, 0xc6, 0x45, 0x93, 0x3a, 0xb3, 0x9f, 0x24, 0xac, 0x67, 0xb5, 0x31, 0xe6, 0x4b, 0x83, 0x28, 0x0c, 0x59, 0x8b, 0x01, 0x6d, 0x80, 0x74, 0x2f, 0x6d, 0xd2 } }
+    },
+    {
+        { { 0x0c, 0xec, 0xd9, 0xa1, 0xb5, 0xc0, 0xb8, 0x0e, 0x09, 0xb9, 0xed, 0xae, 0x50, 0x63, 0x39, 0x7f, 0x62, 0xc7, 0x02, 0x69, 0xb6, 0xe6, 0x17, 0x70, 0x48, 0x34, 0xb6, 0xc4, 0xa0, 0x57, 0xb9, 0x02 },
+          { 0x18, 0xed, 0x69, 0x8b, 0x27, 0xa9, 0x5b, 0xbe, 0x18, 0x0d, 0xea, 0xee, 0x43, 0x96, 0x10, 0xd8, 0x7c, 0x77, 0xf1, 0x42, 0xa4, 0x18, 0x55, 0xda, 0x10, 0xa2, 0xc6, 0x58, 0xe5, 0xc5, 0x2c, 0x13 } },
+        { { 0x2c, 0x1e, 0x6d, 0xa8, 0x27, 0x04, 0x2e, 0xc4, 0x6a, 0x62, 0xd1, 0x14, 0x49, 0x7d, 0xae, 0x78, 0xfe, 0xdd, 0xbc, 0x26, 0x23, 0x73, 0x61, 0x62, 0xca, 0x83, 0x53, 0x8f, 0x32, 0x64, 0x0b, 0xf3 },
+          { 0x1d, 0xec, 0xa1, 0x17, 0x89, 0x3b, 0x97, 0xf1, 0x5e, 0x81, 0xf9, 0x88, 0x06, 0x40, 0xca, 0xc7, 0x96, 0x34, 0x94, 0xd3, 0xa0, 0x21, 0x21, 0x55, 0x34, 0xfb, 0x96, 0xb1, 0x7f, 0x40, 0x1e, 0x06 } },
+        { { 0x1b, 0x99, 0x20, 0xde, 0xf9, 0xc7, 0xa8, 0x13, 0x7a, 0xaa, 0x77, 0x1e, 0xa5, 0x3b, 0xc9, 0x1b, 0xec, 0x54, 0xf4, 0x87, 0xc7, 0x69, 0x02, 0x05, 0x97, 0x04, 0x76, 0xd4, 0xdb, 0x79, 0x76, 0xdc },
+          { 0x35, 0x97, 0xfa, 0x94, 0x09, 0x49, 0xd0, 0xa1, 0x9a, 0xe3, 0xe0, 0xf7, 0xf1, 0x0b, 0x7f, 0x59, 0xdc, 0xbd, 0x90, 0x66, 0xbe, 0xf3, 0x35, 0xb1, 0x59, 0xd5, 0xdf, 0xd5, 0x6d, 0xdc, 0x18, 0x28 } },
+        { { 0x35, 0xc2, 0x14, 0x98, 0x6b, 0x74, 0xc2, 0x27, 0x84, 0x6b, 0xde, 0x24, 0x6e, 0x07, 0xc5, 0x98, 0x63, 0xf2, 0xa1, 0xfd, 0x6e, 0xcb, 0x06, 0xfe, 0xbb, 0x3e, 0x36, 0x11, 0xa8, 0xd5, 0x3d, 0x1a },
+          { 0x1c, 0xeb, 0x9d, 0xa6, 0x99, 0x09, 0x0b, 0xc2, 0x19, 0x73, 0xe8, 0x32, 0xfb, 0xdc, 0xb8, 0x75, 0x09, 0xe5, 0x4c, 0x34, 0xe8, 0xf1, 0x17, 0x54, 0xe5, 0x3c, 0xd9, 0x43, 0x48, 0xfa, 0x46, 0x79 } },
+        { { 0x38, 0xda, 0x1d, 0xad, 0x05, 0x09, 0x5a, 0xef, 0x14, 0x0d, 0xff, 0xba, 0x79, 0x2b, 0xca, 0xc5, 0x90, 0xa5, 0xbd, 0x55, 0xa4, 0xf0, 0xe7, 0xa0, 0x96, 0xaf, 0x88, 0xae, 0xae, 0x5e, 0x46, 0xed },
+          { 0x23, 0x15, 0x06, 0xa8, 0x62, 0x0e, 0x65, 0x00, 0xeb, 0x36, 0x7d, 0x57, 0x74, 0x07, 0x06, 0xfc, 0xb7, 0xc4, 0x23, 0xef, 0x2f, 0x2e, 0xbd, 0x61, 0x6a, 0xae, 0xfb, 0xef, 0xb5, 0xac, 0x56, 0x57 } },
+        { { 0x2f, 0x90, 0x85, 0xae, 0x22, 0xc8, 0x4e, 0x7d, 0xaa, 0xa8, 0x50, 0xdf, 0xb9, 0x08, 0xe6, 0xf4, 0x30, 0x81, 0x8d, 0x48, 0x73, 0x0f, 0x55, 0x13, 0xbb, 0x33, 0xbe, 0xd3, 0x59, 0x36, 0x28, 0x3e },
+          { 0x2b, 0x61, 0xd8, 0xa5, 0x28, 0x0b, 0xb0, 0xbd, 0xd4, 0xd8, 0x6d, 0x77, 0x3d, 0x66, 0xc5, 0xb8, 0x6b, 0x0d, 0x80, 0x68, 0x4f, 0x08, 0x9a, 0xd3, 0xb9, 0xa3, 0x62, 0x44, 0x7b, 0x10, 0x6b, 0xfa } },
+        { { 0x0c, 0x91, 0xdf, 0xcb, 0x6d, 0xd6, 0x78, 0x08, 0xe3, 0x22, 0xb0, 0x8e, 0x82, 0x04, 0x74, 0xb9, 0x4d, 0x44, 0x4a, 0x60, 0xc7, 0x15, 0x3c, 0x5d, 0x3a, 0x1a, 0x16, 0x69, 0x19, 0xe4, 0x08, 0xd3 },
+          { 0x19, 0xf6, 0x5d, 0xa9, 0x27, 0x6d, 0x6e, 0x1d, 0xf3, 0xf7, 0x95, 0x05, 0xcb, 0x4e, 0xc0, 0x06, 0xf2, 0x4d, 0x55, 0xc9, 0xcd, 0x38, 0x76, 0x4f, 0x93, 0x3b, 0xbd, 0x52, 0x56, 0x0c, 0x8c, 0x6b } },
+        { { 0x37, 0x58, 0xa2, 0xe8, 0xc3, 0x54, 0xd0, 0x17, 0x9b, 0xd3, 0x96, 0x51, 0x80, 0x7d, 0x82, 0x45, 0xd6, 0x81, 0xad, 0x02, 0x3e, 0xde, 0x1c, 0xf3, 0xd2, 0xba, 0x65, 0xe7, 0x9b, 0xfb, 0x5d, 0x3f },
+          { 0x04, 0x09, 0x94, 0x87, 0xc2, 0xaa, 0xb1, 0x08, 0xeb, 0x8b, 0xc7, 0xb5, 0xd5, 0xe9, 0x8f, 0x7f, 0x1e, 0x9a, 0x2a, 0x14, 0xd2, 0x8d, 0xe1, 0xa0, 0xd3, 0xbb, 0xc7, 0xc5, 0x84, 0x5c, 0x70, 0xd8 } }
+    },
+    {
+        { { 0x03, 0x6f, 0x51, 0xea, 0x5c, 0x28, 0xcc, 0xec, 0x5c, 0x07, 0x84, 0x6e, 0xc7, 0x63, 0x89, 0x1d, 0x89, 0x1b, 0xf8, 0xb1, 0x75, 0x0a, 0xef, 0x38, 0x3e, 0x66, 0xc5, 0x69, 0xc8, 0x73, 0xc1, 0xf5 },
+          { 0x38, 0xee, 0x34, 0x1d, 0x4a, 0xcf, 0xed, 0xd5, 0x78, 0xf9, 0x93, 0xf5, 0x4a, 0x3f, 0x80, 0xf9, 0xba, 0x48, 0xf8, 0x9c, 0x0f, 0xd1, 0x40, 0x1b, 0xe8, 0x85, 0xd1, 0x4d, 0xab, 0xf6, 0x15, 0x53 } },
+        { { 0x3e, 0x87, 0x18, 0xf8, 0x5f, 0xee, 0xa9, 0xbe, 0x16, 0x81, 0x07, 0x0d, 0xd7, 0xed, 0xcb, 0x44, 0xb0, 0x84, 0xfd, 0xc0, 0x6e, 0x51, 0x9e, 0xa7, 0x3c, 0x1b, 0x0a, 0xf1, 0x87, 0x89, 0xeb, 0x6f },
+          { 0x24, 0x92, 0xb9, 0xd5, 0x7b, 0x2e, 0x61, 0x78, 0x71, 0x7a, 0xba, 0xc9, 0x55, 0xb0, 0x42, 0xe0, 0x0f, 0x2b, 0xe5, 0xe3, 0x8a, 0x1b, 0x2e, 0x65, 0x2c, 0x77, 0x38, 0xb3, 0x54, 0xc8, 0x94, 0x6f } },
+        { { 0x1b, 0x30, 0x39, 0xa6, 0x81, 0xe1, 0x54, 0xae, 0x6b, 0x37, 0x27, 0xbe, 0xe3, 0x7b, 0xad, 0xc4, 0x0e, 0xd3, 0x24, 0x2f, 0x68, 0x84, 0xb5, 0x44, 0x96, 0xe6, 0xed, 0x1d, 0xd6, 0x27, 0xc4, 0xcd },
+          { 0x32, 0x55, 0x72, 0x9a, 0x7f, 0x6e, 0xec, 0x02, 0x3a, 0xdd, 0x2b, 0x5a, 0x53, 0xf3, 0x5d, 0x13, 0x0e, 0xed, 0xb3, 0x24, 0xf3, 0x3e, 0x34, 0x11, 0x61, 0xff, 0x98, 0x59, 0x45, 0xf5, 0x11, 0xb0 } },
+        { { 0x15, 0x76, 0x44, 0xd7, 0x11, 0x3b, 0x2a, 0xa5, 0xf7, 0x82, 0x7a, 0x4c, 0x49, 0x4e, 0x0d, 0xe8, 0x5d, 0x4f, 0x54, 0x2a, 0x45, 0x5c, 0xe5, 0x7f, 0x16, 0xb7, 0x7a, 0x02, 0xab, 0x9c, 0xd9, 0xcb },
+          { 0x26, 0xed, 0x39, 0xde, 0xdb, 0x94, 0x60, 0xd7, 0x4e, 0x3c, 0x30, 0x62, 0xff, 0x7b, 0xbe, 0xe5, 0xec, 0x01, 0x83, 0x1c, 0xf8, 0x43, 0x82, 0x95, 0x21, 0xeb, 0xca, 0x97, 0x3a, 0x33, 0x02, 0xce } },
+        { { 0x00, 0x18, 0xad, 0xf8, 0xff, 0xb8, 0x05, 0x96, 0x2f, 0x7e, 0x77, 0xb9, 0xc7, 0xbe, 0x48, 0xf2, 0x87, 0xd9, 0x92, 0x8d, 0x3e, 0x42, 0x52, 0x1b, 0x9a, 0xb0, 0xbf, 0x7c, 0x77, 0xea, 0x24, 0xd2 },
+          { 0x11, 0x51, 0x8c, 0x12, 0xec, 0xb5, 0xf3, 0xbf, 0xc4, 0xd6, 0x30, 0x55, 0x7f, 0xb4, 0x4a, 0x82, 0x52, 0xb3, 0xd3, 0xfb, 0x71, 0xbf, 0x74, 0x1b, 0x9d, 0x1c, 0xb1, 0x14, 0x25, 0xa1, 0x4c, 0x72 } },
+        { { 0x0e, 0xa6, 0xe9, 0x9f, 0xe1, 0xbe, 0xe7, 0x10, 0xb2, 0xbf, 0x59, 0x6d, 0xf1, 0x59, 0xad, 0x0d, 0x04, 0x4c, 0x75, 0xfa, 0xc7, 0x09, 0xd0, 0xcd, 0x19, 0x07, 0xb1, 0xd2, 0x7c, 0x49, 0x4f, 0x6e },
+          { 0x05, 0x63, 0xbe, 0x3f, 0x32, 0x65, 0xa6, 0x00, 0xc5, 0xfb, 0x5b, 0x48, 0x4e, 0x99, 0x8d, 0x18, 0x4b, 0x53, 0x43, 0x5b, 0x6a, 0x0b, 0x28, 0x18, 0x40, 0x96, 0xa9, 0x7f, 0x92, 0xad, 0x05, 0xed } },
+        { { 0x25, 0xec, 0xb7, 0x08, 0x1f, 0xd4, 0x3f, 0x16, 0x42, 0xb2, 0x2a, 0x31, 0x43, 0x2b, 0x22, 0x76, 0xaf, 0xa0, 0xad, 0x2d, 0x32, 0x30, 0xe7, 0xbc, 0xfa, 0xec, 0x19, 0x9c, 0x96, 0x7e, 0x64, 0x77 },
+          { 0x35, 0xb5, 0x0b, 0x53, 0x7f, 0x9d, 0x01, 0xa0, 0x99, 0x56, 0x4d, 0x6d, 0x25, 0x6e, 0x1f, 0xdc, 0x31, 0xa2, 0xd2, 0x76, 0x8f, 0xf3, 0x26, 0x72, 0xc9, 0x19, 0x2b, 0x76, 0x54, 0x1c, 0x24, 0xf0 } },
+        { { 0x39, 0x11, 0xd2, 0x91, 0xeb, 0x8f, 0x8e, 0x6d, 0x81, 0x1b, 0x97, 0x87, 0xdc, 0xf0, 0x1a, 0x47, 0xbb, 0xec, 0x95, 0x78, 0xe4, 0xb6, 0x43, 0x0e, 0xbe, 0x82, 0x85, 0x89, 0xa3, 0xd7, 0xa6, 0x6a },
+          { 0x33, 0x04, 0x32, 0x3d, 0xbc, 0xea, 0x77, 0x85, 0x8a, 0x87, 0x10, 0xd4, 0xc5, 0x83, 0xad, 0x97, 0x9a, 0x05, 0x12, 0x5d, 0xb2, 0x83, 0x79, 0xec, 0x5b, 0xde, 0xbd, 0x59, 0xe4, 0x59, 0x40, 0x9c } }
+    },
+    {
+        { { 0x0b, 0x9b, 0xe9, 0x6a, 0xf5, 0xba, 0x31, 0xab, 0xa2, 0x87, 0xef, 0xe5, 0xca, 0x0a, 0x6f, 0xb3, 0x84, 0x24, 0xab, 0x9a, 0xf3, 0xfd, 0xcb, 0x9b, 0xf2, 0x5f, 0xac, 0xf1, 0x18, 0x2d, 0x3f, 0xd0 },
+          { 0x20, 0xc0, 0x15, 0x64, 0x60, 0xee, 0x0c, 0x49, 0xdb, 0xf3, 0x04, 0xf9, 0x40, 0xa0, 0x0e, 0xba, 0xcf, 0x45, 0x1e, 0x41, 0x5b, 0x11, 0xc4, 0x4e, 0x07, 0xd6, 0x69, 0x54, 0xe4, 0xd9, 0xd1, 0x05 } },
+        { { 0x1e, 0x8a, 0xaf, 0xa7, 0x22, 0xf1, 0x59, 0x20, 0x95, 0x48, 0x77, 0x8e, 0xd4, 0x4d, 0x34, 0x9c, 0x2f, 0x2c, 0x45, 0x02, 0x24, 0xc4, 0x0d, 0xf9, 0x27, 0x30, 0xa6, 0xc0, 0xdb, 0x32, 0x96, 0x84 },
+          { 0x35, 0xd5, 0x7e, 0x78, 0xb9, 0x3c, 0xad, 0xa2, 0x1e, 0x9e, 0x38, 0x06, 0xf9, 0xd9, 0xa0, 0x56, 0xf4, 0xde, 0xcb, 0xd0, 0x5a, 0x49, 0xe3, 0x69, 0x40, 0x5e, 0xb3, 0x0d, 0x1c, 0x4d, 0xa7, 0x08 } },
+        { { 0x0b, 0x7d, 0x8d, 0x1f, 0x09, 0xba, 0x42, 0xe1, 0x7f, 0xa0, 0xde, 0x3a, 0x85, 0x66, 0x1f, 0x11, 0x78, 0xb1, 0xbb, 0xac, 0x9c, 0x87, 0xf2, 0x37, 0xc4, 0x1d, 0x40, 0x26, 0x6a, 0x55, 0x02, 0xef },
+          { 0x0a, 0x03, 0x52, 0x70, 0x7e, 0x7b, 0x95, 0x2b, 0x99, 0xb5, 0xc5, 0xc4, 0xd0, 0xae, 0x54, 0xe7, 0xbf, 0x4c, 0x1e, 0x9a, 0xc4, 0xed, 0x01, 0xcb, 0xd6, 0x3f, 0x1b, 0xe8, 0x01, 0x55, 0x69, 0xf7 } },
+        { { 0x08, 0x6a, 0xd6, 0x89, 0xd0, 0xfb, 0x65, 0xa3, 0xfd, 0xcd, 0x95, 0x34, 0x97, 0x73, 0xfe, 0xec, 0x64, 0x61, 0x60, 0x02, 0xdd, 0xae, 0xfc, 0x64, 0xe5, 0x60, 0x0a, 0xf1, 0xc3, 0x65, 0x5f, 0x3d },
+          { 0x13, 0xad, 0x2e, 0x8a, 0xfa, 0xb9, 0xaf, 0x45, 0xab, 0xe1, 0x34, 0xc5, 0x25, 0x71, 0x75, 0xd2, 0x88, 0x36, 0xa9, 0x5f, 0xec, 0x4f, 0x43, 0xa2, 0xe8, 0xcc, 0x30, 0xa1, 0x78, 0x81, 0x49, 0xf0 } },
+        { { 0x36, 0xd4, 0xac, 0xd4, 0x20, 0x4f, 0x53, 0x37, 0x99, 0x34, 0x66, 0xc4, 0xaa, 0x26, 0xab, 0xf4, 0xe9, 0x6e, 0x87, 0x23, 0x51, 0xd3, 0x37, 0xb6, 0x98, 0x7d, 0x01, 0x17, 0xb5, 0x79, 0x30, 0xa0 },
+          { 0x2d, 0x38, 0x3d, 0x2c, 0x53, 0xf4, 0xc1, 0xf4, 0x64, 0x60, 0xb2, 0x23, 0x78, 0x38, 0x2a, 0x7a, 0x19, 0x86, 0x5f, 0x4d, 0x14, 0x03, 0x7d, 0x92, 0xe4, 0x90, 0xf0, 0x28, 0x70, 0xc6, 0xbe, 0x84 } },
+        { { 0x3c, 0xed, 0xb9, 0x1f, 0x48, 0x4c, 0xa0, 0x32, 0x1c, 0x17, 0x6f, 0x7b, 0xe0, 0x25, 0x07, 0x38, 0xe2, 0x05, 0x17, 0x85, 0x24, 0xfd, 0x81, 0x6f, 0xf8, 0x0a, 0xe1, 0xeb, 0xcc, 0x2b, 0x24, 0xfd },
+          { 0x05, 0x27, 0x21, 0x72, 0x1e, 0x32, 0x72, 0xf6, 0x83, 0xab, 0x87, 0xb0, 0x10, 0x2e, 0x6c, 0xde, 0x65, 0x19, 0xff, 0x52, 0xe4, 0x5d, 0x2d, 0x03, 0x94, 0xf4, 0x23, 0xf2, 0x72, 0x58, 0x02, 0xdb } },
+        { { 0x3f, 0x42, 0x1f, 0xed, 0xbb, 0xbf, 0xe8, 0xa7, 0xff, 0xa7, 0xce, 0xc3, 0x39, 0x31, 0x26, 0x57, 0x62, 0x04, 0x2c, 0x7c, 0x7e, 0x48, 0x5e, 0x87, 0x06, 0x5b, 0x70, 0x0f, 0xa5, 0xee, 0x14, 0x6a },
+          { 0x1c, 0xf6, 0xe0, 0x96, 0x4a, 0x1a, 0x39, 0xae, 0x0b, 0xfe, 0x7d, 0x1a, 0x84, 0xdb, 0xe7, 0x1b, 0x07, 0xe1, 0x4b, 0xb7, 0x46, 0xd9, 0x82, 0xd4, 0x1b, 0xa0, 0xdb, 0x68, 0x48, 0x26, 0xc0, 0x51 } },
+        { { 0x06, 0xf7, 0x61, 0x9a, 0x4d, 0xbb, 0x2a, 0x08, 0xf9, 0x3d, 0x98, 0xe1, 0xc7, 0x6a, 0xb0, 0xa3, 0x36, 0xa8, 0x85, 0x13, 0xdc, 0x9d, 0x9b, 0xf3, 0x7c, 0x40, 0x85, 0xb9, 0x00, 0x3d, 0x28, 0xbb },
+          { 0x28, 0x4b, 0x86, 0x34, 0xba, 0x64, 0xc7, 0x6d, 0x01, 0x17, 0x99, 0x0c, 0x2d, 0xf4, 0x5d, 0xb0, 0x27, 0x3e, 0x8b, 0x7c, 0x08, 0xf1, 0xce, 0xc9, 0x2a, 0xb3, 0x27, 0x9b, 0xdb, 0xcb, 0xd7, 0x82 } }
+    },
+    {
+        { { 0x3e, 0x8d, 0x32, 0xda, 0x57, 0xfa, 0xda, 0xae, 0xdc, 0xa1, 0xf3, 0xd1, 0x67, 0x5e, 0x75, 0x3a, 0xa1, 0x19, 0xf8, 0xdf, 0xf1, 0xba, 0xe9, 0x31, 0x64, 0x07, 0x30, 0xe0, 0x25, 0x87, 0x51, 0x32 },
+          { 0x3b, 0x15, 0xc2, 0x6e, 0x4c, 0x56, 0xd2, 0x56, 0x72, 0xa8, 0x33, 0x76, 0x05, 0x9e, 0x33, 0xcc, 0xde, 0x62, 0x6e, 0x8b, 0xcc, 0x5d, 0xbd, 0xa7, 0x52, 0x85, 0x97, 0x37, 0x41, 0x85, 0xc4, 0xf8 } },
+        { { 0x2b, 0xcf, 0xf9, 0xc8, 0xd9, 0x37, 0xb5, 0x42, 0xb1, 0x17, 0xec, 0x6c, 0x95, 0x49, 0x74, 0x8a, 0x31, 0xc5, 0x53, 0x0e, 0x35, 0xb2, 0x4b, 0x59, 0x93, 0x63, 0x6e, 0x41, 0x80, 0x82, 0x50, 0xc5 },
+          { 0x32, 0x23, 0x92, 0xc3, 0x8c, 0xd9, 0x32, 0xfe, 0x7a, 0x40, 0x33, 0x0c, 0xab, 0x59, 0x0a, 0x5c, 0x21, 0xc2, 0x29, 0x6d, 0x54, 0xa0, 0xa2, 0x15, 0x52, 0x9a, 0xdd, 0x46, 0x07, 0x51, 0x23, 0x92 } },
+        { { 0x19, 0x1c, 0xcb, 0xad, 0xda, 0x56, 0x57, 0x4f, 0xc2, 0x26, 0x16, 0xbe, 0x18, 0xcc, 0x2a, 0x61, 0xb7, 0xcf, 0x08, 0x43, 0xe9, 0x12, 0x85, 0x22, 0xb9, 0x49, 0x5a, 0x98, 0xf3, 0x47, 0xb9, 0xce },
+          { 0x27, 0x1f, 0x08, 0xa3, 0x4d, 0xde, 0x11, 0x6e, 0x98, 0xb9, 0x4b, 0x12, 0x49, 0x34, 0xb7, 0x0e, 0x75, 0xae, 0xe7, 0xb6, 0x78, 0xb5, 0xc7, 0xb4, 0xb7, 0xad, 0xde, 0x96, 0x33, 0x75, 0x7c, 0xdf } },
+        { { 0x39, 0xfc, 0x4f, 0xa5, 0x64, 0x38, 0x31, 0xb0, 0x87, 0xe2, 0xe4, 0x55, 0x39, 0x76, 0xe5, 0x29, 0xe6, 0xfd, 0x9e, 0x1e, 0x76, 0x66, 0x87, 0x8d, 0x0b, 0xce, 0xa7, 0xc2, 0x4a, 0xfe, 0xf2, 0x0b },
+          { 0x27, 0x52, 0x68, 0x43, 0x89, 0x7f, 0x25, 0x49, 0x27, 0xc0, 0x28, 0xb4, 0x1d, 0xb7, 0x6b, 0x37, 0x26, 0xbd, 0x31, 0xdc, 0x02, 0x38, 0xab, 0x96, 0x23, 0x34, 0xd3, 0x63, 0x89, 0x1e, 0x4f, 0x23 } },
+        { { 0x27, 0x49, 0xce, 0xb2, 0x0e, 0x12, 0x82, 0x09, 0xe1, 0x4b, 0x1e, 0x0f, 0x16, 0x66, 0x1e, 0x64, 0x97, 0x97, 0x5d, 0xee, 0x7e, 0xd2, 0xe1, 0x4c, 0xb1, 0xb2, 0x6e, 0xc1, 0xed, 0xe0, 0x7d, 0xe0 },
+          { 0x1a, 0xd0, 0x4d, 0x7b, 0xf5, 0xaf, 0xa6, 0xc8, 0x52, 0xca, 0xf6, 0xb8, 0x48, 0x0f, 0xe5, 0x42, 0x6c, 0x3b, 0x01, 0x4f, 0x83, 0xfb, 0xa8, 0x91, 0xf7, 0x41, 0x69, 0xf4, 0x04, 0xdb, 0x50, 0xb4 } },
+        { { 0x11, 0xe3, 0xe5, 0x7b, 0xc5, 0xb2, 0xf2, 0x44, 0x08, 0x00, 0xb7, 0x62, 0x28, 0x35, 0x61, 0xc2, 0x27, 0xd5, 0x9a, 0x1b, 0x96, 0xe5, 0x36, 0xd8, 0x51, 0x73, 0x38, 0xd4, 0x0e, 0x94, 0xf8, 0xb3 },
+          { 0x07, 0x8e, 0x54, 0xbd, 0x7e, 0x20, 0x0c, 0x38, 0x53, 0x22, 0x00, 0x19, 0x5f, 0x8c, 0xb5, 0x06, 0x0a, 0x4a, 0x1d, 0xc3, 0x12, 0x86, 0x42, 0x03, 0x17, 0xfc, 0x62, 0xaa, 0xa7, 0x23, 0x2a, 0x4e } },
+        { { 0x2e, 0x01, 0x97, 0xa0, 0x16, 0x61, 0x42, 0x1d, 0xb7, 0x88, 0x6d, 0x24, 0x2c, 0xae, 0x5c, 0xb5, 0x2d, 0xe9, 0x5d, 0x2b, 0x9d, 0xfb, 0x28, 0x1c, 0x89, 0x61, 0x43, 0xa5, 0xa2, 0x68, 0x40, 0x0e },
+          { 0x37, 0xee, 0x34, 0x51, 0x3b, 0x7f, 0x18, 0x82, 0x21, 0x48, 0xd9, 0x51, 0x51, 0x80, 0x1e, 0xae, 0x61, 0x99, 0xce, 0xa5, 0xe9, 0xb1, 0x4e, 0x05, 0xfc, 0x28, 0xd6, 0x33, 0x08, 0x5f, 0x88, 0x82 } },
+        { { 0x2a, 0x90, 0xe1, 0xe5, 0x66, 0xab, 0x00, 0x3c, 0xf9, 0xf6, 0x9e, 0xaf, 0xd5, 0xa2, 0x76, 0xc7, 0xac, 0xa1, 0x60, 0xc2, 0xbc, 0xbf, 0x26, 0x96, 0x60, 0xc2, 0xa2, 0x22, 0x11, 0xc6, 0x88, 0xa9 },
+          { 0x19, 0x73, 0x75, 0xa4, 0xf0, 0x58, 0x40, 0x6b, 0x22, 0x95, 0xc3, 0x95, 0x8e, 0x54, 0x71, 0xc3, 0xcf, 0xce, 0x2e, 0x93, 0xf1, 0x34, 0xa2, 0x3a, 0x94, 0x37, 0x9d, 0x00, 0x0a, 0xd2, 0x5d, 0xef } }
+    },
+    {
+        { { 0x03, 0x40, 0xa1, 0x2b, 0x48, 0x1e, 0x72, 0x6a, 0xab, 0x89, 0xc0, 0xc3, 0x74, 0x1c, 0x86, 0x24, 0x5c, 0x3d, 0x04, 0x22, 0x78, 0xd6, 0x2a, 0xf8, 0x51, 0x80, 0x97, 0x1a, 0x94, 0xf0, 0xcb, 0x57 },
+          { 0x04, 0x08, 0x95, 0x20, 0x36, 0xbe, 0x76, 0x80, 0x09, 0x10, 0x10, 0x1a, 0xd4, 0xc3, 0x6e, 0x4a, 0x1e, 0x2b, 0xd5, 0x76, 0x5b, 0x2c, 0x86, 0xa0, 0xaa, 0x0d, 0xc1, 0x6a, 0xd1, 0x56, 0x41, 0xd8 } },
+        { { 0x0a, 0x8f, 0x59, 0xca, 0x67, 0xc6, 0xf8, 0x12, 0x80, 0xe1, 0x8d, 0x4e, 0xb8, 0x53, 0x0b, 0x47, 0xef, 0xec, 0x90, 0xf2, 0x85, 0xf9, 0x2e, 0xd7, 0xcc, 0xb5, 0x34, 0x08, 0xca, 0x78, 0xe2, 0xea },
+          { 0x0b, 0x24, 0xc3, 0x7b, 0x1e, 0xe3, 0x26, 0x82, 0xc7, 0xa5, 0x9d, 0x24, 0x59, 0x80, 0x91, 0x34, 0x1a, 0xc4, 0xa9, 0x03, 0x62, 0x24, 0xd4, 0xbc, 0xdf, 0xea, 0xe2, 0xce, 0xe9, 0xe6, 0x77, 0xb8 } },
+        { { 0x0b, 0x26, 0xc1, 0x76, 0xf3, 0x2d, 0xb1, 0x28, 0x25, 0x92, 0x83, 0x30, 0xb1, 0xb7, 0xc0, 0x6e, 0x5e, 0x3e, 0x4a, 0x83, 0xee, 0x43, 0x47, 0xe6, 0xaf, 0xf2, 0x08, 0x24, 0x9a, 0xc5, 0xc3, 0xcb },
+          { 0x04, 0x20, 0x82, 0xb6, 0x11, 0x65, 0x98, 0xff, 0x50, 0x73, 0x56, 0xbf, 0x3f, 0xd8, 0x2e, 0x19, 0x3f, 0x26, 0x80, 0x36, 0x40, 0x5e, 0x15, 0x97, 0x17, 0x9e, 0x1a, 0x3f, 0xac, 0x0c, 0xa6, 0x1b } },
+        { { 0x2e, 0xd7, 0xcb, 0xfe, 0x65, 0x37, 0x6e, 0x25, 0x8c, 0x8f, 0x62, 0x09, 0x22, 0xc2, 0x35, 0xcd, 0x6e, 0xc7, 0x0a, 0xdf, 0x9e, 0x09, 0x76, 0xc2, 0x08, 0xf4, 0x6c, 0x47, 0x42, 0x51, 0x36, 0xb2 },
+          { 0x31, 0x60, 0x5f, 0x96, 0x1b, 0xaa, 0x76, 0x2a, 0xbf, 0x5f, 0x71, 0x2d, 0x85, 0x1b, 0x6b, 0x16, 0x09, 0xe1, 0x30, 0x83, 0xcf, 0xc7, 0x8c, 0x4b, 0x24, 0x6c, 0xcb, 0xc4, 0x2f, 0x3a, 0xe1, 0x1d } },
+        { { 0x3e, 0x25, 0x51, 0x77, 0x84, 0xd4, 0x2b, 0x9a, 0xcf, 0x0d, 0xa1, 0xd6, 0x49, 0xb9, 0xa1, 0x13, 0x63, 0x85, 0xcf, 0x8e, 0xb1, 0x8e, 0x10, 0x24, 0x13, 0xb7, 0xa4, 0x3c, 0x19, 0x29, 0xb2, 0xaf },
+          { 0x09, 0xbf, 0x80, 0xa5, 0x96, 0xc7, 0x46, 0x55, 0x22, 0xe4, 0x04, 0x13, 0xa8, 0x71, 0x72, 0x63, 0xd7, 0xfd, 0x08, 0x25, 0x66, 0x33, 0x57, 0xee, 0xc3, 0x39, 0x3d, 0x4a, 0x9b, 0xce, 0x09, 0x80 } },
+        { { 0x12, 0x8d, 0x7e, 0x5e, 0x89, 0x0c, 0xe8, 0xca, 0x4b, 0xa5, 0xbb, 0x83, 0x4b, 0xd1, 0x39, 0xac, 0xff, 0x63, 0x87, 0x39, 0xea, 0x59, 0xfa, 0xb1, 0x38, 0x7f, 0x9a, 0x25, 0x01, 0x18, 0xf1, 0x4c },
+          { 0x07, 0x2d, 0xd6, 0xce, 0x41, 0x3b, 0xc6, 0x5d, 0x56, 0xd2, 0x8f, 0xd9, 0xe7, 0xde, 0x0f, 0x4b, 0x88, 0xc0, 0x2b, 0xd8, 0xb4, 0x64, 0x09, 0x19, 0x45, 0x5a, 0x3a, 0xaa, 0x69, 0x76, 0x8b, 0xaf } },
+        { { 0x17, 0x8f, 0x86, 0x7e, 0xa7, 0xf8, 0x7d, 0xa7, 0x85, 0x45, 0xf5, 0x76, 0xcc, 0xf5, 0xfe, 0x2d, 0x5f, 0x39, 0x68, 0x52, 0x46, 0x99, 0xf9, 0xd8, 0x72, 0x37, 0xdf, 0xd1, 0x7e, 0x03, 0xaf, 0xd2 },
+          { 0x18, 0x63, 0x23, 0x48, 0x2c, 0x4e, 0x9c, 0x40, 0x1e, 0x3d, 0x64, 0x64, 0xd8, 0xf3, 0x61, 0x29, 0x66, 0x8a, 0xa1, 0x2f, 0x80, 0x35, 0x3c, 0x22, 0x69, 0x92, 0xcc, 0x6e, 0x46, 0x69, 0x26, 0x5d } },
+        { { 0x3a, 0x7f, 0x85, 0x9e, 0x3d, 0x59, 0xfc, 0x14, 0xe4, 0xe9, 0xb9, 0xbf, 0xd8, 0x6c, 0x57, 0xb1, 0xf3, 0xe2, 0x63, 0x54, 0xcb, 0x9d, 0x0b, 0xf6, 0xb6, 0x68, 0xea, 0x46, 0x9e, 0xde, 0x58, 0x45 },
+          { 0x1d, 0xee, 0x10, 0xb9, 0x6f, 0x68, 0xb0, 0x7c, 0x1e, 0xeb, 0x96, 0xa5, 0xb2, 0x8d, 0x4e, 0x9f, 0xb5, 0x30, 0x4d, 0x26, 0x29, 0x54, 0x49, 0x2f, 0x16, 0xc0, 0xa5, 0xb8, 0xaf, 0xb3, 0x7f, 0xd4 } }
+    },
+    {
+        { { 0x3a, 0x0b, 0x0e, 0x21, 0x0c, 0x30, 0x93, 0xc3, 0x16, 0x31, 0x1f, 0xef, 0x27, 0x86, 0x33, 0xc2, 0x08, 0xdf, 0xd0, 0xcb, 0xd0, 0x8c, 0x27, 0xf6, 0x5e, 0xb4, 0x20, 0x9c, 0x51, 0xd5, 0x9d, 0xb8 },
+          { 0x2f, 0xa2, 0x3b, 0x16, 0x31, 0x50, 0xe3, 0x76, 0x34, 0xc4, 0x1e, 0xad, 0x30, 0x24, 0xdd, 0x93, 0xa9, 0x32, 0x05, 0xd5, 0x38, 0x54, 0x3a, 0x0b, 0x6a, 0x84, 0x12, 0xbe, 0x1f, 0x06, 0x8e, 0xaa } },
+        { { 0x37, 0x98, 0xbc, 0x54, 0x4d, 0x04, 0x45, 0x0f, 0xf7, 0x36, 0x7d, 0x50, 0x7c, 0x7a, 0xdf, 0xbf, 0x9d, 0x40, 0xa6, 0xdc, 0x28, 0x1a, 0x2b, 0x3d, 0x37, 0x29, 0x40, 0xfa, 0xd1, 0x33, 0x76, 0xa4 },
+          { 0x3b, 0x38, 0xe6, 0x37, 0x88, 0xf0, 0x94, 0xd4, 0xc9, 0xb9, 0x5b, 0x5f, 0xff, 0x2f, 0x8e, 0xb6, 0x2f, 0xb3, 0x5f, 0x5e, 0x06, 0x36, 0x32, 0xdd, 0x61, 0x98, 0xf8, 0x08, 0xdf, 0x89, 0xda, 0x21 } },
+        { { 0x0a, 0xf1, 0xb2, 0x6b, 0x62, 0xd1, 0x7e, 0x72, 0x87, 0x77, 0x2c, 0xde, 0xbb, 0x79, 0x07, 0x5c, 0x46, 0x91, 0x6e, 0xa6, 0x5e, 0x85, 0x7a, 0x02, 0x6c, 0xce, 0x01, 0x96, 0x0c, 0xf1, 0x5e, 0xe2 },
+          { 0x35, 0x6f, 0xe0, 0xc0, 0x91, 0x10, 0xdd, 0xf0, 0x38, 0x1f, 0x01, 0xb1, 0x4e, 0x65, 0x43, 0xe6, 0x29, 0xac, 0x24, 0x76, 0xf0, 0xaf, 0xdf, 0x00, 0xfc, 0xfe, 0xd3, 0x55, 0x11, 0xda, 0xc2, 0x35 } },
+        { { 0x0d, 0x87, 0x26, 0x67, 0x97, 0xc6, 0xf6, 0xfc, 0x68, 0x8a, 0x37, 0xbe, 0x98, 0x31, 0x8b, 0x95, 0xa3, 0x3c, 0x9a, 0x50, 0xe2, 0x91, 0x54, 0x47, 0x27, 0xf8, 0xf6, 0xee, 0xc6, 0x1a, 0x1c, 0xb3 },
+          { 0x2b, 0x21, 0xb2, 0x8b, 0x59, 0x68, 0x26, 0x8e, 0x6a, 0x06, 0x40, 0x82, 0xfc, 0xc2, 0xd9, 0x4c, 0x9c, 0x67, 0xac, 0xad, 0xd4, 0x23, 0xeb, 0xe5, 0x3b, 0xfb, 0xec, 0x18, 0x9b, 0x28, 0xcd, 0x47 } },
+        { { 0x0e, 0x5f, 0x5d, 0xe6, 0xe3, 0x3f, 0x14, 0x49, 0x6d, 0x5b, 0xa6, 0xb1, 0x10, 0x55, 0x95, 0x84, 0x9a, 0x69, 0xce, 0xdc, 0x0a, 0xf3, 0xd0, 0xb2, 0x02, 0xfb, 0x6a, 0x4d, 0xc4, 0x11, 0x4d, 0x4b },
+          { 0x05, 0x7f, 0x9f, 0x51, 0x5c, 0x0e, 0x69, 0x7e, 0x97, 0x8b, 0x2c, 0x0a, 0x59, 0x50, 0x9a, 0xcf, 0x4c, 0xf7, 0xe0, 0x40, 0xc9, 0x88, 0x0e, 0x50, 0x68, 0x54, 0x2f, 0x77, 0xb8, 0xf2, 0x1c, 0xb2 } },
+        { { 0x31, 0xff, 0x6f, 0xcf, 0x31, 0x1d, 0xbc, 0x85, 0xef, 0x90, 0xf5, 0x4e, 0x4f, 0xd5, 0x1a, 0xaf, 0x3e, 0xad, 0x5f, 0x68, 0x87, 0x21, 0x4d, 0x1c, 0xa2, 0x59, 0xbe, 0xe3, 0x2a, 0x3b, 0xd4, 0x04 },
+          { 0x34, 0x0a, 0xc1, 0x8f, 0x04, 0x32, 0x16, 0xe7, 0x70, 0xb8, 0x29, 0xb7, 0xdc, 0xe5, 0x1e, 0x95, 0x95, 0xad, 0x1b, 0xa2, 0x51, 0xf5, 0x40, 0x2b, 0x11, 0x5f, 0xad, 0x36, 0xb5, 0x28, 0xbc, 0x85 } },
+        { { 0x07, 0xc1, 0x17, 0x8c, 0x04, 0x79, 0xb4, 0x02, 0x41, 0x1f, 0x05, 0x91, 0xcf, 0xe6, 0x57, 0x59, 0x6e, 0x2c, 0x01, 0xe5, 0xe0, 0x70, 0x1c, 0x19, 0x07, 0x48, 0xcb, 0xac, 0x84, 0x91, 0x5e, 0x45 },
+          { 0x3d, 0x8d, 0x4b, 0x7c, 0x69, 0x2a, 0xdd, 0x1d, 0xf0, 0xb7, 0x1a, 0x32, 0x43, 0x6f, 0x21, 0xa8, 0x37, 0xf6, 0x9f, 0x34, 0x06, 0x19, 0xc7, 0x72, 0x97, 0xba, 0x2a, 0x2c, 0xd1, 0x3a, 0x4f, 0x2f } },
+        { { 0x37, 0x1b, 0x42, 0x51, 0xf9, 0x51, 0x17, 0x8d, 0xf7, 0xbc, 0xe0, 0x2c, 0xa2, 0xf9, 0xce, 0x3f, 0x72, 0xc5, 0x8c, 0xf0, 0x9e, 0x61, 0x1a, 0x32, 0x1a, 0x75, 0xba, 0x53, 0xc5, 0x44, 0x83, 0xa9 },
+          { 0x12, 0x9f, 0xc8, 0xa6, 0xcb, 0x62, 0x86, 0x69, 0x7f, 0x4b, 0x64, 0x6c, 0x7d, 0xfc, 0x7e, 0x99, 0x21, 0xe1, 0x4a, 0xee, 0xb0, 0xc8, 0x67, 0xa6, 0xf2, 0xa3, 0x20, 0xf4, 0xb1, 0x11, 0xad, 0x91 } }
+    },
+    {
+        { { 0x09, 0x4d, 0xc2, 0xe4, 0xc9, 0xc0, 0xcb, 0xb1, 0xf4, 0x84, 0xd8, 0xef, 0x16, 0x6f, 0xe5, 0x8c, 0xab, 0xb5, 0xe1, 0x1b, 0xf8, 0x43, 0x2a, 0x5d, 0x00, 0x6c, 0xf4, 0xe8, 0x1d, 0xd7, 0x4d, 0x9c },
+          { 0x17, 0xc3, 0x44, 0x74, 0x87, 0x08, 0x2c, 0x75, 0x59, 0x86, 0x35, 0x2a, 0x3a, 0x4a, 0xc1, 0x46, 0xe8, 0xab, 0xfc, 0x25, 0x02, 0x80, 0x6d, 0x54, 0x35, 0xc4, 0x3c, 0x32, 0x60, 0x1d, 0xcc, 0x0e } },
+        { { 0x2a, 0xe5, 0xbb, 0xe6, 0x62, 0x37, 0x13, 0x98, 0xab, 0x3e, 0xe3, 0x73, 0xd8, 0x5e, 0xfd, 0x6d, 0x4b, 0xe0, 0x40, 0xa4, 0x7b, 0xf7, 0xfc, 0xf0, 0x9e, 0x9b, 0xc4, 0x2f, 0xac, 0x20, 0x7e, 0xd8 },
+          { 0x23, 0xcc, 0xfa, 0x45, 0xb6, 0xca, 0x2d, 0xf2, 0x4d, 0xd0, 0xb5, 0x07, 0x34, 0xb9, 0x3a, 0xec, 0x2a, 0xd9, 0xef, 0x2f, 0x17, 0xc1, 0x19, 0xb0, 0x93, 0x16, 0xa1, 0x40, 0x35, 0xe6, 0xe5, 0x54 } },
+        { { 0x0b, 0xe0, 0xd3, 0x51, 0xa7, 0xcb, 0xd9, 0x75, 0x93, 0x22, 0x44, 0x63, 0x67, 0xbf, 0x08, 0xdd, 0xf9, 0xdf, 0x94, 0xbc, 0x77, 0xde, 0x6b, 0x39, 0x73, 0x59, 0x0d, 0x1c, 0xe6, 0x28, 0xea, 0x3f },
+          { 0x0b, 0xf8, 0x1c, 0xa8, 0x28, 0x92, 0x7c, 0xb7, 0xf2, 0x4a, 0x21, 0x3a, 0x60, 0x66, 0xe0, 0xb4, 0xb3, 0x42, 0x1d, 0xca, 0x63, 0xaf, 0xa5, 0x2d, 0x50, 0xc4, 0xce, 0x35, 0x66, 0x4a, 0xbf, 0xb7 } },
+        { { 0x0d, 0x23, 0x6f, 0x24, 0x5e, 0x24, 0xcf, 0xbd, 0x13, 0x4e, 0xab, 0xe6, 0x8a, 0x63, 0x8a, 0xfd, 0x55, 0x60, 0x66, 0xad, 0x66, 0xcd, 0x9d, 0x21, 0x80, 0x14, 0xad, 0x76, 0x90, 0xd5, 0x56, 0x18 },
+          { 0x38, 0xcc, 0x9e, 0x8e, 0xe9, 0x53, 0x0e, 0x03, 0xe8, 0xea, 0x48, 0x01, 0xd4, 0xac, 0x83, 0x6a, 0xa9, 0x57, 0x67, 0xbb, 0x1e, 0x08, 0xb3, 0x96, 0x98, 0x03, 0xdc, 0x3a, 0x45, 0x8f, 0x5c, 0xfe } },
+        { { 0x3d, 0x85, 0x3a, 0x77, 0xa1, 0xfa, 0x57, 0x27, 0x3d, 0x7b, 0x3d, 0x75, 0xbb, 0xe3, 0x66, 0x85, 0x8d, 0x58, 0x80, 0x40, 0x9c, 0x7b, 0x03, 0xbf, 0x8a, 0x5a, 0x5c, 0x1f, 0x3b, 0x34, 0x28, 0x74 },
+          { 0x07, 0x65, 0xfd, 0x10, 0x7f, 0x19, 0x28, 0x69, 0x32, 0xf3, 0x5a, 0x39, 0x0d, 0xf2, 0xdb, 0xe5, 0xcb, 0x81, 0xe8, 0x5b, 0x9f, 0x38, 0xf4, 0x92, 0xed, 0xb9, 0x38, 0x8a, 0xd7, 0x91, 0xa5, 0x6a } },
+        { { 0x23, 0xb7, 0xa7, 0x03, 0xa7, 0x9c, 0x01, 0xfa, 0xba, 0x57, 0xa7, 0xf8, 0x05, 0x92, 0x59, 0xe1, 0x61, 0x58, 0x78, 0xeb, 0x0f, 0x41, 0x62, 0x63, 0x32, 0xca, 0xad, 0x8b, 0x29, 0x33, 0x80, 0x44 },
+          { 0x36, 0xea, 0x4c, 0xdc, 0x7e, 0xe6, 0xce, 0x72, 0x1c, 0xa2, 0xb3, 0x28, 0xfd, 0x38, 0xbb, 0xb0, 0x49, 0xf1, 0x83, 0xbe, 0x94, 0xc8, 0xd8, 0x23, 0xab, 0xda, 0x22, 0xc3, 0x0c, 0x6c, 0xe0, 0x7c } },
+        { { 0x1a, 0xac, 0x7e, 0x7f, 0x07, 0x52, 0x81, 0x3c, 0x93, 0x35, 0xcb, 0x88, 0xad, 0xd2, 0x30, 0x55, 0x5a, 0xb9, 0xf7, 0x82, 0xce, 0xb3, 0xc3, 0x2f, 0xb2, 0x3e, 0x11, 0x87, 0xea, 0x10, 0x09, 0xc9 },
+          { 0x39, 0x73, 0xc3, 0x65, 0x4d, 0xdc, 0x81, 0x10, 0xd7, 0x6b, 0xb6, 0x6a, 0xcf, 0x5e, 0xa2, 0x61, 0xab, 0x60, 0x28, 0xcf, 0x48, 0x20, 0x6b, 0x9b, 0xa1, 0x44, 0x0d, 0x4a, 0x8c, 0x0c, 0xa6, 0x1e } },
+        { { 0x02, 0x21, 0x50, 0xf0, 0xc6, 0x20, 0x6e, 0x4e, 0x2e, 0x79, 0x1c, 0xf6, 0x16, 0x0c, 0xce, 0x62, 0x23, 0x04, 0x56, 0x35, 0x56, 0x37, 0xdd, 0x1f, 0xcf, 0xd2, 0x50, 0x85, 0x28, 0x65, 0xa8, 0x70 },
+          { 0x05, 0xa1, 0xaa, 0x82, 0x88, 0xde, 0xcb, 0xe7, 0xd0, 0x81, 0x95, 0x75, 0x0a, 0x85, 0xeb, 0x2d, 0x79, 0x03, 0x1b, 0x8f, 0xc4, 0xb8, 0xec, 0xd7, 0x85, 0xc6, 0x55, 0x5f, 0x87, 0x25, 0x9e, 0xcb } }
+    },
+    {
+        { { 0x1d, 0x7a, 0x7e, 0x7f, 0xa1, 0xc3, 0x18, 0x94, 0xb6, 0x03, 0x88, 0x4d, 0x6d, 0x74, 0x6c, 0xb4, 0xd9, 0x46, 0xf7, 0x98, 0xf2, 0xb6, 0x11, 0x6a, 0xed, 0xeb, 0x2f, 0x96, 0xfd, 0x22, 0xd5, 0x36 },
+          { 0x0e, 0x38, 0x06, 0x6c, 0x62, 0x20, 0x8a, 0xa2, 0xe6, 0x88, 0x9a, 0xf1, 0x1c, 0x22, 0xc4, 0x2b, 0x10, 0x43, 0x73, 0x78, 0x6a, 0x11, 0xf0, 0x61, 0x3e, 0x87, 0x19, 0x1f, 0xfe, 0x0b, 0x61, 0x2b } },
+        { { 0x08, 0xee, 0x57, 0x9f, 0x59, 0x72, 0x6e, 0x6c, 0x13, 0xb5, 0xe1, 0x8c, 0x30, 0xbe, 0xfe, 0xc8, 0x6c, 0xf6, 0x90, 0xbf, 0xe0, 0xd1, 0x46, 0x7f, 0x2f, 0x21, 0x52, 0x56, 0xf3, 0x28, 0xa1, 0x96 },
+          { 0x06, 0x87, 0xb7, 0xf7, 0x7b, 0x60, 0x06, 0xb4, 0x54, 0x71, 0xe5, 0x1f, 0xd4, 0xce, 0x79, 0xef, 0x72, 0x4c, 0x16, 0x60, 0xa3, 0x19, 0x3d, 0x99, 0x2e, 0x6e, 0xc6, 0xf0, 0x0f, 0x3f, 0x08, 0xbe } },
+        { { 0x36, 0xff, 0xde, 0x4b, 0x1e, 0xbf, 0xd6, 0xc3, 0x88, 0x39, 0x8c, 0x58, 0x45, 0x49, 0xc4, 0xfe, 0xe6, 0xcf, 0x21, 0x72, 0x80, 0xbf, 0x65, 0x7c, 0x3f, 0x12, 0x15, 0x2f, 0xd6, 0x0f, 0x7c, 0xbc },
+          { 0x0d, 0x02, 0x00, 0xbd, 0xcd, 0xdb, 0x64, 0x65, 0x76, 0x7c, 0x4f, 0x23, 0x2c, 0xab, 0xc9, 0x5e, 0xcc, 0xd3, 0xe6, 0x92, 0xed, 0x02, 0xeb, 0x87, 0x5f, 0x78, 0x27, 0x83, 0xa4, 0x42, 0x26, 0xae } },
+        { { 0x19, 0xae, 0xe3, 0x9a, 0x64, 0x13, 0x7c, 0x1d, 0xe2, 0xda, 0x63, 0x95, 0x85, 0x06, 0x13, 0x51, 0xbe, 0xee, 0xfc, 0xdf, 0xb6, 0x72, 0xd0, 0xa6, 0x78, 0x77, 0x3a, 0x68, 0xee, 0x7f, 0x98, 0x09 },
+          { 0x1d, 0x2b, 0x29, 0x3b, 0x9b, 0x7c, 0x78, 0x84, 0x5a, 0x93, 0xae, 0x86, 0x6b, 0x02, 0x0e, 0x00, 0xcd, 0x80, 0x75, 0x63, 0x92, 0xe1, 0x17, 0xcc, 0x8d, 0x3a, 0xb1, 0x96, 0xf1, 0x33, 0x17, 0x3d } },
+        { { 0x2e, 0xc9, 0x62, 0x9f, 0x56, 0x85, 0x5f, 0x61, 0x14, 0x28, 0xaf, 0x12, 0x55, 0xe3, 0x32, 0x3e, 0x83, 0x09, 0xb8, 0xf5, 0x98, 0x19, 0xa7, 0xa0, 0xf6, 0x69, 0xa5, 0xa3, 0xea, 0x82, 0x61, 0x23 },
+          { 0x0e, 0xf4, 0xf5, 0xa1, 0xda, 0x40, 0x65, 0xb1, 0xad, 0x82, 0x1e, 0xdd, 0x33, 0xcc, 0xe2, 0x3b, 0x75, 0x85, 0x80, 0xfe, 0x67, 0x23, 0x9f, 0xa5, 0x44, 0x97, 0x3e, 0x49, 0x62, 0x49, 0xb7, 0x47 } },
+        { { 0x24, 0xc6, 0x8c, 0x97, 0x7f, 0xcf, 0x3b, 0x86, 0x8d, 0xb5, 0x94, 0x12, 0x44, 0xdd, 0x81, 0x37, 0x0e, 0x3f, 0x1e, 0xc7, 0x53, 0xae, 0x0f, 0x46, 0x8c, 0xc7, 0xe8, 0x3d, 0x42, 0x40, 0x44, 0x45 },
+          { 0x1d, 0xba, 0x22, 0xe1, 0xd0, 0xe0, 0x91, 0xa4, 0xe6, 0x0f, 0x49, 0xd2, 0x43, 0x06, 0x6f, 0x7c, 0xcd, 0x98, 0xe4, 0xc7, 0x5c, 0x59, 0x81, 0xab, 0xe3, 0x35, 0x2c, 0xde, 0x5a, 0x48, 0x76, 0x62 } },
+        { { 0x10, 0x32, 0xe2, 0x5f, 0x7b, 0x82, 0xd0, 0x50, 0x75, 0xd7, 0xef, 0xcb, 0x7d, 0xc2, 0x75, 0xca, 0x75, 0x9c, 0xf8, 0x7e, 0xb3, 0x5d, 0x4c, 0xb5, 0xaa, 0xd4, 0xbb, 0x25, 0xa0, 0x88, 0xed, 0xc2 },
+          { 0x0f, 0x99, 0x06, 0xd2, 0x8c, 0x75, 0xf2, 0xcb, 0x48, 0xea, 0x52, 0xed, 0x81, 0x9c, 0x72, 0x39, 0x74, 0x9d, 0x2d, 0xc8, 0x81, 0x81, 0xa1, 0xb3, 0xef, 0xc4, 0x6f, 0x52, 0xab, 0x17, 0x96, 0xe0 } },
+        { { 0x04, 0xe5, 0xdf, 0xe5, 0xd1, 0x8a, 0xd0, 0x2e, 0x5c, 0xa8, 0x43, 0x7a, 0xb1, 0x14, 0xdf, 0xcf, 0x40, 0x2d, 0xd7, 0xd9, 0x5f, 0xd2, 0x44, 0x4f, 0xff, 0xf4, 0x3b, 0xb7, 0xbd, 0x2b, 0xe0, 0xcd },
+          { 0x04, 0x97, 0xf1, 0x31, 0x0e, 0xdc, 0x3f, 0x98, 0x25, 0x3a, 0x69, 0x9b, 0x9f, 0xf7, 0x05, 0xf4, 0x25, 0xbd, 0x3c, 0x4b, 0x82, 0x12, 0xc0, 0xc3, 0x01, 0x5f, 0x55, 0x6d, 0xa9, 0x71, 0x7a, 0xa8 } }
+    }
+};
+
+#endif
+
+#endif
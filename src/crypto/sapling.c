@@ -29,6 +29,7 @@
 #include "key.h"
 #include "ff1.h"
 #include "address.h"
+#include "gd_cache.h"
 #include "tx.h"
 #include "transparent.h"
 #include "globals.h"
@@ -36,61 +37,24 @@
 #include "../ui/menu.h"
 #include "../helper/send_response.h"
 
-static cx_bn_t M; // M is the modulus in the base field of jubjub, Fq
-#ifndef NO_MONTGOMERY
-static const uint8_t mont_h[] = {
-    0x07, 0x48, 0xd9, 0xd9, 0x9f, 0x59, 0xff, 0x11, 0x05, 0xd3, 0x14, 0x96, 0x72, 0x54, 0x39, 0x8f, 0x2b, 0x6c, 0xed, 0xcb, 0x87, 0x92, 0x5c, 0x23, 0xc9, 0x99, 0xe9, 0x90, 0xf3, 0xf2, 0x9c, 0x6d
-};
-#endif
 #include "fr.h"
 #include "mont.h"
 #include "sapling.h"
-
-/// q is the modulus of Fq
-/// q = 0x73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001
-static const uint8_t fq_m[32] = {
-  0x73, 0xed, 0xa7, 0x53, 0x29, 0x9d, 0x7d, 0x48, 
-  0x33, 0x39, 0xd8, 0x08, 0x09, 0xa1, 0xd8, 0x05, 
-  0x53, 0xbd, 0xa4, 0x02, 0xff, 0xfe, 0x5b, 0xfe, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01    
-};
-
-/// r is the modulus of Fr
-/// r = 0x0e7db4ea6533afa906673b0101343b00a6682093ccc81082d0970e5ed6f72cb7
-static const uint8_t fr_m[32] = {
-  0x0e, 0x7d, 0xb4, 0xea, 0x65, 0x33, 0xaf, 0xa9, 
-  0x06, 0x67, 0x3b, 0x01, 0x01, 0x34, 0x3b, 0x00, 
-  0xa6, 0x68, 0x20, 0x93, 0xcc, 0xc8, 0x10, 0x82, 
-  0xd0, 0x97, 0x0e, 0x5e, 0xd6, 0xf7, 0x2c, 0xb7
-};
-
-/// the parameter d of JJ in Fq
-/// JJ is a twisted Edward curve: -u^2 + v^2 = 1 + d.u^2.v^2
-static const uint8_t fq_D[32] = {
-  0x2A, 0x93, 0x18, 0xE7, 0x4B, 0xFA, 0x2B, 0x48, 
-  0xF5, 0xFD, 0x92, 0x07, 0xE6, 0xBD, 0x7F, 0xD4, 
-  0x29, 0x2D, 0x7F, 0x6D, 0x37, 0x57, 0x9D, 0x26, 
-  0x01, 0x06, 0x5F, 0xD6, 0xD6, 0x34, 0x3E, 0xB1,
-};
-
-/// 2*d in Fq
-static const uint8_t fq_D2[32] = {
-  0x55, 0x26, 0x31, 0xCE, 0x97, 0xF4, 0x56, 0x91, 
-  0xEB, 0xFB, 0x24, 0x0F, 0xCD, 0x7A, 0xFF, 0xA8, 
-  0x52, 0x5A, 0xFE, 0xDA, 0x6E, 0xAF, 0x3A, 0x4C, 
-  0x02, 0x0C, 0xBF, 0xAD, 0xAC, 0x68, 0x7D, 0x62,
-};
+#include "inv.h"
+#include "sqrt.h"
 
 void init_ph(pedersen_state_t *state);
 void destroy_ph(pedersen_state_t *state);
 void update_ph(pedersen_state_t *state, uint8_t *data, size_t data_bit_len);
-void finalize_ph(pedersen_state_t *state);
+void finalize_ph(pedersen_state_t *state, const jj_comb_t *rand);
 
 void swap_endian(uint8_t *data, int8_t len);
 void en_mul(jj_e_t *pk, jj_en_t *G, cx_bn_t sk);
+void en_fixed_base_mult(jj_e_t *pk, const ff_jj_en_aff_t (*table)[9], cx_bn_t sk);
 void e_double(jj_e_t *r);
 void een_add_assign(jj_e_t *x, jj_en_t *y);
 void e_to_bytes(uint8_t *pkb, jj_e_t *p);
+void e_to_bytes_batch(uint8_t *const *pkb, jj_e_t *const *p, uint8_t n);
 void e_to_u(uint8_t *ub, const jj_e_t *p);
 
 void sk_to_pk(uint8_t *pkb, jj_en_t *g, cx_bn_t sk);
@@ -98,7 +62,7 @@ int hash_to_e(jj_e_t *p, const uint8_t *msg, size_t len);
 
 static void get_ivk(uint8_t *ivk, uint8_t *ak, uint8_t *nk);
 
-static int derive_spending_key(uint8_t *spk, uint8_t account);
+static int derive_spending_key(uint8_t *spk, const uint8_t *tsk);
 
 static void prf_expand_spending_key(uint8_t *buffer, uint8_t *key, uint8_t t);
 static void reduce_wide_bytes(cx_bn_t dest, uint8_t *src, cx_bn_t M);
@@ -108,7 +72,6 @@ static void alloc_en(jj_en_t *r);
 static void destroy_e(jj_e_t *r);
 static void destroy_en(jj_en_t *r);
 
-static void load_en(jj_en_t *dest, const ff_jj_en_t *src);
 static void e_to_en(jj_en_t *dest, jj_e_t *src);
 static void e_set0(jj_e_t *r);
 
@@ -153,19 +116,19 @@ static uint8_t buffer[64];
  * 
  * stack usage = hash (2) + spk + ask + nsk + ovk + dk + ak + nk + ivk + d (1/3) + pkd
 */
-void sapling_derive_spending_key(uint8_t account) {
+void sapling_derive_spending_key(const uint8_t *tsk) {
     ui_display_processing("z-key");
-    expanded_spending_key_t *pkeys = &G_context.exp_sk_info;
-    PRINTF("Derive sapling keys for account %d\n", account);
+    expanded_spending_key_t *pkeys = &G_context.keys->exp_sk_info;
+    PRINTF("Derive sapling keys\n");
 
     uint8_t spk[32];
 
-    derive_spending_key(spk, account);
+    derive_spending_key(spk, tsk);
 
     PRINTF("Spending key %.*H\n", 32, spk);
-    cx_bn_lock(32, 0);
-    BN_DEF(rM); cx_bn_init(rM, fr_m, 32);
-    init_mont(fq_m);
+    bn_session_begin();
+    cx_bn_t rM = field_ctx(FIELD_FR)->M;
+    use_field(field_ctx(FIELD_FQ));
 
     BN_DEF(temp);
     // derive the first layer of keys
@@ -194,21 +157,26 @@ void sapling_derive_spending_key(uint8_t account) {
 
     // ak is the byte representation of A = G.ask where G is the spending auth generator point
     BN_DEF(ask); cx_bn_init(ask, pkeys->ask, 32);
-    jj_en_t G; alloc_en(&G); load_en(&G, &SPENDING_GEN);
-    sk_to_pk(G_context.proofk_info.ak, &G, ask);
-    PRINTF("ak %.*H\n", 32, G_context.proofk_info.ak);
+    jj_e_t ak; alloc_e(&ak);
+    en_fixed_base_mult(&ak, SPENDING_GEN_TABLE, ask);
     cx_bn_destroy(&ask);
-    destroy_en(&G);
 
     // same thing with nsk -> nk
     BN_DEF(nsk); cx_bn_init(nsk, pkeys->nsk, 32);
-    jj_en_t G2; alloc_en(&G2); load_en(&G2, &PROOF_GEN);
-    sk_to_pk(G_context.proofk_info.nk, &G2, nsk);
-    PRINTF("nk %.*H\n", 32, G_context.proofk_info.nk);
+    jj_e_t nk; alloc_e(&nk);
+    en_fixed_base_mult(&nk, PROOF_GEN_TABLE, nsk);
     cx_bn_destroy(&nsk);
-    destroy_en(&G2);
 
-    get_ivk(pkeys->pk_d, G_context.proofk_info.ak, G_context.proofk_info.nk); // use pk_d as ivk to save on space
+    // compress both with a single inversion
+    uint8_t *const aknkb[2] = {G_context.keys->proofk_info.ak, G_context.keys->proofk_info.nk};
+    jj_e_t *const aknk[2] = {&ak, &nk};
+    e_to_bytes_batch(aknkb, aknk, 2);
+    destroy_e(&ak);
+    destroy_e(&nk);
+    PRINTF("ak %.*H\n", 32, G_context.keys->proofk_info.ak);
+    PRINTF("nk %.*H\n", 32, G_context.keys->proofk_info.nk);
+
+    get_ivk(pkeys->pk_d, G_context.keys->proofk_info.ak, G_context.keys->proofk_info.nk); // use pk_d as ivk to save on space
     PRINTF("ivk %.*H\n", 32, pkeys->pk_d);
 
     // Find the first diversifier = default address
@@ -228,23 +196,33 @@ void sapling_derive_spending_key(uint8_t account) {
     }
 
     // Convert G to ext niels
-    alloc_en(&G);
+    jj_en_t G; alloc_en(&G);
     e_to_en(&G, &Gd);
-    destroy_e(&Gd);
     print_bn("vpu", G.vpu);
     print_bn("vmu", G.vmu);
     print_bn("z", G.z);
     print_bn("t2d", G.t2d);
     swap_endian(pkeys->pk_d, 32); // that's in fact ivk
     BN_DEF(ivk); cx_bn_init(ivk, pkeys->pk_d, 32);
-    sk_to_pk(pkeys->pk_d, &G, ivk); // pkd = Gd.ivk
+    jj_e_t pkd; alloc_e(&pkd);
+    en_mul(&pkd, &G, ivk); // pkd = Gd.ivk
     destroy_en(&G);
 
+    // compress Gd and pkd with a single inversion
+    uint8_t *const gdpkb[2] = {G_store.Gdb, pkeys->pk_d};
+    jj_e_t *const gdpk[2] = {&Gd, &pkd};
+    e_to_bytes_batch(gdpkb, gdpk, 2);
+    destroy_e(&Gd);
+    destroy_e(&pkd);
+
+    // Keep the default address in the G_d cache for change outputs
+    gd_cache_put(GD_SAPLING, pkeys->d, G_store.Gdb, true);
+
     PRINTF("pkd %.*H\n", 32, pkeys->pk_d);
     // to_address_bech32(G_context.address, pkeys->d, pkeys->pk_d);
     // PRINTF("address %s\n", G_context.address);
 
-    cx_bn_unlock();
+    bn_session_end();
     ui_menu_main();
 }
 
@@ -255,9 +233,9 @@ void sapling_derive_spending_key(uint8_t account) {
 /// @param sig_hash 
 void sapling_sign(uint8_t *signature, uint8_t *sig_hash) {
     // PRINTF("sig hash %.*H\n", 32, sig_hash);
-    cx_bn_lock(32, 0); 
-    init_mont(fq_m);
-    BN_DEF(rM); cx_bn_alloc_init(&rM, 32, fr_m, 32); // Use scalar field
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FQ));
+    cx_bn_t rM = field_ctx(FIELD_FR)->M; // Use scalar field
 
     // use signature buffer as temporary storage
     // signature has 64 bytes, it will be used to store H* output
@@ -283,7 +261,7 @@ void sapling_sign(uint8_t *signature, uint8_t *sig_hash) {
 
     // rerandomize the authorization key with alpha as ask
     // ask is going to be this signature secret key
-    BN_DEF(ask); cx_bn_init(ask, G_context.exp_sk_info.ask, 32);
+    BN_DEF(ask); cx_bn_init(ask, G_context.keys->exp_sk_info.ask, 32);
     // print_bn("ask", ask);
     cx_bn_mod_add_fixed(ask, ask, rsk, rM); // ask is now re-randomized by alpha
     // print_bn("SK", ask);
@@ -292,8 +270,7 @@ void sapling_sign(uint8_t *signature, uint8_t *sig_hash) {
     // nonce = H*(random|Abar|sig_hash)
     // where Abar = bytes(ask.G)
     jj_e_t ak; alloc_e(&ak);
-    jj_en_t G; alloc_en(&G); load_en(&G, &SPENDING_GEN);
-    en_mul(&ak, &G, ask);
+    en_fixed_base_mult(&ak, SPENDING_GEN_TABLE, ask);
     uint8_t abar[32];
     e_to_bytes(abar, &ak);
     // PRINTF("PK %.*H\n", 32, abar);
@@ -306,7 +283,7 @@ void sapling_sign(uint8_t *signature, uint8_t *sig_hash) {
     reduce_wide_bytes(rsk, signature, rM);
     // print_bn("rsk", rsk);
 
-    en_mul(&ak, &G, rsk); // ak = R = r.G
+    en_fixed_base_mult(&ak, SPENDING_GEN_TABLE, rsk); // ak = R = r.G
     uint8_t rbar[32];
     e_to_bytes(rbar, &ak);
     // PRINTF("Rbar %.*H\n", 32, rbar);
@@ -339,7 +316,14 @@ void sapling_sign(uint8_t *signature, uint8_t *sig_hash) {
     swap_endian(signature + 32, 32);
     // PRINTF("r|s %.*H\n", 64, signature);
 
-    cx_bn_unlock(); // no need to destroy BN individually
+    // free the BN explicitly, the session may be shared by a batch
+    // of signatures
+    cx_bn_destroy(&rsk);
+    cx_bn_destroy(&ask);
+    cx_bn_destroy(&ar);
+    cx_bn_destroy(&temp);
+    destroy_e(&ak);
+    bn_session_end();
 }
 
 void sk_to_pk(uint8_t *pkb, jj_en_t *G, cx_bn_t sk) {
@@ -366,15 +350,13 @@ static void reduce_wide_bytes(cx_bn_t dest, uint8_t *src, cx_bn_t mod) {
 /// @param spk 
 /// @param account 
 /// @return 
-static int derive_spending_key(uint8_t *spk, uint8_t account) {
-    derive_tsk(spk, account);
-
-    cx_blake2b_init2_no_throw(&G_context.hasher, 256,
+static int derive_spending_key(uint8_t *spk, const uint8_t *tsk) {
+    cx_blake2b_init2_no_throw(&G_store.hasher, 256,
                               NULL, 0,
                               (uint8_t *) "ZSaplingSeedHash", 16);
-    cx_hash((cx_hash_t *) &G_context.hasher,
+    cx_hash((cx_hash_t *) &G_store.hasher,
             CX_LAST,
-            spk, 32,
+            (uint8_t *)tsk, 32,
             spk, 32);
     return 0;
 }
@@ -420,16 +402,6 @@ static void destroy_en(jj_en_t *r) {
     cx_bn_destroy(&r->t2d);
 }
 
-/// @brief load ff into bn, convert to MF
-/// @param dest 
-/// @param src 
-static void load_en(jj_en_t *dest, const ff_jj_en_t *src) {
-    cx_bn_init(dest->vpu, src->vpu, 32); TO_MONT(dest->vpu);
-    cx_bn_init(dest->vmu, src->vmu, 32); TO_MONT(dest->vmu);
-    cx_bn_init(dest->z, src->z, 32); TO_MONT(dest->z);
-    cx_bn_init(dest->t2d, src->t2d, 32); TO_MONT(dest->t2d);
-}
-
 /// @brief Multiplies G by sk
 /// @param pk output point in extended coord
 /// @param G generator in extended niels coord
@@ -460,12 +432,122 @@ void en_mul(jj_e_t *pk, jj_en_t *G, cx_bn_t sk) {
     // print_mont("t2", pk->t2);
 }
 
+/// @brief Constant time lookup of |digit|.G in a tooth,
+/// swaps v+u and v-u if the digit is negative
+static void select_en_aff(ff_jj_en_aff_t *res, const ff_jj_en_aff_t *tooth, uint8_t n_entries, int8_t digit) {
+    uint8_t is_neg = (uint8_t)(digit >> 7);
+    uint8_t d = (uint8_t)((digit ^ (int8_t)is_neg) - (int8_t)is_neg);
+    memset(res, 0, sizeof(ff_jj_en_aff_t));
+    for (uint8_t j = 0; j < n_entries; j++) {
+        uint8_t mask = ct_eq_mask(d, j);
+        const uint8_t *e = (const uint8_t *)&tooth[j];
+        uint8_t *r = (uint8_t *)res;
+        for (size_t k = 0; k < sizeof(ff_jj_en_aff_t); k++)
+            r[k] |= e[k] & mask;
+    }
+    // -(u, v) = (-u, v)
+    for (size_t k = 0; k < 32; k++) {
+        uint8_t x = (res->vpu[k] ^ res->vmu[k]) & is_neg;
+        res->vpu[k] ^= x;
+        res->vmu[k] ^= x;
+    }
+}
+
+/// @brief Signed radix-16 digit i of a packed digit string
+static int8_t get_digit(const uint8_t *digits, int i) {
+    uint8_t n = (digits[i / 2] >> ((i & 1) * 4)) & 0x0F;
+    return (int8_t)(n << 4) >> 4;
+}
+
+static void set_digit(uint8_t *digits, int i, int8_t d) {
+    uint8_t shift = (i & 1) * 4;
+    digits[i / 2] = (digits[i / 2] & ~(0x0F << shift)) | (((uint8_t)d & 0x0F) << shift);
+}
+
+/// @brief Multi scalar multiplication of fixed bases by their combs
+/// pk = sum over the combs of digits[t*JJ_FB_SPACING+s].16^s.T[t]
+/// The combs share the same chain of doublings. Every step is a complete
+/// addition, including for zero digits, and the lookups scan the whole
+/// tooth so that the timing does not depend on the digits
+/// @param pk output point in extended coord
+/// @param combs 
+/// @param n_combs
+static void en_msm(jj_e_t *pk, const jj_comb_t *combs, uint8_t n_combs) {
+    e_set0(pk);
+    jj_en_t q; alloc_en(&q);
+    cx_bn_copy(q.z, pk->z); // one
+    BN_DEF(neg);
+    BN_DEF(mask);
+    BN_DEF(temp);
+
+    ff_jj_en_aff_t entry;
+    for (int s = JJ_FB_SPACING - 1; s >= 0; s--) {
+        if (s != JJ_FB_SPACING - 1) {
+            for (int k = 0; k < 4; k++)
+                e_double(pk);
+        }
+        for (uint8_t i = 0; i < n_combs; i++) {
+            const jj_comb_t *c = &combs[i];
+            for (int t = 0; t < c->teeth; t++) {
+                int8_t d = get_digit(c->digits, t * JJ_FB_SPACING + s);
+                select_en_aff(&entry, c->table + t * c->n_entries, c->n_entries, d);
+                // already in Montgomery form
+                cx_bn_init(q.vpu, entry.vpu, 32);
+                cx_bn_init(q.vmu, entry.vmu, 32);
+                cx_bn_init(q.t2d, entry.t2d, 32);
+                cx_bn_mod_sub(neg, zero, q.t2d, M);
+                bn_set_mask(mask, (uint8_t)(d >> 7));
+                bn_cmov(q.t2d, neg, mask, temp);
+                een_add_assign(pk, &q);
+            }
+        }
+    }
+    explicit_bzero(&entry, sizeof(entry));
+
+    destroy_en(&q);
+    cx_bn_destroy(&neg);
+    cx_bn_destroy(&mask);
+    cx_bn_destroy(&temp);
+}
+
+/// @brief Recode a scalar < r into the packed digits of a comb
+/// @param digits JJ_FB_TEETH * JJ_FB_SPACING / 2 bytes
+/// @param sk 
+static void en_recode(uint8_t *digits, cx_bn_t sk) {
+    uint8_t skb[32];
+    int8_t d[JJ_FB_TEETH * JJ_FB_SPACING];
+    cx_bn_export(sk, skb, 32);
+    recode_signed_radix16(d, skb, JJ_FB_TEETH * JJ_FB_SPACING);
+    for (int i = 0; i < JJ_FB_TEETH * JJ_FB_SPACING; i++)
+        set_digit(digits, i, d[i]);
+    explicit_bzero(skb, sizeof(skb));
+    explicit_bzero(d, sizeof(d));
+}
+
+/// @brief Multiplies a fixed generator by sk using its precomputed table
+/// in constant time
+/// @param pk output point in extended coord
+/// @param table comb of the generator, see jubjub_tables.c
+/// @param sk scalar, < r
+void en_fixed_base_mult(jj_e_t *pk, const ff_jj_en_aff_t (*table)[9], cx_bn_t sk) {
+    uint8_t digits[JJ_FB_TEETH * JJ_FB_SPACING / 2];
+    en_recode(digits, sk);
+    jj_comb_t comb = {
+        .table = &table[0][0],
+        .digits = digits,
+        .n_entries = 9,
+        .teeth = JJ_FB_TEETH,
+    };
+    en_msm(pk, &comb, 1);
+    explicit_bzero(digits, sizeof(digits));
+}
+
 /// @brief set r to identity
 /// @param r 
 static void e_set0(jj_e_t *r) {
     // (0, 1, 1, 0, 0)
     cx_bn_set_u32(r->u, 0);
-    cx_bn_set_u32(r->v, 1); TO_MONT(r->v);
+    cx_bn_init(r->v, FQ_ONE, 32);
     cx_bn_copy(r->z, r->v);
     cx_bn_copy(r->t1, r->u);
     cx_bn_copy(r->t2, r->u);
@@ -487,15 +569,13 @@ void e_double(jj_e_t *r) {
     cx_bn_copy(zz2, r->z);
     CX_MUL(temp, zz2, zz2);
     cx_bn_copy(zz2, temp);
-    cx_bn_mod_add_fixed(zz2, zz2, zz2, M);
+    cx_bn_mod_add_lazy(zz2, zz2, zz2, M); // only subtracted from
 
-    BN_DEF(uv2);
-    cx_bn_mod_add_fixed(uv2, r->u, r->v, M);
-    CX_MUL(temp, uv2, uv2);
-    cx_bn_copy(uv2, temp);
+    // t1 = (u + v)^2 - u*u - v*v = 2uv, one multiplication either way
+    CX_MUL(temp, r->u, r->v);
+    cx_bn_mod_add_fixed(r->t1, temp, temp, M);
 
-    BN_DEF(vpu);
-    cx_bn_mod_add_fixed(vpu, vv, uu, M); // vpu = v*v + u*u
+    cx_bn_mod_add_fixed(r->t2, vv, uu, M); // t2 = v*v + u*u
 
     BN_DEF(vmu);
     cx_bn_mod_sub(vmu, vv, uu, M); // vmu = v*v - u*u
@@ -503,8 +583,6 @@ void e_double(jj_e_t *r) {
     BN_DEF(t);
     cx_bn_mod_sub(t, zz2, vmu, M);
 
-    cx_bn_mod_sub(r->t1, uv2, vpu, M);
-    cx_bn_copy(r->t2, vpu);
     CX_MUL(r->u, r->t1, t);
     CX_MUL(r->v, r->t2, vmu);
     CX_MUL(r->z, vmu, t);
@@ -518,8 +596,6 @@ void e_double(jj_e_t *r) {
     cx_bn_destroy(&temp);
     cx_bn_destroy(&t);
     cx_bn_destroy(&vmu);
-    cx_bn_destroy(&vpu);
-    cx_bn_destroy(&uv2);
     cx_bn_destroy(&zz2);
     cx_bn_destroy(&vv);
     cx_bn_destroy(&uu);
@@ -544,7 +620,7 @@ void een_add_assign(jj_e_t *x, jj_en_t *y) {
     CX_MUL(temp, x->t1, x->t2); 
     CX_MUL(c, temp, y->t2d); // c = t1 * t2 * t2d
     CX_MUL(d, x->z, y->z);
-    cx_bn_mod_add_fixed(d, d, d, M); // d = 2zz
+    cx_bn_mod_add_lazy(d, d, d, M); // d = 2zz
 
     BN_DEF(u);
     BN_DEF(v);
@@ -553,7 +629,7 @@ void een_add_assign(jj_e_t *x, jj_en_t *y) {
 
     BN_DEF(z);
     BN_DEF(t);
-    cx_bn_mod_add_fixed(z, d, c, M); // z = d + c
+    cx_bn_mod_add_reduce(z, d, c, temp, M); // z = d + c
     cx_bn_mod_sub(t, d, c, M); // t = d - c
 
     // print_bn("A", a);
@@ -587,7 +663,7 @@ void een_add_assign(jj_e_t *x, jj_en_t *y) {
 /// @param dest 
 /// @param src 
 void e_to_en(jj_en_t *dest, jj_e_t *src) {
-    BN_DEF(D2); cx_bn_init(D2, fq_D2, 32); TO_MONT(D2);
+    BN_DEF(D2); cx_bn_init(D2, FQ_D2, 32);
     BN_DEF(temp);
     cx_bn_mod_add_fixed(dest->vpu, src->v, src->u, M);
     cx_bn_mod_sub(dest->vmu, src->v, src->u, M);
@@ -602,24 +678,39 @@ void e_to_en(jj_en_t *dest, jj_e_t *src) {
 /// @param pkb v coord with highest bit set to the parity of u, in LE
 /// @param p 
 void e_to_bytes(uint8_t *pkb, jj_e_t *p) {
-    BN_DEF(zinv);
-    cx_bn_copy(zinv, p->z);
-    cx_bn_mod_invert_nprime(zinv, zinv, M);
+    e_to_bytes_batch(&pkb, &p, 1);
+}
+
+/// @brief convert several points into their compressed bytes
+/// with a single inversion
+/// @param pkb n buffers of 32 bytes
+/// @param p n points
+/// @param n count, at most FF_BATCH_MAX
+void e_to_bytes_batch(uint8_t *const *pkb, jj_e_t *const *p, uint8_t n) {
+    cx_bn_t z[FF_BATCH_MAX];
+    cx_bn_t zinv[FF_BATCH_MAX];
+    for (uint8_t i = 0; i < n; i++) {
+        z[i] = p[i]->z;
+        CX_THROW(cx_bn_alloc(&zinv[i], 32));
+    }
+    ff_batch_inv(FIELD_FQ, zinv, z, n);
 
     // Do not use the Montgomery Multiplication because
     // zinv contains the 1/h factor equivalent to FROM_MONT
     BN_DEF(u);
-    CX_BN_MOD_MUL(u, p->u, zinv);
     BN_DEF(v);
-    CX_BN_MOD_MUL(v, p->v, zinv);
-
-    bool sign; // put the parity of u into highest bit of v
-    cx_bn_tst_bit(u, 0, &sign);
-    if (sign)
-        cx_bn_set_bit(v, 255);
-    cx_bn_export(v, pkb, 32);
-    swap_endian(pkb, 32); // to LE
-    cx_bn_destroy(&zinv);
+    for (uint8_t i = 0; i < n; i++) {
+        CX_BN_MOD_MUL(u, p[i]->u, zinv[i]);
+        CX_BN_MOD_MUL(v, p[i]->v, zinv[i]);
+
+        bool sign; // put the parity of u into highest bit of v
+        cx_bn_tst_bit(u, 0, &sign);
+        if (sign)
+            cx_bn_set_bit(v, 255);
+        cx_bn_export(v, pkb[i], 32);
+        swap_endian(pkb[i], 32); // to LE
+        cx_bn_destroy(&zinv[i]);
+    }
     cx_bn_destroy(&u);
     cx_bn_destroy(&v);
 }
@@ -629,8 +720,7 @@ void e_to_bytes(uint8_t *pkb, jj_e_t *p) {
 /// @param p 
 void e_to_u(uint8_t *ub, const jj_e_t *p) {
     BN_DEF(zinv);
-    cx_bn_copy(zinv, p->z);
-    cx_bn_mod_invert_nprime(zinv, zinv, M);
+    ff_inv(FIELD_FQ, zinv, p->z);
 
     // Do not use the Montgomery Multiplication because
     // zinv contains the 1/h factor equivalent to FROM_MONT
@@ -661,13 +751,12 @@ int hash_to_e(jj_e_t *p, const uint8_t *msg, size_t len) {
     blake2s_update(&G_store.hash_ctx, msg, len);
     blake2s_final(&G_store.hash_ctx, G_store.hash, 32);
 
-    BN_DEF(one); cx_bn_set_u32(one, 1); TO_MONT(one);
+    BN_DEF(one); cx_bn_init(one, FQ_ONE, 32);
     BN_DEF(v); 
     BN_DEF(temp);
     BN_DEF(v2);
     BN_DEF(v2m1);
-    BN_DEF(D); cx_bn_init(D, fq_D, 32); TO_MONT(D);
-    BN_DEF(u2);
+    BN_DEF(D); cx_bn_init(D, FQ_D, 32);
     BN_DEF(u);
 
     uint8_t sign = G_store.hash[31] >> 7;
@@ -688,19 +777,21 @@ int hash_to_e(jj_e_t *p, const uint8_t *msg, size_t len) {
     cx_bn_mod_sub(v2m1, v2, one, M); // v2-1
 
     CX_MUL(temp, v2, D); //v2*D
-    cx_bn_mod_add_fixed(v2, temp, one, M); //v2*D+1 (*h)
-    cx_bn_mod_invert_nprime(temp, v2, M); // 1/(v2*D+1) (/h)
-
-    // Don't use Mont. Mult because temp has 1/h
-    CX_BN_MOD_MUL(u2, v2m1, temp); // u2 = (v2-1)/(v2*D+1)
-    print_bn("u2", u2);
+    cx_bn_mod_add_fixed(v2, temp, one, M); //v2*D+1
 
-    cx_error = cx_bn_mod_sqrt(u, u2, M, sign);
-    if (cx_error) {
+    // u = sqrt((v2-1)/(v2*D+1))
+    if (!ff_sqrt_ratio(FIELD_FQ, u, v2m1, v2)) {
         cx_error = CX_INVALID_PARAMETER;
         goto end;
     }
-    TO_MONT(u);
+    // pick the root whose parity is the sign bit
+    bool u_odd;
+    cx_bn_copy(temp, u); FROM_MONT(temp);
+    cx_bn_is_odd(temp, &u_odd);
+    if (u_odd != sign) {
+        cx_bn_mod_sub(temp, zero, u, M);
+        cx_bn_copy(u, temp);
+    }
 
     cx_bn_copy(p->u, u);
     cx_bn_copy(p->v, v);
@@ -719,7 +810,6 @@ end:
     cx_bn_destroy(&v2);
     cx_bn_destroy(&v2m1);
     cx_bn_destroy(&D);
-    cx_bn_destroy(&u2);
     cx_bn_destroy(&u);
 
     // PRINTF("vpu %.*H\n", 32, r->vpu);
@@ -790,9 +880,9 @@ static void write_debug_mont(uint8_t label, cx_bn_t x) {
 /// @param rseed 
 /// throws if address is not valid
 void get_cmu(uint8_t *cmu, uint8_t *d, uint8_t *pkd, uint64_t value, uint8_t *rseed) {    
-    cx_bn_lock(32, 0);
-    init_mont(fq_m);
-    BN_DEF(rM); cx_bn_init(rM, fr_m, 32);
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FQ));
+    cx_bn_t rM = field_ctx(FIELD_FR)->M;
     uint8_t rcmb[32];
     BN_DEF(rcm); prf_expand_spending_key(buffer, rseed, 4);
     reduce_wide_bytes(rcm, buffer, rM);
@@ -805,23 +895,28 @@ void get_cmu(uint8_t *cmu, uint8_t *d, uint8_t *pkd, uint64_t value, uint8_t *rs
     update_ph(&G_store.ph, &perso, 6);
     update_ph(&G_store.ph, (uint8_t *)&value, 64); // value
     PRINTF("value %.*H\n", 8, (uint8_t *)&value);
-    jj_e_t Gd; alloc_e(&Gd);
-    CX_THROW(hash_to_e(&Gd, d, 11)); // check if d is a good diversifier
-    e_to_bytes(G_store.Gdb, &Gd);
-    destroy_e(&Gd);
+    if (!gd_cache_get(GD_SAPLING, d, G_store.Gdb)) {
+        jj_e_t Gd; alloc_e(&Gd);
+        CX_THROW(hash_to_e(&Gd, d, 11)); // check if d is a good diversifier
+        e_to_bytes(G_store.Gdb, &Gd);
+        destroy_e(&Gd);
+        gd_cache_put(GD_SAPLING, d, G_store.Gdb, false);
+    }
     PRINTF("Gd %.*H\n", 32, G_store.Gdb);
     update_ph(&G_store.ph, G_store.Gdb, 256); // Gd
     PRINTF("pkd %.*H\n", 32, pkd);
     update_ph(&G_store.ph, pkd, 256); // pkd
-    finalize_ph(&G_store.ph);
-
-    jj_en_t Gcmu; alloc_en(&Gcmu); load_en(&Gcmu, &CMU_RAND_GEN);
-    jj_e_t pkcmu; alloc_e(&pkcmu);
-    en_mul(&pkcmu, &Gcmu, rcm);
-    e_to_en(&Gcmu, &pkcmu);
-    een_add_assign(&G_store.ph.hash, &Gcmu);
-    destroy_en(&Gcmu);
-    destroy_e(&pkcmu);
+    // rcm.CMU_RAND_GEN goes on the same doubling chain as the segments
+    uint8_t rcm_digits[JJ_FB_TEETH * JJ_FB_SPACING / 2];
+    en_recode(rcm_digits, rcm);
+    jj_comb_t rand = {
+        .table = &CMU_RAND_GEN_TABLE[0][0],
+        .digits = rcm_digits,
+        .n_entries = 9,
+        .teeth = JJ_FB_TEETH,
+    };
+    finalize_ph(&G_store.ph, &rand);
+    explicit_bzero(rcm_digits, sizeof(rcm_digits));
 
     print_e(&G_store.ph.hash);
 
@@ -829,28 +924,18 @@ void get_cmu(uint8_t *cmu, uint8_t *d, uint8_t *pkd, uint64_t value, uint8_t *rs
 
     destroy_ph(&G_store.ph);
     cx_bn_destroy(&rcm);
-    cx_bn_destroy(&rM);
-    cx_bn_unlock();
+    bn_session_end();
 }
 
 static void process_chunk(pedersen_state_t *state);
-static void process_acc(pedersen_state_t *state);
 
 void init_ph(pedersen_state_t *state) {
     memset(state, 0, sizeof(pedersen_state_t));
     alloc_e(&state->hash); e_set0(&state->hash);
-    cx_bn_alloc(&state->zero, 32); cx_bn_set_u32(state->zero, 0);
-    cx_bn_alloc(&state->cur, 32); cx_bn_set_u32(state->cur, 1);
-    cx_bn_alloc(&state->acc, 32); cx_bn_set_u32(state->acc, 0);
-    cx_bn_alloc(&state->M, 32); cx_bn_init(state->M, fr_m, 32);
 }
 
 void destroy_ph(pedersen_state_t *state) {
     destroy_e(&state->hash);
-    cx_bn_destroy(&state->zero);
-    cx_bn_destroy(&state->cur);
-    cx_bn_destroy(&state->acc);
-    cx_bn_destroy(&state->M);
 }
 
 void update_ph(pedersen_state_t *state, uint8_t *data, size_t data_bit_len) {
@@ -890,81 +975,287 @@ void update_ph(pedersen_state_t *state, uint8_t *data, size_t data_bit_len) {
     }
 }
 
-void finalize_ph(pedersen_state_t *state) {
+/// @brief Evaluate the hash of every segment, and an optional extra fixed
+/// base term, with a single multi scalar multiplication
+/// @param state 
+/// @param rand extra term, i.e. rcm.CMU_RAND_GEN, or NULL
+void finalize_ph(pedersen_state_t *state, const jj_comb_t *rand) {
     // process the last partial chunk if any
     if (state->bits_in_pack > 0) {
         process_chunk(state);
         state->bits_in_pack = 0;
     }
-    process_acc(state);
+
+    jj_comb_t combs[PH_SEGMENTS + 1];
+    uint8_t n_combs = (state->index_pack + PH_SEGMENT_CHUNKS - 1) / PH_SEGMENT_CHUNKS;
+    for (uint8_t i = 0; i < n_combs; i++) {
+        combs[i].table = &PH_GENS_TABLE[i][0][0];
+        combs[i].digits = state->digits[i];
+        combs[i].n_entries = 5;
+        combs[i].teeth = PH_FB_TEETH;
+    }
+    if (rand != NULL)
+        combs[n_combs++] = *rand;
+    en_msm(&state->hash, combs, n_combs);
     print_e(&state->hash);
 }
 
+/// @brief encode 3 bits as a digit in [-4, 4] and buffer it
+/// The generator of chunk j of segment i is 2^(4j).PH_GENS[i], i.e.
+/// the chunks are the radix-16 digits of the scalar of the segment
+/// @param state 
 static void process_chunk(pedersen_state_t *state) {
     uint8_t c = state->current_pack;
-    // accumulate 3 bits into state->acc
-    // scale state->cur
-    BN_DEF(temp); cx_bn_copy(temp, state->cur); // temp = cur
-    if ((c & 1) != 0) {
-        // PRINTF("+");
-        cx_bn_mod_add_fixed(temp, temp, state->cur, state->M); // temp += cur
-    }
-    cx_bn_mod_add_fixed(state->cur, state->cur, state->cur, state->M); // double cur
-    if ((c & 2) != 0) {
-        // PRINTF("+");
-        cx_bn_mod_add_fixed(temp, temp, state->cur, state->M); // temp += cur
-    }
-    if ((c & 4) != 0) {
-        // PRINTF("-");
-        cx_bn_mod_sub(temp, state->zero, temp, state->M); // temp = -temp
-    }
-    cx_bn_mod_add_fixed(state->cur, state->cur, state->cur, state->M); // double cur
-    cx_bn_mod_add_fixed(state->cur, state->cur, state->cur, state->M); // double cur
-    cx_bn_mod_add_fixed(state->cur, state->cur, state->cur, state->M); // double cur
-    // PRINTF("=\n");
-    // print_bn("temp", temp);
-    cx_bn_mod_add_fixed(state->acc, state->acc, temp, state->M); // acc += temp
-    cx_bn_destroy(&temp);
-
-    if (state->index_pack % 63 == 62) {
-        process_acc(state);
-        cx_bn_set_u32(state->acc, 0);
-        cx_bn_set_u32(state->cur, 1);
-    }
-
+    int8_t enc = 1 + (c & 1) + (c & 2); // 1 + b0 + 2.b1
+    if ((c & 4) != 0)
+        enc = -enc;
+    uint8_t segment = state->index_pack / PH_SEGMENT_CHUNKS;
+    if (segment >= PH_SEGMENTS)
+        THROW(EXCEPTION_OVERFLOW);
+    set_digit(state->digits[segment], state->index_pack % PH_SEGMENT_CHUNKS, enc);
     state->index_pack++;
 }
 
-/// @brief process a group of 63 chunks, use one of the PH generators
-/// we need 4 points for the data that we hash
-/// @param state 
-static void process_acc(pedersen_state_t *state) {
-    print_bn("acc", state->acc);
-    uint8_t index_gen = state->index_pack / 63;
-    jj_en_t G; alloc_en(&G); load_en(&G, &PH_GENS[index_gen]);
-    jj_e_t pk; alloc_e(&pk);
-    en_mul(&pk, &G, state->acc);
-    e_to_en(&G, &pk);
-    een_add_assign(&state->hash, &G);
-    destroy_e(&pk);
-    destroy_en(&G);
-}
-
 #ifdef TEST
 int test_cmu(uint8_t *data) {
     pdebug = debug;
-    cx_bn_lock(32, 0);
-    init_mont(fq_m);
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FQ));
     PRINTF("init ph\n");
     init_ph(&G_store.ph);
     uint8_t perso = 0x3F;
     update_ph(&G_store.ph, &perso, 6);
     update_ph(&G_store.ph, data, (8+32+32)*8);
-    finalize_ph(&G_store.ph);
+    finalize_ph(&G_store.ph, NULL);
     uint8_t cmu[32];
     e_to_u(cmu, &G_store.ph.hash);
     PRINTF("cmu %.*H\n", 32, cmu);
-    cx_bn_unlock();
+    destroy_ph(&G_store.ph);
+    bn_session_end();
     return helper_send_response_bytes(debug, 250);
 }
+
+/// @brief load ff into bn, convert to MF
+/// @param dest 
+/// @param src 
+static void load_en(jj_en_t *dest, const ff_jj_en_t *src) {
+    cx_bn_init(dest->vpu, src->vpu, 32); TO_MONT(dest->vpu);
+    cx_bn_init(dest->vmu, src->vmu, 32); TO_MONT(dest->vmu);
+    cx_bn_init(dest->z, src->z, 32); TO_MONT(dest->z);
+    cx_bn_init(dest->t2d, src->t2d, 32); TO_MONT(dest->t2d);
+}
+
+bool test_jubjub_consts() {
+    bool ok = true;
+    int diff;
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FQ));
+    BN_DEF(one); cx_bn_init(one, FQ_ONE, 32);
+    BN_DEF(d); cx_bn_init(d, FQ_D, 32);
+    BN_DEF(d2); cx_bn_init(d2, FQ_D2, 32);
+    BN_DEF(t);
+    BN_DEF(lhs);
+    BN_DEF(rhs);
+
+    // FQ_ONE is 1 in MF, FQ_D2 = 2.FQ_D
+    cx_bn_copy(t, one); FROM_MONT(t);
+    cx_bn_cmp_u32(t, 1, &diff);
+    ok = ok && diff == 0;
+    cx_bn_mod_add_fixed(t, d, d, M);
+    cx_bn_cmp(t, d2, &diff);
+    ok = ok && diff == 0;
+
+    // With a = v + u and b = v - u, the curve equation
+    // -u^2 + v^2 = 1 + d.u^2.v^2 is 16.a.b = 16 + d.(a^2 - b^2)^2
+    // and t2d = 2d.u.v = d.(a^2 - b^2)/2
+    const ff_jj_en_t *gens[3 + PH_SEGMENTS] = {&SPENDING_GEN, &PROOF_GEN, &CMU_RAND_GEN,
+        &PH_GENS[0], &PH_GENS[1], &PH_GENS[2], &PH_GENS[3]};
+    jj_en_t G; alloc_en(&G);
+    for (int i = 0; i < 3 + PH_SEGMENTS; i++) {
+        load_en(&G, gens[i]);
+        CX_MUL(lhs, G.vpu, G.vpu);
+        CX_MUL(rhs, G.vmu, G.vmu);
+        cx_bn_mod_sub(t, lhs, rhs, M); // a^2 - b^2
+
+        cx_bn_mod_add_fixed(lhs, G.t2d, G.t2d, M);
+        CX_MUL(rhs, d, t);
+        cx_bn_cmp(lhs, rhs, &diff);
+        ok = ok && diff == 0;
+
+        CX_MUL(rhs, t, t);
+        CX_MUL(t, rhs, d);
+        cx_bn_copy(rhs, one);
+        for (int k = 0; k < 4; k++)
+            cx_bn_mod_add_fixed(rhs, rhs, rhs, M);
+        cx_bn_mod_add_fixed(rhs, rhs, t, M);
+        CX_MUL(lhs, G.vpu, G.vmu);
+        for (int k = 0; k < 4; k++)
+            cx_bn_mod_add_fixed(lhs, lhs, lhs, M);
+        cx_bn_cmp(lhs, rhs, &diff);
+        ok = ok && diff == 0;
+    }
+
+    destroy_en(&G);
+    cx_bn_destroy(&one);
+    cx_bn_destroy(&d);
+    cx_bn_destroy(&d2);
+    cx_bn_destroy(&t);
+    cx_bn_destroy(&lhs);
+    cx_bn_destroy(&rhs);
+    bn_session_end();
+    return ok;
+}
+
+bool test_jubjub_fixed_base() {
+    const ff_jj_en_aff_t (*tables[3])[9] = {SPENDING_GEN_TABLE, PROOF_GEN_TABLE, CMU_RAND_GEN_TABLE};
+    const ff_jj_en_t *gens[3] = {&SPENDING_GEN, &PROOF_GEN, &CMU_RAND_GEN};
+    uint8_t r1[32];
+    memmove(r1, fr_m, 32); r1[31] -= 1; // r - 1
+    uint8_t pb[32], pb_ref[32];
+    bool ok = true;
+
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FQ));
+    cx_bn_t rM = field_ctx(FIELD_FR)->M;
+    BN_DEF(sk);
+    jj_en_t G; alloc_en(&G);
+    jj_e_t p; alloc_e(&p);
+    jj_e_t p_ref; alloc_e(&p_ref);
+    for (int i = 0; i < 3; i++) {
+        load_en(&G, gens[i]);
+        // 1, r - 1 and a random scalar
+        for (int j = 0; j < 3; j++) {
+            if (j == 0)
+                cx_bn_set_u32(sk, 1);
+            else if (j == 1)
+                cx_bn_init(sk, r1, 32);
+            else
+                cx_bn_rng(sk, rM);
+            en_fixed_base_mult(&p, tables[i], sk);
+            en_mul(&p_ref, &G, sk);
+            e_to_bytes(pb, &p);
+            e_to_bytes(pb_ref, &p_ref);
+            ok = ok && memcmp(pb, pb_ref, 32) == 0;
+        }
+    }
+    cx_bn_destroy(&sk);
+    destroy_en(&G);
+    destroy_e(&p);
+    destroy_e(&p_ref);
+    bn_session_end();
+    return ok;
+}
+
+bool test_jubjub_order() {
+    uint8_t r1[32];
+    memmove(r1, fr_m, 32); r1[31] -= 1; // r - 1
+    uint8_t pb[32];
+    uint8_t id[32] = {1}; // (0, 1)
+
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FQ));
+    BN_DEF(sk);
+    jj_en_t G; alloc_en(&G);
+    jj_e_t p; alloc_e(&p);
+    jj_e_t p1; alloc_e(&p1);
+    load_en(&G, &SPENDING_GEN);
+    cx_bn_set_u32(sk, 1);
+    en_mul(&p1, &G, sk);
+    cx_bn_init(sk, r1, 32);
+    en_mul(&p, &G, sk);
+    e_to_en(&G, &p);
+    een_add_assign(&p1, &G);
+    e_to_bytes(pb, &p1);
+
+    cx_bn_destroy(&sk);
+    destroy_en(&G);
+    destroy_e(&p);
+    destroy_e(&p1);
+    bn_session_end();
+    return memcmp(pb, id, 32) == 0;
+}
+
+/// @brief Bit i of perso (0x3F, 6 bits) || data, 0 past the end
+static uint32_t ph_bit(const uint8_t *data, size_t i, size_t bit_len) {
+    if (i >= bit_len) return 0;
+    if (i < 6) return 1;
+    i -= 6;
+    return (data[i / 8] >> (i % 8)) & 1;
+}
+
+bool test_pedersen_hash() {
+    // 574 bits with the perso: 4 segments, the last chunk is partial
+    uint8_t data[71];
+    size_t bit_len = 6 + sizeof(data) * 8;
+    cx_get_random_bytes(data, sizeof(data));
+
+    bn_session_begin();
+    use_field(field_ctx(FIELD_FQ));
+    cx_bn_t rM = field_ctx(FIELD_FR)->M;
+
+    // rcm.CMU_RAND_GEN shares the doubling chain of the segments, as in get_cmu
+    BN_DEF(rcm); cx_bn_rng(rcm, rM);
+    uint8_t rcm_digits[JJ_FB_TEETH * JJ_FB_SPACING / 2];
+    en_recode(rcm_digits, rcm);
+    jj_comb_t rand = {
+        .table = &CMU_RAND_GEN_TABLE[0][0],
+        .digits = rcm_digits,
+        .n_entries = 9,
+        .teeth = JJ_FB_TEETH,
+    };
+
+    init_ph(&G_store.ph);
+    uint8_t perso = 0x3F;
+    update_ph(&G_store.ph, &perso, 6);
+    update_ph(&G_store.ph, data, sizeof(data) * 8);
+    finalize_ph(&G_store.ph, &rand);
+
+    // rcm.CMU_RAND_GEN plus the sum over the segments of s.PH_GENS[i], where
+    // s is the sum over the chunks of enc(chunk j).2^(4j), with one en_mul per term
+    jj_e_t acc; alloc_e(&acc);
+    jj_e_t p; alloc_e(&p);
+    jj_en_t G; alloc_en(&G);
+    load_en(&G, &CMU_RAND_GEN);
+    en_mul(&acc, &G, rcm);
+    BN_DEF(sc);
+    BN_DEF(pow16);
+    BN_DEF(enc);
+    BN_DEF(temp);
+    size_t n_chunks = (bit_len + 2) / 3;
+    for (size_t k = 0; k < n_chunks; k += PH_SEGMENT_CHUNKS) {
+        cx_bn_set_u32(sc, 0);
+        cx_bn_set_u32(pow16, 1);
+        for (size_t c = k; c < k + PH_SEGMENT_CHUNKS && c < n_chunks; c++) {
+            cx_bn_set_u32(enc, 1 + ph_bit(data, 3 * c, bit_len) + 2 * ph_bit(data, 3 * c + 1, bit_len));
+            cx_bn_mod_mul(temp, enc, pow16, rM);
+            if (ph_bit(data, 3 * c + 2, bit_len))
+                cx_bn_mod_sub(sc, sc, temp, rM);
+            else
+                cx_bn_mod_add_fixed(sc, sc, temp, rM);
+            cx_bn_set_u32(enc, 16);
+            cx_bn_mod_mul(temp, pow16, enc, rM);
+            cx_bn_copy(pow16, temp);
+        }
+        load_en(&G, &PH_GENS[k / PH_SEGMENT_CHUNKS]);
+        en_mul(&p, &G, sc);
+        e_to_en(&G, &p);
+        een_add_assign(&acc, &G);
+    }
+
+    uint8_t hb[32], accb[32];
+    e_to_bytes(hb, &G_store.ph.hash);
+    e_to_bytes(accb, &acc);
+
+    destroy_ph(&G_store.ph);
+    cx_bn_destroy(&rcm);
+    destroy_e(&acc);
+    destroy_e(&p);
+    destroy_en(&G);
+    cx_bn_destroy(&sc);
+    cx_bn_destroy(&pow16);
+    cx_bn_destroy(&enc);
+    cx_bn_destroy(&temp);
+    bn_session_end();
+    return memcmp(hb, accb, 32) == 0;
+}
 #endif
@@ -2,12 +2,33 @@
 
 #include <stdint.h>   // uint*_t
 
-void sapling_derive_spending_key(uint8_t account);
+void sapling_derive_spending_key(const uint8_t *tsk);
 void get_cmu(uint8_t *cmu, uint8_t *d, uint8_t *pkd, uint64_t value, uint8_t *rseed);
 void sapling_sign(uint8_t *signature, uint8_t *sig_hash);
 
 int test_cmu(uint8_t *data);
 
+/// @brief Check FQ_ONE, FQ_D and FQ_D2, which are in Montgomery form,
+/// against the generators of sapling.h which are not
+/// @return true if the generators are on the curve
+bool test_jubjub_consts();
+
+/// @brief Check the fixed base tables of SPENDING_GEN, PROOF_GEN and
+/// CMU_RAND_GEN against en_mul for 1, r - 1 and a random scalar
+/// @return true if the points are the same
+bool test_jubjub_fixed_base();
+
+/// @brief Check that (r - 1).G + G is the identity, where the doublings
+/// and additions of en_mul and een_add_assign use lazy reductions
+/// @return true if it is
+bool test_jubjub_order();
+
+/// @brief Check the Pedersen hash of a random message and a random
+/// rcm.CMU_RAND_GEN term against one en_mul of PH_GENS per segment, with
+/// the chunks encoded from the message bits, and one en_mul for rcm
+/// @return true if the points are the same
+bool test_pedersen_hash();
+
 typedef struct {
     cx_bn_t u;
     cx_bn_t v;
@@ -30,6 +51,54 @@ typedef struct {
     uint8_t t2d[32]; // t1.t2.2d
 } ff_jj_en_t; // same as jj_en_t without BN
 
+typedef struct {
+    uint8_t vpu[32]; // v+u
+    uint8_t vmu[32]; // v-u
+    uint8_t t2d[32]; // u.v.2d
+} ff_jj_en_aff_t; // extended niels with z = 1
+
+/// Fixed base tables are combs of signed radix-16 digits
+/// Tooth t holds j.16^(t*JJ_FB_SPACING).G for j in [0, 9), entry 0
+/// being the identity. Every tooth is 864 bytes of flash, every extra
+/// unit of spacing costs 4 doublings
+#ifdef NO_MONTGOMERY
+#define JJ_FB_SPACING 22
+#else
+#define JJ_FB_SPACING 4
+#endif
+#define JJ_FB_DIGITS 65 // scalars < r < 2^252
+#define JJ_FB_TEETH ((JJ_FB_DIGITS + JJ_FB_SPACING - 1) / JJ_FB_SPACING)
+
+/// @brief Precomputed multiples of SPENDING_GEN, PROOF_GEN and CMU_RAND_GEN
+/// see jubjub_tables.c
+extern const ff_jj_en_aff_t SPENDING_GEN_TABLE[JJ_FB_TEETH][9];
+extern const ff_jj_en_aff_t PROOF_GEN_TABLE[JJ_FB_TEETH][9];
+extern const ff_jj_en_aff_t CMU_RAND_GEN_TABLE[JJ_FB_TEETH][9];
+
+/// @brief 1, d and 2.d in Fq, in Montgomery form, see jubjub_tables.c
+/// JJ is a twisted Edward curve: -u^2 + v^2 = 1 + d.u^2.v^2
+extern const uint8_t FQ_ONE[32];
+extern const uint8_t FQ_D[32];
+extern const uint8_t FQ_D2[32];
+
+/// Pedersen hash segments have 63 chunks, each encoded as a digit in [-4, 4]
+#define PH_SEGMENT_CHUNKS 63
+#define PH_FB_TEETH ((PH_SEGMENT_CHUNKS + JJ_FB_SPACING - 1) / JJ_FB_SPACING)
+
+#define PH_SEGMENTS 4
+#define PH_DIGITS_LEN (PH_FB_TEETH * JJ_FB_SPACING / 2) // JJ_FB_SPACING is even
+
+/// @brief Precomputed multiples of PH_GENS, one comb per segment
+extern const ff_jj_en_aff_t PH_GENS_TABLE[PH_SEGMENTS][PH_FB_TEETH][5];
+
+/// @brief A fixed base term of a multi scalar multiplication
+typedef struct {
+    const ff_jj_en_aff_t *table; // teeth * n_entries points, entry j of tooth t is j.16^(t*JJ_FB_SPACING).G
+    const uint8_t *digits;       // teeth * JJ_FB_SPACING radix-16 digits in [-8, 8), two per byte, low nibble first
+    uint8_t n_entries;
+    uint8_t teeth;
+} jj_comb_t;
+
 /// @brief Generator point for the spending authorization key pair
 /// in Niels form
 static const ff_jj_en_t SPENDING_GEN = {
@@ -17,7 +17,8 @@
 
 #include <stdint.h>   // uint*_t
 #include <string.h>   // memset, explicit_bzero
-#include <os.h>       // sprintf
+#include <stdbool.h>  // bool
+#include <os.h>       // sprintf, cx_get_random_bytes
 #include "sinsemilla.h"
 #include "pallas.h"
 
@@ -27,7 +28,8 @@
 
 void init_sinsemilla(sinsemilla_state_t *state, jac_p_t *Q) {
     memset(state, 0, sizeof(sinsemilla_state_t));
-    memmove(&state->p, Q, sizeof(jac_p_t));
+    bn_session_begin(); // until finalize_sinsemilla
+    pallas_jac_load(&state->acc, Q);
 }
 
 void hash_sinsemilla(sinsemilla_state_t *state, uint8_t *data, size_t data_bit_len) {
@@ -59,12 +61,7 @@ void hash_sinsemilla(sinsemilla_state_t *state, uint8_t *data, size_t data_bit_l
             // if the pack is full, emit it
             if (state->bits_in_pack == 10) {
                 // PRINTF("Pack %04X\n", state->current_pack);
-                jac_p_t S;
-                sinsemilla_S(&S, state->current_pack);
-                jac_p_t acc;
-                pallas_copy_jac(&acc, &state->p);
-                pallas_add_assign(&state->p, &S);
-                pallas_add_assign(&state->p, &acc);
+                pallas_sinsemilla_step(&state->acc, &SINSEMILLA_S[state->current_pack & 0x3FF]);
                 state->bits_in_pack = 0;
                 state->current_pack = 0;
             }
@@ -72,22 +69,48 @@ void hash_sinsemilla(sinsemilla_state_t *state, uint8_t *data, size_t data_bit_l
     }
 }
 
-void finalize_sinsemilla(sinsemilla_state_t *state, uint8_t *hash) {
+void finalize_sinsemilla(sinsemilla_state_t *state, jac_p_t *res) {
     if (state->bits_in_pack > 0) {
         // PRINTF("Pack 0x%04X\n", state->current_pack);
-        jac_p_t S;
-        sinsemilla_S(&S, state->current_pack);
-        jac_p_t acc;
-        pallas_copy_jac(&acc, &state->p);
-        pallas_add_assign(&state->p, &S);
-        pallas_add_assign(&state->p, &acc);
-        if (hash)
-            pallas_to_bytes(hash, &state->p);
+        pallas_sinsemilla_step(&state->acc, &SINSEMILLA_S[state->current_pack & 0x3FF]);
         state->bits_in_pack = 0;
     }
+    pallas_jac_store(res, &state->acc);
+    bn_session_end();
 }
 
-void init_commit(sinsemilla_state_t *state, uint8_t *perso_M, size_t perso_len) {
+static void aff_to_jac(jac_p_t *res, const aff_p_t *p) {
+    memmove(res->x, p->x, 32);
+    memmove(res->y, p->y, 32);
+    memset(res->z, 0, 32);
+    res->z[31] = 1;
+}
+
+static void commit(sinsemilla_state_t *state, jac_p_t *R, fv_t *v, uint8_t *hash) {
+    jac_p_t p;
+    finalize_sinsemilla(state, &p);
+    jac_p_t r;
+    pallas_base_mult(&r, R, v);
+    pallas_add_assign(&r, &p);
+    pallas_to_bytes(hash, &r);
+    swap_endian(hash, 32);
+    hash[0] &= 0x7F;
+}
+
+void init_commit(sinsemilla_state_t *state, sinsemilla_perso_e perso) {
+    jac_p_t Q;
+    aff_to_jac(&Q, &SINSEMILLA_Q[perso]);
+    init_sinsemilla(state, &Q);
+}
+
+void finalize_commit(sinsemilla_state_t *state, sinsemilla_perso_e perso, fv_t *v, uint8_t *hash) {
+    jac_p_t R;
+    aff_to_jac(&R, &SINSEMILLA_R[perso]);
+    commit(state, &R, v, hash);
+}
+
+#ifdef TEST
+void init_commit_perso(sinsemilla_state_t *state, uint8_t *perso_M, size_t perso_len) {
     jac_p_t Q;
     hash_to_curve(&Q, 
         (uint8_t *)"z.cash:SinsemillaQ", 18,
@@ -96,24 +119,94 @@ void init_commit(sinsemilla_state_t *state, uint8_t *perso_M, size_t perso_len)
     init_sinsemilla(state, &Q);
 }
 
-void finalize_commit(sinsemilla_state_t *state, uint8_t *perso_r, size_t perso_len, fv_t *v, uint8_t *hash) {
-    finalize_sinsemilla(state, NULL);
+void finalize_commit_perso(sinsemilla_state_t *state, uint8_t *perso_r, size_t perso_len, fv_t *v, uint8_t *hash) {
     jac_p_t R;
     hash_to_curve(&R, 
         perso_r, perso_len,
         NULL, 0);
-    jac_p_t r;
-    pallas_base_mult(&r, &R, v);
-    pallas_add_assign(&r, &state->p);
-    pallas_to_bytes(hash, &r);
-    swap_endian(hash, 32);
-    hash[0] &= 0x7F;
+    commit(state, &R, v, hash);
 }
 
-void sinsemilla_S(jac_p_t *S, uint32_t i) {
-    hash_to_curve(S, 
-        (uint8_t *)"z.cash:SinsemillaS", 18,
-        (uint8_t *)&i, 4);
+static bool commit_both(sinsemilla_perso_e perso, uint8_t *perso_M, uint8_t *perso_r, size_t perso_len,
+    uint8_t *msg, size_t msg_bit_len, fv_t *v) {
+    sinsemilla_state_t state;
+    uint8_t hash[32];
+    uint8_t hash_ref[32];
+
+    init_commit(&state, perso);
+    hash_sinsemilla(&state, msg, msg_bit_len);
+    finalize_commit(&state, perso, v, hash);
+
+    init_commit_perso(&state, perso_M, perso_len);
+    hash_sinsemilla(&state, msg, msg_bit_len);
+    finalize_commit_perso(&state, perso_r, perso_len, v, hash_ref);
+
+    return memcmp(hash, hash_ref, 32) == 0;
 }
 
+bool test_sinsemilla_bases() {
+    uint8_t msg[8];
+    fv_t v;
+    cx_get_random_bytes(msg, sizeof(msg));
+    cx_get_random_bytes(v, 32);
+    v[0] &= 0x3F; // < v
+
+    // 61 bits: the last pack is partial
+    return commit_both(SINSEMILLA_NOTE_COMMIT,
+            (uint8_t *)"z.cash:Orchard-NoteCommit-M", (uint8_t *)"z.cash:Orchard-NoteCommit-r", 27,
+            msg, 61, &v) &&
+        commit_both(SINSEMILLA_COMMIT_IVK,
+            (uint8_t *)"z.cash:Orchard-CommitIvk-M", (uint8_t *)"z.cash:Orchard-CommitIvk-r", 26,
+            msg, 61, &v);
+}
+
+/// @brief Pack k of a message, bits past the end are 0
+static uint16_t get_pack(const uint8_t *msg, size_t k, size_t bit_len) {
+    uint16_t m = 0;
+    for (int j = 0; j < 10; j++) {
+        size_t i = k * 10 + j;
+        if (i < bit_len && ((msg[i / 8] >> (i % 8)) & 1) != 0)
+            m |= 1 << j;
+    }
+    return m;
+}
+
+bool test_sinsemilla_s() {
+    // packs 0 and 1023, a random pack and a partial one of 6 bits
+    uint8_t msg[5];
+    size_t bit_len = 36;
+    cx_get_random_bytes(msg, sizeof(msg));
+    msg[0] = 0;
+    msg[1] |= 0xFC;
+    msg[1] &= 0xFC;
+    msg[2] |= 0x0F;
+
+    jac_p_t Q;
+    aff_to_jac(&Q, &SINSEMILLA_Q[SINSEMILLA_NOTE_COMMIT]);
+    sinsemilla_state_t state;
+    jac_p_t hash;
+    init_sinsemilla(&state, &Q);
+    hash_sinsemilla(&state, msg, bit_len);
+    finalize_sinsemilla(&state, &hash);
+
+    // acc = (acc + S(m)) + acc with S(m) = hash_to_curve("z.cash:SinsemillaS", LE32(m))
+    jac_p_t acc, s, t;
+    pallas_copy_jac(&acc, &Q);
+    for (size_t k = 0; k < (bit_len + 9) / 10; k++) {
+        uint16_t m = get_pack(msg, k, bit_len);
+        uint8_t i[4] = {m & 0xFF, m >> 8, 0, 0};
+        hash_to_curve(&s, (uint8_t *)"z.cash:SinsemillaS", 18, i, 4);
+        pallas_copy_jac(&t, &acc);
+        pallas_add_assign(&t, &s);
+        pallas_add_assign(&t, &acc);
+        pallas_copy_jac(&acc, &t);
+    }
+
+    uint8_t hb[32], accb[32];
+    pallas_to_bytes(hb, &hash);
+    pallas_to_bytes(accb, &acc);
+    return memcmp(hb, accb, 32) == 0;
+}
+#endif
+
 #endif
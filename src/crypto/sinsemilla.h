@@ -1,19 +1,28 @@
 #pragma once
 
 #include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
 #include "fr.h"
 #include "pallas.h"
 
 /// Sinsemilla Commitment
 
+/// @brief Personalizations of the Sinsemilla commitments
+typedef enum {
+    SINSEMILLA_NOTE_COMMIT, // z.cash:Orchard-NoteCommit
+    SINSEMILLA_COMMIT_IVK,  // z.cash:Orchard-CommitIvk
+    SINSEMILLA_PERSO_COUNT
+} sinsemilla_perso_e;
+
 /// @brief  State of the Sinsemilla Hasher
 typedef struct {
-    jac_p_t p;
+    jac_p_bn_t acc; // in the BN unit, Montgomery form
     uint16_t current_pack;
     int bits_in_pack;
 } sinsemilla_state_t;
 
 /// @brief Initialize 
+/// Opens a BN session that lasts until finalize_sinsemilla
 /// @param state 
 /// @param Q 
 void init_sinsemilla(sinsemilla_state_t *state, jac_p_t *Q);
@@ -23,24 +32,54 @@ void init_sinsemilla(sinsemilla_state_t *state, jac_p_t *Q);
 /// @param data 
 /// @param data_bit_len Length is BITS
 void hash_sinsemilla(sinsemilla_state_t *state, uint8_t *data, size_t data_bit_len);
-void finalize_sinsemilla(sinsemilla_state_t *state, uint8_t *hash);
 
-/// @brief Return S value (used internally by hasher)
-/// @param S 
-/// @param i 
-void sinsemilla_S(jac_p_t *S, uint32_t i);
+/// @brief Process the remaining bits and export the hash point
+/// @param state 
+/// @param res 
+void finalize_sinsemilla(sinsemilla_state_t *state, jac_p_t *res);
+
+/// @brief Precomputed S values, see sinsemilla_s.c
+extern const aff_p_t SINSEMILLA_S[1024];
+
+/// @brief Precomputed Q and R bases of the commitments, see sinsemilla_s.c
+extern const aff_p_t SINSEMILLA_Q[SINSEMILLA_PERSO_COUNT];
+extern const aff_p_t SINSEMILLA_R[SINSEMILLA_PERSO_COUNT];
 
 /// @brief Initialize the Sinemilla Hasher
 /// @param state 
+/// @param perso Personalization ID
+void init_commit(sinsemilla_state_t *state, sinsemilla_perso_e perso);
+
+/// @brief Finish and get the hash value
+/// @param state 
+/// @param perso Personalization ID, same as init_commit
+/// @param v key
+/// @param hash output hash value 
+void finalize_commit(sinsemilla_state_t *state, sinsemilla_perso_e perso, fv_t *v, uint8_t *hash);
+
+#ifdef TEST
+/// @brief Same as init_commit with an arbitrary personalization,
+/// Q is computed with hash_to_curve
+/// @param state 
 /// @param perso_M 
 /// @param perso_len 
-void init_commit(sinsemilla_state_t *state, uint8_t *perso_M, size_t perso_len);
+void init_commit_perso(sinsemilla_state_t *state, uint8_t *perso_M, size_t perso_len);
 
-/// @brief Finish and get the hash value
+/// @brief Same as finalize_commit with an arbitrary personalization
 /// @param state 
 /// @param perso_r Personalization
 /// @param perso_len Length in bytes
 /// @param v key
 /// @param hash output hash value 
-/// @remark state.p has the hash point
-void finalize_commit(sinsemilla_state_t *state, uint8_t *perso_r, size_t perso_len, fv_t *v, uint8_t *hash);
+void finalize_commit_perso(sinsemilla_state_t *state, uint8_t *perso_r, size_t perso_len, fv_t *v, uint8_t *hash);
+
+/// @brief Check the precomputed Q and R of both personalizations
+/// against the bases computed by hash_to_curve
+/// @return true if the commitments of a random message are the same
+bool test_sinsemilla_bases();
+
+/// @brief Check the S table and the accumulator of the hasher against
+/// the definition of the hash, with S computed by hash_to_curve
+/// @return true if the hash points of a random message are the same
+bool test_sinsemilla_s();
+#endif
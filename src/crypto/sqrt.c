@@ -0,0 +1,265 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+#include <stdint.h>   // uint*_t
+#include <string.h>   // memset, explicit_bzero
+#include <stdbool.h>  // bool
+#include <os.h>
+#include <ox_bn.h>
+
+#include "fr.h"
+#include "sqrt.h"
+
+#include "mont.h"
+
+/**
+ * Square root for fields with p - 1 = 2^32.T, T odd (Sarkar, eprint 2020/1407)
+ *
+ * Let u = num/div. Without inverting div (BDLSY, pasta_curves):
+ *   s = div^(2^32-1), w = (s^2.div.num)^((T-1)/2).s
+ *   v = w.div = u^((T-1)/2), uv = w.num = u^((T+1)/2)
+ * x = uv.v = u^T is a 2^32-th root of unity g^k. k is found 4 bits at a time
+ * from the bottom: x^(2^(28-4i)) multiplied by the inverse powers of g of the
+ * digits already known is a 16-th root of unity, looked up in SQRT_ROOTS[7].
+ * Then uv/g^(k/2) squares to u if k is even, to g.u if it is odd.
+ *
+ * Table entries are read and compared in full, outside of the BN unit, so
+ * that the memory accesses do not depend on the digits.
+*/
+
+static void sqr_n(cx_bn_t a, cx_bn_t temp, int n) {
+    for (int i = 0; i < n; i++) {
+        CX_MUL(temp, a, a);
+        cx_bn_copy(a, temp);
+    }
+}
+
+static void mul_assign(cx_bn_t a, cx_bn_t b, cx_bn_t temp) {
+    CX_MUL(temp, a, b);
+    cx_bn_copy(a, temp);
+}
+
+/// @brief r = row[d], reading every entry
+static void load_root(cx_bn_t r, const uint8_t (*row)[32], uint8_t d) {
+    uint8_t v[32];
+    memset(v, 0, 32);
+    for (uint8_t j = 0; j < 16; j++) {
+        uint8_t mask = ct_eq_mask(j, d);
+        for (int i = 0; i < 32; i++)
+            v[i] |= row[j][i] & mask;
+    }
+    cx_bn_init(r, v, 32);
+    explicit_bzero(v, 32);
+}
+
+/// @brief d such that row[d] == y, comparing every entry. 0 if none
+static uint8_t find_root(const uint8_t (*row)[32], const uint8_t *y) {
+    uint8_t d = 0;
+    for (uint8_t j = 0; j < 16; j++) {
+        uint8_t diff = 0;
+        for (int i = 0; i < 32; i++)
+            diff |= row[j][i] ^ y[i];
+        d |= j & ct_eq_mask(diff, 0);
+    }
+    return d;
+}
+
+bool ff_sqrt_ratio(field_e f, cx_bn_t r, cx_bn_t num, cx_bn_t div) {
+    const uint8_t *exp;
+    const uint8_t (*roots)[16][32];
+    switch (f) {
+#ifdef ORCHARD
+        case FIELD_FP:
+            exp = SQRT_FP_EXP;
+            roots = SQRT_FP_ROOTS;
+            break;
+#endif
+        case FIELD_FQ:
+            exp = SQRT_FQ_EXP;
+            roots = SQRT_FQ_ROOTS;
+            break;
+        default:
+            THROW(CX_INVALID_PARAMETER);
+    }
+
+    bn_session_begin();
+    use_field(field_ctx(f));
+    BN_DEF(s);
+    BN_DEF(t);
+    BN_DEF(w);
+    BN_DEF(uv);
+    BN_DEF(temp);
+
+    // s = div^(2^32-1), by doubling the run of ones 5 times
+    cx_bn_copy(s, div);
+    for (int i = 0; i < 5; i++) {
+        cx_bn_copy(t, s);
+        sqr_n(t, temp, 1 << i);
+        mul_assign(s, t, temp);
+    }
+    // w = (div^(2^33-1).num)^((T-1)/2).s
+    CX_MUL(t, s, s);
+    mul_assign(t, div, temp);
+    mul_assign(t, num, temp);
+    CX_POW(w, t, exp, 32);
+    mul_assign(w, s, temp);
+
+    CX_MUL(uv, w, num);
+    CX_MUL(s, w, div);
+    CX_MUL(t, uv, s); // x = u^T
+
+    // xs[i] = x^(16^i)
+    uint8_t xs[SQRT_WINDOWS][32];
+    uint8_t y[32];
+    cx_bn_export(t, xs[0], 32);
+    for (int i = 1; i < SQRT_WINDOWS; i++) {
+        sqr_n(t, temp, 4);
+        cx_bn_export(t, xs[i], 32);
+    }
+
+    uint32_t k = 0;
+    for (int i = 0; i < SQRT_WINDOWS; i++) {
+        // x^(16^(7-i)) / g^((k mod 16^i).16^(7-i)) = g^(k_i.2^28)
+        cx_bn_init(t, xs[SQRT_WINDOWS - 1 - i], 32);
+        for (int j = 0; j < i; j++) {
+            load_root(s, roots[SQRT_WINDOWS - 1 - i + j], (k >> (4 * j)) & 0x0F);
+            mul_assign(t, s, temp);
+        }
+        cx_bn_export(t, y, 32);
+        // SQRT_ROOTS[7][d] = g^(-d.2^28)
+        uint8_t d = find_root(roots[SQRT_WINDOWS - 1], y);
+        k |= (uint32_t)((16 - d) & 0x0F) << (4 * i);
+    }
+
+    // w = uv/g^(k/2)
+    k >>= 1;
+    cx_bn_copy(w, uv);
+    for (int i = 0; i < SQRT_WINDOWS; i++) {
+        load_root(s, roots[i], (k >> (4 * i)) & 0x0F);
+        mul_assign(w, s, temp);
+    }
+    k = 0;
+    explicit_bzero(xs, sizeof(xs));
+    explicit_bzero(y, sizeof(y));
+
+    // square iff w^2.div = num
+    CX_MUL(t, w, w);
+    CX_MUL(s, t, div);
+    int diff;
+    cx_bn_cmp(s, num, &diff);
+    cx_bn_copy(r, w);
+
+    cx_bn_destroy(&s);
+    cx_bn_destroy(&t);
+    cx_bn_destroy(&w);
+    cx_bn_destroy(&uv);
+    cx_bn_destroy(&temp);
+    bn_session_end();
+
+    return diff == 0;
+}
+
+bool ff_sqrt(field_e f, cx_bn_t r, cx_bn_t a) {
+    bn_session_begin();
+    use_field(field_ctx(f));
+    BN_DEF(one);
+    cx_bn_set_u32(one, 1);
+    TO_MONT(one);
+    bool square = ff_sqrt_ratio(f, r, a, one);
+    cx_bn_destroy(&one);
+    bn_session_end();
+    return square;
+}
+
+#ifdef TEST
+/// @brief ok && a == b
+static bool check_eq(bool ok, cx_bn_t a, cx_bn_t b) {
+    int diff;
+    cx_bn_cmp(a, b, &diff);
+    return ok && diff == 0;
+}
+
+static bool test_ff_sqrt_field(field_e f, const uint8_t *g_inv) {
+    bool ok = true;
+    bn_session_begin();
+    use_field(field_ctx(f));
+    BN_DEF(x);
+    BN_DEF(c);
+    BN_DEF(num);
+    BN_DEF(r);
+    BN_DEF(t);
+    BN_DEF(temp);
+    BN_DEF(gi);
+    cx_bn_init(gi, g_inv, 32);
+    cx_bn_rng(x, M);
+    cx_bn_rng(c, M);
+
+    // x^2.c/c is a square: r^2.c = num
+    CX_MUL(t, x, x);
+    CX_MUL(num, t, c);
+    ok = ok && ff_sqrt_ratio(f, r, num, c);
+    CX_MUL(t, r, r);
+    CX_MUL(temp, t, c);
+    ok = check_eq(ok, temp, num);
+
+    // x^2.c.g^-1/c is not a square: r^2.c = g.num
+    mul_assign(num, gi, temp);
+    ok = ok && !ff_sqrt_ratio(f, r, num, c);
+    CX_MUL(t, r, r);
+    CX_MUL(temp, t, c);
+    mul_assign(temp, gi, t);
+    ok = check_eq(ok, temp, num);
+
+    // 0/c = 0^2, x/0 is not a square
+    cx_bn_set_u32(num, 0);
+    ok = ok && ff_sqrt_ratio(f, r, num, c);
+    ok = check_eq(ok, r, num);
+    ok = ok && !ff_sqrt_ratio(f, r, x, num);
+
+    // random values, same squares as cx_bn_mod_sqrt
+    for (int i = 0; i < 4; i++) {
+        cx_bn_rng(x, M);
+        bool square = ff_sqrt(f, r, x);
+        cx_bn_copy(t, x);
+        FROM_MONT(t);
+        ok = ok && square == (cx_bn_mod_sqrt(temp, t, M, 0) == CX_OK);
+        if (square) {
+            CX_MUL(t, r, r);
+            ok = check_eq(ok, t, x);
+        }
+    }
+
+    cx_bn_destroy(&x);
+    cx_bn_destroy(&c);
+    cx_bn_destroy(&num);
+    cx_bn_destroy(&r);
+    cx_bn_destroy(&t);
+    cx_bn_destroy(&temp);
+    cx_bn_destroy(&gi);
+    bn_session_end();
+    return ok;
+}
+
+bool test_ff_sqrt() {
+    // SQRT_x_ROOTS[0][1] = 1/g
+    bool ok = test_ff_sqrt_field(FIELD_FQ, SQRT_FQ_ROOTS[0][1]);
+#ifdef ORCHARD
+    ok = ok && test_ff_sqrt_field(FIELD_FP, SQRT_FP_ROOTS[0][1]);
+#endif
+    return ok;
+}
+#endif
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <stdbool.h>  // bool
+#include <stdint.h>   // uint*_t
+#include <ox_bn.h>
+
+#include "fr.h"
+
+/// Fp and Fq have p - 1 = 2^32.T, the discrete log of a 2^32-th root
+/// of unity is recovered 4 bits at a time
+#define SQRT_WINDOWS 8
+
+/// @brief Powers of the roots of unity and exponents, see sqrt_tables.c
+#ifdef ORCHARD
+extern const uint8_t SQRT_FP_EXP[32];
+extern const uint8_t SQRT_FP_ROOTS[SQRT_WINDOWS][16][32];
+#endif
+extern const uint8_t SQRT_FQ_EXP[32];
+extern const uint8_t SQRT_FQ_ROOTS[SQRT_WINDOWS][16][32];
+
+/// @brief Square root of num/div in Fp (Pallas base) or Fq (Jubjub base),
+/// in constant time and without inversion.
+/// Must be called in a BN session. Values are in Montgomery form
+/// @param f FIELD_FP or FIELD_FQ
+/// @param r result, sqrt(num/div) if it is a square, sqrt(g.num/div)
+/// otherwise where g is the 2^32-th root of unity of the field (a non square),
+/// 0 if num or div is 0. Must not be num or div
+/// @param num
+/// @param div
+/// @return true if num/div is a square or num is 0, false if it is not a
+/// square or div is 0 (and num is not)
+bool ff_sqrt_ratio(field_e f, cx_bn_t r, cx_bn_t num, cx_bn_t div);
+
+/// @brief Square root in Fp or Fq, see ff_sqrt_ratio
+/// @return true if a is a square, r is unspecified otherwise
+bool ff_sqrt(field_e f, cx_bn_t r, cx_bn_t a);
+
+#ifdef TEST
+/// @brief Check ff_sqrt_ratio in Fq (and Fp) on squares, non squares
+/// and zeros, and ff_sqrt against cx_bn_mod_sqrt on random values
+/// @return true if all the results are consistent
+bool test_ff_sqrt();
+#endif
@@ -0,0 +1,642 @@
+/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+// GENERATED by tools/gen_tables.py - DO NOT EDIT
+
+#include <stdint.h>
+#include <ox_bn.h>
+
+#include "fr.h"
+#include "sqrt.h"
+
+/// @brief SQRT_x_ROOTS[m][d] = g^(-d.16^m) where g = gen^T is the 2^32-th
+/// root of unity of the field, big endian.
+/// SQRT_x_EXP = (T-1)/2 where p - 1 = 2^32.T
+/// Roots are in Montgomery form (x.2^256 mod p), except on the Nano S
+/// that does not use Montgomery multiplication
+
+#ifdef ORCHARD
+
+const uint8_t SQRT_FP_EXP[32] = {
+    0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x23, 0x4c, 0x7e, 0x04, 0xa6, 0x7c, 0x8d, 0xcc, 0x96, 0x98, 0x76
+};
+
+#ifdef NO_MONTGOMERY
+
+const uint8_t SQRT_FP_ROOTS[SQRT_WINDOWS][16][32] = {
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x2c, 0xd5, 0x28, 0x2c, 0x53, 0x11, 0x6b, 0x5c, 0xb4, 0xed, 0x8e, 0x64, 0x71, 0x96, 0xda, 0xd1, 0x84, 0xa0, 0xa1, 0xd8, 0x85, 0x9f, 0x06, 0x6f, 0xf0, 0xb8, 0x7c, 0x7d, 0xb2, 0xce, 0x91, 0xf6 },
+        { 0x39, 0x48, 0x3d, 0x92, 0x60, 0x75, 0xfa, 0xc4, 0x47, 0xd4, 0xd2, 0x6a, 0xc1, 0xae, 0xf5, 0x9c, 0x19, 0x2a, 0x5d, 0x43, 0x2d, 0x69, 0x78, 0x37, 0x1f, 0xe0, 0x70, 0xae, 0xde, 0xc6, 0x55, 0xa0 },
+        { 0x2c, 0xf9, 0x30, 0xb1, 0x0b, 0xf5, 0x36, 0x3c, 0x46, 0xf7, 0x14, 0x43, 0xeb, 0x13, 0xe1, 0x80, 0xe8, 0x6b, 0xfd, 0xb3, 0xb1, 0x56, 0xcf, 0x66, 0x06, 0x08, 0x69, 0x75, 0x2a, 0x79, 0x0e, 0x98 },
+        { 0x35, 0xd1, 0x0b, 0x80, 0x41, 0xf7, 0x54, 0x24, 0x74, 0x2b, 0xcf, 0xaa, 0xcd, 0x6e, 0x24, 0xa7, 0x7a, 0x5c, 0x04, 0xd7, 0x44, 0xbb, 0xc5, 0xb3, 0x49, 0x97, 0x0d, 0x21, 0x63, 0xcc, 0x8d, 0x81 },
+        { 0x05, 0xba, 0xdf, 0x36, 0x2f, 0x42, 0x9d, 0xe6, 0x1f, 0x52, 0x7f, 0x7d, 0xbf, 0x7a, 0x4a, 0x07, 0x89, 0xee, 0xf5, 0x37, 0xac, 0xe3, 0x06, 0xb4, 0xb3, 0x62, 0x14, 0x78, 0x70, 0xbd, 0xb0, 0xa0 },
+        { 0x2c, 0x62, 0x16, 0x91, 0x07, 0x69, 0x3c, 0x42, 0x48, 0x19, 0x22, 0x8b, 0x28, 0x63, 0x08, 0xa9, 0x5c, 0x48, 0xc5, 0xf5, 0xaa, 0x72, 0xf9, 0xf4, 0x57, 0xa9, 0x8e, 0x7c, 0x2d, 0xd5, 0xea, 0xd9 },
+        { 0x2f, 0x82, 0xd9, 0x6d, 0xfe, 0xe5, 0xc4, 0xa2, 0x01, 0x39, 0x1c, 0x3e, 0x98, 0x2f, 0x07, 0xad, 0xbb, 0xaa, 0x5f, 0xba, 0xdb, 0x12, 0xf9, 0x3b, 0x03, 0x01, 0x72, 0x39, 0x3d, 0x9f, 0xdc, 0x75 },
+        { 0x03, 0x06, 0x2f, 0x19, 0x53, 0x89, 0xf7, 0xf6, 0x09, 0x5d, 0x8e, 0xe9, 0x28, 0xe1, 0x27, 0x27, 0xca, 0x8d, 0xb0, 0xab, 0xd9, 0x34, 0x85, 0xac, 0x54, 0xb0, 0xe1, 0x6f, 0x4b, 0x41, 0x40, 0x7c },
+        { 0x28, 0xcb, 0x07, 0x9f, 0xe6, 0xec, 0x9a, 0x0b, 0xb2, 0xa7, 0x5e, 0x9e, 0xc0, 0xa9, 0xcf, 0xe7, 0x22, 0x59, 0x5d, 0x5e, 0x62, 0xe7, 0xec, 0x96, 0x55, 0xa4, 0x5d, 0x29, 0xfe, 0x90, 0xa4, 0x3e },
+        { 0x09, 0x86, 0x1d, 0x8f, 0xe3, 0x13, 0x43, 0x5c, 0xbb, 0xf3, 0xf2, 0x83, 0xd6, 0xcd, 0x34, 0xd3, 0x46, 0x07, 0x44, 0x35, 0x52, 0x97, 0xc0, 0x23, 0xb8, 0xfe, 0x80, 0x83, 0x9a, 0xd1, 0x6f, 0x3e },
+        { 0x00, 0x39, 0x75, 0xe0, 0x48, 0xca, 0xd0, 0x7c, 0x4d, 0xfc, 0xf8, 0xb1, 0xb8, 0xe9, 0xab, 0x08, 0xd6, 0x19, 0x42, 0x9c, 0x6e, 0x64, 0x70, 0xc5, 0x71, 0xbb, 0xfe, 0xdb, 0x1d, 0x29, 0x5f, 0xd8 },
+        { 0x39, 0x99, 0x79, 0xc3, 0x9b, 0x62, 0x58, 0x5b, 0x4f, 0xfd, 0xe6, 0xe6, 0xea, 0xdc, 0xd7, 0x70, 0xff, 0x48, 0xd2, 0xa3, 0x5d, 0x7f, 0x2c, 0xe4, 0x9e, 0x61, 0x13, 0xe8, 0x76, 0x49, 0x42, 0x8f },
+        { 0x04, 0xdd, 0x34, 0x9f, 0x54, 0xab, 0x91, 0x05, 0x60, 0x21, 0x5b, 0x7f, 0xb4, 0x6b, 0x9a, 0x84, 0x42, 0xce, 0x83, 0xd3, 0x2b, 0xfd, 0x31, 0x2e, 0xde, 0x53, 0x1a, 0x1c, 0x05, 0xeb, 0x9d, 0xd1 },
+        { 0x39, 0xd0, 0x81, 0x01, 0xae, 0x71, 0x9b, 0x6c, 0x43, 0x28, 0xf7, 0x2f, 0xaa, 0x8e, 0x82, 0x20, 0x7a, 0x1c, 0x86, 0x29, 0xa4, 0x4b, 0x0f, 0xef, 0xfe, 0x37, 0xa7, 0x17, 0xf9, 0x40, 0xe8, 0xbf },
+        { 0x37, 0xfd, 0xc0, 0x5c, 0x3e, 0x46, 0xa5, 0x4c, 0x27, 0xc7, 0x17, 0xea, 0xfd, 0x3f, 0xda, 0x68, 0x95, 0x85, 0x06, 0x9b, 0xd0, 0x61, 0x15, 0x03, 0x41, 0xbc, 0xe9, 0x57, 0xd8, 0x95, 0x40, 0x97 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x00, 0x0d, 0x10, 0x9f, 0x4a, 0x8d, 0x14, 0xb5, 0xff, 0xb7, 0xc0, 0x6e, 0x60, 0x45, 0xa0, 0xd2, 0x3e, 0x97, 0xe4, 0xeb, 0xfa, 0x98, 0x44, 0xc7, 0xb1, 0x6b, 0x3f, 0x8f, 0x4f, 0xad, 0xde, 0x05 },
+        { 0x1e, 0x19, 0x95, 0x15, 0x88, 0x99, 0xe5, 0xe9, 0x94, 0x02, 0x65, 0xaa, 0x39, 0xd6, 0xb2, 0xd8, 0xef, 0x62, 0xe9, 0x87, 0x56, 0x17, 0xed, 0x92, 0xf8, 0x1d, 0x1d, 0x05, 0x94, 0x19, 0x42, 0xa3 },
+        { 0x32, 0x32, 0xd4, 0x17, 0xea, 0x6f, 0x11, 0x6e, 0xa5, 0x71, 0x92, 0x12, 0xb0, 0x85, 0xa3, 0x56, 0x53, 0xbd, 0xe2, 0x2d, 0x35, 0xf8, 0x5b, 0x47, 0xfd, 0x12, 0xdb, 0x70, 0x1e, 0x04, 0x32, 0xd2 },
+        { 0x19, 0x46, 0xdc, 0x7e, 0x26, 0xa3, 0x55, 0xb9, 0x5d, 0x97, 0x31, 0x6f, 0xc1, 0xed, 0x86, 0x5a, 0x9b, 0x31, 0x76, 0x05, 0xd2, 0x43, 0x00, 0xf2, 0xff, 0x32, 0x0e, 0x73, 0x39, 0x0f, 0x11, 0x47 },
+        { 0x31, 0x22, 0x4e, 0x04, 0x1a, 0xe9, 0xef, 0x9b, 0xbb, 0xd7, 0xa4, 0xea, 0x0c, 0x9f, 0x56, 0x1f, 0xa4, 0x12, 0xfc, 0x16, 0xb1, 0x66, 0xc6, 0x89, 0x1e, 0x87, 0x2d, 0x0d, 0x90, 0x32, 0x60, 0xab },
+        { 0x25, 0xf5, 0x21, 0x65, 0x48, 0x4a, 0x8b, 0x99, 0xff, 0xac, 0x61, 0x4d, 0x4f, 0x02, 0xf7, 0x50, 0xd6, 0x56, 0x48, 0x46, 0x51, 0xaf, 0x3a, 0x89, 0xcb, 0x19, 0xf2, 0x8d, 0x33, 0x64, 0x87, 0x33 },
+        { 0x2e, 0xa0, 0x3b, 0xd7, 0x04, 0x62, 0x44, 0x40, 0x5c, 0xcb, 0x61, 0x1a, 0xf6, 0x57, 0xba, 0x34, 0x1c, 0xfb, 0x07, 0x6e, 0x2f, 0xc0, 0xe3, 0xff, 0x6e, 0xeb, 0x38, 0xfc, 0x58, 0x2b, 0x97, 0x79 },
+        { 0x11, 0x01, 0xae, 0x73, 0xb1, 0xef, 0x99, 0xc4, 0x15, 0xa6, 0xac, 0x0a, 0xfd, 0x82, 0x7c, 0x2a, 0xd0, 0x1c, 0xa8, 0x77, 0x26, 0x9a, 0xa7, 0x4f, 0x89, 0x66, 0xd6, 0xb8, 0xd8, 0x55, 0x39, 0xb6 },
+        { 0x04, 0x1e, 0xc9, 0x8b, 0x46, 0x26, 0xcc, 0x43, 0x05, 0xc3, 0xfb, 0x9b, 0x0e, 0x77, 0x51, 0xcc, 0x84, 0xa6, 0x48, 0x68, 0xc6, 0xa2, 0x7b, 0xd1, 0x93, 0x10, 0x6e, 0xde, 0xbc, 0xdf, 0x4b, 0xa1 },
+        { 0x3d, 0x53, 0x65, 0x99, 0x4a, 0xc1, 0x5b, 0xa3, 0x9d, 0x7a, 0xcf, 0xb8, 0x62, 0xd8, 0x88, 0xc9, 0xea, 0x80, 0xeb, 0x9c, 0x60, 0xa4, 0x22, 0x4d, 0xe8, 0xdd, 0x77, 0xc7, 0xe9, 0xb9, 0xf0, 0x39 },
+        { 0x34, 0x46, 0x15, 0x38, 0x95, 0x29, 0xae, 0x0a, 0x3c, 0x31, 0xb2, 0xdf, 0xd0, 0xc8, 0xf4, 0x1d, 0xa4, 0x7d, 0xb8, 0x50, 0x4a, 0xc8, 0xed, 0xc8, 0x31, 0xe4, 0x9c, 0x78, 0xd6, 0xae, 0xff, 0xd7 },
+        { 0x25, 0xb8, 0x67, 0x24, 0x93, 0xd8, 0x20, 0x6f, 0x80, 0x59, 0x78, 0x65, 0x1c, 0x25, 0xbe, 0xbc, 0x30, 0xc6, 0x23, 0x44, 0x9a, 0x0b, 0x71, 0x17, 0xbf, 0x48, 0x84, 0x53, 0x94, 0xe9, 0x6c, 0x4a },
+        { 0x03, 0x17, 0x2b, 0x81, 0xf1, 0xde, 0xa5, 0xfd, 0x6a, 0xf0, 0xa8, 0x17, 0xd7, 0x26, 0x8f, 0x03, 0x26, 0x1e, 0x9f, 0xb8, 0x02, 0x44, 0x69, 0xf2, 0xb1, 0x4a, 0x39, 0xb4, 0xab, 0x2b, 0x79, 0x34 },
+        { 0x27, 0xc4, 0x75, 0x59, 0x4b, 0x84, 0x49, 0x5c, 0x0d, 0xed, 0x94, 0xa4, 0x3d, 0xd4, 0x23, 0xbf, 0x63, 0x75, 0xeb, 0x78, 0x04, 0x8e, 0xef, 0x42, 0x32, 0x57, 0x55, 0xf8, 0x4a, 0x5a, 0x8c, 0x38 },
+        { 0x3a, 0xea, 0x17, 0x61, 0xb9, 0xa8, 0x87, 0x40, 0x6f, 0xa7, 0x0e, 0x0e, 0x31, 0xca, 0x5e, 0x93, 0xcb, 0x7b, 0x9f, 0xb3, 0xba, 0x43, 0xdc, 0xd6, 0xe2, 0xfd, 0xa7, 0x5c, 0x5e, 0x87, 0x65, 0xe5 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x31, 0x40, 0xf1, 0x64, 0xec, 0xfc, 0x5c, 0x2d, 0x5f, 0x05, 0xbe, 0x6a, 0x05, 0x97, 0x1c, 0x16, 0xa1, 0x57, 0xa0, 0x2b, 0x92, 0x35, 0x2a, 0x7a, 0x12, 0x94, 0xef, 0xb5, 0xeb, 0xb4, 0x29, 0x62 },
+        { 0x1f, 0xf6, 0x1e, 0xf0, 0x05, 0x3d, 0x97, 0x42, 0x89, 0xf5, 0x2d, 0xb1, 0xa0, 0x24, 0xe6, 0x44, 0x0f, 0x5e, 0x26, 0x23, 0x11, 0x95, 0x1f, 0x3c, 0x1c, 0x53, 0x6f, 0x34, 0x9d, 0xcf, 0xcd, 0x12 },
+        { 0x3a, 0x93, 0xec, 0x15, 0x99, 0xd2, 0x2e, 0xcb, 0x4a, 0x16, 0x17, 0x9d, 0x8e, 0xf6, 0x13, 0xb0, 0xe8, 0x5d, 0x2a, 0x2c, 0x52, 0xc7, 0x78, 0x52, 0xab, 0xbf, 0xf9, 0x48, 0x7c, 0xbe, 0xed, 0x77 },
+        { 0x0f, 0x2d, 0x69, 0x3d, 0x1d, 0x98, 0xd5, 0x9c, 0xb7, 0x49, 0x3f, 0xfc, 0xd2, 0x72, 0x51, 0x8f, 0x9c, 0xd6, 0x25, 0x1b, 0xb0, 0xa0, 0x67, 0x79, 0x92, 0xd3, 0xb9, 0x3f, 0xac, 0x99, 0x43, 0xbb },
+        { 0x3b, 0xb9, 0x44, 0xc9, 0xca, 0xb5, 0xa9, 0x18, 0xf1, 0x1d, 0x86, 0x43, 0xc2, 0x74, 0x62, 0x66, 0x85, 0x9d, 0xff, 0x49, 0x90, 0x04, 0xbd, 0x6b, 0x03, 0x7f, 0x48, 0x45, 0xf1, 0x2a, 0x7e, 0x84 },
+        { 0x2a, 0x6d, 0xfd, 0x90, 0x96, 0x03, 0x24, 0xf5, 0xee, 0x41, 0xe1, 0x38, 0x41, 0xd2, 0xdc, 0xb0, 0xc1, 0x59, 0x6d, 0x31, 0xb8, 0x17, 0x25, 0x7d, 0xc3, 0xda, 0x83, 0xc3, 0x90, 0x52, 0xdc, 0x61 },
+        { 0x39, 0x42, 0x29, 0x14, 0xa2, 0xf1, 0xb2, 0x10, 0xa5, 0x1e, 0x37, 0x78, 0xaf, 0xf0, 0xec, 0x2e, 0x01, 0x54, 0x87, 0x82, 0x04, 0xbc, 0x5b, 0x38, 0xaa, 0xb9, 0x1d, 0x0f, 0x6e, 0x65, 0x83, 0x68 },
+        { 0x16, 0x84, 0x90, 0xdb, 0xac, 0x14, 0x3a, 0x95, 0xcb, 0xa6, 0xe2, 0x0b, 0x53, 0x7c, 0xac, 0xb0, 0xfb, 0xff, 0xab, 0x70, 0x7e, 0x95, 0x61, 0x43, 0x1b, 0xc1, 0xa1, 0xe2, 0x99, 0x8e, 0x58, 0xb7 },
+        { 0x0c, 0x49, 0x4a, 0xd7, 0xb4, 0xb7, 0x09, 0xa9, 0x02, 0x36, 0xe9, 0x0f, 0x15, 0xbc, 0xbb, 0xe2, 0x49, 0xd1, 0x33, 0x93, 0x8a, 0x90, 0x67, 0x8e, 0x88, 0xe8, 0xff, 0x2e, 0x35, 0x1a, 0x3b, 0x34 },
+        { 0x03, 0xbd, 0xe8, 0xba, 0xd1, 0x99, 0x02, 0x1a, 0xe6, 0xca, 0x0f, 0xf7, 0x94, 0xdf, 0x4d, 0x15, 0xb9, 0x2c, 0x50, 0xd8, 0x70, 0x3f, 0x6b, 0xdb, 0x2a, 0x73, 0xce, 0x48, 0xd4, 0x65, 0xf7, 0x3b },
+        { 0x25, 0x23, 0x09, 0x5b, 0x39, 0x50, 0x01, 0x57, 0xe4, 0x0b, 0x78, 0x19, 0x0e, 0x41, 0x73, 0xfa, 0xb1, 0x8f, 0x39, 0xcc, 0x12, 0x58, 0x28, 0xcb, 0x91, 0x49, 0xc3, 0x59, 0x2b, 0xcf, 0xa8, 0x43 },
+        { 0x09, 0x7e, 0x74, 0x16, 0xad, 0x08, 0xc7, 0x86, 0xcf, 0x5e, 0xcc, 0x06, 0xf9, 0xe4, 0x9c, 0x80, 0x99, 0x9c, 0x74, 0xd2, 0x55, 0x27, 0x45, 0x59, 0x78, 0x0d, 0xb3, 0x3a, 0x83, 0x58, 0x68, 0x14 },
+        { 0x10, 0x41, 0x2f, 0x41, 0x4f, 0x89, 0x11, 0xd0, 0x07, 0x33, 0x5a, 0x1f, 0x6a, 0x62, 0x8e, 0x46, 0x8e, 0xa0, 0xcb, 0xba, 0x29, 0x60, 0xb5, 0xa7, 0x5f, 0xe3, 0x6e, 0xae, 0x23, 0xf6, 0x81, 0xd8 },
+        { 0x2d, 0x29, 0x24, 0x15, 0x37, 0xba, 0xb3, 0x53, 0x72, 0x2f, 0x8f, 0x73, 0x37, 0xdf, 0xeb, 0x63, 0x3e, 0xbe, 0xcf, 0x46, 0xa8, 0x1b, 0xa7, 0xff, 0xe1, 0xaf, 0xaf, 0xd3, 0xca, 0x8c, 0x39, 0xe7 },
+        { 0x1d, 0x25, 0x23, 0x4c, 0xb8, 0xb5, 0x8a, 0xac, 0x4d, 0x4a, 0x89, 0x2e, 0x49, 0xaf, 0x6a, 0x21, 0x73, 0x20, 0x22, 0x97, 0x76, 0xbe, 0x2a, 0xee, 0x8f, 0xc3, 0x84, 0xaa, 0x47, 0xab, 0x52, 0xb9 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x38, 0xaa, 0xc0, 0x73, 0x35, 0xbe, 0xa8, 0x3a, 0x79, 0xaa, 0x29, 0x9d, 0xe7, 0xba, 0x3f, 0x98, 0x9b, 0x18, 0x33, 0xac, 0x45, 0x17, 0xe4, 0x70, 0x61, 0xb1, 0x62, 0x9a, 0xda, 0x0d, 0xd7, 0x42 },
+        { 0x03, 0x0a, 0xdf, 0x84, 0x55, 0x99, 0xa1, 0xfa, 0x3b, 0xe9, 0xed, 0xb0, 0x69, 0xfe, 0xbf, 0x6c, 0x93, 0x79, 0x1e, 0xdc, 0x41, 0xb2, 0xe1, 0xf9, 0x59, 0xff, 0xfd, 0x64, 0xbd, 0xa5, 0x81, 0x11 },
+        { 0x01, 0x63, 0xa4, 0x25, 0xfb, 0x1b, 0x60, 0x26, 0xfb, 0x54, 0xe7, 0x5b, 0x73, 0x9e, 0x11, 0x3e, 0x13, 0x56, 0x35, 0x8d, 0xd7, 0xa2, 0xc8, 0xdd, 0x0c, 0xd8, 0x4e, 0xfa, 0xda, 0xe2, 0xbb, 0x34 },
+        { 0x02, 0x02, 0x25, 0xd5, 0x53, 0xad, 0x25, 0x00, 0xd4, 0x8c, 0x8f, 0xfb, 0x3d, 0xb4, 0xcd, 0x8b, 0x97, 0x05, 0xb0, 0xea, 0x26, 0xe2, 0xb3, 0x2a, 0x57, 0xa5, 0xf9, 0x19, 0x24, 0x67, 0x19, 0x21 },
+        { 0x16, 0xfb, 0x1c, 0xb8, 0xe5, 0xd6, 0x82, 0x7f, 0xcf, 0x11, 0x62, 0x07, 0xc4, 0xe5, 0x09, 0xd6, 0xaa, 0x7e, 0x59, 0x14, 0x50, 0x03, 0x9b, 0x9d, 0xd1, 0xd3, 0x3d, 0x7e, 0xe0, 0xa5, 0x62, 0x52 },
+        { 0x0c, 0xfa, 0xb9, 0xf3, 0x08, 0x01, 0xb1, 0x9c, 0x1a, 0xd6, 0xd8, 0x15, 0x6f, 0xec, 0xce, 0x9f, 0x9f, 0x16, 0x22, 0x34, 0x3b, 0x19, 0x05, 0x6b, 0x93, 0x08, 0x7e, 0xef, 0xa5, 0xa5, 0x45, 0x71 },
+        { 0x2d, 0xb8, 0xdd, 0x89, 0xc7, 0x93, 0x50, 0xa5, 0x65, 0x60, 0x34, 0x76, 0xb2, 0x8e, 0xe5, 0xec, 0x1d, 0x67, 0x2d, 0xa1, 0x0f, 0xd8, 0x6a, 0x5e, 0xb3, 0x77, 0x6d, 0x24, 0xe7, 0x2e, 0x10, 0x28 },
+        { 0x3f, 0x6e, 0xf3, 0x03, 0x4a, 0x1a, 0xa8, 0x5d, 0x04, 0x27, 0xa7, 0x31, 0x6d, 0xc9, 0x7e, 0x04, 0x68, 0xa0, 0xd5, 0x8a, 0x9e, 0x4f, 0x52, 0xfb, 0x57, 0xf6, 0x3a, 0x70, 0xe3, 0x3c, 0xdb, 0x61 },
+        { 0x38, 0xf9, 0x15, 0x47, 0xf1, 0xd4, 0x5a, 0x55, 0x20, 0x67, 0xa6, 0x79, 0xd6, 0xf8, 0x1d, 0xe9, 0xe9, 0x5c, 0xea, 0x53, 0xbc, 0xe9, 0xb0, 0x86, 0x44, 0xe1, 0x09, 0xab, 0x18, 0xd5, 0xee, 0xf4 },
+        { 0x19, 0x67, 0x64, 0xda, 0x77, 0x94, 0x55, 0xf5, 0xf3, 0xbb, 0x3d, 0xfc, 0x91, 0xf0, 0x68, 0x13, 0x51, 0xad, 0x0e, 0x22, 0xe9, 0x43, 0x42, 0x62, 0x17, 0xd2, 0xb5, 0xc4, 0x4c, 0x7a, 0x84, 0x5f },
+        { 0x3d, 0x03, 0x21, 0xb8, 0xb5, 0xf8, 0xa2, 0xfb, 0x9f, 0xb7, 0x8d, 0x4c, 0xa1, 0xca, 0xd4, 0x5a, 0xe1, 0x18, 0x3a, 0x8d, 0xa6, 0x62, 0x2d, 0x42, 0x2e, 0xc6, 0x82, 0xf5, 0xc1, 0xe6, 0x17, 0x52 },
+        { 0x1c, 0xfd, 0xd4, 0x41, 0x70, 0x25, 0x47, 0x33, 0x68, 0xf7, 0x9a, 0x6d, 0xc0, 0xeb, 0x7e, 0x92, 0xb2, 0x63, 0x5c, 0xfc, 0x67, 0x03, 0x47, 0xe9, 0xe1, 0x57, 0xa1, 0x70, 0x08, 0x37, 0x95, 0x20 },
+        { 0x2e, 0xe7, 0x21, 0xb7, 0x21, 0xcf, 0x2b, 0x34, 0x97, 0x57, 0x31, 0x77, 0x19, 0x67, 0x21, 0xe9, 0x5f, 0x83, 0x91, 0x0f, 0x5f, 0x4a, 0x8a, 0xc5, 0xc9, 0xa4, 0xd9, 0x05, 0xa3, 0x48, 0x14, 0xb3 },
+        { 0x20, 0x3a, 0x28, 0xba, 0x72, 0xe0, 0x43, 0xf5, 0x44, 0x32, 0x52, 0x75, 0xd3, 0x99, 0x2c, 0x2b, 0x78, 0xb5, 0x1d, 0xe4, 0xdd, 0xd2, 0xae, 0xf1, 0xbd, 0xe0, 0xdc, 0xbf, 0x38, 0xd5, 0xff, 0x26 },
+        { 0x3a, 0x87, 0x96, 0x5d, 0x61, 0x0c, 0xed, 0xe8, 0xa6, 0xa8, 0x14, 0xb3, 0xb6, 0xfc, 0x2d, 0xad, 0x70, 0xfc, 0x54, 0xc0, 0x0f, 0x10, 0xb2, 0x02, 0x00, 0xea, 0x58, 0x5e, 0xfb, 0xde, 0x59, 0xcc }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x3d, 0x14, 0x24, 0x05, 0x54, 0x19, 0xa0, 0x21, 0xa9, 0x58, 0x14, 0x94, 0xc9, 0xea, 0xdd, 0x7e, 0x05, 0x83, 0x02, 0x01, 0xcb, 0xb3, 0x30, 0x2b, 0xde, 0x25, 0x60, 0x90, 0x4a, 0x09, 0x79, 0x61 },
+        { 0x1f, 0xcb, 0x97, 0x44, 0xa1, 0x7f, 0x75, 0x56, 0xac, 0x55, 0x80, 0x6a, 0x07, 0x83, 0xe3, 0x80, 0x26, 0x36, 0x98, 0xca, 0x3a, 0x14, 0x44, 0x00, 0x91, 0xcb, 0x89, 0x8c, 0x62, 0x97, 0x1f, 0x88 },
+        { 0x2e, 0xa1, 0x7b, 0xd7, 0xfc, 0x7b, 0x4c, 0x11, 0x1f, 0x19, 0x50, 0x6e, 0x62, 0x52, 0x95, 0x79, 0xf9, 0x8b, 0x51, 0x57, 0xd4, 0x20, 0x43, 0x15, 0x0b, 0xde, 0xd5, 0xb2, 0x23, 0xfd, 0x04, 0xcb },
+        { 0x34, 0x61, 0x64, 0x68, 0xd3, 0x72, 0x9e, 0x84, 0xd2, 0xb4, 0x2e, 0x08, 0xf0, 0x8f, 0xfb, 0xd9, 0x40, 0x9e, 0x5e, 0x81, 0xb1, 0x3d, 0x25, 0x88, 0x81, 0xeb, 0x38, 0x7f, 0x6f, 0xea, 0xca, 0xa1 },
+        { 0x12, 0x3d, 0x5d, 0x81, 0xa3, 0x64, 0x9e, 0xbf, 0x96, 0x2b, 0x3f, 0x6d, 0x2c, 0x8a, 0x52, 0x75, 0xd2, 0xa2, 0xc8, 0x67, 0xf0, 0x50, 0x68, 0xa5, 0xe1, 0xbc, 0x7d, 0x17, 0x0d, 0xdf, 0x51, 0x5c },
+        { 0x26, 0x9b, 0xf4, 0x3d, 0x14, 0xf1, 0x14, 0xc9, 0xc6, 0x0f, 0x45, 0x54, 0x2f, 0x58, 0x31, 0x60, 0xdb, 0x6a, 0x4d, 0x40, 0x6d, 0x53, 0x98, 0x6b, 0xc9, 0xe9, 0x42, 0x95, 0x08, 0xbc, 0xf0, 0xec },
+        { 0x3e, 0x42, 0x70, 0x9e, 0xf1, 0x69, 0xf1, 0xfc, 0x07, 0x24, 0xd6, 0x08, 0xf8, 0x62, 0x65, 0xdc, 0x37, 0xb5, 0xd1, 0xc1, 0xbb, 0xfa, 0x84, 0x92, 0xc5, 0xff, 0xb2, 0x16, 0x10, 0x11, 0x10, 0xec },
+        { 0x20, 0xa6, 0x5c, 0xa0, 0xee, 0x62, 0xde, 0x45, 0x41, 0xad, 0x34, 0x87, 0x1d, 0x15, 0xaa, 0x55, 0x1a, 0x5d, 0x2d, 0x2c, 0x93, 0x05, 0x7b, 0x0a, 0xdf, 0x9a, 0x6d, 0x5a, 0x55, 0xb4, 0x51, 0xf5 },
+        { 0x0c, 0x8b, 0xd6, 0x79, 0xa6, 0x11, 0x86, 0x4a, 0xb5, 0x72, 0x9c, 0x7f, 0xda, 0xb4, 0x3c, 0x58, 0x3d, 0xc9, 0xbf, 0x28, 0x16, 0x24, 0xb6, 0x39, 0x2a, 0xf1, 0xb8, 0xb1, 0xdf, 0x77, 0x58, 0x18 },
+        { 0x1b, 0x72, 0xc6, 0xa5, 0xe8, 0xaa, 0xf6, 0xca, 0xba, 0xba, 0x7f, 0x52, 0x8a, 0x32, 0xe2, 0x26, 0x40, 0xa6, 0xdf, 0x19, 0xc0, 0x76, 0x50, 0x7f, 0x67, 0xec, 0x87, 0xb3, 0xdb, 0xdd, 0x30, 0xbe },
+        { 0x0e, 0xe5, 0x08, 0xab, 0xce, 0xd3, 0x09, 0x8c, 0xc9, 0x48, 0x0b, 0x12, 0x1c, 0xda, 0xb9, 0x26, 0x32, 0xca, 0xc1, 0x98, 0xb6, 0xee, 0x6f, 0x94, 0x1b, 0x92, 0xe0, 0x4f, 0x9f, 0x52, 0x28, 0x26 },
+        { 0x0c, 0x77, 0x21, 0xef, 0x7e, 0x73, 0x1a, 0xca, 0x30, 0x2d, 0x32, 0x47, 0x8c, 0x3a, 0x47, 0x48, 0x0a, 0x1b, 0xf7, 0xe0, 0x3a, 0x11, 0xcd, 0x97, 0xda, 0x97, 0xff, 0xb9, 0xed, 0x0b, 0x71, 0x61 },
+        { 0x1d, 0x4a, 0x40, 0x7b, 0x99, 0x78, 0xee, 0xa1, 0x72, 0x15, 0x99, 0xc3, 0x31, 0x1d, 0xcf, 0x32, 0xd1, 0x6d, 0xfe, 0xc8, 0x09, 0x2f, 0xfe, 0xce, 0xd4, 0xca, 0xd4, 0xaf, 0xef, 0xf9, 0x65, 0xae },
+        { 0x03, 0xa7, 0x8c, 0x4e, 0x02, 0x79, 0x66, 0x0d, 0x14, 0x10, 0x5c, 0x79, 0x5a, 0xa4, 0xb0, 0xb5, 0x8b, 0x6a, 0xa3, 0xbb, 0x14, 0x0a, 0x62, 0xc5, 0xa1, 0x01, 0x8f, 0xc2, 0x43, 0xbb, 0xf9, 0x7c },
+        { 0x1e, 0x9f, 0x60, 0x8e, 0xd2, 0x13, 0xcc, 0xf0, 0xf1, 0x7a, 0xc7, 0xa4, 0xdc, 0x68, 0x6c, 0x61, 0x69, 0x77, 0x47, 0xef, 0xb9, 0x3b, 0xb2, 0x83, 0x83, 0x40, 0x23, 0xba, 0xc8, 0x3c, 0x4a, 0x71 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x18, 0x1a, 0xf1, 0x18, 0x04, 0x09, 0x70, 0x12, 0x0b, 0x6f, 0x10, 0xf5, 0x4d, 0x56, 0x3b, 0x64, 0xfc, 0x50, 0x67, 0x49, 0x39, 0xb8, 0x9f, 0x1c, 0x1f, 0x80, 0x86, 0x8b, 0x37, 0x2b, 0xc6, 0xaf },
+        { 0x1a, 0xbb, 0x38, 0x7d, 0xa2, 0x72, 0xde, 0x47, 0x75, 0xac, 0xcf, 0x53, 0x2e, 0x29, 0x53, 0x38, 0x5e, 0x1f, 0x7d, 0xe3, 0x90, 0x5b, 0x75, 0x3a, 0x3b, 0x69, 0x8b, 0xa0, 0x46, 0xce, 0x6f, 0x04 },
+        { 0x09, 0x29, 0x14, 0xce, 0xbf, 0xf8, 0x36, 0x9b, 0xf2, 0xab, 0x8e, 0x1f, 0x57, 0xbd, 0x42, 0x70, 0x13, 0x52, 0x0c, 0xc3, 0xc1, 0xb6, 0xe4, 0x7c, 0xb0, 0x98, 0x69, 0x55, 0xa2, 0x3a, 0xe0, 0x08 },
+        { 0x30, 0x6f, 0x7c, 0xfe, 0x54, 0x89, 0xdc, 0x65, 0x5b, 0xc0, 0xf0, 0xe5, 0x09, 0x15, 0x27, 0x28, 0xfd, 0x63, 0x56, 0x82, 0x55, 0x0d, 0xde, 0x86, 0x76, 0xfc, 0x1c, 0x75, 0xe5, 0x55, 0x75, 0x90 },
+        { 0x01, 0x27, 0xa6, 0x7f, 0xca, 0x29, 0x19, 0xe5, 0xc5, 0xaa, 0xb5, 0x49, 0x8d, 0x91, 0xe2, 0xb8, 0x82, 0x83, 0xe6, 0xb9, 0xa3, 0xf3, 0x69, 0x27, 0xb9, 0x1d, 0x47, 0x10, 0xf4, 0xed, 0xfb, 0x8e },
+        { 0x2c, 0xb1, 0xa2, 0x4e, 0x83, 0x48, 0xfd, 0xe2, 0xb8, 0xbb, 0x84, 0x3e, 0x0f, 0x68, 0x8b, 0x5b, 0xb7, 0x3a, 0x9d, 0x1c, 0x6e, 0x68, 0xf5, 0xfd, 0x52, 0xad, 0x41, 0xf2, 0xd5, 0x5c, 0xdb, 0xef },
+        { 0x3e, 0x91, 0x3e, 0xc6, 0x94, 0xfe, 0x2f, 0xe3, 0x82, 0x04, 0x7a, 0x26, 0x9d, 0xf9, 0x9a, 0xbe, 0x10, 0x73, 0xb9, 0xa1, 0x87, 0x17, 0x03, 0xad, 0x05, 0xf6, 0x3f, 0xdb, 0xfc, 0x61, 0x61, 0xee },
+        { 0x11, 0xac, 0x1f, 0xc8, 0x46, 0xca, 0xf2, 0x30, 0xa1, 0xde, 0xd7, 0xbe, 0x03, 0x33, 0x32, 0xa4, 0x0d, 0x75, 0xab, 0x0d, 0x48, 0xd9, 0xbc, 0x5f, 0xa5, 0x4e, 0xe0, 0xfd, 0xa9, 0x1f, 0xe9, 0x6b },
+        { 0x1a, 0xb0, 0xd1, 0xef, 0x97, 0xab, 0x50, 0x74, 0x42, 0xb0, 0xa2, 0x36, 0x05, 0x28, 0xe4, 0xbe, 0xee, 0xad, 0xb3, 0x42, 0x31, 0x6f, 0xce, 0x58, 0x06, 0xad, 0x48, 0x46, 0xdb, 0x87, 0x43, 0xa6 },
+        { 0x2f, 0x58, 0xb5, 0x83, 0x47, 0x6d, 0xb0, 0xa4, 0xb2, 0x40, 0x08, 0x17, 0xf7, 0x0b, 0xd0, 0x7d, 0xad, 0x65, 0xa2, 0xa2, 0x03, 0xea, 0x9e, 0x52, 0x59, 0xfb, 0x36, 0x00, 0xd8, 0xfa, 0xdf, 0x62 },
+        { 0x00, 0x0e, 0xba, 0x24, 0xfb, 0x19, 0x12, 0x04, 0x47, 0x28, 0xf6, 0x9c, 0xc4, 0x6f, 0xb1, 0x9c, 0xc2, 0xff, 0x14, 0xad, 0xd5, 0x41, 0x49, 0x87, 0xf8, 0x40, 0xac, 0x39, 0x39, 0x39, 0x6b, 0x84 },
+        { 0x06, 0xcc, 0x2f, 0x38, 0xd7, 0xb9, 0xe1, 0x5f, 0x16, 0x2b, 0x0c, 0x6d, 0x5b, 0x98, 0xd2, 0x23, 0x14, 0xfe, 0x8c, 0x92, 0xca, 0x8f, 0xb4, 0xd2, 0x83, 0x84, 0xe4, 0xf5, 0x2f, 0x2e, 0x49, 0xe4 },
+        { 0x3d, 0x07, 0x63, 0xe0, 0x11, 0xa5, 0x4e, 0x6f, 0x37, 0x53, 0x31, 0x87, 0x75, 0x51, 0xe4, 0x8f, 0x67, 0x3d, 0xf1, 0xab, 0x34, 0x0b, 0xf5, 0x5c, 0x64, 0x37, 0xf1, 0xd5, 0x07, 0x57, 0xff, 0x33 },
+        { 0x16, 0x5a, 0x07, 0x03, 0xa1, 0xf1, 0xd4, 0xa9, 0xeb, 0xda, 0x06, 0xe0, 0x0d, 0xc1, 0x01, 0xb9, 0xb4, 0xaa, 0x82, 0x38, 0xf6, 0x18, 0xfd, 0x2e, 0x45, 0x35, 0x3e, 0x27, 0x6a, 0xc2, 0xb3, 0x25 },
+        { 0x39, 0x6e, 0x3a, 0x4d, 0x89, 0x00, 0x9d, 0xbf, 0x03, 0x87, 0xfe, 0xd4, 0x64, 0x9c, 0x0f, 0xaa, 0xd3, 0x97, 0x48, 0xa6, 0xf4, 0x3f, 0x48, 0x54, 0xe3, 0xfc, 0x56, 0x86, 0x59, 0x5d, 0x6e, 0x06 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x11, 0xf9, 0x49, 0x26, 0x0a, 0x78, 0x60, 0xaf, 0x3a, 0x48, 0xfc, 0x44, 0x78, 0x36, 0xce, 0xbe, 0x94, 0xe9, 0x41, 0xf2, 0xa3, 0x8a, 0xfe, 0x4f, 0x78, 0xeb, 0x82, 0x21, 0x9e, 0x74, 0x94, 0x11 },
+        { 0x01, 0x45, 0xde, 0x7c, 0x76, 0x6c, 0xe3, 0xef, 0x7a, 0x2a, 0x3f, 0x7f, 0x83, 0xc0, 0x17, 0x9f, 0x1e, 0xab, 0x4b, 0xef, 0x2a, 0xb0, 0xe5, 0x86, 0xd8, 0x59, 0x64, 0xca, 0xf6, 0xd5, 0x9f, 0xcd },
+        { 0x13, 0xb9, 0xdf, 0xab, 0xae, 0x09, 0x3c, 0x44, 0x15, 0xb4, 0x54, 0x53, 0x41, 0x19, 0xf6, 0x13, 0x31, 0x42, 0xfe, 0x6b, 0xcd, 0x0a, 0x39, 0x25, 0x5f, 0x3f, 0x6b, 0x32, 0xcc, 0xca, 0x9c, 0xcf },
+        { 0x2e, 0xa2, 0x99, 0x35, 0xb6, 0x80, 0xdd, 0xc9, 0xd0, 0x9d, 0xb5, 0xbb, 0x76, 0x7c, 0x30, 0x8c, 0xf1, 0x09, 0x04, 0x17, 0x74, 0xf5, 0x32, 0x22, 0xcd, 0x32, 0x6a, 0x31, 0x8f, 0x5b, 0x4e, 0xd8 },
+        { 0x3e, 0x7b, 0xb9, 0xad, 0x48, 0x89, 0x8a, 0x96, 0xed, 0x9c, 0xea, 0x1a, 0xcb, 0xe6, 0x47, 0x94, 0x7a, 0xd4, 0x7f, 0xee, 0x84, 0x60, 0xea, 0x29, 0xe4, 0x94, 0x78, 0xf3, 0xb2, 0x61, 0xc6, 0x03 },
+        { 0x1b, 0x03, 0x9f, 0x60, 0x83, 0xa3, 0xeb, 0x39, 0x15, 0x90, 0xf5, 0x0b, 0x21, 0xb2, 0x60, 0xf1, 0xdc, 0xae, 0x2b, 0x91, 0x49, 0x80, 0x6d, 0x95, 0x5e, 0xcf, 0xb0, 0x2b, 0x95, 0x9f, 0xde, 0xac },
+        { 0x1e, 0xc6, 0x27, 0xca, 0xeb, 0x38, 0xac, 0x66, 0x16, 0xf4, 0x45, 0x0c, 0x3a, 0xae, 0x03, 0xa3, 0xd7, 0x46, 0x99, 0xec, 0x58, 0x4f, 0x0a, 0xb0, 0x3a, 0xc2, 0x4f, 0x08, 0x37, 0xd0, 0xf9, 0x03 },
+        { 0x14, 0x2f, 0xbf, 0xa5, 0x4b, 0xa9, 0x0f, 0x41, 0x5c, 0xce, 0x32, 0x1f, 0xb8, 0x44, 0xd3, 0xed, 0xc8, 0xfc, 0xcd, 0x37, 0x5f, 0xc0, 0xfb, 0xba, 0xf0, 0x4d, 0x1f, 0x5e, 0x96, 0x89, 0xa1, 0x87 },
+        { 0x3c, 0x02, 0x82, 0x32, 0x13, 0xb3, 0x81, 0x81, 0x0c, 0x89, 0x2a, 0xfa, 0x5e, 0x77, 0xb5, 0x5e, 0x11, 0x15, 0x45, 0xe5, 0xa3, 0xfd, 0x08, 0x01, 0x91, 0x20, 0xb7, 0x33, 0x61, 0x4d, 0x83, 0x9c },
+        { 0x1f, 0x88, 0x21, 0x59, 0x99, 0x2c, 0xfd, 0x16, 0x97, 0xf3, 0xdb, 0x5b, 0xc2, 0x63, 0x1c, 0x55, 0x03, 0x98, 0x51, 0x2d, 0xa3, 0x11, 0xd8, 0x30, 0x37, 0x75, 0xb4, 0x61, 0x26, 0x9a, 0xcf, 0xc6 },
+        { 0x38, 0xb0, 0xca, 0x06, 0x19, 0x9e, 0xfa, 0xb5, 0xa4, 0x80, 0x6b, 0x24, 0xdc, 0x61, 0xea, 0x66, 0x03, 0x9f, 0xb6, 0xb4, 0xb4, 0x07, 0x4b, 0x14, 0x40, 0xea, 0xb2, 0xa5, 0xe5, 0xb6, 0xdd, 0xdf },
+        { 0x3d, 0xfb, 0x4b, 0x65, 0xf2, 0xcd, 0xfb, 0x71, 0xdf, 0x8e, 0xaf, 0xb8, 0x96, 0xca, 0xe5, 0x53, 0x75, 0xf2, 0x46, 0x70, 0x93, 0x9c, 0xe3, 0xbd, 0x5e, 0xbc, 0xb1, 0xbb, 0x6d, 0x34, 0x21, 0xe9 },
+        { 0x09, 0x7c, 0x29, 0x70, 0x02, 0xef, 0x13, 0x2d, 0xf3, 0xd7, 0x73, 0xc7, 0x97, 0x7c, 0x71, 0x6d, 0x42, 0xdc, 0xf1, 0x63, 0xeb, 0x16, 0x8e, 0x74, 0x55, 0x6d, 0xab, 0x78, 0xac, 0x59, 0x1a, 0x7f },
+        { 0x30, 0xb3, 0xf7, 0x1e, 0x72, 0x57, 0xdb, 0xc1, 0x5d, 0x48, 0xd1, 0xa1, 0xdd, 0x9b, 0x65, 0x5b, 0x6e, 0x8a, 0xc5, 0x1b, 0x36, 0x43, 0xda, 0x16, 0x28, 0x74, 0x32, 0xb7, 0x84, 0x86, 0xc4, 0x70 },
+        { 0x29, 0x28, 0x13, 0xa2, 0x7a, 0x37, 0x48, 0xb8, 0x90, 0x5d, 0x17, 0x09, 0x8d, 0x09, 0x31, 0x26, 0xe0, 0x4b, 0x05, 0x93, 0x0d, 0x5a, 0xcf, 0x6a, 0x01, 0x8c, 0xa5, 0xde, 0x11, 0xc7, 0x3f, 0x92 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x04, 0xc9, 0x17, 0x81, 0xdd, 0xd6, 0xcd, 0xc6, 0x25, 0xe0, 0x14, 0x28, 0x22, 0x3d, 0x2d, 0xf8, 0x32, 0x7d, 0x16, 0xad, 0x23, 0x28, 0x76, 0x1a, 0xa9, 0xf1, 0xe6, 0xc1, 0xc3, 0x84, 0xb8, 0x00 },
+        { 0x3d, 0x73, 0xbb, 0x15, 0x4c, 0x4c, 0xb1, 0x68, 0xc6, 0xb1, 0x55, 0x73, 0xda, 0x8b, 0xb0, 0x45, 0xcc, 0x9f, 0x23, 0xe4, 0xeb, 0xba, 0x48, 0x1d, 0x8f, 0xa2, 0xde, 0x9e, 0x94, 0x63, 0xad, 0x30 },
+        { 0x20, 0x0d, 0x79, 0xc0, 0x2c, 0xa4, 0x03, 0xa6, 0x1a, 0xe0, 0xc9, 0x6c, 0x40, 0xc8, 0x1d, 0x27, 0xe0, 0x74, 0xe3, 0x00, 0x1c, 0x0b, 0xc0, 0x24, 0x43, 0x86, 0xf8, 0x2e, 0x37, 0x8a, 0xf5, 0x44 },
+        { 0x09, 0x42, 0x33, 0x84, 0xf0, 0xd7, 0x4a, 0x20, 0xce, 0x8b, 0xb0, 0x48, 0xdc, 0xd9, 0x7d, 0x62, 0x22, 0xae, 0x78, 0xc1, 0xc3, 0x54, 0x0d, 0x2a, 0xb8, 0xe5, 0x3c, 0x64, 0x67, 0x32, 0x49, 0x26 },
+        { 0x3e, 0x8a, 0x50, 0xa7, 0xaf, 0x3b, 0x74, 0xac, 0xed, 0x7e, 0xeb, 0xa7, 0x31, 0x94, 0x6e, 0x35, 0xef, 0x6f, 0xc9, 0x16, 0x77, 0xfb, 0xbd, 0xcd, 0x36, 0x49, 0xce, 0x4a, 0xe2, 0x90, 0x70, 0xec },
+        { 0x00, 0x70, 0xe3, 0x39, 0xf3, 0x92, 0x58, 0xd6, 0x2d, 0x9c, 0xfe, 0xed, 0xc2, 0x19, 0xa1, 0x26, 0x5b, 0x0a, 0x9d, 0xaa, 0xed, 0x5a, 0xd5, 0x6f, 0x7c, 0x18, 0x29, 0x9e, 0x8f, 0x75, 0x3a, 0x53 },
+        { 0x28, 0x19, 0x3a, 0x8f, 0x8c, 0x87, 0x68, 0x0c, 0x7a, 0x18, 0x76, 0x23, 0x43, 0x85, 0xf6, 0x42, 0xd2, 0xc3, 0xed, 0xbd, 0xf7, 0xca, 0x4a, 0x4e, 0x18, 0x40, 0x93, 0xe1, 0x11, 0x05, 0x93, 0x94 },
+        { 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x46, 0x98, 0xfc, 0x09, 0x4c, 0xf9, 0x1b, 0x99, 0x2d, 0x30, 0xed, 0x00, 0x00, 0x00, 0x00 },
+        { 0x3b, 0x36, 0xe8, 0x7e, 0x22, 0x29, 0x32, 0x39, 0xda, 0x1f, 0xeb, 0xd7, 0xdd, 0xc2, 0xd2, 0x07, 0xef, 0xc9, 0x82, 0x4e, 0xe6, 0x24, 0x83, 0x00, 0xef, 0x3b, 0x4a, 0x2b, 0x3c, 0x7b, 0x48, 0x01 },
+        { 0x02, 0x8c, 0x44, 0xea, 0xb3, 0xb3, 0x4e, 0x97, 0x39, 0x4e, 0xaa, 0x8c, 0x25, 0x74, 0x4f, 0xba, 0x55, 0xa7, 0x75, 0x17, 0x1d, 0x92, 0xb0, 0xfe, 0x09, 0x8a, 0x52, 0x4e, 0x6b, 0x9c, 0x52, 0xd1 },
+        { 0x1f, 0xf2, 0x86, 0x3f, 0xd3, 0x5b, 0xfc, 0x59, 0xe5, 0x1f, 0x36, 0x93, 0xbf, 0x37, 0xe2, 0xd8, 0x41, 0xd1, 0xb5, 0xfb, 0xed, 0x41, 0x38, 0xf7, 0x55, 0xa6, 0x38, 0xbe, 0xc8, 0x75, 0x0a, 0xbd },
+        { 0x36, 0xbd, 0xcc, 0x7b, 0x0f, 0x28, 0xb5, 0xdf, 0x31, 0x74, 0x4f, 0xb7, 0x23, 0x26, 0x82, 0x9d, 0xff, 0x98, 0x20, 0x3a, 0x45, 0xf8, 0xeb, 0xf0, 0xe0, 0x47, 0xf4, 0x88, 0x98, 0xcd, 0xb6, 0xdb },
+        { 0x01, 0x75, 0xaf, 0x58, 0x50, 0xc4, 0x8b, 0x53, 0x12, 0x81, 0x14, 0x58, 0xce, 0x6b, 0x91, 0xca, 0x32, 0xd6, 0xcf, 0xe5, 0x91, 0x51, 0x3b, 0x4e, 0x62, 0xe3, 0x62, 0xa2, 0x1d, 0x6f, 0x8f, 0x15 },
+        { 0x3f, 0x8f, 0x1c, 0xc6, 0x0c, 0x6d, 0xa7, 0x29, 0xd2, 0x63, 0x01, 0x12, 0x3d, 0xe6, 0x5e, 0xd9, 0xc7, 0x3b, 0xfb, 0x51, 0x1b, 0xf2, 0x23, 0xac, 0x1d, 0x15, 0x07, 0x4e, 0x70, 0x8a, 0xc5, 0xae },
+        { 0x17, 0xe6, 0xc5, 0x70, 0x73, 0x78, 0x97, 0xf3, 0x85, 0xe7, 0x89, 0xdc, 0xbc, 0x7a, 0x09, 0xbd, 0x4f, 0x82, 0xab, 0x3e, 0x11, 0x82, 0xae, 0xcd, 0x80, 0xec, 0x9d, 0x0b, 0xee, 0xfa, 0x6c, 0x6d }
+    }
+};
+
+#else
+
+const uint8_t SQRT_FP_ROOTS[SQRT_WINDOWS][16][32] = {
+    {
+        { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd },
+        { 0x18, 0x04, 0x7f, 0xb9, 0xf9, 0x10, 0x68, 0xbc, 0xdf, 0x81, 0x00, 0x16, 0x45, 0x21, 0x41, 0x10, 0x17, 0x64, 0x60, 0xc2, 0x73, 0x4c, 0x46, 0x21, 0x5c, 0xfe, 0x5f, 0x67, 0xcb, 0x15, 0x54, 0x42 },
+        { 0x01, 0xd3, 0x65, 0x27, 0xda, 0x74, 0xde, 0x40, 0x8f, 0x16, 0x45, 0x5f, 0x31, 0x16, 0xae, 0x8e, 0x5a, 0xda, 0x07, 0x98, 0xd9, 0x38, 0xca, 0xb2, 0x39, 0xae, 0x11, 0xc7, 0x99, 0xb3, 0x68, 0x04 },
+        { 0x1d, 0x22, 0x78, 0x1a, 0x63, 0x7a, 0x35, 0x18, 0xad, 0x36, 0x65, 0x03, 0x88, 0x89, 0xab, 0xa9, 0x38, 0x5c, 0x9b, 0xc8, 0xc1, 0x9c, 0xa2, 0x1b, 0xb8, 0xb5, 0xe7, 0x28, 0xc8, 0x5f, 0x64, 0x90 },
+        { 0x02, 0xbd, 0xac, 0x2f, 0xc0, 0x39, 0xae, 0xfb, 0x72, 0x46, 0x36, 0x16, 0x0e, 0x33, 0x2e, 0xbf, 0x79, 0xa1, 0x5a, 0xd3, 0x2a, 0x10, 0xa3, 0xb9, 0xbf, 0xa8, 0x48, 0x2d, 0x7f, 0x4f, 0x7b, 0xc6 },
+        { 0x2a, 0xfd, 0xe1, 0xd5, 0x0d, 0x6a, 0x72, 0x0c, 0xa6, 0x54, 0x46, 0x12, 0x90, 0xcc, 0xf6, 0xc6, 0x6c, 0x41, 0x7c, 0xf6, 0xbc, 0x0f, 0xe5, 0x51, 0x13, 0x5c, 0xef, 0xab, 0xa2, 0xff, 0x26, 0x6c },
+        { 0x30, 0xa1, 0x1e, 0x17, 0xb2, 0x88, 0x81, 0xf7, 0x6b, 0x65, 0x71, 0xbd, 0x60, 0xe0, 0xdd, 0x19, 0x08, 0xd6, 0xe8, 0xdc, 0xeb, 0xb0, 0x9b, 0x2b, 0x61, 0xfa, 0x6e, 0xe2, 0x31, 0x7b, 0xd7, 0x16 },
+        { 0x19, 0x90, 0xbe, 0x42, 0x9e, 0xa7, 0x20, 0xb2, 0x02, 0x44, 0x7f, 0x37, 0x79, 0x81, 0x86, 0xc7, 0x12, 0xf5, 0x77, 0x09, 0x41, 0x51, 0xe6, 0x12, 0xf2, 0xe0, 0xdc, 0xa1, 0x21, 0xe9, 0x77, 0xf9 },
+        { 0x3b, 0xbb, 0x2f, 0x06, 0xf5, 0xe0, 0x5b, 0xc5, 0xef, 0x85, 0x65, 0x11, 0x32, 0x62, 0xde, 0x6d, 0x43, 0x63, 0x96, 0x0a, 0x6c, 0x2a, 0xb6, 0x00, 0x00, 0x57, 0x1a, 0xc5, 0x25, 0xbe, 0x8d, 0x97 },
+        { 0x35, 0xb3, 0x63, 0xf0, 0x7f, 0x7a, 0x52, 0xe3, 0x2a, 0x8d, 0x21, 0x92, 0x11, 0x71, 0x17, 0x4c, 0xa0, 0x95, 0x47, 0xbb, 0x82, 0x7b, 0x69, 0xe4, 0x6f, 0xf9, 0xd9, 0x15, 0x15, 0x80, 0xfa, 0x84 },
+        { 0x21, 0x4b, 0x18, 0x3c, 0x9d, 0x66, 0xf8, 0xdb, 0x78, 0x52, 0xe8, 0x21, 0xb5, 0xe7, 0x02, 0xf6, 0x3e, 0x15, 0xf2, 0x54, 0x7c, 0x09, 0x04, 0x6d, 0xdf, 0x7f, 0xf8, 0x75, 0x16, 0x71, 0x69, 0xb3 },
+        { 0x10, 0xe2, 0xee, 0x31, 0x0e, 0x0f, 0xbd, 0x85, 0x65, 0xe1, 0xa3, 0x4a, 0x6e, 0x2f, 0xe1, 0xaf, 0xaf, 0x0e, 0x87, 0xe5, 0x1d, 0xe7, 0x1f, 0x74, 0x01, 0xdd, 0xb3, 0x27, 0x19, 0x7b, 0x6b, 0xc7 },
+        { 0x23, 0x14, 0x2e, 0xa0, 0x47, 0xa7, 0x47, 0x36, 0x41, 0x1c, 0x23, 0x54, 0x26, 0x33, 0x34, 0x2b, 0x80, 0x8f, 0x69, 0xba, 0x73, 0x14, 0x80, 0xd9, 0x66, 0xeb, 0x98, 0x58, 0x53, 0x1f, 0x05, 0xe3 },
+        { 0x36, 0x59, 0xca, 0x11, 0xa5, 0x60, 0x55, 0x82, 0x94, 0x14, 0xdc, 0x5d, 0x66, 0x12, 0x57, 0x34, 0xc2, 0xa4, 0xbc, 0xed, 0x1f, 0x49, 0xe2, 0xaf, 0x6a, 0xde, 0xa6, 0xb0, 0x8f, 0x4d, 0xcb, 0x9a },
+        { 0x11, 0x3a, 0xae, 0xc9, 0x28, 0xa2, 0xb3, 0xda, 0xcd, 0x7d, 0x96, 0x12, 0x9b, 0x11, 0x84, 0x95, 0x57, 0xb3, 0xc8, 0x0c, 0x93, 0x62, 0x63, 0x62, 0xa9, 0x20, 0x4c, 0x77, 0x1e, 0x45, 0x7f, 0x8b },
+        { 0x36, 0x32, 0x73, 0xea, 0xd2, 0xe6, 0xcb, 0x51, 0xee, 0x7b, 0x70, 0x76, 0x90, 0x2d, 0x73, 0xaa, 0xa9, 0x69, 0x90, 0x6a, 0x0c, 0x5f, 0xd2, 0x73, 0xc4, 0xed, 0x60, 0x98, 0xb9, 0x55, 0x8f, 0x50 }
+    },
+    {
+        { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd },
+        { 0x1c, 0x6a, 0xc3, 0x2c, 0xbc, 0xf9, 0xe9, 0x5f, 0x05, 0x5b, 0xf8, 0x88, 0xf3, 0x8b, 0xb7, 0x42, 0x03, 0x40, 0xcd, 0xd6, 0xac, 0xff, 0xbd, 0xbd, 0xd0, 0x20, 0xfa, 0x66, 0x6f, 0xf5, 0x39, 0x16 },
+        { 0x0a, 0x69, 0x93, 0x2a, 0xdd, 0xf8, 0x02, 0x67, 0x0b, 0x72, 0xc1, 0xb6, 0x79, 0x74, 0x19, 0xad, 0x92, 0x20, 0xf0, 0xa4, 0x64, 0x57, 0x60, 0xfc, 0xa7, 0x99, 0x87, 0xb9, 0xf6, 0x4a, 0xc9, 0x9f },
+        { 0x1b, 0xa3, 0xd8, 0xc6, 0xf0, 0xc4, 0x0d, 0x4a, 0x52, 0x9a, 0xd8, 0x7b, 0x7e, 0xa9, 0x2f, 0x48, 0x7a, 0x73, 0xdf, 0x9f, 0x16, 0x3e, 0x88, 0x29, 0x69, 0x19, 0xbf, 0x34, 0x60, 0xcd, 0x93, 0x7f },
+        { 0x32, 0xed, 0x3e, 0xb2, 0xb9, 0x2f, 0x56, 0x67, 0x07, 0x0b, 0x3c, 0x12, 0x11, 0x9f, 0x4f, 0x70, 0xdd, 0xa2, 0x6b, 0x6b, 0x8e, 0xb6, 0x6b, 0x9a, 0x58, 0xf1, 0x43, 0xc9, 0x45, 0xf7, 0x4c, 0xfe },
+        { 0x06, 0xfd, 0x76, 0xd1, 0xab, 0x4c, 0x43, 0x4d, 0x94, 0xe4, 0x5b, 0x78, 0xc1, 0x83, 0x89, 0x43, 0x72, 0x16, 0xd8, 0xfe, 0x29, 0x14, 0xeb, 0x94, 0x6f, 0x7b, 0x0c, 0xdf, 0xe9, 0x3f, 0x4d, 0x8f },
+        { 0x3b, 0x44, 0x1d, 0xc4, 0xb7, 0x16, 0xf1, 0x2a, 0x29, 0x80, 0x7f, 0xf9, 0x62, 0xcf, 0xf7, 0xc5, 0x75, 0x52, 0x2b, 0x75, 0xab, 0x4f, 0xc9, 0x0d, 0xa2, 0x9e, 0xa7, 0x6e, 0x8c, 0xe3, 0x14, 0x01 },
+        { 0x16, 0x61, 0x74, 0x1c, 0xd1, 0x4a, 0x6d, 0x73, 0xfe, 0x46, 0xe8, 0x1e, 0x76, 0xd4, 0x10, 0x58, 0x24, 0x05, 0xfb, 0x40, 0xb6, 0xe8, 0x76, 0x03, 0xc2, 0x8a, 0x36, 0x4e, 0x30, 0x06, 0xc7, 0x0b },
+        { 0x2a, 0x2f, 0xb1, 0x21, 0x00, 0xe1, 0x30, 0x50, 0x04, 0xf9, 0x1b, 0xa8, 0x27, 0xba, 0xf5, 0x10, 0x9a, 0x2a, 0x69, 0xe4, 0x0c, 0xb5, 0x65, 0x18, 0x52, 0x01, 0xc4, 0x7c, 0xb9, 0x01, 0xfd, 0x70 },
+        { 0x3c, 0xeb, 0x88, 0x15, 0xd3, 0xe8, 0x1a, 0xf7, 0xf4, 0xf0, 0xa3, 0xd8, 0xae, 0xfb, 0xc0, 0x03, 0xab, 0xed, 0xf9, 0xfb, 0x37, 0x69, 0x23, 0x5d, 0xc8, 0x2b, 0xe7, 0x62, 0x1f, 0xb4, 0x58, 0x00 },
+        { 0x3c, 0x47, 0x01, 0xfe, 0x95, 0x94, 0xf6, 0x2f, 0xa0, 0x2a, 0xe8, 0xe7, 0xa3, 0x36, 0xd3, 0x3f, 0x60, 0xdc, 0xf7, 0x67, 0x55, 0x56, 0xf2, 0xd0, 0x67, 0xa2, 0xe8, 0x7f, 0xbd, 0xba, 0x26, 0x5b },
+        { 0x07, 0x0b, 0xea, 0x4f, 0xf7, 0xa1, 0x77, 0x38, 0xdb, 0xf6, 0xc3, 0xe3, 0x49, 0x61, 0xde, 0x00, 0x31, 0x79, 0x7a, 0x5b, 0x1b, 0x84, 0xb3, 0x22, 0x40, 0x0a, 0xab, 0x2d, 0x22, 0xc5, 0x00, 0xf4 },
+        { 0x02, 0x7c, 0xb6, 0x0a, 0x9d, 0xae, 0x12, 0xf4, 0x3c, 0xd1, 0xc7, 0xe9, 0x52, 0xd8, 0xfe, 0x73, 0x01, 0x86, 0x52, 0xcf, 0x27, 0xa6, 0x62, 0xd2, 0xba, 0x7f, 0x8b, 0x14, 0x48, 0x48, 0x72, 0xd8 },
+        { 0x0c, 0x71, 0xdb, 0x06, 0xc8, 0xaf, 0xef, 0x81, 0x2c, 0x8d, 0x1f, 0x20, 0x90, 0x19, 0x7e, 0x45, 0x08, 0xa8, 0x26, 0x8b, 0x42, 0x65, 0xaf, 0x99, 0x77, 0x29, 0xc8, 0xe0, 0x4e, 0xf2, 0x28, 0xaa },
+        { 0x08, 0xc8, 0x00, 0x86, 0xae, 0x24, 0x9a, 0xad, 0x42, 0x11, 0x07, 0xb8, 0xbf, 0x05, 0xa5, 0x4d, 0xc5, 0x11, 0xfc, 0xc0, 0x75, 0xdf, 0x03, 0x02, 0x96, 0x01, 0xad, 0xfb, 0x47, 0xdc, 0x30, 0x64 },
+        { 0x37, 0x46, 0x17, 0xec, 0xc1, 0x18, 0x71, 0x17, 0x29, 0x59, 0x4c, 0xfb, 0x5c, 0x20, 0x3c, 0xba, 0x58, 0x92, 0xcd, 0x1b, 0x59, 0x00, 0xe4, 0xd2, 0x10, 0x7d, 0xc5, 0x87, 0xa4, 0x63, 0x12, 0xf6 }
+    },
+    {
+        { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd },
+        { 0x0c, 0x48, 0xc6, 0xec, 0x0a, 0xbb, 0x7a, 0x66, 0x42, 0xf0, 0xf8, 0x0b, 0xd4, 0x9c, 0x7c, 0xf0, 0x1c, 0x54, 0xc4, 0x7b, 0x0f, 0xf8, 0x59, 0x14, 0x28, 0x1d, 0x7e, 0x00, 0xe5, 0xd1, 0x85, 0x18 },
+        { 0x35, 0xc4, 0x51, 0xa6, 0xd1, 0xea, 0xc3, 0xeb, 0x4c, 0x1c, 0x4b, 0xb1, 0xe7, 0xd4, 0x94, 0x5e, 0x9a, 0xdf, 0x07, 0x70, 0x9f, 0x93, 0xe6, 0xa2, 0x23, 0x49, 0x0a, 0xb3, 0x31, 0x0c, 0xf5, 0xad },
+        { 0x3b, 0xfa, 0x2b, 0x3a, 0xf6, 0x6b, 0xa0, 0xb7, 0x2d, 0x3e, 0xe8, 0x61, 0x3a, 0x1d, 0x98, 0x00, 0xe3, 0x40, 0x2a, 0xdc, 0x15, 0xc5, 0x1c, 0xdf, 0xc5, 0x43, 0xfc, 0xc8, 0x13, 0xa8, 0xb2, 0x8a },
+        { 0x37, 0x34, 0x15, 0x75, 0x9b, 0x76, 0xcb, 0x44, 0xca, 0xb7, 0x56, 0x97, 0x02, 0xfd, 0x17, 0x7d, 0xc5, 0x63, 0xae, 0x31, 0x1d, 0xf0, 0x01, 0xc0, 0xf9, 0x60, 0x84, 0x7d, 0xd1, 0x7e, 0x47, 0x18 },
+        { 0x3b, 0x06, 0xa9, 0x1a, 0x74, 0x6e, 0x1c, 0x47, 0x88, 0xb6, 0xe0, 0x5a, 0x67, 0xdb, 0x15, 0x58, 0x85, 0xfd, 0x93, 0x11, 0x86, 0xb7, 0xe7, 0x53, 0xc1, 0xa9, 0xa5, 0x3c, 0xa6, 0x5d, 0x6e, 0x11 },
+        { 0x26, 0x07, 0xb8, 0x5c, 0xae, 0x41, 0xd3, 0x08, 0x0f, 0xde, 0x40, 0x46, 0x93, 0x93, 0x8c, 0xe4, 0xc7, 0x45, 0xcb, 0x83, 0x82, 0x65, 0x61, 0x1e, 0x5b, 0x50, 0x97, 0x5f, 0x3b, 0xaa, 0x61, 0xdc },
+        { 0x37, 0x2a, 0x1a, 0x6d, 0x77, 0x14, 0x63, 0x53, 0xc9, 0x89, 0xf9, 0x10, 0xc9, 0x92, 0x6b, 0xdf, 0xf8, 0x89, 0xd7, 0xee, 0x9e, 0x0e, 0x8f, 0xb3, 0x50, 0x79, 0xc2, 0x22, 0x1d, 0x90, 0x98, 0x12 },
+        { 0x05, 0xcf, 0xd8, 0xe6, 0x6c, 0x40, 0x6b, 0xcf, 0xc5, 0x41, 0x34, 0x91, 0x91, 0x01, 0x38, 0xa4, 0x9a, 0xed, 0xe8, 0xc2, 0x16, 0x4e, 0x94, 0xae, 0x50, 0x2d, 0x92, 0x2a, 0x86, 0x0e, 0x02, 0x48 },
+        { 0x02, 0x3b, 0x26, 0x06, 0x91, 0xee, 0x50, 0x70, 0x2d, 0x5e, 0xff, 0x28, 0x57, 0x1f, 0x0f, 0xe1, 0xb5, 0x89, 0x1f, 0x82, 0x36, 0xcd, 0x43, 0x22, 0x0b, 0x13, 0xac, 0xd2, 0xde, 0xdb, 0x68, 0x4a },
+        { 0x10, 0x82, 0x73, 0xe6, 0xa0, 0x9c, 0x96, 0xa0, 0xd8, 0xde, 0xeb, 0xc3, 0x21, 0x1f, 0x82, 0xbe, 0xe7, 0xa6, 0xbf, 0x78, 0xa2, 0x5a, 0x7c, 0x26, 0x49, 0x1c, 0x8f, 0xab, 0x59, 0x95, 0xfd, 0xde },
+        { 0x14, 0x4f, 0x65, 0xc6, 0x74, 0x44, 0xdf, 0xa5, 0x84, 0x08, 0xd6, 0x7c, 0xaf, 0x45, 0x83, 0x83, 0x8f, 0x82, 0x35, 0x39, 0x39, 0xc3, 0x25, 0x47, 0x2f, 0xde, 0x87, 0x80, 0x1b, 0x92, 0xa2, 0x2e },
+        { 0x38, 0xbb, 0xfd, 0xd4, 0xeb, 0x8d, 0x72, 0x1e, 0x61, 0x23, 0xaf, 0x04, 0x0b, 0x49, 0x32, 0x02, 0xb1, 0xed, 0x39, 0xc7, 0xfa, 0xfa, 0xe8, 0x4c, 0x91, 0xcf, 0x93, 0x58, 0x94, 0x30, 0x5f, 0xb1 },
+        { 0x03, 0xbd, 0x55, 0x35, 0x22, 0x09, 0xa8, 0xb2, 0x5d, 0xb3, 0x03, 0xc0, 0x7b, 0x9f, 0x05, 0x7e, 0xcc, 0xc5, 0x1a, 0x6e, 0xdb, 0x7d, 0x01, 0x0d, 0x9d, 0x0e, 0x2a, 0xcf, 0x7c, 0xdf, 0x9f, 0x2f },
+        { 0x1d, 0x53, 0xa2, 0x6c, 0x68, 0xac, 0x1e, 0x41, 0x3d, 0xa7, 0x9c, 0x18, 0x52, 0x7f, 0x63, 0xf6, 0xac, 0xa6, 0x31, 0x36, 0x7e, 0x4d, 0x85, 0xa9, 0x02, 0x2b, 0xac, 0xbc, 0x91, 0x1f, 0xdb, 0x8e },
+        { 0x26, 0x95, 0xbd, 0xae, 0xfa, 0x0f, 0xb0, 0xf1, 0xb4, 0x20, 0x3c, 0x1a, 0x1f, 0x12, 0x47, 0x47, 0x99, 0xb2, 0x24, 0x3e, 0xc7, 0x65, 0x9f, 0x1b, 0xdb, 0x86, 0x49, 0x86, 0x71, 0xff, 0x37, 0x27 }
+    },
+    {
+        { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd },
+        { 0x31, 0xea, 0x15, 0xf1, 0xac, 0xd4, 0x6e, 0x73, 0xe4, 0xf2, 0x6d, 0xf7, 0xf8, 0xab, 0x03, 0x71, 0x4c, 0xd4, 0x03, 0x2c, 0xa9, 0xfb, 0xc7, 0xcc, 0x51, 0x97, 0xdf, 0x49, 0x59, 0x03, 0xed, 0xd6 },
+        { 0x3c, 0x79, 0x78, 0xe8, 0xb4, 0x1f, 0x50, 0xd3, 0xbf, 0x94, 0x92, 0xad, 0xb9, 0x49, 0xc6, 0xe6, 0x23, 0x08, 0x17, 0x11, 0x69, 0xa2, 0x1f, 0x4e, 0x89, 0x99, 0x0b, 0xe1, 0x0d, 0x94, 0x14, 0x0e },
+        { 0x12, 0xcb, 0x3f, 0xbb, 0x95, 0xa5, 0x58, 0x51, 0x37, 0x62, 0x28, 0xb1, 0xde, 0x6e, 0x7e, 0x3d, 0x35, 0x70, 0x47, 0xf6, 0x27, 0x9c, 0x10, 0x55, 0x76, 0xad, 0xe6, 0x7b, 0xf2, 0xe3, 0x5d, 0x07 },
+        { 0x0b, 0x69, 0xc1, 0x28, 0xef, 0x08, 0xdb, 0x88, 0xe4, 0xbc, 0x42, 0x1e, 0x6d, 0xe6, 0x41, 0x19, 0x7a, 0x4d, 0x3a, 0x76, 0x41, 0x26, 0xbd, 0x02, 0x10, 0x80, 0x21, 0x90, 0xc3, 0x5f, 0xbc, 0x24 },
+        { 0x15, 0x54, 0xed, 0x92, 0xe2, 0x53, 0x78, 0x78, 0x38, 0xc3, 0x5b, 0xee, 0x13, 0x79, 0x95, 0xca, 0x37, 0x6f, 0xd8, 0x1b, 0x93, 0x57, 0xcf, 0x63, 0x6a, 0xd5, 0x63, 0x01, 0xde, 0xf0, 0xc5, 0xf1 },
+        { 0x17, 0x9b, 0xa3, 0xfb, 0xb7, 0xae, 0x64, 0x12, 0xa0, 0x2e, 0x69, 0x9a, 0xa9, 0x07, 0x1e, 0x53, 0x42, 0x18, 0x6a, 0x71, 0xb5, 0xbb, 0xca, 0x71, 0x74, 0x15, 0x50, 0xde, 0xcc, 0xf6, 0x64, 0x84 },
+        { 0x04, 0x34, 0xab, 0x74, 0xbe, 0x7a, 0xf2, 0x35, 0x88, 0xdf, 0xa6, 0xd1, 0x3f, 0x3e, 0x8d, 0x0a, 0xe9, 0xde, 0xea, 0x48, 0x47, 0x6a, 0x2d, 0x94, 0x89, 0x3f, 0xc2, 0x4d, 0xb0, 0xd5, 0x1f, 0x47 },
+        { 0x25, 0xb6, 0xde, 0x6c, 0x62, 0x71, 0x03, 0xcc, 0xd0, 0x49, 0x5b, 0xa4, 0x62, 0x0a, 0x60, 0xdd, 0x92, 0xa5, 0x64, 0x08, 0x1f, 0x65, 0x41, 0x3a, 0x76, 0xc9, 0x67, 0x91, 0x71, 0x1e, 0x79, 0x4f },
+        { 0x26, 0xd9, 0xb8, 0x3b, 0x46, 0x38, 0x22, 0x22, 0xfb, 0xf6, 0x09, 0x0a, 0x1e, 0x1a, 0xb4, 0x60, 0x79, 0xad, 0xd3, 0x07, 0x17, 0x70, 0xc6, 0xa5, 0x88, 0x8e, 0x89, 0x1f, 0xaf, 0x7a, 0xc0, 0x9d },
+        { 0x01, 0x61, 0x19, 0x26, 0xd5, 0x28, 0x5e, 0xdd, 0x39, 0x4a, 0x14, 0xd1, 0x49, 0x64, 0x8a, 0xbb, 0x43, 0xa9, 0x29, 0x65, 0x5b, 0x90, 0x87, 0x27, 0x91, 0x25, 0x7e, 0x54, 0x6c, 0x96, 0xca, 0x38 },
+        { 0x3c, 0xd6, 0x92, 0xb6, 0xa6, 0x56, 0x48, 0xca, 0x1d, 0xaf, 0x22, 0x4a, 0x34, 0x2a, 0xc6, 0x67, 0x55, 0x5d, 0x86, 0x1e, 0x23, 0xf4, 0x3a, 0xa5, 0x67, 0xd4, 0xb7, 0x3f, 0xc0, 0xf7, 0xce, 0xac },
+        { 0x23, 0xfc, 0x6d, 0xf0, 0x81, 0x9b, 0xec, 0x66, 0x39, 0xa3, 0x03, 0x2d, 0x13, 0x6d, 0xf8, 0x7f, 0x19, 0x39, 0x23, 0xbf, 0xe0, 0x22, 0x1f, 0xb1, 0x68, 0x66, 0x01, 0x72, 0x57, 0x57, 0x5a, 0xda },
+        { 0x08, 0xa2, 0x0b, 0x59, 0x1e, 0x1f, 0x7c, 0x98, 0x61, 0xd4, 0x1a, 0x9d, 0xe5, 0x83, 0xf0, 0x10, 0x41, 0x14, 0x72, 0x6c, 0x59, 0x15, 0x4a, 0xc5, 0xd2, 0x0a, 0x0f, 0xc4, 0xfd, 0x30, 0xb5, 0x7c },
+        { 0x27, 0xfa, 0x6a, 0xee, 0x24, 0x07, 0x94, 0xc8, 0x8f, 0xac, 0xf1, 0xef, 0x51, 0x41, 0x88, 0x07, 0x67, 0x3f, 0x4f, 0x95, 0xdd, 0xc6, 0xe6, 0xb5, 0x35, 0xb3, 0x89, 0x57, 0x77, 0xb7, 0x7c, 0xf7 },
+        { 0x38, 0x9a, 0xb3, 0x0f, 0x6d, 0xbd, 0xe1, 0x80, 0x7c, 0x6f, 0x89, 0xa8, 0xf5, 0xb1, 0xe1, 0xc5, 0x4d, 0x6a, 0x50, 0xfd, 0x78, 0x1c, 0x34, 0xe0, 0x1a, 0xdd, 0xac, 0x82, 0xa0, 0xd4, 0xa7, 0xf5 }
+    },
+    {
+        { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd },
+        { 0x17, 0xcc, 0xf4, 0x94, 0x7f, 0x47, 0x88, 0x56, 0xbe, 0x7b, 0x3b, 0x2b, 0x6a, 0x16, 0x4e, 0x05, 0xbd, 0xd1, 0x59, 0x63, 0x90, 0xbc, 0xb4, 0x5e, 0x16, 0x45, 0x5d, 0xab, 0xae, 0xb1, 0x5b, 0x15 },
+        { 0x32, 0x46, 0x0e, 0xc6, 0xb7, 0x8f, 0xf3, 0x58, 0x00, 0x49, 0x3d, 0xba, 0x0d, 0x99, 0x20, 0xfc, 0x0e, 0xe0, 0x41, 0x4e, 0x8f, 0x23, 0xe8, 0xdc, 0x5d, 0xb8, 0x0c, 0x23, 0xc8, 0xb7, 0x93, 0xe2 },
+        { 0x00, 0x28, 0x22, 0x20, 0x39, 0xcf, 0x55, 0x3e, 0xad, 0xe7, 0xee, 0xaa, 0x07, 0xdc, 0x98, 0x41, 0x9c, 0x94, 0xad, 0x51, 0xd5, 0xd8, 0x0c, 0xa1, 0xce, 0xcc, 0xee, 0xc7, 0xda, 0xb5, 0x51, 0xa7 },
+        { 0x24, 0x78, 0x79, 0xd7, 0xb6, 0xa8, 0xd6, 0xa6, 0x42, 0xc6, 0x49, 0x66, 0x76, 0x40, 0x60, 0xe7, 0x94, 0xb6, 0xba, 0xe1, 0x9f, 0x31, 0x32, 0xd0, 0xbe, 0xad, 0x03, 0x41, 0x10, 0x3e, 0x86, 0xff },
+        { 0x1c, 0xb8, 0x0e, 0x6a, 0x59, 0xc4, 0xca, 0x43, 0xcd, 0xe7, 0x03, 0x64, 0xb6, 0xd8, 0xca, 0x7d, 0x7d, 0x7f, 0x69, 0xeb, 0x96, 0x2d, 0x42, 0xbd, 0x0a, 0xaa, 0x02, 0x4b, 0xa7, 0xde, 0x6e, 0x76 },
+        { 0x1f, 0x18, 0xba, 0x9a, 0xc2, 0xc8, 0x06, 0xd1, 0xe8, 0x76, 0x19, 0x91, 0x6b, 0x9c, 0x92, 0x80, 0x8a, 0xf4, 0x03, 0xb2, 0x94, 0x46, 0xb2, 0x36, 0x0d, 0x6c, 0x52, 0x16, 0xc4, 0x1c, 0x49, 0x8a },
+        { 0x23, 0x0b, 0xf2, 0x9f, 0xf6, 0xe6, 0x30, 0x46, 0x2a, 0x2f, 0xee, 0x0d, 0x80, 0xcd, 0xd8, 0xd7, 0xbd, 0xf9, 0x1c, 0x13, 0x81, 0xd6, 0x02, 0xb0, 0x0c, 0xd8, 0x4e, 0xb7, 0x33, 0xaa, 0x12, 0x94 },
+        { 0x0d, 0x54, 0x14, 0x92, 0x2e, 0xff, 0x66, 0x0d, 0xbd, 0x99, 0x28, 0x8d, 0xd8, 0xf4, 0x37, 0x37, 0x31, 0x99, 0xce, 0x25, 0xe6, 0xfd, 0x3e, 0x72, 0xed, 0x9a, 0xca, 0xac, 0x3b, 0x3f, 0xea, 0xfb },
+        { 0x0f, 0x58, 0x85, 0xcc, 0x92, 0x2d, 0xc6, 0x33, 0x9a, 0x2f, 0xea, 0xa8, 0x66, 0x4a, 0x24, 0xb4, 0x8d, 0x93, 0xa9, 0xfc, 0x5b, 0x6b, 0x52, 0xdf, 0xd3, 0xd4, 0x88, 0x4f, 0x33, 0x7a, 0x0f, 0xa7 },
+        { 0x01, 0xce, 0x76, 0xbe, 0x3a, 0xc2, 0x2a, 0xe9, 0x70, 0xb8, 0xa1, 0x1a, 0x95, 0x98, 0x7b, 0xa9, 0x87, 0x1a, 0x02, 0x99, 0xd2, 0xb8, 0xd3, 0x90, 0x48, 0x3f, 0x15, 0x2e, 0x5a, 0xfe, 0x2a, 0xf9 },
+        { 0x0b, 0x1b, 0xa5, 0x5f, 0x88, 0x81, 0xc3, 0x08, 0x70, 0x9c, 0xfa, 0xf8, 0x76, 0xb1, 0x82, 0x8b, 0xe0, 0xc6, 0x92, 0x80, 0x68, 0xab, 0x46, 0xb4, 0x0a, 0xd1, 0xb6, 0xe5, 0xe5, 0x60, 0x25, 0xda },
+        { 0x0f, 0xbe, 0x05, 0x17, 0xb8, 0xe0, 0x8a, 0x54, 0x1e, 0x5e, 0xd8, 0xf8, 0x0c, 0x41, 0xec, 0x80, 0xf1, 0x02, 0x79, 0x0b, 0x35, 0x4c, 0x9c, 0x01, 0xc4, 0x6d, 0x1e, 0x3c, 0xc8, 0x2e, 0xac, 0xa3 },
+        { 0x07, 0xd6, 0x35, 0x44, 0x1f, 0x69, 0x73, 0xad, 0x6f, 0xba, 0x4a, 0xf3, 0x39, 0xfc, 0x5f, 0x9c, 0xdd, 0xed, 0xd2, 0x3d, 0x0a, 0x3d, 0xb6, 0xb7, 0x71, 0xf2, 0x2f, 0x93, 0xf8, 0xb3, 0xf7, 0x1d },
+        { 0x32, 0xdb, 0x27, 0x2c, 0x3d, 0xc9, 0xc4, 0x55, 0xf1, 0x43, 0x8f, 0xd2, 0x0f, 0x81, 0x2b, 0x0f, 0x85, 0xcd, 0xe9, 0xdc, 0x5a, 0xe4, 0x79, 0xa0, 0x5f, 0x87, 0xbd, 0x64, 0xb9, 0x04, 0x56, 0xd1 },
+        { 0x2e, 0x1d, 0x30, 0x05, 0xf3, 0x13, 0x48, 0x02, 0x1c, 0xbb, 0x68, 0x8a, 0x39, 0x06, 0xae, 0x68, 0x5e, 0xfb, 0x34, 0x0c, 0x7b, 0x79, 0xd9, 0x8a, 0x8f, 0x61, 0x9c, 0x2d, 0x07, 0x36, 0x1d, 0x2a }
+    },
+    {
+        { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd },
+        { 0x2f, 0x5e, 0x37, 0x2e, 0xa4, 0x9e, 0x45, 0x7c, 0x4e, 0x29, 0xf7, 0x7e, 0x8d, 0x0c, 0x29, 0x02, 0xe1, 0x92, 0x71, 0x5a, 0x10, 0x68, 0x41, 0xc4, 0x4e, 0x9f, 0x8a, 0xf7, 0x97, 0xeb, 0x86, 0x84 },
+        { 0x04, 0x48, 0x61, 0x6b, 0x35, 0x06, 0xa7, 0xbb, 0x73, 0xdd, 0xe4, 0x18, 0x76, 0xef, 0x35, 0x8f, 0xd1, 0xb4, 0xd0, 0x44, 0x9c, 0x38, 0xe9, 0x55, 0x2e, 0x8d, 0x8b, 0x45, 0x72, 0x3f, 0xf4, 0x80 },
+        { 0x2d, 0x5b, 0x28, 0x48, 0x74, 0x78, 0x02, 0xbd, 0x77, 0x67, 0xa1, 0xd0, 0x05, 0x50, 0x9e, 0xb8, 0x00, 0x9f, 0x67, 0x86, 0x49, 0x6b, 0x56, 0xbd, 0x3b, 0x9f, 0x40, 0x51, 0x10, 0xe8, 0xe9, 0x7b },
+        { 0x12, 0x18, 0xa2, 0x77, 0xa2, 0xbd, 0xe0, 0xa2, 0xe8, 0xea, 0x04, 0xf2, 0x5d, 0x93, 0xcf, 0x27, 0x8b, 0xe3, 0xd3, 0x3c, 0x2f, 0x03, 0x4a, 0xd4, 0x65, 0xa4, 0x8f, 0xfd, 0x99, 0x08, 0xf6, 0x33 },
+        { 0x31, 0x5b, 0xdb, 0xd9, 0x13, 0x82, 0x91, 0xb1, 0x1c, 0x11, 0x7b, 0xb2, 0x31, 0x4c, 0x3b, 0xe4, 0xf4, 0x23, 0x32, 0xb2, 0x5a, 0xe7, 0x1c, 0x2f, 0xb1, 0x76, 0xcd, 0x90, 0xf4, 0x2d, 0x30, 0x91 },
+        { 0x0e, 0x8a, 0x79, 0x4a, 0xde, 0x3d, 0x34, 0x2d, 0x0d, 0x62, 0xd6, 0xbe, 0xaa, 0xe3, 0x2c, 0x8c, 0xcb, 0x85, 0x30, 0x47, 0xab, 0x8f, 0xe3, 0xd5, 0x51, 0x91, 0xba, 0xf5, 0x35, 0xf5, 0x32, 0x1a },
+        { 0x17, 0x86, 0x66, 0xce, 0x0a, 0x29, 0x69, 0xb4, 0xe3, 0xe2, 0xa2, 0x50, 0x0b, 0xec, 0x65, 0x4d, 0x54, 0xa0, 0xc7, 0xb9, 0xb8, 0x3a, 0x38, 0x5e, 0x14, 0x94, 0x5b, 0x82, 0x81, 0x1b, 0x94, 0xbb },
+        { 0x24, 0x1d, 0xb4, 0xca, 0x80, 0x27, 0xab, 0x61, 0x18, 0xac, 0xe1, 0xb6, 0xcc, 0xf1, 0x72, 0xf8, 0xa2, 0x63, 0xe7, 0x97, 0xe6, 0xc2, 0xc9, 0x02, 0x0c, 0xd7, 0x50, 0x7e, 0xb7, 0xb5, 0x5b, 0xc5 },
+        { 0x16, 0x90, 0x48, 0x43, 0x91, 0xb8, 0x81, 0xf6, 0xbd, 0x4c, 0x53, 0x9d, 0xfc, 0x81, 0xa9, 0xe4, 0xde, 0xff, 0x33, 0x58, 0xc1, 0x61, 0x9a, 0x5e, 0x40, 0xa2, 0xe6, 0x21, 0x5c, 0x3a, 0xd9, 0xaf },
+        { 0x32, 0x9e, 0xdb, 0xd1, 0xf7, 0x02, 0xdb, 0x95, 0x2a, 0xa1, 0x79, 0x8f, 0x3f, 0xe8, 0x50, 0x96, 0xf7, 0x9e, 0x22, 0xe0, 0xa2, 0x9d, 0x00, 0x77, 0x74, 0x59, 0xd1, 0xc9, 0x46, 0xc5, 0xc2, 0xc2 },
+        { 0x21, 0x18, 0x0a, 0xdc, 0x47, 0x32, 0x1c, 0x35, 0x96, 0x9b, 0x70, 0x39, 0x34, 0xd6, 0xba, 0x66, 0x8d, 0xd0, 0x0b, 0x8d, 0x88, 0x32, 0xd9, 0xe2, 0x43, 0xf3, 0x7d, 0x72, 0x27, 0x20, 0xb3, 0x11 },
+        { 0x09, 0xf4, 0x17, 0xeb, 0x43, 0x1a, 0xa2, 0x37, 0x44, 0xb3, 0x6a, 0xda, 0x9d, 0x7d, 0x22, 0x3c, 0x0a, 0x93, 0xe4, 0x7c, 0x7f, 0xc7, 0x5e, 0x11, 0xe8, 0xd8, 0xc7, 0x73, 0x8a, 0x7a, 0xc8, 0x1d },
+        { 0x05, 0xd2, 0xd4, 0x92, 0x54, 0x6d, 0x1c, 0x57, 0x2a, 0xd1, 0x16, 0x98, 0xb4, 0xa6, 0x45, 0xe1, 0xd5, 0x8e, 0x9d, 0xff, 0xa1, 0xc9, 0xe9, 0x62, 0xa9, 0xf7, 0x7c, 0x48, 0x54, 0x64, 0xf9, 0xcf },
+        { 0x14, 0xc8, 0xf8, 0xb3, 0x65, 0x57, 0x6e, 0x48, 0x9f, 0x9d, 0xb7, 0x1c, 0x12, 0xb9, 0xf8, 0x3f, 0xee, 0xb8, 0x14, 0x32, 0x9a, 0x6a, 0x2b, 0x5a, 0x51, 0x0a, 0xc2, 0xa3, 0x94, 0x81, 0x49, 0x13 },
+        { 0x0d, 0x46, 0x8d, 0x7a, 0x4d, 0x5e, 0xcc, 0xe0, 0xb5, 0x3f, 0x1a, 0x00, 0x52, 0x58, 0xde, 0x4a, 0x5d, 0xa1, 0xe3, 0xca, 0x07, 0xc4, 0xb7, 0x25, 0x8e, 0x56, 0x42, 0x68, 0xb1, 0x70, 0xed, 0x40 }
+    },
+    {
+        { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd },
+        { 0x2b, 0x90, 0xf1, 0x07, 0x30, 0xde, 0xa5, 0x33, 0xfa, 0xbc, 0xff, 0x5a, 0x5a, 0x83, 0x3b, 0xdc, 0x99, 0xfe, 0x6e, 0xd9, 0xac, 0x8c, 0x9a, 0x8b, 0x3f, 0x4b, 0x89, 0x66, 0x7f, 0x42, 0x00, 0xa0 },
+        { 0x27, 0x09, 0x94, 0xbe, 0x59, 0xee, 0x16, 0x88, 0x65, 0x3e, 0x9e, 0xe6, 0x65, 0x5e, 0xc9, 0xca, 0x27, 0xcf, 0xdb, 0x43, 0x56, 0xc5, 0xa3, 0x34, 0x5c, 0xe1, 0x0b, 0x11, 0x99, 0x44, 0x71, 0xdb },
+        { 0x3d, 0x9b, 0xe9, 0xab, 0x3d, 0xd5, 0x36, 0xb9, 0x22, 0x76, 0xdd, 0x3e, 0xc6, 0x7f, 0x98, 0x91, 0x4a, 0x6d, 0x3f, 0x5b, 0x50, 0x29, 0x43, 0xab, 0x18, 0xf1, 0x0e, 0x20, 0x29, 0x1c, 0x53, 0x08 },
+        { 0x33, 0x4a, 0xfd, 0x13, 0x24, 0x87, 0xec, 0x24, 0x3d, 0x87, 0x5a, 0xd5, 0xf8, 0xe6, 0x20, 0x78, 0x08, 0x8c, 0xaa, 0xb9, 0x90, 0xe6, 0xfc, 0xd7, 0xb4, 0x5b, 0xc2, 0xaa, 0xba, 0x47, 0x02, 0x34 },
+        { 0x1e, 0xa9, 0x2f, 0xfa, 0x85, 0x46, 0x8f, 0xe0, 0xcd, 0x19, 0x87, 0xc4, 0x76, 0xc7, 0x76, 0x7d, 0x0c, 0x3e, 0x81, 0xaa, 0xbc, 0xcf, 0xf0, 0x3d, 0x47, 0x0a, 0x0e, 0xd3, 0x7e, 0x91, 0x14, 0xae },
+        { 0x19, 0xb3, 0xab, 0xc5, 0x80, 0x33, 0x46, 0xe9, 0x79, 0x6f, 0xe5, 0x90, 0x6f, 0x11, 0x21, 0x87, 0x2a, 0xfc, 0xce, 0xcd, 0x85, 0x31, 0x7b, 0xf4, 0x91, 0xfd, 0xe2, 0xf7, 0xdf, 0x65, 0x80, 0x65 },
+        { 0x1a, 0x0c, 0xa8, 0x59, 0x2b, 0x65, 0xbf, 0x06, 0xdf, 0x6a, 0x1d, 0xd7, 0xb9, 0x5f, 0x9a, 0xe0, 0x72, 0x28, 0xd9, 0x81, 0xc3, 0x75, 0xbb, 0x6d, 0x08, 0x57, 0x1a, 0x61, 0x29, 0x22, 0x1b, 0x0e },
+        { 0x3c, 0xf5, 0x23, 0x21, 0xd4, 0xf1, 0x61, 0xd3, 0xfc, 0x19, 0x88, 0xe6, 0x8a, 0x9f, 0x75, 0xe0, 0x2b, 0x8b, 0x67, 0xf0, 0x6f, 0xf5, 0xe5, 0xec, 0xed, 0x01, 0x57, 0x66, 0xaf, 0xf0, 0x86, 0x80 },
+        { 0x28, 0xde, 0x70, 0x26, 0xb1, 0x86, 0x81, 0xe6, 0x42, 0x22, 0x5b, 0xd9, 0x1d, 0xfe, 0xc6, 0x8f, 0x81, 0x6a, 0x54, 0x5a, 0x5f, 0xee, 0xae, 0x83, 0x82, 0x75, 0x7b, 0x6f, 0x12, 0xeb, 0x48, 0x28 },
+        { 0x2a, 0x4e, 0x25, 0xfc, 0x31, 0x81, 0x57, 0x23, 0x5a, 0xc9, 0xe2, 0x12, 0x9e, 0xfa, 0xce, 0xde, 0xa7, 0x36, 0xf4, 0x25, 0xa1, 0xd3, 0x17, 0x59, 0xd2, 0xac, 0x97, 0xa2, 0x81, 0x5d, 0xdc, 0x9b },
+        { 0x3a, 0x3a, 0x04, 0xa0, 0x1f, 0x43, 0x44, 0xed, 0x38, 0xbd, 0x2a, 0x7d, 0x1a, 0x78, 0x29, 0x6d, 0x9c, 0xe3, 0xcb, 0xcc, 0x12, 0xe6, 0x43, 0xf1, 0x52, 0xfd, 0xbc, 0x09, 0x63, 0x61, 0x0d, 0xcc },
+        { 0x16, 0x38, 0x4c, 0x25, 0x39, 0x82, 0xf2, 0xf8, 0x20, 0x23, 0xcf, 0xee, 0xc0, 0xf4, 0x47, 0x6d, 0x89, 0x95, 0xef, 0x4d, 0xb8, 0x7e, 0x01, 0xb8, 0x2e, 0xdd, 0xa8, 0x7a, 0x8c, 0x41, 0x71, 0x56 },
+        { 0x0b, 0xc0, 0x68, 0xd3, 0x33, 0x36, 0x98, 0x2a, 0x22, 0x08, 0x84, 0xb2, 0x85, 0xab, 0x2e, 0xfc, 0x7f, 0xd9, 0x1b, 0xea, 0xfc, 0x9a, 0xf2, 0x7e, 0x37, 0x89, 0x23, 0x3c, 0x6a, 0xe9, 0x9a, 0xce },
+        { 0x00, 0xff, 0xaf, 0x70, 0x99, 0xdc, 0xd6, 0xaf, 0xe6, 0x61, 0x4a, 0x2c, 0xd9, 0xf3, 0xbd, 0x13, 0xc7, 0x29, 0x0f, 0xaa, 0x42, 0x12, 0xf5, 0xb4, 0xa9, 0x9b, 0xad, 0xa5, 0x60, 0xa9, 0xc4, 0x89 },
+        { 0x26, 0x57, 0x3a, 0x0f, 0x14, 0x27, 0x3e, 0x81, 0xfc, 0x74, 0xc0, 0x4f, 0x50, 0x57, 0x72, 0x3f, 0x81, 0xb0, 0xde, 0x70, 0x52, 0xb0, 0x7e, 0xaf, 0x35, 0x54, 0x0a, 0x8f, 0x80, 0x7c, 0xe2, 0x22 }
+    },
+    {
+        { 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x2c, 0x35, 0x0b, 0xe4, 0x19, 0x14, 0xad, 0x34, 0x78, 0x6d, 0x38, 0xff, 0xff, 0xff, 0xfd },
+        { 0x14, 0xcc, 0x05, 0x4c, 0xda, 0x06, 0xfd, 0x17, 0x1a, 0x2d, 0xc5, 0x66, 0xc5, 0x31, 0x87, 0x7d, 0xfe, 0xca, 0x29, 0xbc, 0xce, 0x5a, 0xd4, 0x23, 0x9f, 0x91, 0xfe, 0x66, 0xf2, 0x20, 0x53, 0x43 },
+        { 0x20, 0xc7, 0xf4, 0x4d, 0xdf, 0x56, 0x0f, 0x7b, 0x79, 0x2c, 0xf8, 0x9e, 0x6c, 0x9e, 0x71, 0x97, 0x21, 0x80, 0x23, 0xc7, 0x70, 0x3f, 0x86, 0xaf, 0xe6, 0x33, 0xf8, 0xbb, 0x03, 0x59, 0x49, 0xc8 },
+        { 0x11, 0xa0, 0xed, 0xd8, 0xeb, 0xf7, 0x63, 0xf4, 0xc7, 0x4a, 0xb0, 0x97, 0x63, 0xbc, 0x09, 0x1e, 0x35, 0x9b, 0x53, 0x3e, 0x41, 0xaa, 0x6a, 0xb7, 0x50, 0x6f, 0x82, 0x14, 0x10, 0xe8, 0xd1, 0x21 },
+        { 0x21, 0xa8, 0xa8, 0x7d, 0x7d, 0x90, 0x2b, 0xa3, 0xb3, 0x39, 0x40, 0xac, 0xe5, 0x78, 0xf0, 0x46, 0xad, 0x11, 0x1b, 0x98, 0x57, 0xb8, 0x40, 0x20, 0xaf, 0x57, 0x49, 0x8a, 0xeb, 0x21, 0x41, 0x7f },
+        { 0x1e, 0x75, 0xba, 0xe8, 0x56, 0xa7, 0xf0, 0xaa, 0x95, 0xad, 0x8d, 0x79, 0xb5, 0x1f, 0x18, 0x7f, 0x99, 0x6a, 0x49, 0xe1, 0x0e, 0x2c, 0xa0, 0xc0, 0x4b, 0xd4, 0xea, 0x62, 0x25, 0x65, 0x27, 0xf1 },
+        { 0x08, 0x7e, 0x51, 0xb5, 0xd5, 0xb6, 0x0f, 0x18, 0xed, 0x12, 0x26, 0x70, 0xc8, 0x57, 0xec, 0x3a, 0x72, 0x1b, 0x2b, 0x19, 0x96, 0x24, 0x51, 0xe5, 0x2b, 0xad, 0xb8, 0x76, 0x9b, 0xc8, 0xbc, 0x8d },
+        { 0x2c, 0x43, 0x5f, 0x83, 0x08, 0x02, 0xd4, 0x75, 0xc4, 0x52, 0x2a, 0x1f, 0xc3, 0xa2, 0xaf, 0x35, 0x90, 0x7c, 0x87, 0xbc, 0x71, 0x75, 0x2e, 0xd7, 0x07, 0x90, 0x53, 0x65, 0x99, 0xe1, 0x0f, 0x7a },
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x89, 0x1a, 0x63, 0xf0, 0x25, 0x33, 0xe4, 0x6e, 0x64, 0xb4, 0xc3, 0xb4, 0x00, 0x00, 0x00, 0x04 },
+        { 0x2b, 0x33, 0xfa, 0xb3, 0x25, 0xf9, 0x02, 0xe8, 0xe5, 0xd2, 0x3a, 0x99, 0x3a, 0xce, 0x78, 0x82, 0x23, 0x7c, 0x6f, 0x3f, 0x3a, 0xf2, 0x24, 0xf7, 0xf9, 0x9b, 0x32, 0x86, 0x0d, 0xdf, 0xac, 0xbe },
+        { 0x1f, 0x38, 0x0b, 0xb2, 0x20, 0xa9, 0xf0, 0x84, 0x86, 0xd3, 0x07, 0x61, 0x93, 0x61, 0x8e, 0x69, 0x00, 0xc6, 0x75, 0x34, 0x99, 0x0d, 0x72, 0x6b, 0xb2, 0xf9, 0x38, 0x31, 0xfc, 0xa6, 0xb6, 0x39 },
+        { 0x2e, 0x5f, 0x12, 0x27, 0x14, 0x08, 0x9c, 0x0b, 0x38, 0xb5, 0x4f, 0x68, 0x9c, 0x43, 0xf6, 0xe1, 0xec, 0xab, 0x45, 0xbd, 0xc7, 0xa2, 0x8e, 0x64, 0x48, 0xbd, 0xae, 0xd8, 0xef, 0x17, 0x2e, 0xe0 },
+        { 0x1e, 0x57, 0x57, 0x82, 0x82, 0x6f, 0xd4, 0x5c, 0x4c, 0xc6, 0xbf, 0x53, 0x1a, 0x87, 0x0f, 0xb9, 0x75, 0x35, 0x7d, 0x63, 0xb1, 0x94, 0xb8, 0xfa, 0xe9, 0xd5, 0xe7, 0x62, 0x14, 0xde, 0xbe, 0x82 },
+        { 0x21, 0x8a, 0x45, 0x17, 0xa9, 0x58, 0x0f, 0x55, 0x6a, 0x52, 0x72, 0x86, 0x4a, 0xe0, 0xe7, 0x80, 0x88, 0xdc, 0x4f, 0x1a, 0xfb, 0x20, 0x58, 0x5b, 0x4d, 0x58, 0x46, 0x8a, 0xda, 0x9a, 0xd8, 0x10 },
+        { 0x37, 0x81, 0xae, 0x4a, 0x2a, 0x49, 0xf0, 0xe7, 0x12, 0xed, 0xd9, 0x8f, 0x37, 0xa8, 0x13, 0xc5, 0xb0, 0x2b, 0x6d, 0xe2, 0x73, 0x28, 0xa7, 0x36, 0x6d, 0x7f, 0x78, 0x76, 0x64, 0x37, 0x43, 0x74 },
+        { 0x13, 0xbc, 0xa0, 0x7c, 0xf7, 0xfd, 0x2b, 0x8a, 0x3b, 0xad, 0xd5, 0xe0, 0x3c, 0x5d, 0x50, 0xca, 0x91, 0xca, 0x11, 0x3f, 0x97, 0xd7, 0xca, 0x44, 0x91, 0x9c, 0xdd, 0x87, 0x66, 0x1e, 0xf0, 0x87 }
+    }
+};
+
+#endif
+
+#endif
+
+const uint8_t SQRT_FQ_EXP[32] = {
+    0x00, 0x00, 0x00, 0x00, 0x39, 0xf6, 0xd3, 0xa9, 0x94, 0xce, 0xbe, 0xa4, 0x19, 0x9c, 0xec, 0x04, 0x04, 0xd0, 0xec, 0x02, 0xa9, 0xde, 0xd2, 0x01, 0x7f, 0xff, 0x2d, 0xff, 0x7f, 0xff, 0xff, 0xff
+};
+
+#ifdef NO_MONTGOMERY
+
+const uint8_t SQRT_FQ_ROOTS[SQRT_WINDOWS][16][32] = {
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x05, 0x38, 0xa6, 0xf6, 0x6e, 0x19, 0xc6, 0x53, 0xed, 0x4f, 0x2f, 0x74, 0xa3, 0x5d, 0x01, 0x68, 0x6f, 0x67, 0xd4, 0xa2, 0xb5, 0x66, 0xf8, 0x33, 0x0f, 0xb4, 0xd6, 0xe1, 0x3c, 0xf1, 0x9a, 0x78 },
+        { 0x65, 0x48, 0x3c, 0x0b, 0x65, 0xac, 0xd3, 0x30, 0x39, 0x91, 0x15, 0x2f, 0x92, 0xab, 0x73, 0xbd, 0x8e, 0x60, 0x2f, 0xf1, 0xba, 0x3a, 0x77, 0xb3, 0xd8, 0x1f, 0x9f, 0x02, 0x6f, 0x5c, 0x39, 0x1c },
+        { 0x69, 0xd7, 0x78, 0xda, 0x9f, 0x67, 0x92, 0x05, 0x75, 0xed, 0x04, 0x78, 0x58, 0xf0, 0x5c, 0xb9, 0xe8, 0x07, 0x5a, 0xe8, 0xbc, 0x26, 0x0a, 0x7a, 0x82, 0x30, 0x61, 0x9d, 0xcb, 0x15, 0x58, 0x08 },
+        { 0x50, 0x0b, 0x7b, 0xa5, 0xe0, 0x41, 0x77, 0x02, 0x18, 0x92, 0x3f, 0x8d, 0xd6, 0xfe, 0x2e, 0xb2, 0x04, 0xd5, 0x2f, 0xdc, 0xcb, 0xd4, 0xab, 0xe1, 0x17, 0x2d, 0xed, 0x2c, 0x7c, 0xc7, 0x33, 0xdb },
+        { 0x07, 0xc1, 0x6f, 0x20, 0x0a, 0x1a, 0x02, 0x6e, 0xa4, 0xed, 0x61, 0xc9, 0x00, 0x6f, 0x0c, 0xf0, 0xf0, 0x14, 0x22, 0xbd, 0x74, 0xa9, 0x19, 0x2e, 0xc6, 0x27, 0x89, 0x6a, 0x92, 0xb9, 0x87, 0x82 },
+        { 0x3c, 0x40, 0x55, 0x3a, 0xa1, 0x4c, 0xfa, 0x77, 0x13, 0x92, 0xac, 0x25, 0x22, 0x13, 0x9c, 0x36, 0x90, 0xa8, 0x5f, 0x81, 0x00, 0x8d, 0x6c, 0xf5, 0x57, 0x03, 0xd9, 0x18, 0xf0, 0x8d, 0xa6, 0x3e },
+        { 0x6f, 0x6d, 0x51, 0xaa, 0x19, 0x27, 0xec, 0xb9, 0x9d, 0xee, 0xca, 0x7f, 0x13, 0x1d, 0xb7, 0xaa, 0x5e, 0x8d, 0x3c, 0x1c, 0x2e, 0x2e, 0x94, 0xfd, 0x58, 0xc2, 0x35, 0x1a, 0x82, 0x97, 0xf9, 0x0b },
+        { 0x09, 0xe6, 0x36, 0x94, 0x35, 0xa3, 0x11, 0xd6, 0x91, 0xb4, 0x7f, 0x62, 0x9b, 0x3a, 0xcd, 0xfb, 0xe6, 0xf5, 0x1d, 0xff, 0x82, 0x32, 0xe7, 0x11, 0xca, 0xdd, 0x5a, 0x57, 0x11, 0x9b, 0x30, 0xed },
+        { 0x10, 0xe3, 0xe1, 0x4b, 0x4c, 0x12, 0x30, 0x3e, 0x28, 0x5f, 0x21, 0xc9, 0x3b, 0x6d, 0x89, 0xbe, 0x01, 0xa8, 0x48, 0x54, 0x34, 0x41, 0xaa, 0x96, 0x27, 0xa3, 0xff, 0x17, 0x08, 0x3a, 0xf2, 0xbd },
+        { 0x61, 0x48, 0xee, 0x12, 0x9e, 0x99, 0x10, 0x5f, 0x98, 0x0b, 0x80, 0x7c, 0x03, 0x2c, 0xc1, 0xeb, 0xf4, 0x14, 0xbe, 0x5f, 0x10, 0xc9, 0xd3, 0x80, 0x1f, 0xcd, 0x61, 0x71, 0xb0, 0x36, 0xb0, 0xfa },
+        { 0x05, 0x27, 0xd4, 0x0b, 0x54, 0x3a, 0x65, 0x10, 0xa7, 0x12, 0xfb, 0xa5, 0x83, 0xfe, 0x1a, 0x4f, 0xfd, 0x58, 0xfb, 0x29, 0x8e, 0x0c, 0xde, 0x08, 0x9e, 0xa5, 0x28, 0x69, 0x78, 0xfb, 0x5c, 0xc2 },
+        { 0x5f, 0x77, 0xfa, 0xd5, 0x57, 0x86, 0xe4, 0xfe, 0xe6, 0xa5, 0xb2, 0xbd, 0x33, 0xcf, 0xca, 0xfb, 0x14, 0x40, 0x4a, 0xbf, 0x66, 0x09, 0xfb, 0x49, 0x91, 0x81, 0xbc, 0x7f, 0xd4, 0xcb, 0x56, 0xdf },
+        { 0x18, 0xe9, 0x4c, 0xbb, 0x6e, 0x14, 0xde, 0xc2, 0xb8, 0xad, 0xe1, 0x2b, 0x41, 0x94, 0xce, 0xa5, 0xfa, 0x62, 0x9f, 0xe0, 0x22, 0x77, 0x6a, 0x94, 0x1a, 0xc7, 0x39, 0xfb, 0xf4, 0xe1, 0xf5, 0x5d },
+        { 0x57, 0x9c, 0x74, 0xf6, 0xf2, 0x74, 0xed, 0xca, 0x9b, 0x59, 0xf2, 0xa2, 0xc8, 0x0c, 0x94, 0x64, 0x90, 0x07, 0xc8, 0x02, 0xd5, 0x13, 0xdf, 0x6d, 0x63, 0xf9, 0x42, 0x8b, 0xa6, 0xee, 0x4a, 0x0c },
+        { 0x4d, 0xa6, 0xec, 0x2e, 0x5f, 0x24, 0xd4, 0x4f, 0xfb, 0xfc, 0x7c, 0xe3, 0xc7, 0x44, 0xc0, 0x5f, 0xc5, 0xdb, 0x2b, 0xd7, 0xb7, 0xcf, 0xae, 0xee, 0xfd, 0xad, 0xa0, 0x01, 0x82, 0x47, 0x9f, 0x15 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x18, 0xde, 0xc9, 0x2f, 0x2a, 0x2d, 0x89, 0x18, 0x98, 0x21, 0x09, 0xa3, 0x99, 0x9f, 0xad, 0x16, 0x29, 0xcf, 0x8b, 0xd1, 0xea, 0x8d, 0x01, 0xb6, 0x8c, 0x0f, 0xb4, 0xee, 0x5c, 0x92, 0xab, 0xb4 },
+        { 0x20, 0x03, 0x6a, 0x16, 0x8c, 0x50, 0xc2, 0xfa, 0x2a, 0xda, 0x9a, 0xdf, 0x92, 0x7c, 0x68, 0xf8, 0x16, 0x33, 0x05, 0xd2, 0xe0, 0x7a, 0x8c, 0x5f, 0xbb, 0xb5, 0xc9, 0xfa, 0x2d, 0x30, 0xae, 0x8d },
+        { 0x02, 0x50, 0x53, 0xbd, 0x92, 0xf3, 0x32, 0xbe, 0x32, 0xaa, 0x16, 0x7d, 0xfc, 0x46, 0x32, 0x6f, 0x9e, 0xac, 0xf2, 0xfa, 0x6f, 0x95, 0x3f, 0x96, 0xf4, 0xf6, 0xf4, 0x61, 0xfd, 0x28, 0xdd, 0x9a },
+        { 0x46, 0x9a, 0x31, 0x2a, 0x70, 0x2e, 0x41, 0x83, 0xec, 0x40, 0x78, 0x5f, 0x01, 0xa6, 0x08, 0xea, 0x30, 0x41, 0x39, 0x95, 0x74, 0xa7, 0xdf, 0xf6, 0xe9, 0x1c, 0x56, 0xf8, 0xc4, 0x71, 0xab, 0x8f },
+        { 0x51, 0xd9, 0xef, 0x11, 0xbe, 0xe7, 0xb4, 0xb3, 0x7c, 0xea, 0x0a, 0x2c, 0xdf, 0x9c, 0xf4, 0x54, 0x50, 0x0e, 0x9f, 0x32, 0xb1, 0x15, 0x5f, 0x95, 0x9f, 0x8b, 0xf2, 0x0c, 0x96, 0x2b, 0x76, 0xd6 },
+        { 0x43, 0xa6, 0x57, 0x43, 0xf0, 0x2b, 0x12, 0x54, 0xeb, 0x39, 0xae, 0x9a, 0x12, 0xc0, 0x3f, 0xd4, 0x94, 0xc2, 0x07, 0x86, 0x8d, 0x77, 0xa9, 0x4f, 0x0f, 0x6f, 0xc3, 0x98, 0x90, 0xff, 0xc8, 0xdb },
+        { 0x1a, 0xa1, 0x88, 0x98, 0x40, 0x44, 0xd9, 0x78, 0x8d, 0x89, 0x18, 0x6f, 0x4c, 0x01, 0x31, 0x1c, 0x74, 0x25, 0x20, 0xb2, 0x09, 0x9c, 0x8c, 0x6e, 0x16, 0x58, 0x7d, 0xa9, 0x9f, 0xbc, 0x82, 0x5b },
+        { 0x6b, 0xdf, 0xb6, 0xaf, 0xdc, 0x51, 0xe1, 0x59, 0xd6, 0x3b, 0x3e, 0x2d, 0x3c, 0xc0, 0x9a, 0x42, 0x7e, 0xbe, 0x37, 0x6e, 0x94, 0x92, 0x86, 0xe7, 0x74, 0x91, 0x63, 0x3f, 0xf3, 0x81, 0x8d, 0x30 },
+        { 0x37, 0xf9, 0x3d, 0x18, 0x99, 0xc2, 0x35, 0xd6, 0x1b, 0x55, 0xdf, 0x8a, 0x3c, 0xd7, 0xe5, 0xd0, 0x17, 0xfb, 0xfc, 0x90, 0xaf, 0x84, 0xc2, 0x14, 0x3e, 0xd0, 0x43, 0x2f, 0x54, 0xb0, 0xbc, 0x8d },
+        { 0x25, 0x5e, 0x87, 0x35, 0x08, 0xc9, 0x9d, 0x0d, 0x53, 0x07, 0x20, 0x8b, 0xf7, 0xb2, 0xb9, 0x63, 0x16, 0xb3, 0x63, 0x7b, 0xfe, 0x44, 0x73, 0x8e, 0xc0, 0xa8, 0x92, 0x6b, 0xfd, 0x6d, 0xc4, 0x4d },
+        { 0x6d, 0xbf, 0x16, 0x9a, 0x45, 0xa4, 0xa2, 0xc7, 0x34, 0x6d, 0x95, 0x4f, 0x96, 0x2f, 0xb2, 0x4e, 0xcc, 0x64, 0x89, 0x48, 0x92, 0xb5, 0x62, 0x02, 0xc7, 0x65, 0xdd, 0xa0, 0x45, 0xee, 0x2f, 0x80 },
+        { 0x26, 0x9b, 0x5d, 0xf4, 0xbf, 0xf2, 0xd3, 0xa8, 0x9a, 0x16, 0x0a, 0xec, 0xce, 0xff, 0x52, 0xee, 0x11, 0x20, 0xd4, 0xc2, 0x64, 0x17, 0x8f, 0x0e, 0x05, 0x30, 0x3d, 0x7e, 0xa3, 0x44, 0xa0, 0xa4 },
+        { 0x09, 0x33, 0xf5, 0xf5, 0xf5, 0x08, 0x8b, 0xc9, 0x73, 0x8f, 0x5b, 0x0d, 0x18, 0x55, 0xce, 0x4e, 0x0d, 0xcf, 0x05, 0xaf, 0xff, 0x8c, 0x93, 0xe0, 0xfb, 0xe2, 0x13, 0xa7, 0x3a, 0x76, 0xe9, 0x53 },
+        { 0x00, 0x30, 0x69, 0x81, 0x52, 0x76, 0x5c, 0x94, 0x6e, 0x57, 0x2b, 0x42, 0x5d, 0xf5, 0xd8, 0x79, 0x9b, 0xc0, 0xd3, 0xfa, 0xfc, 0x2e, 0xa5, 0xa3, 0x4e, 0x5f, 0x55, 0xbe, 0x8c, 0x31, 0x15, 0x91 },
+        { 0x22, 0x21, 0xac, 0x6e, 0x7f, 0x54, 0x93, 0x45, 0x3b, 0x94, 0xe1, 0xd4, 0x6e, 0x45, 0xcd, 0x71, 0x06, 0x3b, 0xa8, 0xc9, 0x28, 0x16, 0x06, 0x91, 0xb0, 0x20, 0x09, 0x70, 0x4b, 0x7f, 0x6c, 0x33 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x17, 0x2e, 0xd7, 0x07, 0x3b, 0x37, 0xe3, 0xbb, 0xa5, 0x37, 0xf7, 0x4f, 0x3f, 0x6e, 0x8c, 0xff, 0xa9, 0x6a, 0xdc, 0xb5, 0xf3, 0xe1, 0x5c, 0xbc, 0xea, 0x4b, 0x5e, 0x83, 0x2c, 0x8d, 0xc1, 0xd5 },
+        { 0x33, 0x17, 0xcc, 0xcc, 0xf6, 0x19, 0xad, 0x8c, 0x1c, 0x2a, 0x46, 0x79, 0xe3, 0xa9, 0x98, 0x23, 0x71, 0x72, 0x71, 0xf7, 0x69, 0x85, 0x7d, 0x69, 0x17, 0x27, 0x91, 0x67, 0x93, 0x51, 0xb3, 0x10 },
+        { 0x35, 0x21, 0x9b, 0x03, 0x88, 0x03, 0xfa, 0x62, 0x53, 0x61, 0x46, 0xb7, 0x26, 0xec, 0xd4, 0x23, 0x24, 0x44, 0xc2, 0x88, 0xb4, 0x0c, 0x10, 0xab, 0x39, 0xb5, 0xc9, 0x71, 0x11, 0xe9, 0x2c, 0x55 },
+        { 0x2a, 0x89, 0xf5, 0x20, 0xcb, 0x79, 0xe3, 0x51, 0x4b, 0xfc, 0x37, 0xd5, 0xa3, 0x52, 0xf5, 0xab, 0xcc, 0x39, 0xb5, 0xc2, 0xfb, 0xc4, 0xa0, 0x5e, 0x75, 0x40, 0x83, 0x9d, 0x0a, 0x3d, 0xf6, 0x40 },
+        { 0x06, 0x1e, 0x5a, 0x8c, 0x18, 0x51, 0x3c, 0x8f, 0xe5, 0x84, 0x39, 0x36, 0x50, 0x11, 0x6b, 0xbd, 0x61, 0xc9, 0xfc, 0x0b, 0x76, 0x74, 0xed, 0x22, 0x28, 0x57, 0x60, 0x44, 0x45, 0x75, 0xd1, 0x8c },
+        { 0x10, 0x28, 0xe8, 0x6c, 0xe2, 0x19, 0xa5, 0x20, 0x76, 0x1c, 0x1c, 0xad, 0x84, 0xf3, 0xec, 0x74, 0xb9, 0x5e, 0x98, 0xe8, 0x30, 0xa7, 0xe8, 0x97, 0xf5, 0x29, 0xc5, 0x48, 0x3d, 0x97, 0x80, 0xdd },
+        { 0x67, 0xdc, 0x50, 0x2e, 0x5e, 0x89, 0x89, 0x8e, 0x55, 0x6c, 0x94, 0xe0, 0x13, 0x85, 0x09, 0x90, 0x01, 0xa3, 0x67, 0xc6, 0xba, 0x5f, 0xe4, 0xb5, 0xa4, 0x2a, 0x44, 0xf4, 0xbe, 0x33, 0x4a, 0xed },
+        { 0x5f, 0x3e, 0xd1, 0x80, 0xc5, 0x14, 0x6c, 0xab, 0x91, 0xc8, 0xe2, 0x24, 0x7c, 0xfa, 0x53, 0x6d, 0xbe, 0xbe, 0xb8, 0x12, 0x9b, 0x00, 0x29, 0xa5, 0xdf, 0x97, 0x39, 0xf7, 0x8f, 0x26, 0xd8, 0x9e },
+        { 0x6f, 0x70, 0xc8, 0x46, 0xaa, 0x43, 0xbe, 0x55, 0x46, 0x3a, 0x22, 0x47, 0x7d, 0xe8, 0xe1, 0x69, 0x7c, 0xbb, 0xd9, 0x17, 0xef, 0x11, 0xb2, 0x0f, 0x69, 0xc8, 0x5f, 0x2e, 0xbf, 0xc4, 0x99, 0xf1 },
+        { 0x59, 0x54, 0xcb, 0xc5, 0x15, 0xd5, 0xea, 0x21, 0x4d, 0x17, 0x05, 0x59, 0xaa, 0xab, 0xdf, 0x27, 0x10, 0x64, 0x80, 0xd7, 0x8d, 0x65, 0xe3, 0x10, 0xe9, 0xc2, 0xac, 0x7d, 0x6c, 0x80, 0x4c, 0xd2 },
+        { 0x26, 0x69, 0x25, 0x48, 0xc6, 0x4a, 0x0d, 0x4f, 0xfd, 0xa8, 0x04, 0x43, 0x3b, 0xf5, 0xb2, 0xc9, 0xa3, 0xd5, 0xa2, 0x5d, 0xc3, 0xa9, 0x3d, 0xc1, 0x5f, 0x9c, 0x43, 0xad, 0x97, 0x20, 0x62, 0xaa },
+        { 0x33, 0x10, 0xda, 0x32, 0x35, 0xfc, 0x28, 0x08, 0xcb, 0x6e, 0xf7, 0xed, 0xa8, 0x05, 0xbc, 0x62, 0x11, 0xe1, 0x20, 0x0d, 0x8f, 0xfb, 0xf7, 0x6c, 0x02, 0x84, 0x40, 0x6b, 0xed, 0xd0, 0x04, 0x0c },
+        { 0x44, 0xad, 0x64, 0xb4, 0xb3, 0x5d, 0x3b, 0xd5, 0x40, 0xe4, 0x5e, 0x07, 0xe5, 0xd0, 0xd9, 0x15, 0x22, 0x90, 0x95, 0x4d, 0xcb, 0xc5, 0x97, 0x13, 0x72, 0x83, 0xdb, 0xba, 0x68, 0x72, 0x2d, 0x3a },
+        { 0x0c, 0xc3, 0x39, 0x00, 0xc8, 0xb3, 0xd0, 0x63, 0xb3, 0x37, 0x4f, 0x49, 0x40, 0xe7, 0x7e, 0x92, 0x5c, 0x56, 0x6c, 0xb1, 0x0d, 0x7e, 0x36, 0x7e, 0x01, 0x38, 0x74, 0x9c, 0x23, 0xe9, 0x59, 0x49 },
+        { 0x67, 0xd5, 0x9f, 0x13, 0x42, 0xe1, 0xb1, 0x7f, 0x3d, 0xdd, 0x23, 0x00, 0x96, 0xa8, 0xe8, 0xde, 0xc8, 0x83, 0xf5, 0x9c, 0x2d, 0xe3, 0x2f, 0x8c, 0x5f, 0x43, 0x84, 0xcd, 0xd9, 0x78, 0x8e, 0x8f }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x6c, 0x39, 0x44, 0x2e, 0xad, 0xe0, 0x09, 0x27, 0x68, 0xac, 0x03, 0x3f, 0xa6, 0xf6, 0x08, 0x75, 0x06, 0x24, 0xa1, 0xbb, 0x17, 0xdb, 0xc0, 0x26, 0xef, 0x97, 0xc3, 0x57, 0x3a, 0x28, 0xfc, 0x8c },
+        { 0x05, 0x9d, 0x12, 0x33, 0x80, 0x29, 0x65, 0x9f, 0xa0, 0xe8, 0x39, 0x71, 0x6e, 0xc6, 0x4c, 0x88, 0x0d, 0x93, 0x40, 0x1c, 0xa1, 0x4e, 0x79, 0xb4, 0x99, 0x19, 0x6b, 0xe3, 0x07, 0x04, 0x89, 0x3a },
+        { 0x38, 0xa6, 0x36, 0x01, 0xe1, 0x39, 0x3e, 0x6d, 0x35, 0xc3, 0x5a, 0x01, 0x4e, 0xcc, 0xe2, 0x00, 0x3e, 0x93, 0x54, 0x81, 0xa2, 0xe7, 0xe8, 0x4d, 0xbf, 0x00, 0x69, 0xfa, 0xaa, 0x1f, 0xc3, 0x85 },
+        { 0x11, 0xb7, 0x1e, 0xd3, 0xf4, 0x00, 0x81, 0x28, 0x70, 0x6f, 0xe0, 0xe3, 0x51, 0xde, 0x85, 0x79, 0xe3, 0x58, 0xc8, 0xa0, 0xbb, 0xd6, 0xa8, 0x33, 0x52, 0xb9, 0x24, 0x81, 0x26, 0xd9, 0x11, 0xd3 },
+        { 0x6a, 0x29, 0xfe, 0x31, 0xac, 0x79, 0x1e, 0x88, 0x40, 0x73, 0x7f, 0xf0, 0x0a, 0xff, 0x39, 0x87, 0xfb, 0xd2, 0x59, 0x1d, 0x36, 0x44, 0x80, 0x33, 0xbb, 0x1f, 0xe3, 0x23, 0x99, 0x9f, 0xa4, 0xbf },
+        { 0x12, 0x99, 0x5c, 0xcd, 0x5d, 0x93, 0x66, 0xd8, 0x20, 0x88, 0xe3, 0xbe, 0xaa, 0x4c, 0xa1, 0xb2, 0xac, 0x04, 0x7d, 0x66, 0xa1, 0x17, 0xd3, 0x0d, 0xf7, 0x35, 0xc2, 0xc1, 0xd4, 0x95, 0x25, 0x56 },
+        { 0x16, 0x68, 0x52, 0xee, 0xa2, 0x5f, 0xc9, 0xa2, 0x44, 0x09, 0x62, 0x21, 0x3d, 0x3a, 0xf0, 0xf1, 0xfa, 0x1f, 0x15, 0x37, 0x87, 0x0e, 0x97, 0x96, 0x14, 0xba, 0x7b, 0x73, 0x53, 0x05, 0x96, 0x44 },
+        { 0x19, 0x29, 0x7f, 0x11, 0xed, 0x26, 0x2e, 0xa0, 0x84, 0x06, 0xd4, 0x79, 0x62, 0x3b, 0x2c, 0x68, 0xb5, 0x42, 0x0c, 0x48, 0x3c, 0x2f, 0x23, 0xaa, 0xa8, 0xad, 0xdb, 0x03, 0x98, 0x47, 0x5e, 0x5f },
+        { 0x72, 0x36, 0xc6, 0x32, 0x6a, 0x26, 0x67, 0xb6, 0x2e, 0xc2, 0x92, 0x6b, 0x2f, 0x8c, 0x1f, 0x5c, 0xf1, 0x4c, 0x2c, 0xdc, 0xa6, 0x4c, 0x0a, 0x7c, 0x03, 0xaa, 0x5d, 0x9c, 0x88, 0xfc, 0x9c, 0x5d },
+        { 0x2a, 0x0c, 0xcb, 0xaa, 0x06, 0x13, 0xf0, 0x93, 0xf2, 0xbb, 0x6e, 0x97, 0x85, 0x95, 0x13, 0xf0, 0xb6, 0x13, 0xd8, 0x58, 0x7e, 0xaa, 0x92, 0xdb, 0x9e, 0x56, 0x04, 0xb8, 0xd6, 0xb6, 0x8d, 0x45 },
+        { 0x45, 0xdb, 0x9c, 0x49, 0x3c, 0x40, 0x7b, 0x7e, 0xb4, 0xb3, 0xa1, 0x9a, 0x27, 0xde, 0x56, 0x0c, 0xe4, 0x95, 0xf2, 0x5a, 0x0e, 0xe4, 0x61, 0x21, 0x2e, 0x08, 0xf2, 0xa8, 0x7c, 0x82, 0x5f, 0x91 },
+        { 0x47, 0x83, 0x3c, 0x71, 0x8a, 0x57, 0x9c, 0xb9, 0x43, 0x0d, 0x46, 0x10, 0xd8, 0xb9, 0x90, 0x43, 0xca, 0xff, 0xcf, 0xdc, 0xb2, 0xfe, 0xcb, 0xf6, 0x13, 0xff, 0xf8, 0x82, 0xb3, 0xda, 0xa2, 0x18 },
+        { 0x11, 0xde, 0x84, 0x82, 0x51, 0xcd, 0x28, 0x2c, 0x0a, 0xca, 0xda, 0xf0, 0x34, 0xf0, 0x17, 0x36, 0x5f, 0x60, 0x6b, 0xc5, 0x1f, 0x2f, 0xb3, 0x1b, 0x08, 0x63, 0x76, 0xeb, 0x77, 0x25, 0xaa, 0xdb },
+        { 0x07, 0xb6, 0xb7, 0xc0, 0x5e, 0x74, 0xd8, 0xbe, 0xd3, 0x73, 0x86, 0x91, 0x92, 0x9b, 0x70, 0x8b, 0xdb, 0xc1, 0x31, 0x56, 0x22, 0x30, 0xed, 0x9f, 0x0f, 0x18, 0xfa, 0xc2, 0x7f, 0xaa, 0xc6, 0x11 },
+        { 0x73, 0x0d, 0xf5, 0x4c, 0x0d, 0x27, 0x23, 0x0c, 0x12, 0xb9, 0x35, 0x28, 0x4d, 0xed, 0x2c, 0x20, 0x90, 0xed, 0x08, 0x31, 0x3b, 0x6d, 0xc9, 0x10, 0xd7, 0x7f, 0x88, 0x10, 0xd4, 0x91, 0x5c, 0x22 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x50, 0x9e, 0x12, 0x81, 0x1a, 0x86, 0x72, 0x93, 0xd3, 0x09, 0x63, 0x9c, 0x30, 0x7e, 0x90, 0xeb, 0x6f, 0x52, 0x6a, 0x72, 0x45, 0x90, 0xe6, 0xdb, 0x89, 0x9e, 0x9d, 0x33, 0x60, 0xbf, 0x37, 0xa0 },
+        { 0x28, 0xe1, 0x12, 0xde, 0xab, 0x70, 0x1f, 0xe9, 0xd4, 0x04, 0x07, 0x30, 0x3f, 0x88, 0x1f, 0xa4, 0xe0, 0x55, 0x94, 0xbb, 0x9c, 0x30, 0xac, 0x06, 0x92, 0xf8, 0xf7, 0x1f, 0xe1, 0x50, 0xdf, 0x15 },
+        { 0x20, 0x5e, 0xcd, 0x64, 0xa3, 0x1e, 0x13, 0xa6, 0x09, 0x28, 0xd8, 0xf1, 0xc6, 0x01, 0x06, 0xfc, 0xcc, 0x36, 0xb1, 0x09, 0x92, 0x67, 0xee, 0x39, 0xf0, 0x08, 0x49, 0x26, 0x64, 0x60, 0xa7, 0xd0 },
+        { 0x28, 0x1f, 0x74, 0x79, 0x0b, 0x85, 0xa2, 0x16, 0xfd, 0x01, 0x3d, 0xf1, 0xf6, 0x83, 0xbf, 0x99, 0xa1, 0x4c, 0x38, 0x25, 0x3f, 0xdb, 0x83, 0x8c, 0xd7, 0xa1, 0xf5, 0xbc, 0x8f, 0x52, 0x95, 0x99 },
+        { 0x30, 0x3d, 0x1f, 0x10, 0x6a, 0xbc, 0x9e, 0x9e, 0xb9, 0xa8, 0xa2, 0xf0, 0xb2, 0x57, 0x1a, 0xa7, 0x6f, 0xb0, 0xd3, 0x0f, 0x81, 0x30, 0xce, 0x1f, 0x79, 0xbc, 0x33, 0x4e, 0x5f, 0x25, 0xcb, 0x16 },
+        { 0x12, 0x37, 0x73, 0xca, 0x37, 0x73, 0xca, 0x20, 0x29, 0x27, 0x9d, 0x66, 0x4d, 0xc8, 0x30, 0x3d, 0xa8, 0xa9, 0x02, 0x1a, 0xe3, 0xd7, 0x71, 0xc5, 0xa7, 0x88, 0x71, 0xf7, 0x70, 0x6f, 0x3d, 0xcd },
+        { 0x23, 0xb2, 0xa2, 0xba, 0x8d, 0x16, 0xdb, 0xbf, 0x8c, 0x1e, 0xee, 0x00, 0xb7, 0xb9, 0xca, 0x19, 0xf9, 0x03, 0x42, 0xd0, 0x35, 0xea, 0xf8, 0x3d, 0x42, 0xbb, 0x88, 0x66, 0x20, 0xa9, 0x22, 0xfa },
+        { 0x57, 0xe6, 0x99, 0x0d, 0x49, 0x81, 0xb1, 0x77, 0xd5, 0x48, 0xfd, 0xa2, 0x62, 0x00, 0x84, 0x19, 0x20, 0x4f, 0x94, 0x76, 0xce, 0xce, 0xf2, 0xdf, 0x68, 0x94, 0x6a, 0xad, 0x32, 0x52, 0x51, 0xed },
+        { 0x32, 0xe2, 0xce, 0x49, 0xda, 0xc0, 0x13, 0x3e, 0x60, 0x5a, 0x9f, 0xc3, 0x4b, 0x44, 0x05, 0xa2, 0x33, 0xab, 0xda, 0x20, 0x0a, 0xec, 0xb1, 0x98, 0x0c, 0x68, 0x92, 0x6f, 0x86, 0x75, 0x3e, 0xd3 },
+        { 0x10, 0x8e, 0x5c, 0x46, 0x85, 0xa8, 0x38, 0x9e, 0xc0, 0x4d, 0x45, 0x36, 0xc7, 0x00, 0x4f, 0x03, 0x16, 0x4b, 0x43, 0x32, 0x3f, 0xbf, 0x50, 0x47, 0x7d, 0xa2, 0xb2, 0x62, 0x3f, 0xa7, 0x53, 0x6f },
+        { 0x31, 0x85, 0xb6, 0x70, 0x2d, 0xde, 0x2a, 0x67, 0x06, 0x32, 0x0a, 0xad, 0xf5, 0x85, 0xb1, 0xe2, 0xc6, 0x13, 0xe7, 0x7a, 0xaa, 0x17, 0x12, 0xbe, 0xe2, 0xa5, 0x3f, 0xab, 0x32, 0xca, 0xc5, 0xc5 },
+        { 0x1c, 0xd5, 0x4b, 0xc8, 0xad, 0xcd, 0x5d, 0xab, 0x79, 0x89, 0xec, 0x74, 0xae, 0x3f, 0x47, 0xf4, 0x58, 0x8f, 0x2d, 0xee, 0xe2, 0xa0, 0xd9, 0xa4, 0x04, 0x04, 0xe4, 0x7e, 0xec, 0xd3, 0x5d, 0xf7 },
+        { 0x4c, 0x16, 0x8f, 0xc1, 0xcb, 0x1c, 0x13, 0x22, 0xec, 0xf7, 0x37, 0x0e, 0x42, 0xe4, 0x4e, 0x96, 0xf2, 0x4b, 0x23, 0x02, 0x1e, 0xa5, 0x6f, 0xde, 0xc9, 0x01, 0xbd, 0x0d, 0x4e, 0x28, 0x20, 0xb6 },
+        { 0x4b, 0xad, 0x10, 0x65, 0x02, 0x82, 0x0d, 0x8d, 0x62, 0xcf, 0x9f, 0xd5, 0x60, 0xea, 0x64, 0xf0, 0x24, 0xa1, 0x8d, 0xf7, 0x0b, 0x28, 0xed, 0xed, 0xfc, 0xdd, 0x2f, 0x43, 0xdb, 0x33, 0x15, 0x4c },
+        { 0x28, 0x86, 0xb5, 0xf1, 0x13, 0x5e, 0x41, 0xb1, 0x11, 0xd8, 0x07, 0xa9, 0x82, 0x01, 0x14, 0xbb, 0xa3, 0x8e, 0xf9, 0xd0, 0xf9, 0x65, 0x38, 0xb1, 0x36, 0x76, 0x54, 0xfd, 0x14, 0xb7, 0x20, 0xd2 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x39, 0x1b, 0x28, 0x56, 0xc6, 0x09, 0xb4, 0x78, 0x4a, 0xe2, 0x5f, 0xfa, 0xb9, 0xdc, 0x59, 0x86, 0x50, 0x46, 0xd1, 0x78, 0x64, 0x18, 0x32, 0x03, 0x96, 0x1a, 0x25, 0x2d, 0xd8, 0x54, 0x33, 0x62 },
+        { 0x55, 0x61, 0x2c, 0x87, 0x90, 0x36, 0xd6, 0x2f, 0xae, 0x65, 0xb5, 0xbd, 0xd4, 0x85, 0xb3, 0x9a, 0xa9, 0x54, 0xd0, 0x2f, 0xf7, 0x07, 0xac, 0x89, 0xdc, 0x98, 0x2d, 0xea, 0xb6, 0x39, 0xeb, 0x06 },
+        { 0x22, 0x29, 0xdd, 0x16, 0xb9, 0x78, 0x80, 0xc2, 0x26, 0xa9, 0x6b, 0x6d, 0x86, 0x23, 0xb9, 0x0e, 0x8a, 0x77, 0x51, 0x93, 0xa9, 0x15, 0x28, 0x7b, 0x84, 0x65, 0x8d, 0x7d, 0x1f, 0xba, 0x41, 0x33 },
+        { 0x51, 0x64, 0xca, 0x4c, 0xf7, 0x45, 0x6c, 0x9b, 0x94, 0x2c, 0x20, 0xe4, 0x5c, 0x3a, 0xd1, 0x4d, 0x9c, 0xe8, 0x62, 0x48, 0x79, 0x04, 0xd0, 0xab, 0x1b, 0x56, 0x13, 0x47, 0xc6, 0xa4, 0x77, 0x27 },
+        { 0x48, 0x2e, 0xc1, 0x0c, 0x0d, 0xfb, 0x6c, 0xca, 0x3d, 0x40, 0x67, 0xca, 0x08, 0xe2, 0xb3, 0xa4, 0xac, 0xa0, 0x2a, 0x3a, 0x8f, 0x44, 0x36, 0x48, 0x36, 0x1e, 0x8e, 0xa8, 0xae, 0x06, 0xb1, 0x26 },
+        { 0x2c, 0x6a, 0xa5, 0x8b, 0x3a, 0x74, 0x9b, 0xc6, 0x2c, 0x8e, 0x65, 0x7f, 0xe4, 0x7e, 0xa5, 0x51, 0xf3, 0x2d, 0xcc, 0x14, 0x06, 0xda, 0x0f, 0x4c, 0x67, 0x04, 0xb9, 0xc8, 0xbb, 0x9b, 0xf6, 0x1e },
+        { 0x52, 0x3c, 0x2a, 0xae, 0xd4, 0x07, 0x6d, 0xb6, 0x9d, 0x9e, 0x66, 0xdd, 0x3f, 0x25, 0x4f, 0xe9, 0x54, 0xef, 0xf6, 0x57, 0x2f, 0x4a, 0xd1, 0x09, 0x93, 0xfc, 0xa2, 0x60, 0x54, 0xdf, 0xc2, 0x43 },
+        { 0x6a, 0x61, 0xdb, 0xd7, 0x81, 0xfc, 0x6d, 0x1c, 0x88, 0x1d, 0xab, 0x49, 0xe1, 0x5d, 0x37, 0x27, 0x7d, 0xd3, 0x4d, 0xc4, 0x8b, 0x54, 0x2a, 0x79, 0x16, 0x65, 0x4b, 0x4e, 0x31, 0x93, 0xf3, 0x85 },
+        { 0x40, 0xef, 0x17, 0x07, 0xf8, 0xce, 0x66, 0xd5, 0x60, 0x14, 0x9d, 0x58, 0xcd, 0xb2, 0xea, 0x0e, 0x53, 0x77, 0xc7, 0xde, 0x24, 0x00, 0xa3, 0x7e, 0x39, 0xe9, 0xc4, 0x36, 0x9a, 0x22, 0x74, 0x07 },
+        { 0x54, 0xd3, 0xca, 0xcb, 0x57, 0x33, 0xaf, 0x74, 0x20, 0x04, 0x84, 0x19, 0xc8, 0x5f, 0x58, 0x3b, 0x44, 0x24, 0x6c, 0x15, 0x7d, 0x33, 0x11, 0x5f, 0x38, 0x93, 0x2b, 0x9a, 0x6e, 0x8c, 0xfe, 0x99 },
+        { 0x08, 0x62, 0x45, 0x9f, 0x44, 0xdd, 0x31, 0x78, 0xe6, 0x79, 0x87, 0x08, 0x08, 0x59, 0x02, 0xbd, 0xb9, 0x8d, 0x62, 0x2f, 0x70, 0x5b, 0xc6, 0x36, 0x98, 0x80, 0xad, 0x61, 0x5f, 0x24, 0xc9, 0xeb },
+        { 0x1d, 0x6c, 0x2e, 0x66, 0x10, 0xdb, 0x2b, 0xe5, 0x79, 0xe2, 0x85, 0xd2, 0x1c, 0x3b, 0xe9, 0x6a, 0x52, 0x62, 0xe5, 0xef, 0x54, 0xd4, 0x46, 0xd0, 0x01, 0xdd, 0x7d, 0xd9, 0x4f, 0x4c, 0x83, 0xf0 },
+        { 0x08, 0x2f, 0x46, 0xd0, 0xf8, 0xdd, 0xf3, 0x53, 0x10, 0x46, 0xcd, 0x85, 0xdb, 0xa9, 0xcb, 0x19, 0xa8, 0x24, 0xd4, 0x40, 0xd7, 0x30, 0xaf, 0x9a, 0x3f, 0x0b, 0x4e, 0xcf, 0xd9, 0x04, 0x11, 0xf1 },
+        { 0x03, 0xbe, 0x2c, 0x28, 0x3e, 0x4b, 0x4c, 0x4e, 0x07, 0x20, 0x7d, 0x0c, 0x1f, 0x80, 0x45, 0x48, 0x3a, 0x3b, 0x2e, 0x3f, 0x6b, 0x50, 0x89, 0x20, 0x51, 0xac, 0x5f, 0x1c, 0x8a, 0x02, 0xf3, 0x0d },
+        { 0x61, 0xf3, 0xee, 0xab, 0x26, 0xfc, 0x08, 0x5d, 0xfb, 0x9e, 0x36, 0xc2, 0x8a, 0xa5, 0xa9, 0xdc, 0xd1, 0xd9, 0x6b, 0xa8, 0x5a, 0x6a, 0xe2, 0xce, 0xb1, 0x47, 0x80, 0xf8, 0x0c, 0xfa, 0xdf, 0x8d }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x18, 0xba, 0x76, 0x58, 0x08, 0x4c, 0x71, 0xa4, 0x67, 0xe7, 0x01, 0xa9, 0x45, 0xe9, 0xb7, 0x13, 0xdf, 0x7b, 0x4e, 0xe6, 0x6e, 0x4c, 0xac, 0xcb, 0x7d, 0x01, 0x86, 0x6a, 0xdd, 0x95, 0x87, 0x80 },
+        { 0x60, 0xc7, 0xef, 0xec, 0x34, 0x09, 0x3e, 0x9a, 0x72, 0x5c, 0xe4, 0x8f, 0x79, 0xbf, 0x9c, 0xd6, 0x00, 0x81, 0x06, 0x6e, 0x57, 0x8d, 0x78, 0xbf, 0x62, 0x07, 0xcd, 0x2f, 0x20, 0xdf, 0x9d, 0x12 },
+        { 0x36, 0xe1, 0xeb, 0xe1, 0x24, 0x83, 0x4a, 0x8f, 0xcf, 0xdc, 0x1d, 0xa7, 0xbf, 0x59, 0x00, 0x4b, 0x42, 0xf4, 0x64, 0xcb, 0x42, 0x56, 0xa3, 0xb3, 0xf3, 0xf9, 0x0b, 0xd2, 0xb0, 0x5e, 0x60, 0x2e },
+        { 0x64, 0x0d, 0x09, 0x74, 0x61, 0xa2, 0xee, 0xaf, 0x4e, 0x84, 0xb3, 0xcd, 0x7d, 0xc7, 0x5b, 0x61, 0xdb, 0x87, 0x2e, 0xf3, 0xdc, 0xe2, 0x8e, 0x78, 0x8d, 0x28, 0xc1, 0x43, 0x16, 0x8b, 0xba, 0x2c },
+        { 0x1f, 0x2c, 0xaa, 0x7a, 0xee, 0xf7, 0xd8, 0xde, 0xe0, 0xeb, 0x9d, 0x91, 0xcd, 0xec, 0xcc, 0xfb, 0xbf, 0x53, 0x54, 0xab, 0x6e, 0x8c, 0x2a, 0xb4, 0xf0, 0x07, 0xbd, 0xc1, 0x50, 0xd0, 0x24, 0xb1 },
+        { 0x1f, 0x38, 0x34, 0xa0, 0xf3, 0x87, 0xad, 0xd7, 0xfa, 0xa1, 0xf3, 0x80, 0x4f, 0xdb, 0x73, 0xd0, 0x08, 0xcc, 0xff, 0xd4, 0x3f, 0x19, 0x31, 0xb6, 0x3f, 0xf6, 0x30, 0xd3, 0xf8, 0x9c, 0x4c, 0x2c },
+        { 0x6a, 0x94, 0x59, 0x80, 0xda, 0xde, 0x66, 0xef, 0xbc, 0xca, 0x66, 0x0e, 0xe3, 0x27, 0xeb, 0x37, 0x7a, 0x1c, 0xb8, 0xc0, 0x70, 0xf0, 0xce, 0x32, 0x2e, 0x9a, 0x4d, 0xb5, 0xf1, 0x38, 0xda, 0xb3 },
+        { 0x5e, 0x73, 0xed, 0x8c, 0x43, 0x24, 0x05, 0xd0, 0xae, 0x25, 0xb2, 0x1d, 0xf6, 0xc5, 0x2b, 0x2a, 0x6c, 0x78, 0x76, 0xbf, 0x09, 0x28, 0xe6, 0x8f, 0xae, 0x34, 0xa8, 0x1e, 0x1c, 0xfc, 0xa2, 0xec },
+        { 0x11, 0xc1, 0x76, 0x01, 0x02, 0x9a, 0x41, 0x96, 0xd2, 0x47, 0xf1, 0x68, 0x7a, 0x9e, 0xb7, 0x54, 0xcb, 0xba, 0x2b, 0x75, 0x2d, 0xa2, 0x7a, 0x4e, 0x8d, 0x66, 0xb6, 0xb5, 0x01, 0x72, 0x25, 0xbb },
+        { 0x1a, 0x11, 0x2d, 0x20, 0x40, 0x9a, 0x83, 0x5f, 0xe1, 0xb2, 0xc3, 0xaa, 0x0e, 0xb4, 0x55, 0xff, 0xbe, 0x66, 0xf8, 0xa0, 0xdc, 0x0e, 0x6b, 0xbe, 0x91, 0xe8, 0xa1, 0xba, 0x3b, 0x6f, 0x34, 0x41 },
+        { 0x73, 0x43, 0x2a, 0x23, 0x5b, 0x18, 0x5c, 0x76, 0x3e, 0x29, 0x38, 0x67, 0x32, 0x4c, 0x9a, 0x71, 0xd9, 0x8a, 0x9a, 0x8b, 0x48, 0x55, 0x9c, 0x15, 0x63, 0x58, 0xcf, 0x18, 0x76, 0x3f, 0x40, 0x63 },
+        { 0x10, 0x95, 0x2f, 0x01, 0x22, 0xe8, 0x07, 0x2d, 0xab, 0xac, 0x70, 0xf8, 0x3e, 0x4a, 0xcd, 0x51, 0x9b, 0xba, 0xbf, 0x1e, 0x9e, 0x17, 0x2d, 0xe6, 0x22, 0x3c, 0x4f, 0xc0, 0x56, 0xe4, 0x3d, 0x9a },
+        { 0x3d, 0xbe, 0x99, 0x4d, 0x9f, 0xc0, 0x04, 0x0d, 0x8e, 0x1d, 0xd9, 0x27, 0xf6, 0xf6, 0xbf, 0x4a, 0xc2, 0xb9, 0x01, 0xd9, 0xb4, 0x4b, 0xf6, 0xce, 0xe9, 0xdd, 0x22, 0xa4, 0x97, 0x76, 0x57, 0x19 },
+        { 0x02, 0xa8, 0xfa, 0x6a, 0x84, 0xee, 0xc9, 0x3c, 0xd9, 0xbb, 0xb5, 0xad, 0xeb, 0xfd, 0xc2, 0x99, 0x4f, 0x75, 0xc4, 0xfd, 0x31, 0xa9, 0xbd, 0xfb, 0xb1, 0x4b, 0x44, 0xa2, 0x3c, 0xfe, 0x6f, 0x92 },
+        { 0x67, 0xdc, 0x39, 0xc6, 0x3d, 0xce, 0xa5, 0x1c, 0x6d, 0xfd, 0xa5, 0xce, 0x9b, 0xf2, 0xfc, 0x0c, 0x49, 0x0a, 0x9a, 0x54, 0x7a, 0xf7, 0xf7, 0x20, 0x3c, 0x1d, 0x97, 0xdd, 0x94, 0x23, 0xb5, 0xd1 }
+    },
+    {
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 },
+        { 0x3b, 0x25, 0xb4, 0x75, 0xab, 0x91, 0x19, 0x4b, 0x68, 0x7a, 0x73, 0xc9, 0x2f, 0x18, 0x86, 0x12, 0xfc, 0x01, 0x0d, 0x53, 0xcc, 0xb2, 0x25, 0x42, 0x5e, 0x54, 0x4c, 0xdf, 0x4c, 0x88, 0x79, 0x48 },
+        { 0x60, 0xb9, 0xf5, 0x24, 0xcc, 0xbc, 0x6d, 0x03, 0x78, 0x7d, 0x7d, 0x08, 0x3f, 0x1b, 0x18, 0x9f, 0xc5, 0x49, 0x13, 0xcc, 0x6b, 0x4e, 0x0c, 0x26, 0x9f, 0xc8, 0x01, 0x7d, 0x51, 0x66, 0xaf, 0xd3 },
+        { 0x24, 0xc1, 0x4d, 0xe4, 0xb4, 0x5f, 0x2d, 0x7b, 0xc4, 0xa7, 0x2e, 0x43, 0xa8, 0xf2, 0x0d, 0xbb, 0x34, 0xc8, 0xbd, 0x90, 0x14, 0x3c, 0x7a, 0x43, 0x6a, 0x20, 0xb4, 0xc8, 0xfb, 0xee, 0x01, 0x8e },
+        { 0x73, 0xed, 0xa7, 0x53, 0x29, 0x9d, 0x7d, 0x47, 0xa5, 0xe8, 0x0b, 0x39, 0x93, 0x9e, 0xd3, 0x34, 0x67, 0xba, 0xa4, 0x00, 0x89, 0xfb, 0x5b, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01 },
+        { 0x55, 0x11, 0x15, 0xb4, 0x60, 0x7e, 0x44, 0x9b, 0xd6, 0x6c, 0x91, 0xd6, 0x18, 0x32, 0xfc, 0x60, 0xbd, 0x43, 0x38, 0x96, 0x04, 0xee, 0xaf, 0x5a, 0x7f, 0x84, 0x7e, 0xe4, 0x7d, 0xc0, 0x8d, 0x74 },
+        { 0x3f, 0x96, 0x40, 0x5d, 0x25, 0xa3, 0x16, 0x60, 0xa7, 0x33, 0xb2, 0x3a, 0x98, 0xca, 0x5b, 0x22, 0xa0, 0x32, 0x82, 0x40, 0x78, 0xea, 0xa4, 0xfe, 0x8d, 0xd7, 0x02, 0xcb, 0x68, 0x8b, 0xc0, 0x87 },
+        { 0x53, 0x3b, 0xd8, 0xc1, 0xe9, 0x77, 0x02, 0x4e, 0x56, 0x1d, 0xcd, 0x0f, 0xd4, 0xd3, 0x14, 0xd9, 0x3b, 0xfe, 0xf0, 0xf0, 0x0d, 0xf2, 0xec, 0x88, 0xac, 0x15, 0x9e, 0x26, 0x88, 0xbd, 0x43, 0x33 },
+        { 0x73, 0xed, 0xa7, 0x53, 0x29, 0x9d, 0x7d, 0x48, 0x33, 0x39, 0xd8, 0x08, 0x09, 0xa1, 0xd8, 0x05, 0x53, 0xbd, 0xa4, 0x02, 0xff, 0xfe, 0x5b, 0xfe, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00 },
+        { 0x38, 0xc7, 0xf2, 0xdd, 0x7e, 0x0c, 0x63, 0xfc, 0xca, 0xbf, 0x64, 0x3e, 0xda, 0x89, 0x51, 0xf2, 0x57, 0xbc, 0x96, 0xaf, 0x33, 0x4c, 0x36, 0xbc, 0xa1, 0xab, 0xb3, 0x1f, 0xb3, 0x77, 0x86, 0xb9 },
+        { 0x13, 0x33, 0xb2, 0x2e, 0x5c, 0xe1, 0x10, 0x44, 0xba, 0xbc, 0x5a, 0xff, 0xca, 0x86, 0xbf, 0x65, 0x8e, 0x74, 0x90, 0x36, 0x94, 0xb0, 0x4f, 0xd8, 0x60, 0x37, 0xfe, 0x81, 0xae, 0x99, 0x50, 0x2e },
+        { 0x4f, 0x2c, 0x59, 0x6e, 0x75, 0x3e, 0x4f, 0xcc, 0x6e, 0x92, 0xa9, 0xc4, 0x60, 0xaf, 0xca, 0x4a, 0x1e, 0xf4, 0xe6, 0x72, 0xeb, 0xc1, 0xe1, 0xbb, 0x95, 0xdf, 0x4b, 0x36, 0x04, 0x11, 0xfe, 0x73 },
+        { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8d, 0x51, 0xcc, 0xce, 0x76, 0x03, 0x04, 0xd0, 0xec, 0x03, 0x00, 0x02, 0x76, 0x03, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 },
+        { 0x1e, 0xdc, 0x91, 0x9e, 0xc9, 0x1f, 0x38, 0xac, 0x5c, 0xcd, 0x46, 0x31, 0xf1, 0x6e, 0xdb, 0xa4, 0x96, 0x7a, 0x6b, 0x6c, 0xfb, 0x0f, 0xac, 0xa4, 0x80, 0x7b, 0x81, 0x1a, 0x82, 0x3f, 0x72, 0x8d },
+        { 0x34, 0x57, 0x66, 0xf6, 0x03, 0xfa, 0x66, 0xe7, 0x8c, 0x06, 0x25, 0xcd, 0x70, 0xd7, 0x7c, 0xe2, 0xb3, 0x8b, 0x21, 0xc2, 0x87, 0x13, 0xb7, 0x00, 0x72, 0x28, 0xfd, 0x33, 0x97, 0x74, 0x3f, 0x7a },
+        { 0x20, 0xb1, 0xce, 0x91, 0x40, 0x26, 0x7a, 0xf9, 0xdd, 0x1c, 0x0a, 0xf8, 0x34, 0xce, 0xc3, 0x2c, 0x17, 0xbe, 0xb3, 0x12, 0xf2, 0x0b, 0x6f, 0x76, 0x53, 0xea, 0x61, 0xd8, 0x77, 0x42, 0xbc, 0xce }
+    }
+};
+
+#else
+
+const uint8_t SQRT_FQ_ROOTS[SQRT_WINDOWS][16][32] = {
+    {
+        { 0x18, 0x24, 0xb1, 0x59, 0xac, 0xc5, 0x05, 0x6f, 0x99, 0x8c, 0x4f, 0xef, 0xec, 0xbc, 0x4f, 0xf5, 0x58, 0x84, 0xb7, 0xfa, 0x00, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe },
+        { 0x2d, 0x2f, 0xc0, 0x49, 0x65, 0x8a, 0xfd, 0x43, 0xf9, 0xc3, 0xf1, 0xd7, 0x5f, 0x7a, 0x3b, 0x27, 0x45, 0xf3, 0x7b, 0x7f, 0x96, 0xb6, 0xca, 0xd3, 0x42, 0x56, 0x48, 0x1a, 0xdc, 0xf3, 0x21, 0x9a },
+        { 0x5f, 0x5b, 0x95, 0x9a, 0x87, 0xe5, 0xe5, 0xd4, 0x67, 0x26, 0x2f, 0x63, 0x98, 0x4f, 0x65, 0x27, 0xcc, 0x60, 0x32, 0xec, 0x18, 0x4b, 0x83, 0x22, 0x1e, 0x47, 0x39, 0xc8, 0xb5, 0x10, 0xe5, 0x7e },
+        { 0x26, 0x24, 0x05, 0x2c, 0xb7, 0xe5, 0x0e, 0xd6, 0xdc, 0x59, 0x21, 0xa2, 0x89, 0x87, 0xdc, 0x47, 0x9f, 0x7c, 0x11, 0x0d, 0xa3, 0x01, 0xcb, 0x77, 0x2c, 0x18, 0xff, 0xe6, 0x55, 0xba, 0x3b, 0x5b },
+        { 0x18, 0x48, 0x57, 0xc8, 0xfb, 0xd5, 0xad, 0x87, 0x68, 0x7f, 0xc8, 0x7a, 0xb0, 0x64, 0xbd, 0x3c, 0xfe, 0x59, 0x29, 0x90, 0x87, 0x98, 0x9f, 0xc9, 0x04, 0x91, 0xbc, 0xeb, 0x70, 0xde, 0x2c, 0x18 },
+        { 0x0d, 0x34, 0x1d, 0x07, 0x14, 0x18, 0xb3, 0x41, 0x7c, 0xcb, 0x44, 0x92, 0x6d, 0xa4, 0x4d, 0x28, 0xeb, 0xef, 0xe1, 0x78, 0x0f, 0x89, 0x52, 0x56, 0x7d, 0xa1, 0xec, 0x25, 0x15, 0xd8, 0x08, 0x6b },
+        { 0x64, 0xe6, 0xed, 0x21, 0x89, 0x61, 0x61, 0x01, 0xda, 0x60, 0x56, 0xf1, 0xe8, 0x6e, 0x03, 0xe8, 0x03, 0x23, 0x3f, 0x13, 0xb2, 0xad, 0xfd, 0x57, 0x37, 0x1f, 0x6f, 0x57, 0xa3, 0x92, 0x60, 0xbd },
+        { 0x4b, 0x38, 0x01, 0xe3, 0x8c, 0x10, 0xc9, 0x1d, 0x45, 0x5a, 0x4a, 0xef, 0x5a, 0x40, 0xec, 0x6f, 0x71, 0x7d, 0x65, 0x28, 0xf0, 0xbc, 0x64, 0xeb, 0xc6, 0x21, 0x3a, 0x40, 0x5d, 0x68, 0xad, 0xab },
+        { 0x1c, 0x9b, 0xd1, 0x7e, 0xd4, 0xa5, 0x02, 0xf9, 0x1f, 0xdd, 0xcc, 0xe9, 0x47, 0x87, 0x38, 0x90, 0x1d, 0x44, 0xbe, 0x7d, 0xd0, 0x7f, 0xc6, 0x45, 0x79, 0x67, 0x59, 0x17, 0x54, 0xeb, 0x1d, 0x75 },
+        { 0x1f, 0x71, 0x01, 0x87, 0x39, 0x83, 0x58, 0xa9, 0x35, 0x80, 0x61, 0xcf, 0x97, 0xa3, 0xd0, 0xe0, 0xf0, 0xca, 0x46, 0x60, 0x2d, 0x5e, 0xe4, 0xf0, 0x91, 0xd3, 0x6f, 0xb2, 0xf4, 0x16, 0x14, 0xdb },
+        { 0x3b, 0x82, 0xfc, 0x93, 0x47, 0xe3, 0x25, 0xc6, 0x8e, 0xc1, 0x1e, 0x78, 0x6f, 0xef, 0xa1, 0x81, 0x45, 0x87, 0x6f, 0x88, 0xfd, 0xe6, 0xdf, 0x69, 0x57, 0x3d, 0xe5, 0x90, 0x0e, 0x97, 0x5e, 0xb0 },
+        { 0x27, 0xcb, 0x05, 0x65, 0x24, 0x21, 0x22, 0xd5, 0xc7, 0x87, 0xac, 0x1b, 0xfb, 0x97, 0x78, 0x27, 0x5f, 0x80, 0x4e, 0x66, 0x9d, 0x3b, 0x75, 0xc2, 0x7d, 0x6c, 0xc6, 0xf9, 0x44, 0xc7, 0x34, 0x2b },
+        { 0x66, 0xd7, 0xe2, 0xd2, 0x74, 0x0a, 0x24, 0x63, 0xbf, 0x43, 0xe8, 0x2f, 0xd3, 0x6a, 0x1a, 0x77, 0xe6, 0x9a, 0x00, 0x18, 0x02, 0x49, 0x35, 0x55, 0xed, 0xa7, 0x54, 0x5b, 0x76, 0xab, 0x12, 0x6f },
+        { 0x4e, 0x33, 0x5a, 0x86, 0x9a, 0xc0, 0x5d, 0xc5, 0x44, 0x1a, 0xe2, 0x96, 0xb5, 0x3a, 0x80, 0x83, 0x33, 0xe0, 0x6f, 0x94, 0xf5, 0x20, 0xad, 0x2e, 0x25, 0xe3, 0xcf, 0xcb, 0x28, 0x7d, 0xef, 0x7a },
+        { 0x41, 0x20, 0x2b, 0x7a, 0xbf, 0x54, 0x7a, 0xff, 0x1a, 0xed, 0x09, 0x40, 0xdb, 0xe2, 0xdc, 0x3d, 0x55, 0x10, 0xc6, 0x21, 0xb5, 0xef, 0x3c, 0xa5, 0x8b, 0x75, 0x3c, 0xbd, 0xd9, 0x61, 0x43, 0x3f },
+        { 0x6a, 0xea, 0x05, 0xa3, 0x6b, 0x4a, 0xfe, 0x61, 0x6f, 0x9e, 0x9b, 0x13, 0x51, 0x0a, 0xe2, 0x6b, 0x76, 0x7e, 0xd6, 0x06, 0x69, 0x66, 0x26, 0x43, 0x9a, 0xd7, 0x6d, 0xe6, 0xd9, 0xf2, 0xb2, 0xe9 }
+    },
+    {
+        { 0x18, 0x24, 0xb1, 0x59, 0xac, 0xc5, 0x05, 0x6f, 0x99, 0x8c, 0x4f, 0xef, 0xec, 0xbc, 0x4f, 0xf5, 0x58, 0x84, 0xb7, 0xfa, 0x00, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe },
+        { 0x2b, 0xcc, 0xc2, 0x88, 0x90, 0xca, 0x22, 0x26, 0xe7, 0xa7, 0x27, 0x91, 0xdf, 0xbf, 0x15, 0x8f, 0xe6, 0xc3, 0x38, 0x3b, 0x3f, 0x40, 0x36, 0x8f, 0x25, 0x90, 0x9f, 0xe2, 0x7b, 0x48, 0x39, 0x97 },
+        { 0x6b, 0x3c, 0xb8, 0x3c, 0xd0, 0x7e, 0xc3, 0x8b, 0x1d, 0x4e, 0x30, 0x56, 0x3f, 0xfd, 0x89, 0xd1, 0x02, 0x9e, 0x0c, 0x54, 0xb3, 0x4e, 0xca, 0x42, 0x3b, 0xbb, 0x6d, 0x5f, 0x61, 0xb4, 0xa6, 0xdf },
+        { 0x15, 0x1b, 0x14, 0x0d, 0x3c, 0x63, 0xc3, 0x3d, 0x28, 0x1f, 0x3d, 0x36, 0x63, 0xe9, 0xf4, 0x31, 0x46, 0x4c, 0xe9, 0x85, 0xb0, 0xe2, 0xf0, 0x81, 0x6c, 0x0e, 0xcb, 0xb6, 0x2f, 0xe0, 0x09, 0x38 },
+        { 0x06, 0x8d, 0xfb, 0xae, 0x2b, 0x59, 0xd6, 0x21, 0xc1, 0x7c, 0x34, 0xcd, 0x06, 0xea, 0xb0, 0xa9, 0x4d, 0xdc, 0x72, 0x90, 0x2b, 0x57, 0x63, 0x7f, 0xf6, 0xd8, 0x2d, 0xbf, 0x27, 0xc5, 0x62, 0xbb },
+        { 0x6a, 0x14, 0xb0, 0x4a, 0x51, 0x75, 0xc2, 0x76, 0x68, 0xb6, 0xc2, 0x55, 0xa1, 0x54, 0xe5, 0xf1, 0x7f, 0xc2, 0xc5, 0xea, 0x50, 0x50, 0x0a, 0xd0, 0x55, 0x0d, 0xd9, 0xd7, 0x7f, 0x33, 0x2d, 0xb5 },
+        { 0x31, 0x55, 0x22, 0x26, 0x7d, 0xed, 0x3f, 0xd6, 0xc7, 0x41, 0x60, 0xd9, 0x99, 0xcc, 0x35, 0xba, 0x04, 0xcd, 0xb7, 0xa3, 0xbd, 0x12, 0xa1, 0x48, 0xea, 0xc4, 0x7c, 0x6d, 0x3d, 0x57, 0x98, 0x18 },
+        { 0x4b, 0x7f, 0x6e, 0x39, 0x76, 0x62, 0x09, 0xd0, 0xd2, 0xaa, 0x95, 0x42, 0x33, 0xcd, 0x2d, 0x6b, 0x67, 0xae, 0x65, 0xc8, 0xe4, 0xb9, 0xaf, 0x79, 0x07, 0x02, 0x24, 0x27, 0x45, 0xfe, 0xca, 0x49 },
+        { 0x5a, 0xdc, 0x0a, 0x48, 0x24, 0xed, 0x7b, 0x31, 0xf6, 0xfc, 0x95, 0xfc, 0x76, 0xa3, 0xe4, 0x4e, 0x2d, 0xb0, 0x7b, 0x79, 0x14, 0x09, 0xbd, 0x44, 0xbd, 0x56, 0xd6, 0x84, 0xae, 0x32, 0xdc, 0xde },
+        { 0x4c, 0xf2, 0xc6, 0x6f, 0x0e, 0x93, 0xa5, 0x9d, 0x95, 0x16, 0xa6, 0x09, 0x1a, 0xea, 0xa4, 0xc7, 0x03, 0xc5, 0x53, 0x5e, 0xad, 0x6a, 0x2e, 0x5e, 0x18, 0xfa, 0xac, 0x24, 0x9b, 0x8a, 0xc5, 0x97 },
+        { 0x02, 0xbe, 0x67, 0x19, 0xaf, 0x12, 0x43, 0xee, 0x1a, 0x1b, 0x8f, 0xc9, 0x6a, 0x6f, 0xed, 0x50, 0x99, 0xd3, 0x67, 0xe2, 0xa6, 0xa5, 0x83, 0x37, 0x22, 0xb8, 0x55, 0xf1, 0xb0, 0x53, 0xe3, 0x4b },
+        { 0x22, 0x89, 0x4c, 0x17, 0xfd, 0x04, 0xf9, 0x65, 0x5b, 0x69, 0xa5, 0x65, 0x3f, 0xb3, 0xe2, 0x64, 0x92, 0x07, 0x72, 0x79, 0x52, 0xa0, 0x03, 0x33, 0x4c, 0x89, 0x99, 0x74, 0x56, 0xa1, 0xb0, 0x5a },
+        { 0x2d, 0x8f, 0xee, 0x11, 0x8b, 0x7f, 0xc6, 0x1e, 0x59, 0x34, 0x21, 0x8e, 0xaa, 0xd6, 0x6e, 0xd8, 0x6e, 0x15, 0xf7, 0x48, 0x27, 0xb6, 0xe4, 0xcd, 0xaa, 0xb1, 0x37, 0x50, 0x76, 0xd4, 0xf9, 0xa2 },
+        { 0x09, 0x35, 0xb0, 0x70, 0xdc, 0x28, 0x9c, 0x5c, 0x16, 0x66, 0x27, 0x07, 0x03, 0x17, 0x5c, 0xb2, 0x73, 0xe9, 0x4e, 0x78, 0xe1, 0x08, 0x03, 0x4a, 0xda, 0x0e, 0x36, 0x3b, 0x22, 0xba, 0x09, 0x6c },
+        { 0x25, 0x3b, 0xaa, 0x10, 0x23, 0x0d, 0x1a, 0x6f, 0x19, 0x44, 0xfd, 0x71, 0x3e, 0xd4, 0x8e, 0xc8, 0x74, 0x29, 0x7a, 0x3c, 0x10, 0xba, 0x63, 0x80, 0x87, 0x10, 0x44, 0x9f, 0xba, 0x91, 0xd9, 0x35 },
+        { 0x0a, 0xb3, 0xe2, 0x80, 0xa9, 0x70, 0xbf, 0x7e, 0x3d, 0x96, 0x0b, 0x14, 0x45, 0xd2, 0x19, 0x2f, 0x94, 0xce, 0x8b, 0x8f, 0x0e, 0xff, 0x7d, 0x88, 0x99, 0x12, 0x83, 0x9c, 0x45, 0xaf, 0x1c, 0xb2 }
+    },
+    {
+        { 0x18, 0x24, 0xb1, 0x59, 0xac, 0xc5, 0x05, 0x6f, 0x99, 0x8c, 0x4f, 0xef, 0xec, 0xbc, 0x4f, 0xf5, 0x58, 0x84, 0xb7, 0xfa, 0x00, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe },
+        { 0x39, 0xf3, 0x9d, 0x66, 0x0b, 0x26, 0x86, 0x1d, 0x8d, 0xce, 0x37, 0xc6, 0x77, 0x6d, 0xcb, 0xae, 0xfc, 0xc7, 0x5b, 0x77, 0x35, 0xd5, 0x36, 0xac, 0xad, 0x97, 0x0b, 0xf0, 0x99, 0x0a, 0xda, 0xca },
+        { 0x13, 0xb6, 0x32, 0xee, 0xf7, 0xc5, 0x60, 0xf3, 0x4a, 0x9e, 0xa2, 0xd0, 0x0c, 0x4e, 0x28, 0x17, 0xf6, 0x0c, 0x53, 0xc0, 0xbb, 0x17, 0xed, 0xba, 0x62, 0xa1, 0x7c, 0x8a, 0x3f, 0x3f, 0x74, 0x13 },
+        { 0x35, 0x81, 0x7d, 0x11, 0xc8, 0x9b, 0x39, 0x8e, 0xe2, 0x05, 0xf1, 0x4c, 0xb0, 0xe6, 0x9d, 0x63, 0x82, 0x40, 0x8b, 0x4c, 0x18, 0x03, 0xba, 0x5b, 0xaa, 0x23, 0xc7, 0x1f, 0xbf, 0x8d, 0x20, 0x10 },
+        { 0x5b, 0xb6, 0x6c, 0xdb, 0x93, 0x36, 0xbf, 0x44, 0x5e, 0xcc, 0x78, 0xdd, 0x0f, 0x71, 0xa3, 0x46, 0xbf, 0x33, 0x42, 0x8e, 0x5e, 0xc9, 0x55, 0x69, 0x52, 0xc4, 0x0f, 0xb8, 0xf6, 0x42, 0x1a, 0x00 },
+        { 0x37, 0xfc, 0xf0, 0xec, 0xd0, 0x0f, 0x81, 0x28, 0x16, 0x5f, 0x9f, 0xec, 0x01, 0xdf, 0x01, 0x86, 0x31, 0xaa, 0x9c, 0x79, 0xc8, 0xb9, 0x4a, 0xc3, 0x9d, 0x39, 0xae, 0x58, 0xd7, 0xa6, 0x91, 0x37 },
+        { 0x34, 0x0c, 0x1c, 0xd8, 0xc9, 0x83, 0x96, 0x7d, 0x3e, 0x0d, 0x24, 0xa9, 0xf4, 0x05, 0xe8, 0x23, 0x33, 0x5c, 0x25, 0x73, 0x3e, 0x94, 0xbc, 0x59, 0xc5, 0xad, 0x52, 0xbe, 0x88, 0x30, 0xc8, 0x3b },
+        { 0x3f, 0x38, 0xe6, 0x44, 0xa1, 0xa1, 0x66, 0x1e, 0x6a, 0x37, 0x2a, 0xe3, 0x75, 0x6f, 0x09, 0x18, 0x89, 0xa0, 0x13, 0xdb, 0x07, 0xf0, 0x9b, 0xf5, 0xe0, 0xe1, 0x55, 0x08, 0x50, 0x15, 0xe0, 0x46 },
+        { 0x64, 0xbf, 0xfb, 0x89, 0xf6, 0xae, 0x05, 0x1c, 0x64, 0xa4, 0xe5, 0x83, 0x29, 0xaf, 0x63, 0x49, 0xc3, 0xa0, 0x74, 0x02, 0xd6, 0x7b, 0x21, 0xbc, 0x9a, 0xa2, 0xba, 0x63, 0xe3, 0xc3, 0x0b, 0x08 },
+        { 0x08, 0x1c, 0xce, 0xcb, 0x83, 0x42, 0xd3, 0x21, 0x63, 0x9a, 0x4b, 0xa0, 0x07, 0x24, 0xa3, 0x3a, 0x9d, 0x2b, 0x3e, 0x00, 0xde, 0x22, 0x70, 0xf4, 0x5c, 0x06, 0x56, 0xe3, 0x97, 0xe8, 0xc1, 0x41 },
+        { 0x57, 0x19, 0x19, 0x69, 0x46, 0xfa, 0x1a, 0xfd, 0x53, 0xc1, 0xe1, 0x4f, 0x48, 0x47, 0x1b, 0xa3, 0x01, 0xc1, 0xe4, 0x52, 0x7c, 0x9d, 0x4f, 0x12, 0x2e, 0xb0, 0x3e, 0x83, 0x5e, 0xb6, 0x5c, 0x76 },
+        { 0x06, 0x2b, 0x69, 0x96, 0x13, 0x9e, 0x2b, 0xed, 0x00, 0x9d, 0xda, 0xd0, 0x01, 0x92, 0xe4, 0xae, 0xd5, 0xf2, 0xb8, 0xe9, 0x34, 0x8a, 0xdb, 0xef, 0x21, 0x76, 0xd8, 0xce, 0x40, 0x37, 0x49, 0x53 },
+        { 0x68, 0xf9, 0x2b, 0x69, 0x13, 0xed, 0xe9, 0xe1, 0xc4, 0x3f, 0x28, 0x4b, 0xd6, 0x57, 0x17, 0x7c, 0xe5, 0xcc, 0x4b, 0x84, 0x67, 0x7c, 0x3a, 0x87, 0xa4, 0x73, 0x14, 0x1b, 0xc5, 0x4c, 0x72, 0x24 },
+        { 0x16, 0x79, 0xbc, 0xf7, 0x7b, 0xdc, 0x83, 0x36, 0xcb, 0xc2, 0x39, 0x89, 0x39, 0xd8, 0xc9, 0x6b, 0xe6, 0xee, 0x13, 0x68, 0xb7, 0x9b, 0xac, 0x80, 0xac, 0xe2, 0xb2, 0xb2, 0x61, 0xe3, 0xb1, 0x45 },
+        { 0x6f, 0x64, 0x36, 0xc3, 0xda, 0x01, 0xf7, 0xb5, 0x7a, 0xc5, 0x1b, 0x8a, 0xa8, 0xf3, 0x9d, 0x52, 0x9c, 0xc6, 0x64, 0xa2, 0x72, 0x10, 0x6c, 0xf8, 0x5e, 0x54, 0xcc, 0x69, 0x19, 0x60, 0x6f, 0x59 },
+        { 0x6a, 0xc6, 0x0d, 0xd2, 0x6c, 0x77, 0xc1, 0x7a, 0x91, 0x82, 0x7a, 0x03, 0x36, 0x0f, 0x0e, 0x9f, 0xd3, 0xb7, 0xde, 0xad, 0x1b, 0x61, 0xb4, 0xa3, 0xf0, 0xf3, 0xc5, 0x0b, 0xc1, 0xce, 0x4a, 0x7a }
+    },
+    {
+        { 0x18, 0x24, 0xb1, 0x59, 0xac, 0xc5, 0x05, 0x6f, 0x99, 0x8c, 0x4f, 0xef, 0xec, 0xbc, 0x4f, 0xf5, 0x58, 0x84, 0xb7, 0xfa, 0x00, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe },
+        { 0x48, 0x23, 0x0b, 0x86, 0x2a, 0xe8, 0xd6, 0x89, 0xd7, 0x49, 0xce, 0x3d, 0x25, 0x6c, 0x4b, 0xec, 0x8e, 0xed, 0xa8, 0x1e, 0x0a, 0x2b, 0x8b, 0xaf, 0x68, 0xee, 0x7c, 0xb8, 0xb6, 0x49, 0x57, 0xf6 },
+        { 0x0b, 0x25, 0xdb, 0x2f, 0xb7, 0x0a, 0x70, 0x51, 0x80, 0x74, 0xcb, 0xd9, 0x54, 0x77, 0x0c, 0x18, 0xcc, 0x31, 0x12, 0xe3, 0xd9, 0xe1, 0xe4, 0x54, 0x39, 0xd1, 0x65, 0x75, 0x13, 0xa3, 0x2f, 0x88 },
+        { 0x0e, 0xbe, 0xbb, 0xa8, 0xd6, 0xb1, 0x24, 0xa1, 0xde, 0x9b, 0x84, 0xdb, 0xf3, 0x65, 0xfb, 0x4c, 0xe8, 0x97, 0x0f, 0x27, 0x55, 0x3f, 0x04, 0x3b, 0xe2, 0x7d, 0x8c, 0xff, 0x94, 0xc2, 0xc0, 0x40 },
+        { 0x2b, 0xf6, 0xe1, 0xfb, 0x14, 0xaa, 0x05, 0x89, 0x4c, 0x57, 0x48, 0x3a, 0x5c, 0x0c, 0xc7, 0x36, 0xb4, 0x0f, 0xb5, 0x41, 0x7a, 0x9e, 0xa4, 0xd0, 0x61, 0xc7, 0xa1, 0x18, 0x08, 0xea, 0x08, 0x5b },
+        { 0x41, 0x03, 0xa9, 0xc8, 0x94, 0xe6, 0x62, 0xd6, 0x2a, 0x2a, 0x02, 0xc1, 0x02, 0xe1, 0x85, 0xd6, 0xc4, 0x63, 0x0a, 0xc0, 0x63, 0xa7, 0xb5, 0x8f, 0x27, 0x31, 0x52, 0xdd, 0x80, 0xbe, 0x91, 0x65 },
+        { 0x29, 0xb5, 0xf7, 0xc2, 0x63, 0xec, 0x61, 0x26, 0x9f, 0xd7, 0x32, 0x52, 0xae, 0xfe, 0xc2, 0xa6, 0xb8, 0xfa, 0xd5, 0x06, 0xe6, 0x29, 0x3e, 0x25, 0x4d, 0x66, 0xfc, 0x07, 0x10, 0xa8, 0x8a, 0xf1 },
+        { 0x42, 0x7d, 0x01, 0x0e, 0x6a, 0x21, 0xe7, 0xaa, 0x0e, 0x2a, 0x09, 0x46, 0x41, 0xbd, 0x02, 0xdd, 0x66, 0x39, 0x4b, 0xb7, 0x71, 0xbd, 0xd0, 0xe5, 0x19, 0x61, 0x35, 0x63, 0x61, 0x3e, 0x1f, 0xc9 },
+        { 0x44, 0x34, 0xce, 0x21, 0x52, 0xce, 0xf6, 0x9c, 0x48, 0x79, 0x07, 0x0c, 0xa0, 0x4f, 0x82, 0x7f, 0x56, 0xc6, 0xbb, 0x33, 0x04, 0x85, 0x95, 0x1f, 0x82, 0x0f, 0xbd, 0xda, 0x71, 0xd5, 0xe3, 0x17 },
+        { 0x05, 0xa6, 0xbb, 0x12, 0xeb, 0x20, 0x03, 0x28, 0xbe, 0xcb, 0x49, 0x1d, 0x35, 0x16, 0xe2, 0x41, 0xfd, 0x7d, 0x77, 0x34, 0xae, 0x43, 0x30, 0x81, 0xa6, 0x72, 0xc6, 0x4c, 0x7d, 0x59, 0x69, 0xbe },
+        { 0x2b, 0x9e, 0x04, 0x28, 0x52, 0x72, 0x8b, 0xfb, 0xb3, 0xd5, 0x10, 0x96, 0xff, 0xdd, 0x1d, 0x88, 0x55, 0x33, 0x4b, 0xc3, 0x18, 0xac, 0x3f, 0x20, 0x22, 0x2b, 0xc4, 0x7c, 0xe0, 0xc0, 0x5e, 0x8d },
+        { 0x20, 0x26, 0xf3, 0x91, 0x7b, 0x7f, 0x5b, 0x47, 0x3e, 0xca, 0x7b, 0xd6, 0x5d, 0x3e, 0x00, 0x55, 0x26, 0x7e, 0xa8, 0x15, 0x55, 0xd0, 0x54, 0x36, 0x04, 0x55, 0xf5, 0x24, 0x58, 0x7c, 0x8c, 0xee },
+        { 0x48, 0x49, 0xd1, 0xea, 0xf3, 0xbd, 0x8b, 0x2f, 0x45, 0x52, 0x23, 0xe7, 0x16, 0x90, 0xc1, 0x71, 0x14, 0x6b, 0xee, 0x7d, 0x28, 0x42, 0x99, 0x55, 0xee, 0xfc, 0x8d, 0xb4, 0xbd, 0xff, 0xf7, 0x8c },
+        { 0x03, 0x82, 0x8c, 0x2b, 0x77, 0xd5, 0x75, 0xe3, 0x84, 0x49, 0x62, 0x77, 0x19, 0x48, 0xc5, 0xf2, 0x85, 0x91, 0x4f, 0xaa, 0x41, 0x25, 0xfa, 0x8b, 0xe5, 0xe6, 0x2e, 0xfb, 0x02, 0x51, 0x8e, 0x38 },
+        { 0x3b, 0xc7, 0x2d, 0x1f, 0xd6, 0x40, 0x3e, 0x79, 0x85, 0xdb, 0xc3, 0xc0, 0x6d, 0xf8, 0x94, 0x50, 0x62, 0x84, 0x9b, 0xde, 0x32, 0x66, 0x6e, 0xaf, 0x7c, 0x30, 0x9d, 0x30, 0x8c, 0xed, 0xf0, 0x77 },
+        { 0x06, 0x6d, 0xe4, 0xf4, 0x70, 0x1a, 0x8a, 0xe6, 0x13, 0x2a, 0xe6, 0xc7, 0x38, 0x70, 0x9c, 0x78, 0x34, 0x5d, 0xf7, 0x38, 0x7e, 0x54, 0x73, 0xec, 0x38, 0x5a, 0x3b, 0x46, 0xe7, 0x85, 0x62, 0x86 }
+    },
+    {
+        { 0x18, 0x24, 0xb1, 0x59, 0xac, 0xc5, 0x05, 0x6f, 0x99, 0x8c, 0x4f, 0xef, 0xec, 0xbc, 0x4f, 0xf5, 0x58, 0x84, 0xb7, 0xfa, 0x00, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe },
+        { 0x4f, 0xfe, 0x80, 0x88, 0xa9, 0x51, 0x25, 0xa3, 0x47, 0xb2, 0x27, 0xda, 0x5e, 0x78, 0x29, 0x70, 0x78, 0xcd, 0x3e, 0x7a, 0x64, 0x92, 0x53, 0xa6, 0x9d, 0xa1, 0x1b, 0x8f, 0x32, 0x23, 0x3a, 0x37 },
+        { 0x6b, 0x3b, 0xd7, 0x90, 0xcd, 0xc0, 0xb4, 0xe0, 0xbb, 0x34, 0xc1, 0x4a, 0xe5, 0xc2, 0xd7, 0x88, 0x2f, 0xaa, 0x86, 0xe3, 0x15, 0x74, 0xd9, 0x0f, 0x8d, 0x5a, 0xc1, 0x09, 0x6b, 0x2c, 0x5d, 0xea },
+        { 0x2d, 0xa8, 0x66, 0x3b, 0xf3, 0x62, 0x07, 0x74, 0xc5, 0x15, 0x5c, 0xad, 0xcd, 0xe5, 0x93, 0x36, 0x0b, 0x25, 0x3e, 0xaa, 0x45, 0x1e, 0x7b, 0xd4, 0x0c, 0xcb, 0x15, 0x69, 0xf8, 0x7b, 0xc9, 0x8f },
+        { 0x14, 0x07, 0x94, 0x3e, 0x93, 0x12, 0xdc, 0x0c, 0xa3, 0x5d, 0xff, 0x64, 0xef, 0x7e, 0xa5, 0x00, 0x55, 0xd9, 0x3c, 0xac, 0x4d, 0xdd, 0x94, 0xbf, 0x92, 0xc4, 0x28, 0x15, 0xb5, 0x65, 0x30, 0x1e },
+        { 0x46, 0xf2, 0x03, 0xc5, 0xb8, 0x3f, 0xf4, 0x4b, 0xa8, 0x75, 0xfc, 0xcc, 0xc2, 0x25, 0xa0, 0x9d, 0x58, 0x6f, 0xbb, 0x9d, 0x5b, 0x37, 0x5f, 0x46, 0x1f, 0x42, 0x15, 0x46, 0x62, 0x20, 0xa5, 0xa2 },
+        { 0x16, 0x54, 0x4c, 0x58, 0x38, 0x6a, 0xd7, 0xb7, 0x15, 0x0d, 0xeb, 0x01, 0x11, 0x89, 0x61, 0xab, 0xda, 0x6e, 0x6b, 0x50, 0xbb, 0x14, 0x65, 0xeb, 0x62, 0x62, 0x81, 0xb5, 0xc4, 0x8f, 0xeb, 0x42 },
+        { 0x5d, 0xac, 0x1c, 0x3f, 0x14, 0xd5, 0x9c, 0xda, 0x55, 0x30, 0x02, 0xae, 0x91, 0xf7, 0x76, 0x53, 0x80, 0xbd, 0x9e, 0xd1, 0x15, 0x8d, 0xad, 0xff, 0x23, 0xe6, 0x92, 0xd8, 0x9b, 0x21, 0xd8, 0xf3 },
+        { 0x24, 0x15, 0xd7, 0x70, 0x9d, 0xbc, 0xe1, 0x62, 0x60, 0x42, 0xc8, 0xdb, 0xee, 0x05, 0x57, 0xf8, 0xeb, 0x71, 0xfd, 0x25, 0x9b, 0x69, 0xcc, 0x1a, 0x50, 0x7d, 0xbe, 0xf9, 0xa1, 0x35, 0x5e, 0x75 },
+        { 0x1b, 0x99, 0x40, 0xb7, 0x3f, 0xea, 0x3b, 0xce, 0xee, 0x6b, 0x00, 0x35, 0x63, 0x00, 0x3a, 0x76, 0x48, 0xf3, 0x60, 0xc1, 0x4a, 0x0f, 0xe3, 0xc0, 0xd7, 0x25, 0x23, 0x5a, 0x6c, 0x4c, 0xd0, 0x9b },
+        { 0x72, 0x51, 0x00, 0x9b, 0x85, 0xb4, 0x3b, 0xf4, 0x7a, 0xd7, 0x15, 0xf3, 0xdd, 0xec, 0x08, 0x08, 0x22, 0x23, 0xcf, 0x26, 0x24, 0xa6, 0xff, 0x0c, 0x1f, 0xf0, 0x04, 0x0d, 0xab, 0xde, 0x4e, 0xa8 },
+        { 0x2d, 0xf8, 0x11, 0x55, 0x47, 0xa4, 0x93, 0x59, 0x65, 0x25, 0x7b, 0xa0, 0x1b, 0x66, 0x12, 0x46, 0xc6, 0x14, 0x99, 0x7c, 0x76, 0x13, 0xb1, 0xcc, 0x7d, 0xd1, 0x15, 0xdc, 0xcd, 0xcd, 0x7d, 0x80 },
+        { 0x08, 0x00, 0x50, 0x1a, 0xf4, 0x0e, 0x52, 0xd6, 0xc0, 0xcc, 0xed, 0x84, 0x3f, 0x76, 0xff, 0x19, 0xcf, 0x08, 0xb0, 0x08, 0xa1, 0xae, 0xa5, 0x03, 0x57, 0x69, 0x09, 0x79, 0x37, 0x3d, 0xa2, 0x3a },
+        { 0x15, 0xaf, 0x07, 0x21, 0x8b, 0xa4, 0x7a, 0x71, 0xcb, 0x98, 0x6f, 0xd8, 0x5a, 0x51, 0x45, 0x8f, 0x1f, 0xc0, 0xa9, 0x41, 0xf6, 0x18, 0x1f, 0x6f, 0xe1, 0x9c, 0x61, 0xfa, 0x55, 0x48, 0xb6, 0xce },
+        { 0x1b, 0x59, 0xb3, 0xfd, 0x37, 0x8f, 0x76, 0x53, 0x8e, 0x25, 0xbf, 0xe0, 0x8a, 0x0d, 0x2d, 0xfa, 0x35, 0x69, 0x13, 0xff, 0x94, 0x71, 0x82, 0x3b, 0x91, 0xd9, 0x7a, 0x65, 0xcb, 0x77, 0x8b, 0x00 },
+        { 0x01, 0x30, 0x83, 0x5a, 0x5f, 0x72, 0xcb, 0xc1, 0x1c, 0x0e, 0x1b, 0xa3, 0xf5, 0x9f, 0x32, 0xdf, 0x5e, 0x6d, 0x16, 0x85, 0x91, 0x8d, 0x14, 0x6a, 0xb2, 0xa0, 0x37, 0x79, 0x2e, 0x93, 0x80, 0x02 }
+    },
+    {
+        { 0x18, 0x24, 0xb1, 0x59, 0xac, 0xc5, 0x05, 0x6f, 0x99, 0x8c, 0x4f, 0xef, 0xec, 0xbc, 0x4f, 0xf5, 0x58, 0x84, 0xb7, 0xfa, 0x00, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe },
+        { 0x19, 0xd9, 0x42, 0x66, 0x4e, 0x21, 0xe4, 0x19, 0x7c, 0x49, 0xea, 0xcd, 0x4c, 0xe1, 0xd4, 0xcf, 0xb8, 0xf1, 0xf8, 0xb3, 0x1f, 0xe9, 0xc1, 0x9f, 0x5e, 0x13, 0xf9, 0x13, 0x7e, 0x7e, 0x76, 0x6d },
+        { 0x02, 0xfb, 0x07, 0x8f, 0x4f, 0x46, 0x0a, 0x37, 0xc4, 0x1f, 0x72, 0x80, 0x5d, 0x49, 0x30, 0x90, 0x5a, 0xf8, 0x90, 0x9b, 0x4b, 0xdf, 0x67, 0xd7, 0xc2, 0x2a, 0xee, 0x4c, 0x9a, 0xc9, 0xca, 0x75 },
+        { 0x72, 0x9d, 0x4a, 0x71, 0x7c, 0xe6, 0x16, 0x6a, 0x68, 0x03, 0x04, 0x33, 0xca, 0x66, 0xb5, 0x4d, 0x81, 0xeb, 0x0e, 0xc8, 0x42, 0x74, 0x7d, 0x75, 0xe7, 0x8f, 0xdf, 0xf2, 0x6d, 0x60, 0x86, 0xf9 },
+        { 0x4a, 0x6b, 0x4e, 0x6b, 0xf0, 0x7a, 0xdb, 0xbd, 0x16, 0x72, 0x2b, 0x72, 0x4a, 0x74, 0x34, 0xe8, 0x09, 0x83, 0x1c, 0x84, 0x87, 0x18, 0x27, 0x5c, 0x2b, 0x56, 0xce, 0xa3, 0xc3, 0xb1, 0xc0, 0x80 },
+        { 0x4a, 0x06, 0xa5, 0xa1, 0xa5, 0x43, 0x66, 0x3e, 0x0b, 0x52, 0x64, 0x83, 0xa0, 0x4a, 0x3f, 0xa6, 0x96, 0xf8, 0xf3, 0x2a, 0xb0, 0x28, 0x3e, 0x30, 0x72, 0xdc, 0x2d, 0x79, 0x64, 0x83, 0x65, 0x39 },
+        { 0x3c, 0xb1, 0xf0, 0x63, 0xd5, 0xa5, 0x07, 0x93, 0x35, 0x81, 0xf2, 0xd1, 0x7d, 0x40, 0x48, 0x81, 0x37, 0x6d, 0xd5, 0x59, 0x37, 0x37, 0xf9, 0xdc, 0x93, 0x8e, 0xfd, 0x6d, 0x9d, 0xaf, 0x4a, 0x5b },
+        { 0x03, 0xe3, 0x82, 0x27, 0x34, 0xc3, 0xf0, 0xd4, 0x04, 0xb9, 0x3b, 0x12, 0xfc, 0x13, 0x2a, 0x79, 0x89, 0xd3, 0x7a, 0xb5, 0xf0, 0xdb, 0x05, 0x28, 0x7e, 0x4d, 0x1e, 0x4b, 0xa9, 0x4c, 0x30, 0xd2 },
+        { 0x65, 0xaf, 0x65, 0x6f, 0xca, 0x80, 0x97, 0x9f, 0x96, 0x12, 0xab, 0x09, 0xbf, 0x51, 0xb9, 0xec, 0x20, 0xfe, 0x58, 0x79, 0x2d, 0xdb, 0x14, 0x30, 0x7e, 0x90, 0xc8, 0xe2, 0x1f, 0x27, 0xde, 0xe5 },
+        { 0x05, 0xe1, 0xd0, 0x76, 0xaf, 0x16, 0x97, 0xcc, 0x45, 0x94, 0x32, 0x0f, 0x2e, 0x32, 0x7c, 0xb9, 0xaa, 0x5b, 0xc3, 0xd1, 0x08, 0xfe, 0xa8, 0x4b, 0x44, 0x24, 0x60, 0xe2, 0xa1, 0xec, 0x05, 0x83 },
+        { 0x36, 0xd6, 0xd2, 0x5a, 0x29, 0x6c, 0x5c, 0x05, 0x9f, 0x2d, 0xfe, 0xed, 0x6f, 0xcb, 0xf0, 0x1f, 0x13, 0x3d, 0xfd, 0x8d, 0x5a, 0xee, 0x2b, 0x1a, 0x13, 0xee, 0x46, 0x73, 0xf2, 0x76, 0x27, 0x96 },
+        { 0x21, 0x9c, 0x55, 0x2d, 0x53, 0xc5, 0x32, 0xbc, 0x77, 0x95, 0x4f, 0xe8, 0xcd, 0xab, 0xd3, 0xae, 0x36, 0x98, 0xe0, 0xb8, 0xbc, 0xef, 0x4f, 0xdd, 0xed, 0xa1, 0x6c, 0x2a, 0x43, 0x3d, 0x91, 0xb5 },
+        { 0x1d, 0xfb, 0x4a, 0x2c, 0x98, 0x02, 0x56, 0x96, 0xbd, 0xf5, 0x87, 0x52, 0xb3, 0x31, 0x30, 0xa9, 0xed, 0x53, 0xa2, 0xdc, 0xc5, 0x20, 0x3a, 0xe9, 0xdf, 0x9f, 0x5b, 0xcb, 0x1f, 0x0d, 0x33, 0x68 },
+        { 0x4b, 0x23, 0x53, 0xea, 0x13, 0x4e, 0xf3, 0x2f, 0x18, 0x09, 0xd8, 0x15, 0x31, 0x12, 0x4e, 0xe6, 0xfb, 0xed, 0x88, 0x1b, 0x81, 0x6a, 0x64, 0xa6, 0x36, 0x9c, 0xe9, 0xcd, 0x4e, 0x75, 0xf8, 0xd0 },
+        { 0x44, 0x69, 0x14, 0x6e, 0xd6, 0xf6, 0xb6, 0x0a, 0x2a, 0x10, 0xfd, 0xf0, 0x77, 0xbe, 0x66, 0x45, 0xe3, 0x08, 0x2f, 0x17, 0x24, 0xd4, 0x8d, 0x7a, 0xee, 0x50, 0x9f, 0x54, 0xdc, 0x8a, 0x34, 0x45 },
+        { 0x4c, 0xc3, 0x28, 0xa0, 0xbc, 0xcb, 0x3f, 0x25, 0x07, 0xc4, 0x71, 0x97, 0x3a, 0xb7, 0x42, 0x52, 0xfc, 0xfc, 0x2f, 0xec, 0x09, 0x7b, 0xfc, 0x13, 0xf5, 0xe9, 0x6d, 0xb4, 0xad, 0x59, 0x8b, 0xa0 }
+    },
+    {
+        { 0x18, 0x24, 0xb1, 0x59, 0xac, 0xc5, 0x05, 0x6f, 0x99, 0x8c, 0x4f, 0xef, 0xec, 0xbc, 0x4f, 0xf5, 0x58, 0x84, 0xb7, 0xfa, 0x00, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe },
+        { 0x16, 0x92, 0x1f, 0x60, 0x6f, 0xa4, 0x6d, 0x9f, 0xb7, 0x45, 0x15, 0x39, 0xaf, 0x33, 0x4b, 0x5f, 0x34, 0xbd, 0x6b, 0x2e, 0xf1, 0xb4, 0x33, 0x02, 0xa4, 0x1a, 0xf2, 0x72, 0x9b, 0x6b, 0x31, 0xb6 },
+        { 0x6b, 0x00, 0xe7, 0xac, 0x62, 0xd2, 0xcf, 0x16, 0x93, 0x8d, 0xf1, 0x95, 0x72, 0x39, 0x34, 0x44, 0x36, 0xcb, 0xba, 0xa0, 0xf1, 0x4b, 0x64, 0x96, 0x17, 0x17, 0x2e, 0x1f, 0x8e, 0x9f, 0x64, 0xe7 },
+        { 0x19, 0x0f, 0x88, 0xd4, 0xd8, 0x67, 0xd4, 0xc8, 0x1c, 0x47, 0x60, 0xb2, 0x83, 0x92, 0xe9, 0x49, 0x96, 0xa9, 0xd6, 0xdc, 0x5e, 0xed, 0x44, 0x92, 0x2d, 0x48, 0x27, 0x7a, 0x8f, 0x62, 0x96, 0x51 },
+        { 0x12, 0xfe, 0x87, 0x33, 0xc7, 0xf0, 0x2a, 0xeb, 0xa9, 0xbc, 0xb9, 0xa2, 0x25, 0xaa, 0x35, 0x30, 0xe8, 0x07, 0x8a, 0x41, 0xec, 0x44, 0xa0, 0x18, 0xf0, 0xe6, 0xca, 0x26, 0x35, 0x35, 0x7c, 0xee },
+        { 0x3a, 0xa9, 0x8f, 0x8d, 0x56, 0x7e, 0xef, 0xc3, 0x78, 0x8f, 0x54, 0x37, 0x76, 0xf2, 0xb2, 0xd6, 0xe6, 0x7a, 0xa2, 0xa9, 0xec, 0x01, 0xf5, 0x21, 0x8a, 0x2a, 0x8d, 0x16, 0x22, 0xb0, 0xd8, 0x75 },
+        { 0x2f, 0x3a, 0xe5, 0xff, 0x6f, 0x3a, 0x35, 0x33, 0x55, 0xab, 0xd1, 0xa1, 0x04, 0x6e, 0x6b, 0xea, 0xbe, 0x7e, 0x32, 0xf8, 0xba, 0x67, 0x94, 0x57, 0x1d, 0x8d, 0xcd, 0xbc, 0xa7, 0xc8, 0xe3, 0xa9 },
+        { 0x0b, 0xc5, 0xef, 0x09, 0xd5, 0x84, 0x9f, 0x34, 0x24, 0x14, 0xfe, 0x3d, 0x67, 0x20, 0x0d, 0xb5, 0x5d, 0x8f, 0x32, 0x9d, 0x3d, 0x18, 0xef, 0x63, 0x79, 0x49, 0x9e, 0xf5, 0x2c, 0xd9, 0xa8, 0x82 },
+        { 0x5b, 0x5e, 0xbc, 0x8d, 0xb4, 0x13, 0x4c, 0x95, 0xfe, 0x64, 0x2f, 0x9d, 0xed, 0x4e, 0x3d, 0x6d, 0x60, 0x07, 0x2e, 0xb5, 0xd9, 0xad, 0x2c, 0x34, 0x64, 0xdb, 0x78, 0x8d, 0x71, 0x8c, 0x69, 0x44 },
+        { 0x2a, 0x21, 0x68, 0xf2, 0x82, 0xc4, 0xdc, 0x9e, 0xee, 0x0c, 0x8a, 0x1e, 0x22, 0xb4, 0x2c, 0x61, 0xf5, 0xb3, 0xd9, 0xaa, 0x4f, 0x18, 0x7e, 0x3a, 0x90, 0x89, 0xad, 0xa7, 0xe0, 0x29, 0x52, 0xab },
+        { 0x63, 0xfa, 0xcb, 0xc8, 0x03, 0xcf, 0xfb, 0xfe, 0xd8, 0xd0, 0x29, 0xe9, 0x95, 0xe2, 0xfd, 0xd4, 0xc5, 0x12, 0xd0, 0x7d, 0x27, 0x59, 0x0f, 0xc9, 0xd2, 0x0c, 0x30, 0x00, 0xff, 0x00, 0xca, 0x5f },
+        { 0x1b, 0x34, 0xf9, 0x09, 0x77, 0x93, 0xd5, 0xc6, 0x5b, 0x03, 0xa4, 0x77, 0x48, 0x43, 0xbc, 0x31, 0x01, 0xa7, 0x86, 0x00, 0x71, 0x11, 0x5f, 0xf3, 0x62, 0x07, 0x39, 0xae, 0xa3, 0x3c, 0xbf, 0xd2 },
+        { 0x1f, 0x8f, 0xb8, 0xea, 0xc5, 0xa1, 0xd3, 0xf2, 0x55, 0x24, 0x44, 0x34, 0xb5, 0xf5, 0x91, 0xc4, 0xb9, 0xdd, 0x8e, 0x7b, 0x73, 0xb8, 0x22, 0x56, 0x1e, 0x54, 0xda, 0xd0, 0xf3, 0x65, 0x9e, 0x6b },
+        { 0x3d, 0x24, 0xd0, 0x16, 0x28, 0xbf, 0x38, 0xf9, 0x42, 0x02, 0xed, 0xae, 0x4a, 0x0a, 0xdc, 0x0c, 0xc7, 0x21, 0xe0, 0xde, 0xa5, 0xc0, 0xa9, 0x1a, 0x3f, 0x6c, 0xa4, 0x36, 0x94, 0xb9, 0x08, 0x53 },
+        { 0x56, 0x52, 0x88, 0x77, 0x1c, 0x8d, 0x6b, 0xee, 0xda, 0x89, 0xb3, 0xb5, 0x0b, 0x1f, 0xe7, 0x7d, 0x1d, 0x1a, 0xfc, 0x39, 0xb3, 0x4c, 0x0e, 0xc9, 0xff, 0xa9, 0x45, 0x00, 0xc0, 0xcf, 0xec, 0x9a },
+        { 0x5b, 0x54, 0x8f, 0x28, 0xb6, 0xb6, 0xfc, 0x17, 0xb2, 0x1b, 0x4b, 0x37, 0x07, 0x9d, 0x43, 0xb3, 0x7c, 0xaa, 0x50, 0xdc, 0xb2, 0x63, 0xd4, 0x08, 0x53, 0xec, 0x83, 0x80, 0x64, 0x00, 0xff, 0x1f }
+    },
+    {
+        { 0x18, 0x24, 0xb1, 0x59, 0xac, 0xc5, 0x05, 0x6f, 0x99, 0x8c, 0x4f, 0xef, 0xec, 0xbc, 0x4f, 0xf5, 0x58, 0x84, 0xb7, 0xfa, 0x00, 0x03, 0x48, 0x02, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xfe },
+        { 0x2b, 0xd4, 0xab, 0x5c, 0x73, 0x23, 0x5a, 0x95, 0x55, 0x96, 0x24, 0x9d, 0x48, 0x5a, 0xcc, 0x4a, 0x74, 0x26, 0x26, 0x83, 0xcc, 0x22, 0x7e, 0xa9, 0xf2, 0x22, 0xd1, 0xb8, 0x23, 0x41, 0x12, 0xae },
+        { 0x1a, 0x78, 0xad, 0x5b, 0x3c, 0x03, 0x34, 0x57, 0x80, 0xb2, 0x7f, 0x64, 0x7b, 0x65, 0x36, 0xc9, 0x34, 0x46, 0x7c, 0x7e, 0x90, 0xc5, 0xa3, 0xbe, 0xee, 0xe0, 0x67, 0xbc, 0xc1, 0x4d, 0x57, 0x24 },
+        { 0x24, 0x8d, 0x2b, 0xa9, 0x3a, 0xba, 0x3b, 0x86, 0xeb, 0xff, 0xfb, 0x3d, 0x31, 0x87, 0x12, 0x2c, 0xbc, 0xa1, 0x32, 0x83, 0x82, 0xf6, 0x3a, 0x76, 0xda, 0x3d, 0x5f, 0xfc, 0xf4, 0xf5, 0xed, 0x78 },
+        { 0x26, 0xc0, 0xc3, 0x4d, 0xfc, 0x43, 0xf9, 0xd3, 0x64, 0x9f, 0xca, 0x48, 0xe4, 0x3b, 0x5d, 0xdf, 0x4c, 0x8e, 0xa2, 0xc2, 0x9f, 0xf7, 0xa2, 0x00, 0x0c, 0x4f, 0xa9, 0x8a, 0x55, 0x76, 0x30, 0x50 },
+        { 0x25, 0xd5, 0xb0, 0xe3, 0xb2, 0xa9, 0x9c, 0x18, 0x30, 0xfe, 0x31, 0x7c, 0x9e, 0x22, 0xea, 0xbd, 0x53, 0xc8, 0x08, 0x8a, 0x74, 0x73, 0x40, 0xe3, 0xa0, 0x4b, 0xf3, 0x87, 0xba, 0x3f, 0x63, 0x6b },
+        { 0x1f, 0x35, 0xa4, 0xec, 0x06, 0xff, 0x7a, 0x2c, 0xf3, 0x44, 0x08, 0xcf, 0xb3, 0x4b, 0x26, 0xa8, 0xe4, 0xfb, 0xa9, 0x7f, 0xb2, 0xa0, 0x61, 0xa7, 0x91, 0x30, 0xb6, 0x69, 0xd3, 0xbd, 0x10, 0x09 },
+        { 0x4c, 0x45, 0x53, 0x15, 0x5b, 0x0d, 0x6a, 0xa7, 0x44, 0xd5, 0x3b, 0x5c, 0xd8, 0x99, 0xda, 0x0f, 0xf8, 0xa4, 0xed, 0xcb, 0x7e, 0x5f, 0x5b, 0xaf, 0xe5, 0x30, 0x9b, 0x1a, 0x77, 0xdf, 0xd4, 0x9c },
+        { 0x5b, 0xc8, 0xf5, 0xf9, 0x7c, 0xd8, 0x77, 0xd8, 0x99, 0xad, 0x88, 0x18, 0x1c, 0xe5, 0x88, 0x0f, 0xfb, 0x38, 0xec, 0x08, 0xff, 0xfb, 0x13, 0xfc, 0xff, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x03 },
+        { 0x48, 0x18, 0xfb, 0xf6, 0xb6, 0x7a, 0x22, 0xb2, 0xdd, 0xa3, 0xb3, 0x6a, 0xc1, 0x47, 0x0b, 0xba, 0xdf, 0x97, 0x7d, 0x7f, 0x33, 0xdb, 0xdd, 0x55, 0x0d, 0xdd, 0x2e, 0x46, 0xdc, 0xbe, 0xed, 0x53 },
+        { 0x59, 0x74, 0xf9, 0xf7, 0xed, 0x9a, 0x48, 0xf0, 0xb2, 0x87, 0x58, 0xa3, 0x8e, 0x3c, 0xa1, 0x3c, 0x1f, 0x77, 0x27, 0x84, 0x6f, 0x38, 0xb8, 0x40, 0x11, 0x1f, 0x98, 0x42, 0x3e, 0xb2, 0xa8, 0xdd },
+        { 0x4f, 0x60, 0x7b, 0xa9, 0xee, 0xe3, 0x41, 0xc1, 0x47, 0x39, 0xdc, 0xca, 0xd8, 0x1a, 0xc5, 0xd8, 0x97, 0x1c, 0x71, 0x7f, 0x7d, 0x08, 0x21, 0x88, 0x25, 0xc2, 0xa0, 0x02, 0x0b, 0x0a, 0x12, 0x89 },
+        { 0x4d, 0x2c, 0xe4, 0x05, 0x2d, 0x59, 0x83, 0x74, 0xce, 0x9a, 0x0d, 0xbf, 0x25, 0x66, 0x7a, 0x26, 0x07, 0x2f, 0x01, 0x40, 0x60, 0x06, 0xb9, 0xfe, 0xf3, 0xb0, 0x56, 0x74, 0xaa, 0x89, 0xcf, 0xb1 },
+        { 0x4e, 0x17, 0xf6, 0x6f, 0x76, 0xf3, 0xe1, 0x30, 0x02, 0x3b, 0xa6, 0x8b, 0x6b, 0x7e, 0xed, 0x47, 0xff, 0xf5, 0x9b, 0x78, 0x8b, 0x8b, 0x1b, 0x1b, 0x5f, 0xb4, 0x0c, 0x77, 0x45, 0xc0, 0x9c, 0x96 },
+        { 0x54, 0xb8, 0x02, 0x67, 0x22, 0x9e, 0x03, 0x1b, 0x3f, 0xf5, 0xcf, 0x38, 0x56, 0x56, 0xb1, 0x5c, 0x6e, 0xc1, 0xfa, 0x83, 0x4d, 0x5d, 0xfa, 0x57, 0x6e, 0xcf, 0x49, 0x95, 0x2c, 0x42, 0xef, 0xf8 },
+        { 0x27, 0xa8, 0x54, 0x3d, 0xce, 0x90, 0x12, 0xa0, 0xee, 0x64, 0x9c, 0xab, 0x31, 0x07, 0xfd, 0xf5, 0x5b, 0x18, 0xb6, 0x37, 0x81, 0x9f, 0x00, 0x4f, 0x1a, 0xcf, 0x64, 0xe4, 0x88, 0x20, 0x2b, 0x65 }
+    }
+};
+
+#endif
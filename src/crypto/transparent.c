@@ -30,42 +30,37 @@
 #include "globals.h"
 #include "address.h"
 
-int derive_pubkey(uint8_t *pk, uint8_t account) {
-    uint8_t tsk[32];
+int derive_pubkey(uint8_t *pk, const uint8_t *tsk) {
     cx_ecfp_private_key_t t_prvk;
     cx_ecfp_public_key_t t_pubk;
-    derive_tsk(tsk, account);
     cx_ecfp_init_private_key_no_throw(CX_CURVE_SECP256K1, tsk, 32, &t_prvk);
     cx_ecfp_generate_pair(CX_CURVE_SECP256K1, &t_pubk, &t_prvk, 1);
+    explicit_bzero(&t_prvk, sizeof(t_prvk));
     PRINTF("PK: %.*H\n", 65, t_pubk.W);
 
     memmove(pk + 1, t_pubk.W + 1, 32); // X
     pk[0] = ((t_pubk.W[64] & 1) == 0) ? 0x02 : 0x03; // parity of Y
     PRINTF("CPK: %.*H\n", 33, pk);
 
-    memmove(G_context.transparent_key_info.pub_key, pk, 33);
-
     return 0;
 }
 
-int derive_taddress(uint8_t *pkh, uint8_t account) {
-    uint8_t pk[33];
-    derive_pubkey(pk, account);
-    
+int derive_taddress(uint8_t *pkh, const uint8_t *pk) {
+    uint8_t hash[32];
     cx_sha256_init_no_throw(&G_store.sha_hasher);
-    cx_hash_no_throw((cx_hash_t *)&G_store.sha_hasher, CX_LAST, pk, 33, pk, 32);
-    PRINTF("SHA256: %.*H\n", 32, pk);
+    cx_hash_no_throw((cx_hash_t *)&G_store.sha_hasher, CX_LAST, pk, 33, hash, 32);
+    PRINTF("SHA256: %.*H\n", 32, hash);
 
     cx_ripemd160_init_no_throw(&G_store.ripemd_hasher);
-    cx_hash_no_throw((cx_hash_t *)&G_store.ripemd_hasher, CX_LAST, pk, 32, pkh, 20);
+    cx_hash_no_throw((cx_hash_t *)&G_store.ripemd_hasher, CX_LAST, hash, 32, pkh, 20);
     PRINTF("PKH: %.*H\n", 20, pkh);
 
     return 0;
 }
 
-int transparent_derive_pubkey(uint8_t account) {
-    derive_pubkey(G_context.transparent_key_info.pub_key, account);
-    derive_taddress(G_context.transparent_key_info.pkh, account);
+int transparent_derive_pubkey(const uint8_t *tsk) {
+    derive_pubkey(G_context.keys->transparent_key_info.pub_key, tsk);
+    derive_taddress(G_context.keys->transparent_key_info.pkh, G_context.keys->transparent_key_info.pub_key);
 
     return 0;
 }
@@ -74,7 +69,7 @@ void transparent_ecdsa(uint8_t *signature, uint8_t *key, const uint8_t *hash) {
     cx_get_random_bytes(G_store.rnd, 32);
 
     // compute the sig
-    CX_THROW(cx_bn_lock(32, 0));
+    bn_session_begin();
 
     cx_ecpoint_t Q;
     // --> compute Q = k.G
@@ -136,5 +131,13 @@ void transparent_ecdsa(uint8_t *signature, uint8_t *key, const uint8_t *hash) {
     cx_bn_export(r, signature, 32);
     cx_bn_export(s, signature + 32, 32);
 
-    cx_bn_unlock();
+    cx_bn_destroy(&n);
+    cx_bn_destroy(&r);
+    cx_bn_destroy(&s);
+    cx_bn_destroy(&t);
+    cx_bn_destroy(&v);
+    cx_bn_destroy(&t1);
+    cx_bn_destroy(&t2);
+    cx_bn_destroy(&zero);
+    bn_session_end();
 }
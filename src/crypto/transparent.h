@@ -4,20 +4,20 @@
 
 /// @brief Derive the transparent address
 /// @param pkh public key hash, 20 bytes
-/// @param account 
+/// @param pk compressed public key, 33 bytes
 /// @return 
-int derive_taddress(uint8_t *pkh, uint8_t account);
+int derive_taddress(uint8_t *pkh, const uint8_t *pk);
 
 /// @brief Derive the public key
 /// @param pk public key, 33 bytes
-/// @param account 
+/// @param tsk transparent secret key, see derive_tsk
 /// @return 
-int derive_pubkey(uint8_t *pk, uint8_t account);
+int derive_pubkey(uint8_t *pk, const uint8_t *tsk);
 
 /// @brief Derive transparent keys
-/// @param account 
+/// @param tsk transparent secret key, see derive_tsk
 /// @return 
-int transparent_derive_pubkey(uint8_t account);
+int transparent_derive_pubkey(const uint8_t *tsk);
 
 /// @brief ECDSA on secp256k1
 /// Could not use cx_ecdsa_sign because the stack usage is too high for NanoS
@@ -36,6 +36,8 @@
 #include "../ui/menu.h"
 #include "../helper/send_response.h"
 #include "../ui/action/validate.h"
+#include "../apdu/dispatcher.h"
+#include "../apdu/out_chain.h"
 
 // Zcash___TxInHash when there is no t-inputs
 const uint8_t sapling_tx_in_hash[] = {
@@ -46,14 +48,31 @@ const uint8_t sapling_tx_in_hash[] = {
 };
 
 cx_chacha_context_t chacha_rseed_rng;
-cx_chacha_context_t chacha_alpha_rng;
 
 static int transparent_bundle_hash();
 static int sapling_bundle_hash();
 static int orchard_bundle_hash();
 static int finish_sighash(uint8_t *sighash, const uint8_t *txin_sig_digest);
 
-int init_tx() {
+int init_tx(bool session) {
+    tx_session_t *s = &G_context.session;
+    if (session && s->active) {
+        // keep the confirmed transactions of the session for signing,
+        // they are not dropped when the ring is full, the host must
+        // sign them and end the session first
+        if (G_context.tx_ring[s->slot].confirmed) {
+            uint8_t next = (s->slot + 1) % TX_RING_SIZE;
+            if (G_context.tx_ring[next].confirmed)
+                return io_send_sw(SW_BAD_STATE);
+            s->slot = next;
+        }
+    }
+    else {
+        end_session();
+        s->active = session;
+    }
+    G_context.tx = &G_context.tx_ring[s->slot];
+    memset(G_context.tx, 0, sizeof(tx_digests_t));
     memset(&G_context.signing_ctx, 0, sizeof(tx_signing_ctx_t));
     G_context.signing_ctx.stage = T_IN;
     uint8_t mseed[32];
@@ -80,8 +99,10 @@ int init_tx() {
             mseed, 32,
             seed_rng, 32);
 
-    cx_chacha_init(&chacha_alpha_rng, 20);
-    cx_chacha_set_key(&chacha_alpha_rng, seed_rng, 32);
+    // alpha is drawn when the transaction is signed, possibly after the
+    // next ones of the session were defined
+    cx_chacha_init(&G_context.tx->alpha_rng, 20);
+    cx_chacha_set_key(&G_context.tx->alpha_rng, seed_rng, 32);
 
     cx_blake2b_init2_no_throw(&G_context.hasher,
                               256,
@@ -98,11 +119,22 @@ int change_stage(uint8_t new_stage) {
         reset_app();
         return io_send_sw(SW_BAD_STATE);
     }
+    // the outputs of an unfinished chain would be missing from the digests
+    if (out_chain_active()) {
+        reset_app();
+        return io_send_sw(SW_BAD_STATE);
+    }
 
     cx_hash_t *ph = (cx_hash_t *)&G_context.hasher;
 
     switch (new_stage) {
         case T_OUT:
+            if (G_context.signing_ctx.t_in_streaming) {
+                reset_app();
+                return io_send_sw(SW_BAD_STATE);
+            }
+            // the stream state shares its memory with the output chains
+            memset(&G_context.out_chain, 0, sizeof(out_chain_t));
             cx_hash(ph, CX_LAST,
                     NULL, 0,
                     G_context.signing_ctx.amount_hash, 32);
@@ -155,10 +187,10 @@ int change_stage(uint8_t new_stage) {
 const uint8_t PAY2PKH_1[] = { 0x19, 0x76, 0xA9, 0x14 }; // First part of the pay2pkh bitcoin script
 const uint8_t PAY2PKH_2[] = { 0x88, 0xAC };             // Second part of the pay2pkh bitcoin script
 
-int add_t_input_amount(uint64_t amount) {
+int process_t_in_amount(uint64_t amount) {
     if (G_context.signing_ctx.stage != T_IN) {
         reset_app();
-        return io_send_sw(SW_BAD_STATE);
+        return SW_BAD_STATE;
     }
 
     // In the T_IN stage, we receive transparent input amounts
@@ -168,10 +200,20 @@ int add_t_input_amount(uint64_t amount) {
 
     G_context.signing_ctx.has_t_in = true;
     G_context.signing_ctx.t_net += (int64_t)amount;
-    CHECK_MONEY(G_context.signing_ctx.t_net);
+    if (G_context.signing_ctx.t_net < -MAX_MONEY || G_context.signing_ctx.t_net > MAX_MONEY)
+        return SW_INVALID_PARAM;
     cx_hash((cx_hash_t *) &G_context.hasher, 0, (uint8_t *) &amount, 8, NULL, 0);
 
-    return io_send_sw(SW_OK);
+    return SW_OK;
+}
+
+int add_t_input_amount(uint64_t amount) {
+    // the amounts come with the records when the inputs are streamed
+    if (G_context.signing_ctx.t_in_streaming || G_context.signing_ctx.t_in_streamed) {
+        reset_app();
+        return io_send_sw(SW_BAD_STATE);
+    }
+    return io_send_sw(process_t_in_amount(amount));
 }
 
 int add_t_output(t_out_t *output, bool confirmation) {
@@ -182,7 +224,8 @@ int add_t_output(t_out_t *output, bool confirmation) {
     if (output->address_type != 0)  // only p2pkh for now
         return SW_INVALID_PARAM;
 
-    if (memcmp(output->address_hash, G_context.transparent_key_info.pkh, 20) == 0)
+    require_keys(KEYS_TRANSPARENT);
+    if (memcmp(output->address_hash, G_context.keys->transparent_key_info.pkh, 20) == 0)
         confirmation = false;
 
     // In the T_OUT stage, we receive transparent outputs
@@ -206,11 +249,12 @@ int add_t_output(t_out_t *output, bool confirmation) {
 
 extern uint8_t debug[250];
 
-int add_s_output(s_out_t *output, bool confirmation) {
+int process_s_output(s_out_t *output, uint8_t *cmu, bool *confirmation) {
     if (G_context.signing_ctx.stage != S_OUT) {
         reset_app();
-        return io_send_sw(SW_BAD_STATE);
+        return SW_BAD_STATE;
     }
+    require_keys(KEYS_SAPLING);
     ui_display_processing("z-out");
 
     // In the S_OUT stage, we receive sapling outputs
@@ -219,14 +263,14 @@ int add_s_output(s_out_t *output, bool confirmation) {
     // The next stage is O_ACTION
 
     G_context.signing_ctx.has_s_out = true;
+    G_context.signing_ctx.n_s_out++;
     G_context.signing_ctx.amount_s_out += output->amount;
 
-    if ((memcmp(output->address, G_context.exp_sk_info.d, 11) == 0 &&
-        memcmp(output->address + 11, G_context.exp_sk_info.pk_d, 32) == 0)
+    if ((memcmp(output->address, G_context.keys->exp_sk_info.d, 11) == 0 &&
+        memcmp(output->address + 11, G_context.keys->exp_sk_info.pk_d, 32) == 0)
         || output->amount == 0)
-        confirmation = false;
+        *confirmation = false;
 
-    uint8_t cmu[32];
     PRINTF("ADDRESS: %.*H\n", 43, output->address);
     PRINTF("RSEED: %.*H\n", 32, output->rseed);
     PRINTF("AMOUNT: %.*H\n", 8, &output->amount);
@@ -239,8 +283,17 @@ int add_s_output(s_out_t *output, bool confirmation) {
     cx_hash(ph, 0, output->epk, 32, NULL, 0);  // ephemeral key
     cx_hash(ph, 0, output->enc, 52, NULL, 0);  // first 52 bytes of encrypted note
 
-    PRINTF("CONFIRMATION %d\n", confirmation);
+    PRINTF("CONFIRMATION %d\n", *confirmation);
     PRINTF("AMOUNT: %.*H\n", 8, &output->amount);
+    return SW_OK;
+}
+
+int add_s_output(s_out_t *output, bool confirmation) {
+    uint8_t cmu[32];
+    int sw = process_s_output(output, cmu, &confirmation);
+    if (sw != SW_OK)
+        return io_send_sw(sw);
+
     memmove(G_store.out_buffer, cmu, 32);
     if (confirmation)
         return ui_confirm_s_out(output);
@@ -251,18 +304,20 @@ int add_s_output(s_out_t *output, bool confirmation) {
 }
 
 #ifdef ORCHARD
-int add_o_action(o_action_t *action, bool confirmation) { 
+int process_o_action(o_action_t *action, uint8_t *note_cmx, bool *confirmation) {
     if (G_context.signing_ctx.stage != O_ACTION) {
         reset_app();
-        return io_send_sw(SW_BAD_STATE);
+        return SW_BAD_STATE;
     }
+    require_keys(KEYS_ORCHARD);
     ui_display_processing("o-out");
     G_context.signing_ctx.has_o_action = true;
+    G_context.signing_ctx.n_o_action++;
     G_context.signing_ctx.amount_o_out += action->amount;
 
-    if (memcmp(action->address, G_context.orchard_key_info.address, 43) == 0 || 
+    if (memcmp(action->address, G_context.keys->orchard_key_info.address, 43) == 0 || 
         action->amount == 0)
-        confirmation = false;
+        *confirmation = false;
 
     PRINTF("d %.*H\n", 11, action->address);
     PRINTF("pk_d %.*H\n", 32, action->address + 11);
@@ -272,7 +327,6 @@ int add_o_action(o_action_t *action, bool confirmation) {
     PRINTF("enc %.*H\n", 52, &action->enc);
     PRINTF("rseed %.*H\n", 32, action->rseed);
 
-    u_int8_t note_cmx[32];
     cmx(note_cmx, action->address, action->amount, action->rseed, action->nf);
     swap_endian(note_cmx, 32); // to_repr
 
@@ -281,6 +335,14 @@ int add_o_action(o_action_t *action, bool confirmation) {
     cx_hash(ph, 0, note_cmx, 32, NULL, 0);     // cmx
     cx_hash(ph, 0, action->epk, 32, NULL, 0);  // ephemeral key
     cx_hash(ph, 0, action->enc, 52, NULL, 0);  // first 52 bytes of encrypted note
+    return SW_OK;
+}
+
+int add_o_action(o_action_t *action, bool confirmation) { 
+    uint8_t note_cmx[32];
+    int sw = process_o_action(action, note_cmx, &confirmation);
+    if (sw != SW_OK)
+        return io_send_sw(sw);
 
     if (confirmation)
         return ui_confirm_o_out(action);
@@ -305,18 +367,27 @@ int set_o_net(int64_t balance) {
 #endif
 
 int set_header_digest(uint8_t *hash) {
-    memmove(&G_context.signing_ctx.header_hash, hash, sizeof(t_proofs_t));
+    memmove(&G_context.tx->header_hash, hash, 32);
 
     return io_send_sw(SW_OK);
 }
 
 int set_t_merkle_proof(t_proofs_t *t_proofs) {
+    // the digests of the ADD_T_IN stream cannot be overridden
+    if (G_context.signing_ctx.t_in_streamed) {
+        reset_app();
+        return io_send_sw(SW_BAD_STATE);
+    }
     memmove(&G_context.signing_ctx.t_proofs, t_proofs, sizeof(t_proofs_t));
 
     return io_send_sw(SW_OK);
 }
 
 int set_s_merkle_proof(s_proofs_t *s_proofs) {
+    if (G_context.signing_ctx.s_enc_streamed) {
+        reset_app();
+        return io_send_sw(SW_BAD_STATE);
+    }
     memmove(&G_context.signing_ctx.s_proofs, s_proofs, sizeof(s_proofs_t));
 
     return io_send_sw(SW_OK);
@@ -324,6 +395,10 @@ int set_s_merkle_proof(s_proofs_t *s_proofs) {
 
 #ifdef ORCHARD
 int set_o_merkle_proof(o_proofs_t *o_proofs) { 
+    if (G_context.signing_ctx.o_enc_streamed) {
+        reset_app();
+        return io_send_sw(SW_BAD_STATE);
+    }
     memmove(&G_context.signing_ctx.o_proofs, o_proofs, sizeof(o_proofs_t));
 
     return io_send_sw(SW_OK);
@@ -344,13 +419,15 @@ int confirm_fee(bool confirmation) {
     // Compute the shielded sighash
     // when there is no t_in, do not include the tx_in_hash at all
     // This is going to be used by every shielded signature, therefore we cache the result
-    finish_sighash(G_context.signing_ctx.sapling_sig_hash, 
+    finish_sighash(G_context.tx->sapling_sig_hash, 
         G_context.signing_ctx.has_t_in ? sapling_tx_in_hash : NULL);
 
     if (confirmation)
         return ui_confirm_fee(fee);
-    else 
+    else {
         G_context.signing_ctx.stage = SIGN;
+        G_context.tx->confirmed = true;
+    }
 
     if (G_context.signing_ctx.flags)
         return get_shielded_hashes();
@@ -370,8 +447,8 @@ int transparent_bundle_hash() {
         Notice every shielded signature is computed on the same sig_hash
     */
 
-    cx_hash_t *ph = (cx_hash_t *)&G_context.signing_ctx.transparent_hasher;
-    cx_blake2b_init2_no_throw(&G_context.signing_ctx.transparent_hasher, 256,
+    cx_hash_t *ph = (cx_hash_t *)&G_context.tx->transparent_hasher;
+    cx_blake2b_init2_no_throw(&G_context.tx->transparent_hasher, 256,
                             NULL, 0,
                             (uint8_t *) "ZTxIdTranspaHash", 16);
     if (G_context.signing_ctx.has_t_in || G_context.signing_ctx.has_t_out) {
@@ -408,23 +485,23 @@ int sapling_bundle_hash() {
     }
     cx_hash(ph,
             CX_LAST, NULL, 0,
-            G_context.signing_ctx.sapling_bundle_hash, 32);
+            G_context.tx->sapling_bundle_hash, 32);
     cx_blake2b_init2_no_throw(&G_context.hasher, 256,
                               NULL, 0,
                               (uint8_t *) "ZTxIdSaplingHash", 16);
     if (G_context.signing_ctx.has_s_in || G_context.signing_ctx.has_s_out) {                              
         PRINTF(">> SAPLING BUNDLE: %.*H\n", 32, G_context.signing_ctx.s_proofs.sapling_spends_digest);
-        PRINTF(">> SAPLING BUNDLE: %.*H\n", 32, G_context.signing_ctx.sapling_bundle_hash);
+        PRINTF(">> SAPLING BUNDLE: %.*H\n", 32, G_context.tx->sapling_bundle_hash);
         PRINTF(">> SAPLING BUNDLE: %.*H\n", 8, (uint8_t *)&G_context.signing_ctx.s_net);
         cx_hash(ph, 0, G_context.signing_ctx.s_proofs.sapling_spends_digest, 32, NULL, 0);
-        cx_hash(ph, 0, G_context.signing_ctx.sapling_bundle_hash, 32, NULL, 0);
+        cx_hash(ph, 0, G_context.tx->sapling_bundle_hash, 32, NULL, 0);
         cx_hash(ph, 0, (uint8_t *)&G_context.signing_ctx.s_net, 8, NULL, 0);
     }
     else {
         PRINTF(">> EMPTY SAPLING BUNDLE\n");
     }
-    cx_hash(ph, CX_LAST, NULL, 0, G_context.signing_ctx.sapling_bundle_hash, 32);
-    PRINTF("SAPLING BUNDLE: %.*H\n", 32, G_context.signing_ctx.sapling_bundle_hash);
+    cx_hash(ph, CX_LAST, NULL, 0, G_context.tx->sapling_bundle_hash, 32);
+    PRINTF("SAPLING BUNDLE: %.*H\n", 32, G_context.tx->sapling_bundle_hash);
 
     return 0;
 }
@@ -455,8 +532,8 @@ int orchard_bundle_hash() {
         PRINTF(">> EMPTY ORCHARD BUNDLE\n");
     }
     #endif
-    cx_hash(ph, CX_LAST, NULL, 0, G_context.signing_ctx.orchard_bundle_hash, 32);
-    PRINTF("ORCHARD BUNDLE: %.*H\n", 32, G_context.signing_ctx.orchard_bundle_hash);
+    cx_hash(ph, CX_LAST, NULL, 0, G_context.tx->orchard_bundle_hash, 32);
+    PRINTF("ORCHARD BUNDLE: %.*H\n", 32, G_context.tx->orchard_bundle_hash);
 
     return 0;
 }
@@ -467,26 +544,26 @@ int orchard_bundle_hash() {
 */
 static int finish_sighash(uint8_t *sighash, const uint8_t *txin_sig_digest) {
     cx_blake2b_t tx_t_hasher;
-    memmove(&tx_t_hasher, &G_context.signing_ctx.transparent_hasher, sizeof(cx_blake2b_t));
+    memmove(&tx_t_hasher, &G_context.tx->transparent_hasher, sizeof(cx_blake2b_t));
     cx_hash_t *ph = (cx_hash_t *) &tx_t_hasher;
     uint8_t transparent_hash[32];
     if (txin_sig_digest)
         cx_hash(ph, 0, txin_sig_digest, 32, NULL, 0);
     cx_hash(ph, CX_LAST, NULL, 0, transparent_hash, 32);
 
-    PRINTF("HEADER: %.*H\n", 32, G_context.signing_ctx.header_hash);
+    PRINTF("HEADER: %.*H\n", 32, G_context.tx->header_hash);
     PRINTF("TRANSPARENT SIG BUNDLE: %.*H\n", 32, transparent_hash);
 
     cx_blake2b_init2_no_throw(&tx_t_hasher, 256,
                               NULL, 0,
                               (uint8_t *) "ZcashTxHash_\xB4\xD0\xD6\xC2", 16); // BranchID
-    cx_hash(ph, 0, G_context.signing_ctx.header_hash, 32, NULL, 0);
+    cx_hash(ph, 0, G_context.tx->header_hash, 32, NULL, 0);
     cx_hash(ph, 0, transparent_hash, 32, NULL, 0);
-    cx_hash(ph, 0, G_context.signing_ctx.sapling_bundle_hash, 32, NULL, 0);
-    cx_hash(ph, CX_LAST, G_context.signing_ctx.orchard_bundle_hash, 32, sighash, 32);
+    cx_hash(ph, 0, G_context.tx->sapling_bundle_hash, 32, NULL, 0);
+    cx_hash(ph, CX_LAST, G_context.tx->orchard_bundle_hash, 32, sighash, 32);
 
-    PRINTF("SAPLING SIG BUNDLE: %.*H\n", 32, G_context.signing_ctx.sapling_bundle_hash);
-    PRINTF("ORCHARD SIG BUNDLE: %.*H\n", 32, G_context.signing_ctx.orchard_bundle_hash);
+    PRINTF("SAPLING SIG BUNDLE: %.*H\n", 32, G_context.tx->sapling_bundle_hash);
+    PRINTF("ORCHARD SIG BUNDLE: %.*H\n", 32, G_context.tx->orchard_bundle_hash);
     PRINTF("TXID: %.*H\n", 32, sighash);
 
     return 0;
@@ -498,60 +575,124 @@ int get_sighash(uint8_t *txin_sig_hash) {
         finish_sighash(sighash, txin_sig_hash);
         return helper_send_response_bytes(sighash, 32);
     }
-    return helper_send_response_bytes(G_context.signing_ctx.sapling_sig_hash, 32);
+    return helper_send_response_bytes(G_context.tx->sapling_sig_hash, 32);
+}
+
+void end_session() {
+    tx_session_t *s = &G_context.session;
+    explicit_bzero(s, sizeof(tx_session_t));
+    for (uint8_t i = 0; i < TX_RING_SIZE; i++)
+        G_context.tx_ring[i].confirmed = false;
+    G_context.tx = &G_context.tx_ring[0];
+}
+
+int select_tx(uint8_t slot) {
+    // every transaction of the session must have been confirmed
+    if (G_context.signing_ctx.stage != SIGN || !G_context.session.active) {
+        reset_app();
+        return io_send_sw(SW_BAD_STATE);
+    }
+    if (slot >= TX_RING_SIZE)
+        return io_send_sw(SW_INVALID_PARAM);
+    // no transaction was defined in this slot, the session goes on
+    if (!G_context.tx_ring[slot].confirmed)
+        return io_send_sw(SW_BAD_STATE);
+    G_context.tx = &G_context.tx_ring[slot];
+    G_context.signing_ctx.t_in_signed = 0;
+    return io_send_sw(SW_OK);
+}
+
+/// @brief The transaction selected for signing was approved,
+/// and so was the last one defined
+static bool can_sign() {
+    return G_context.signing_ctx.stage == SIGN && G_context.tx->confirmed;
 }
 
-int sign_transparent() {
-    if (G_context.signing_ctx.stage != SIGN) {
+int sign_transparent(uint8_t count, const uint8_t *txin_sig_digests) {
+    tx_session_t *s = &G_context.session;
+    if (!can_sign()) {
         reset_app();
         return io_send_sw(SW_BAD_STATE);
     }
     ui_display_processing("sign t");
 
-    finish_sighash(G_store.sig_hash, G_context.txin_sig_digest);
-    PRINTF("TRANSPARENT SIG HASH: %.*H\n", 32, G_store.sig_hash);
+    // derive the secret key once per transaction, or once per session
+    if (!s->has_tsk || s->tsk_account != G_context.account) {
+        derive_tsk(s->tsk, G_context.account);
+        s->tsk_account = G_context.account;
+        s->has_tsk = true;
+    }
 
-    derive_tsk(G_store.tsk, G_context.account);
-    transparent_ecdsa(G_store.signature, G_store.tsk, G_store.sig_hash);
+    // the signatures of the batch share the BN lock
+    bn_session_begin();
+    for (uint8_t i = 0; i < count; i++) {
+        finish_sighash(G_store.sig_hash, txin_sig_digests + i * 32);
+        PRINTF("TRANSPARENT SIG HASH: %.*H\n", 32, G_store.sig_hash);
+        transparent_ecdsa(G_store.signatures + i * 64, s->tsk, G_store.sig_hash);
+    }
+    bn_session_end();
 
     ui_menu_main();
-    return helper_send_response_bytes(G_store.signature, 64);
+    return helper_send_response_bytes(G_store.signatures, count * 64);
+}
+
+/// @brief Set G_context.alpha for the i-th signature of a batch
+/// @param alphas alpha values from the client (TEST builds), or NULL
+/// @param i
+static void next_alpha(const uint8_t *alphas, uint8_t i) {
+    memset(G_context.alpha, 0, 64);
+    if (alphas != NULL)
+        memmove(G_context.alpha, alphas + i * 64, 64);
+    // In prod, alpha is picked by our PRNG, not the client's
+    OVERRIDE_ALPHA(G_context.alpha);
 }
 
-int sign_sapling() {
-    if (G_context.signing_ctx.stage != SIGN) {
+int sign_sapling(uint8_t count, const uint8_t *alphas) {
+    if (!can_sign()) {
         reset_app();
         return io_send_sw(SW_BAD_STATE);
     }
+    require_keys(KEYS_SAPLING);
     ui_display_processing("sign z");
 
-    uint8_t signature[64];
-    sapling_sign(signature, G_context.signing_ctx.sapling_sig_hash);
+    // the signatures of the batch share the BN lock and the field contexts
+    bn_session_begin();
+    for (uint8_t i = 0; i < count; i++) {
+        next_alpha(alphas, i);
+        sapling_sign(G_store.out_buffer + i * 64, G_context.tx->sapling_sig_hash);
+    }
+    bn_session_end();
 
-    PRINTF("signature %.*H\n", 64, signature);
+    PRINTF("signatures %.*H\n", count * 64, G_store.out_buffer);
 
     ui_menu_main();
-    return helper_send_response_bytes(signature, 64);
+    return helper_send_response_bytes(G_store.out_buffer, count * 64);
 }
 
-int sign_orchard() { 
-    if (G_context.signing_ctx.stage != SIGN) {
+int sign_orchard(uint8_t count, const uint8_t *alphas) { 
+    if (!can_sign()) {
         reset_app();
         return io_send_sw(SW_BAD_STATE);
     }
+    require_keys(KEYS_ORCHARD);
     ui_display_processing("sign o");
 
-    uint8_t signature[64];
-    do_sign_orchard(signature);
+    bn_session_begin();
+    for (uint8_t i = 0; i < count; i++) {
+        next_alpha(alphas, i);
+        do_sign_orchard(G_store.out_buffer + i * 64);
+    }
+    bn_session_end();
+
     ui_menu_main();
-    return helper_send_response_bytes(signature, 64);
+    return helper_send_response_bytes(G_store.out_buffer, count * 64);
 }
 
 // These hashes are checked against the client values. If there is a mismatch
 // it indicates a miscalculation
 int get_shielded_hashes() {
-    memmove(G_store.out_buffer, G_context.signing_ctx.sapling_bundle_hash, 32);
-    memmove(G_store.out_buffer + 32, G_context.signing_ctx.orchard_bundle_hash, 32);
+    memmove(G_store.out_buffer, G_context.tx->sapling_bundle_hash, 32);
+    memmove(G_store.out_buffer + 32, G_context.tx->orchard_bundle_hash, 32);
     return helper_send_response_bytes(G_store.out_buffer, 64);
 }
 
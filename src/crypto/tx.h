@@ -8,20 +8,27 @@
 #include "../types.h"
 
 extern cx_chacha_context_t chacha_rseed_rng;
-extern cx_chacha_context_t chacha_alpha_rng;
 
 int prf_chacha(cx_chacha_context_t *rng, uint8_t *v, size_t len);
 
 int change_stage(uint8_t new_stage);
 
 /* These function MUST be called and in this order */
-int init_tx();
+int init_tx(bool session); // session keeps the confirmed transactions
 int add_t_input_amount(uint64_t amount); // ZTxTrAmountsHash
 int add_t_output(t_out_t *output, bool confirmation); // ZTxIdOutputsHash
 int add_s_output(s_out_t *output, bool confirmation); // ZTxIdSOutC__Hash
 int add_o_action(o_action_t *action, bool confirmation); // ZTxIdOrcActCHash
 int confirm_fee(bool confirmation); // Sapling and Orchard Bundle Hash
 
+// Same as add_s_output/add_o_action but without the UI and the response
+// cmu/cmx receives the note commitment, confirmation is cleared for change outputs
+// Return SW_OK or an error status word
+int process_s_output(s_out_t *output, uint8_t *cmu, bool *confirmation);
+int process_o_action(o_action_t *action, uint8_t *cmx, bool *confirmation);
+// Same as add_t_input_amount without the response
+int process_t_in_amount(uint64_t amount);
+
 // These functions are optional but must be called before confirm_fee
 int set_s_net(int64_t balance);
 int set_o_net(int64_t balance);
@@ -32,10 +39,19 @@ int set_t_merkle_proof(t_proofs_t *t_proofs);
 int set_s_merkle_proof(s_proofs_t *s_proofs);
 int set_o_merkle_proof(o_proofs_t *o_proofs);
 
+// Multi-transaction session
+// select_tx picks the confirmed transaction that the signing commands use
+// end_session forgets every transaction and the cached secret key
+int select_tx(uint8_t slot);
+void end_session();
+
 // Signing function, users must have confirmed the tx
-int sign_transparent();
-int sign_sapling();
-int sign_orchard();
+// SIGN_TRANSPARENT signs count inputs, txin_sig_digests has count * 32 bytes
+int sign_transparent(uint8_t count, const uint8_t *txin_sig_digests);
+// SIGN_SAPLING and SIGN_ORCHARD sign the count next spends/actions
+// alphas has count * 64 bytes, or is NULL
+int sign_sapling(uint8_t count, const uint8_t *alphas);
+int sign_orchard(uint8_t count, const uint8_t *alphas);
 
 // Verification
 int get_shielded_hashes();
@@ -32,15 +32,15 @@ int encode_my_ua() {
     uint8_t *p = G_store.receivers;
     *p++ = 0;
     *p++ = 20;
-    memmove(p, G_context.transparent_key_info.pkh, 20); p += 20;
+    memmove(p, G_context.keys->transparent_key_info.pkh, 20); p += 20;
     *p++ = 2;
     *p++ = 43;
-    memmove(p, G_context.exp_sk_info.d, 11); p += 11;
-    memmove(p, G_context.exp_sk_info.pk_d, 32); p += 32;
+    memmove(p, G_context.keys->exp_sk_info.d, 11); p += 11;
+    memmove(p, G_context.keys->exp_sk_info.pk_d, 32); p += 32;
     #ifdef ORCHARD
     *p++ = 3;
     *p++ = 43;
-    memmove(p, G_context.orchard_key_info.address, 43); p += 43;
+    memmove(p, G_context.keys->orchard_key_info.address, 43); p += 43;
     #endif
 
     encode_ua_inner(p, G_store.receivers);
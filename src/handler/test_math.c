@@ -33,6 +33,8 @@
 #include "../crypto/fr.h"
 #include "../crypto/prf.h"
 #include "../crypto/pallas.h"
+#include "../crypto/sqrt.h"
+#include "../crypto/inv.h"
 #include "../crypto/sinsemilla.h"
 #include "../crypto/ff1.h"
 #include "../crypto/f4jumble.h"
@@ -41,12 +43,31 @@
 #include "../crypto/orchard.h"
 #include "../crypto/key.h"
 
+/// Self checks of the precomputed tables and of the optimized arithmetic
+/// against the generic code paths. A failure returns SW_SELF_CHECK_FAIL
+/// with the number of the first check that failed. The checks are numbered
+/// in sequence, the Orchard ones last so that there is no gap without ORCHARD
 int handler_test_math() {
     int error = 0;
+    uint8_t failed = 0;
     BEGIN_TRY {
         TRY {
+            if (!failed && !test_jubjub_fixed_base()) failed = 1; // generator tables
+            if (!failed && !test_pedersen_hash()) failed = 2; // Pedersen hash and CMU doubling chain
+            if (!failed && !test_ff_sqrt()) failed = 3; // square roots
+            if (!failed && !test_ff_inv()) failed = 4; // safegcd inversion
+            if (!failed && !test_jubjub_consts()) failed = 5; // Montgomery form constants
+            if (!failed && !test_jubjub_order()) failed = 6; // point formulas
+#ifdef ORCHARD
+            if (!failed && !test_sinsemilla_bases()) failed = 7; // Sinsemilla Q and R
+            if (!failed && !test_sinsemilla_s()) failed = 8; // Sinsemilla S table
+            if (!failed && !test_pallas_fixed_base()) failed = 9; // SpendAuthG comb
+            if (!failed && !test_hash_to_curve()) failed = 10; // simplified SWU map
+            if (!failed && !test_pallas_order()) failed = 11; // point formulas
+#endif
         }
         CATCH_OTHER(e) {
+            bn_session_abort();
             error = e;
         }
         FINALLY {
@@ -54,5 +75,6 @@ int handler_test_math() {
     }
     END_TRY;
     if (error != 0) return io_send_sw(error);
+    if (failed != 0) return io_send_sw(SW_SELF_CHECK_FAIL | failed);
     return io_send_sw(SW_OK);
 }
@@ -17,6 +17,7 @@
 
 #include <stdint.h>
 #include <string.h>
+#include <stdbool.h>
 
 #include "os.h"
 #include "ux.h"
@@ -115,6 +116,12 @@ static uint32_t G_output_len = 0;
  */
 static io_state_e G_io_state = READY;
 
+/**
+ * Capture of the responses of BATCH sub-commands.
+ */
+static bool G_io_capture = false;
+static uint16_t G_io_captured_sw;
+
 void io_init() {
     // Reset length of APDU response
     G_output_len = 0;
@@ -146,6 +153,11 @@ int io_recv_command() {
 int io_send_response(const buffer_t *rdata, uint16_t sw) {
     int ret = -1;
 
+    if (G_io_capture) {
+        G_io_captured_sw = sw;
+        return 0;
+    }
+
     if (rdata != NULL) {
         if (rdata->size - rdata->offset > IO_APDU_BUFFER_SIZE - 2 ||  //
             !buffer_copy(rdata, G_io_apdu_buffer, sizeof(G_io_apdu_buffer))) {
@@ -182,3 +194,13 @@ int io_send_response(const buffer_t *rdata, uint16_t sw) {
 int io_send_sw(uint16_t sw) {
     return io_send_response(NULL, sw);
 }
+
+void io_capture_begin() {
+    G_io_capture = true;
+    G_io_captured_sw = SW_BAD_STATE;
+}
+
+uint16_t io_capture_end() {
+    G_io_capture = false;
+    return G_io_captured_sw;
+}
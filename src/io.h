@@ -63,3 +63,18 @@ int io_send_response(const buffer_t *rdata, uint16_t sw);
  *
  */
 int io_send_sw(uint16_t sw);
+
+/**
+ * Start capturing the responses instead of sending them.
+ * Used by BATCH to run sub-commands. Response data is dropped.
+ */
+void io_capture_begin(void);
+
+/**
+ * Stop capturing the responses.
+ *
+ * @return status word of the last captured response,
+ *   SW_BAD_STATE if there was none.
+ *
+ */
+uint16_t io_capture_end(void);
@@ -28,6 +28,8 @@
 #include "ui/menu.h"
 #include "apdu/parser.h"
 #include "apdu/dispatcher.h"
+#include "apdu/out_chain.h"
+#include "crypto/fr.h"
 
 uint8_t G_io_seproxyhal_spi_buffer[IO_SEPROXYHAL_BUFFER_SIZE_B];
 ux_state_t G_ux;
@@ -76,6 +78,8 @@ void app_main() {
     // Reset context
     explicit_bzero(&G_context, sizeof(G_context));
     G_context.account = 0xFF;
+    G_context.keys = &G_context.key_slots[0].keys;
+    G_context.tx = &G_context.tx_ring[0];
 
     for (;;) {
         BEGIN_TRY {
@@ -116,8 +120,10 @@ void app_main() {
                 THROW(EXCEPTION_IO_RESET);
             }
             CATCH_OTHER(e) {
+                io_capture_end(); // exception in a BATCH sub-command
                 io_send_sw(e);
-                cx_bn_unlock();
+                bn_session_abort();
+                out_chain_clear();
             }
             FINALLY {
                 check_canary();
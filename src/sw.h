@@ -64,3 +64,8 @@
  * Status word for signature fail.
  */
 #define SW_SIGNATURE_FAIL 0xB008
+/**
+ * Status word for a failed self check of TEST_MATH,
+ * the low byte is the number of the check.
+ */
+#define SW_SELF_CHECK_FAIL 0xB100
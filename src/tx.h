@@ -1,6 +1,8 @@
 #pragma once
 
-#include <stdint.h>  // uint*_t
+#include <stdint.h>   // uint*_t
+#include <stdbool.h>  // bool
+#include <lcx_blake2.h>
 
 typedef struct {
     uint64_t amount;
@@ -43,6 +45,80 @@ typedef struct {
     uint8_t orchard_noncompact_digest[32];
 } o_proofs_t;
 
+#define SAPLING_OUT_LEN (43+8+32+52+32)
+#define ORCHARD_OUT_LEN (32+43+8+32+52+32)
+
+#ifdef ORCHARD
+#define OUT_CHAIN_RECORD_MAX ORCHARD_OUT_LEN
+#else
+#define OUT_CHAIN_RECORD_MAX SAPLING_OUT_LEN
+#endif
+// A short APDU (255 bytes) completes at most 2 records
+// of SAPLING_OUT_LEN - 32 bytes or longer
+#define OUT_CHAIN_MAX_RECORDS 2
+
+// SIGN_TRANSPARENT, SIGN_SAPLING and SIGN_ORCHARD return up to 3 signatures of 64 bytes
+// in a short APDU response
+#define SIGN_BATCH_MAX 3
+
+/// @brief State of a chain of ADD_S_OUT_CHAIN or ADD_O_ACTION_CHAIN
+typedef struct {
+    uint8_t ins; // 0 when no chain is in progress
+    uint8_t flags; // P2 of the first APDU
+    bool last; // the current APDU ends the chain
+    uint8_t record_len;
+    uint8_t partial_len; // record split over two APDUs
+    uint8_t partial[OUT_CHAIN_RECORD_MAX];
+    const uint8_t *next; // records of the current APDU not processed yet
+    uint8_t remaining;
+    uint8_t n_cm;
+    uint8_t cm[OUT_CHAIN_MAX_RECORDS * 32]; // CMU/CMX of the current APDU
+} out_chain_t;
+
+/// @brief Field of the transparent input stream being received
+typedef enum {
+    T_IN_COUNT,       // CompactSize, number of inputs
+    T_IN_PREVOUT,     // txid (32) || index (4)
+    T_IN_VALUE,       // amount of the spent output (8)
+    T_IN_SCRIPT_LEN,  // CompactSize
+    T_IN_SCRIPT,      // scriptPubKey of the spent output
+    T_IN_SEQUENCE,    // nSequence (4)
+    T_IN_DONE,
+} t_in_field_e;
+
+/// @brief State of the stream of ADD_T_IN with P1 = 1
+typedef struct {
+    uint8_t field; // t_in_field_e
+    uint64_t inputs; // number of inputs not completed yet
+    uint64_t left; // bytes of the current field not received yet
+    uint8_t carry_len;
+    uint8_t carry[9]; // amount or CompactSize split between two APDUs
+    cx_blake2b_t prevouts_hasher;
+    cx_blake2b_t scripts_hasher;
+    cx_blake2b_t sequence_hasher;
+    cx_blake2b_t txin_hasher; // txin_sig_digest of the current record
+    uint8_t n_tags; // tags of the records completed by the current APDU
+} t_in_stream_t;
+
+// Tag of a streamed input record, see t_in_stream.h
+#define T_IN_TAG_LEN 16
+
+// Ciphertext records of SET_S_MERKLE_PROOF / SET_O_MERKLE_PROOF streams
+// enc[52..564] (memo) || cv || [rk] || enc[564..580] || out_ciphertext
+#define ENC_MEMO_LEN 512
+#define S_ENC_RECORD_LEN (ENC_MEMO_LEN + 32 + 16 + 80)
+#define O_ENC_RECORD_LEN (ENC_MEMO_LEN + 32 + 32 + 16 + 80)
+
+/// @brief State of a stream of output ciphertexts
+typedef struct {
+    uint8_t ins; // SET_S_MERKLE_PROOF or SET_O_MERKLE_PROOF, 0 if there is no stream
+    uint16_t record_len;
+    uint16_t offset; // position in the current record
+    uint16_t records; // number of records completed
+    cx_blake2b_t memos_hasher;
+    cx_blake2b_t noncompact_hasher;
+} enc_stream_t;
+
 typedef struct {
     uint64_t value;
     uint8_t rseed[32];
@@ -12,6 +12,7 @@
 #include "tx.h"
 #include "ua.h"
 #include "blake2s.h"
+#include "chacha.h"
 #include "sapling.h"
 
 #ifdef TEST
@@ -70,6 +71,10 @@ typedef enum {
     ADD_T_OUT = 0x13,
     ADD_S_OUT = 0x14,
     ADD_O_ACTION = 0x15,
+    ADD_S_OUT_CHAIN = 0x1D,
+    ADD_O_ACTION_CHAIN = 0x1E,
+    BATCH = 0x1F,
+    SELECT_TX = 0x25,
     SET_S_NET = 0x16,
     SET_O_NET = 0x17,
     SET_HEADER_DIGEST = 0x18,
@@ -160,9 +165,7 @@ typedef struct {
     uint8_t ak[32]; // authorization public key
     uint8_t dk[32]; // diversifier key
     uint8_t ivk[32]; // incoming viewing key
-    uint8_t div[11]; // default diversifier
-    uint8_t pk_d[32]; // pk_d
-    uint8_t address[43];
+    uint8_t address[43]; // default diversifier (11) || pk_d (32)
 } orchard_key_t;
 
 #ifdef ORCHARD
@@ -172,34 +175,107 @@ typedef struct {
 #endif
 
 typedef struct {
-    cx_blake2b_t transparent_hasher;
     int64_t fee;
     uint64_t amount_s_out;
     ORCHARD_ONLY(uint64_t amount_o_out);
     int64_t t_net;
     int64_t s_net;
     int64_t o_net;
-    uint8_t tsk[32];
     uint8_t amount_hash[32];
     uint8_t t_outputs_hash[32];
-    uint8_t header_hash[32];
     t_proofs_t t_proofs;
     s_proofs_t s_proofs;
     ORCHARD_ONLY(o_proofs_t o_proofs);
     uint8_t s_compact_hash[32];
-    uint8_t sapling_bundle_hash[32];
     ORCHARD_ONLY(uint8_t o_compact_hash[32]);
-    uint8_t orchard_bundle_hash[32];
-    uint8_t sapling_sig_hash[32];
     signing_stage_t stage;
     bool has_t_in;
+    bool t_in_streaming; // ADD_T_IN stream started but not complete
+    bool t_in_streamed; // t_proofs were computed from the ADD_T_IN stream
     bool has_t_out;
     bool has_s_in;
     bool has_s_out;
     bool has_o_action;
+    uint16_t n_s_out;
+    uint16_t n_o_action;
+    uint16_t t_in_signed; // records of SIGN_TRANSPARENT P2 = 1 signed for the selected transaction
+    bool s_enc_streamed; // memos and noncompact digests computed by the app
+    bool o_enc_streamed;
     uint8_t flags;
 } tx_signing_ctx_t;
 
+/// @brief Digests of a transaction, all that its signatures need
+typedef struct {
+    cx_blake2b_t transparent_hasher; // mid state before txin_sig_digest
+    uint8_t header_hash[32];
+    uint8_t sapling_bundle_hash[32];
+    uint8_t orchard_bundle_hash[32];
+    uint8_t sapling_sig_hash[32];
+    #ifdef TX_STREAMS
+    bool t_in_streamed; // the inputs were streamed, they are signed from their records
+    uint16_t n_t_in; // number of inputs of the ADD_T_IN stream
+    uint8_t t_in_key[32]; // key of the tags of the streamed records, see t_in_tag
+    #endif
+    cx_chacha_context_t alpha_rng;
+    bool confirmed; // approved by the user, can be signed
+} tx_digests_t;
+
+// Transactions of a session kept for signing
+#ifdef TARGET_NANOS
+#define TX_RING_SIZE 1
+#else
+#define TX_RING_SIZE 4
+#endif
+
+/// @brief Signing session, spans several transactions
+/// when INIT_TX is called with P1 = 1
+typedef struct {
+    bool active;
+    uint8_t slot; // ring slot of the transaction being defined
+    bool has_tsk;
+    uint8_t tsk_account; // account of tsk
+    uint8_t tsk[32]; // transparent secret key, cleared by reset_app
+} tx_session_t;
+
+/// @brief Derived keys of an account
+typedef struct {
+    uint8_t pools; // KEYS_* flags of the pools already derived
+    transparent_key_t transparent_key_info;
+    expanded_spending_key_t exp_sk_info;
+    #ifdef ORCHARD
+    orchard_key_t orchard_key_info;
+    #endif
+    proofk_ctx_t proofk_info;
+} account_keys_t;
+
+// A slot is about 300 bytes on the Nano S, which only has room for one
+#ifdef TARGET_NANOS
+#define ACCOUNT_SLOTS 1
+#else
+#define ACCOUNT_SLOTS 4
+#endif
+
+/// @brief RAM slot of account keys, managed by key.c
+typedef struct {
+    bool used;
+    uint8_t account;
+    uint8_t age; // 0 for the most recently used
+    bool dirty; // keys derived since the last write to the NVRAM cache
+    account_keys_t keys;
+} account_slot_t;
+
+// Sapling G_d || Orchard G_d, all zeros when unknown
+#define KEY_CACHE_GD_LEN 64
+
+/// @brief Entry of the NVRAM key cache, see key_cache.h
+typedef struct {
+    uint8_t valid; // KEY_CACHE_MAGIC when written
+    uint8_t account;
+    uint8_t nonce[12]; // ChaCha20 nonce, fresh for every write
+    uint8_t tag[16]; // BLAKE2b(mac key || account || nonce || data)
+    uint8_t data[sizeof(account_keys_t) + KEY_CACHE_GD_LEN]; // encrypted
+} key_cache_entry_t;
+
 /**
  * Structure for global context.
  */
@@ -209,18 +285,25 @@ typedef struct {
         t_out_t t_out;
         s_out_t s_out;
         o_action_t o_action;
-        uint8_t txin_sig_digest[32];
         uint8_t alpha[64];
     };
     bool keys_derived;
     cx_blake2b_t hasher;
-    transparent_key_t transparent_key_info;
-    expanded_spending_key_t exp_sk_info;
-    #ifdef ORCHARD
-    orchard_key_t orchard_key_info;
-    #endif
-    proofk_ctx_t proofk_info;
+    account_keys_t *keys; // keys of the current account, points into key_slots
+    account_slot_t key_slots[ACCOUNT_SLOTS];
     tx_signing_ctx_t signing_ctx;
+    tx_session_t session;
+    tx_digests_t *tx; // transaction used by the signing commands, points into tx_ring
+    tx_digests_t tx_ring[TX_RING_SIZE];
+    union { // T_IN, S_OUT/O_ACTION and FEE stages respectively
+        #ifdef TX_STREAMS // three BLAKE2b contexts do not fit in the Nano S RAM
+        t_in_stream_t t_in_stream;
+        #endif
+        out_chain_t out_chain;
+        #ifdef TX_STREAMS
+        enc_stream_t enc_stream;
+        #endif
+    };
 } global_ctx_t;
 
 /// @brief  State of the Sapling Pedersen Hasher
@@ -229,10 +312,7 @@ typedef struct {
     uint8_t current_pack;
     int bits_in_pack;
     jj_e_t hash;
-    cx_bn_t acc;
-    cx_bn_t cur;
-    cx_bn_t zero;
-    cx_bn_t M;
+    uint8_t digits[PH_SEGMENTS][PH_DIGITS_LEN]; // encoded chunks of every segment, packed
 } pedersen_state_t;
 
 /// @brief Storage for temporary variables
@@ -261,16 +341,26 @@ typedef struct {
         };
         struct { // transparent sign
             uint8_t sig_hash[32];
-            uint8_t tsk[32];
-            uint8_t signature[64];
             uint8_t rnd[32];
+            uint8_t signatures[SIGN_BATCH_MAX * 64];
         };
         struct { // UA
             uint8_t receivers[UA_LEN];
             uint8_t bech32_buffer[2*UA_LEN];
         };
+        struct { // key cache
+            union { // never used at the same time
+                cx_blake2b_t nv_hasher;
+                cx_chacha_context_t nv_chacha;
+            };
+            uint8_t nv_keys[64];
+            union {
+                uint8_t nv_block[32]; // load
+                key_cache_entry_t nv_entry; // store, written to flash at once
+            };
+        };
         struct { // out buffer to client
-            uint8_t out_buffer[128];
+            uint8_t out_buffer[SIGN_BATCH_MAX * 64];
         };
     };
 } temp_t;
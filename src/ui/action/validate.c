@@ -16,13 +16,16 @@
  *****************************************************************************/
 
 #include <stdbool.h>  // bool
+#include <string.h>   // explicit_bzero
 
 #include "validate.h"
 #include "../menu.h"
 #include "../../sw.h"
 #include "crypto/tx.h"
+#include "crypto/key.h"
 #include "../../globals.h"
 #include "../../helper/send_response.h"
+#include "../../apdu/out_chain.h"
 
 void validate_address(bool choice) {
     if (choice) {
@@ -34,6 +37,10 @@ void validate_address(bool choice) {
 }
 
 void validate_out(bool choice) {
+    if (out_chain_active()) {
+        out_chain_validate(choice);
+        return;
+    }
     if (choice) {
         ui_menu_main();
         if (G_context.signing_ctx.flags && G_context.signing_ctx.stage == S_OUT)
@@ -49,6 +56,7 @@ void validate_out(bool choice) {
 void validate_fee(bool choice) {
     if (choice) {
         G_context.signing_ctx.stage = SIGN; // last confirmation approved - ok to sign
+        G_context.tx->confirmed = true;
         if (G_context.signing_ctx.flags)
             get_shielded_hashes();
         else 
@@ -60,6 +68,9 @@ void validate_fee(bool choice) {
 }
 
 void reset_app() {
+    out_chain_clear();
     G_context.signing_ctx.stage = IDLE;
+    end_session();
+    flush_keys();
     ui_menu_main();
 }
@@ -23,6 +23,7 @@
 
 #include "../globals.h"
 #include "../crypto/key.h"
+#include "../crypto/ua.h"
 #include "menu.h"
 
 UX_STEP_NOCB(ux_menu_ready_step, pnn, {&C_icon_zcash, "Zcash", "is ready"});
@@ -74,7 +75,8 @@ UX_STEP_NOCB(ux_address_step,
 UX_FLOW(ux_menu_address_flow, &ux_address_step, &ux_menu_back_step);
 
 void ui_menu_address() {
-    derive_default_keys();
+    require_keys(KEYS_ALL);
+    encode_my_ua();
     ux_flow_init(0, ux_menu_address_flow, NULL);
 }
 
@@ -19,6 +19,29 @@ class InsType(IntEnum):
     GET_PROOF_KEY = 0x09
     HAS_ORCHARD = 0x0A
     INIT_TX = 0x10
+    CHANGE_STAGE = 0x11
+    ADD_T_IN = 0x12
+    ADD_T_OUT = 0x13
+    ADD_S_OUT = 0x14
+    ADD_O_ACTION = 0x15
+    SET_S_NET = 0x16
+    SET_O_NET = 0x17
+    SET_HEADER_DIGEST = 0x18
+    SET_T_MERKLE_PROOF = 0x19
+    SET_S_MERKLE_PROOF = 0x1A
+    SET_O_MERKLE_PROOF = 0x1B
+    CONFIRM_FEE = 0x1C
+    ADD_S_OUT_CHAIN = 0x1D
+    ADD_O_ACTION_CHAIN = 0x1E
+    BATCH = 0x1F
+    SIGN_TRANSPARENT = 0x21
+    SIGN_SAPLING = 0x22
+    SIGN_ORCHARD = 0x23
+    GET_S_SIGHASH = 0x24
+    SELECT_TX = 0x25
+    END_TX = 0x30
+    GET_T_SIGHASH = 0x83
+    TEST_MATH = 0xFF
 
 def split_message(message: bytes, max_size: int) -> List[bytes]:
     return [message[x:x + max_size] for x in range(0, len(message), max_size)]
@@ -57,6 +80,9 @@ class ZcashCommandSender:
         if req_type != InsType.INIT_TX: # INIT_TXT returns a random seed that changes every time
             assert (rep == expected)
 
+    def exchange_message(self, req: bytes) -> bytes:
+        return self.backend.exchange_raw(data=req).data
+
     def has_orchard(self) -> bool:
         rep = self.backend.exchange(cla=CLA,
                                     ins=InsType.HAS_ORCHARD,
@@ -64,5 +90,5 @@ class ZcashCommandSender:
                                     p2=0,
                                     data=b"")
         data = rep.data
-        data[0] == 1
+        return data[0] == 1
 
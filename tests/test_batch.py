@@ -0,0 +1,103 @@
+from application_client.command_sender import ZcashCommandSender, InsType, MAX_APDU_LEN
+from tx_flows import load_tx_tests, recorded_flow, run_flow, apdu, ins_of
+
+# In this test we group the stage changes, the input amounts, the nets and the digests
+# of the recorded transactions into BATCH APDUs. Every sub-command must succeed
+# and the sighashes must match the recorded ones.
+# A batch with a sub-command that is not allowed or does not fit is rejected before
+# any of them runs. A batch that fails partway keeps the sub-commands that succeeded:
+# in both cases, the rest of the recorded flow must give the recorded sighashes
+
+BATCHABLE = (
+    InsType.CHANGE_STAGE,
+    InsType.ADD_T_IN,
+    InsType.SET_S_NET,
+    InsType.SET_O_NET,
+    InsType.SET_HEADER_DIGEST,
+    InsType.SET_T_MERKLE_PROOF,
+    InsType.SET_S_MERKLE_PROOF,
+    InsType.SET_O_MERKLE_PROOF,
+)
+
+SW_OK = b"\x90\x00"
+SW_WRONG_DATA_LENGTH = b"\x6A\x87"
+SW_INS_NOT_SUPPORTED = b"\x6D\x00"
+
+
+def sub_command(req):
+    return req[1:] # INS || P1 || P2 || Lc || data
+
+
+def batched(flow):
+    out = []
+    subs = []
+
+    def flush():
+        if subs:
+            # n (1) || SW (2)
+            out.append((apdu(InsType.BATCH, data=b"".join(subs)), bytes([len(subs)]) + SW_OK))
+            subs.clear()
+
+    for req, rep in flow:
+        if ins_of(req) not in BATCHABLE:
+            flush()
+            out.append((req, rep))
+            continue
+        sub = sub_command(req)
+        if len(b"".join(subs)) + len(sub) > MAX_APDU_LEN:
+            flush()
+        subs.append(sub)
+    flush()
+    return out
+
+
+def test_batch(backend):
+    client = ZcashCommandSender(backend)
+    for test in load_tx_tests(client.has_orchard()):
+        run_flow(client, batched(recorded_flow(test)))
+
+
+def split_at_t_in(client):
+    # the recorded flow of a transaction with an input, before and from ADD_T_IN
+    for test in load_tx_tests(client.has_orchard()):
+        flow = recorded_flow(test)
+        i = next((i for i, (req, _) in enumerate(flow) if ins_of(req) == InsType.ADD_T_IN), None)
+        if i is not None:
+            return flow[:i], flow[i:]
+
+
+def test_batch_rejected(backend):
+    client = ZcashCommandSender(backend)
+    before, rest = split_at_t_in(client)
+    t_in = sub_command(rest[0][0])
+    run_flow(client, before)
+
+    rejected = [
+        # not batchable
+        (t_in + sub_command(apdu(InsType.ADD_T_OUT, data=bytes(29))), SW_INS_NOT_SUPPORTED),
+        (t_in + sub_command(apdu(InsType.INIT_TX)), SW_INS_NOT_SUPPORTED),
+        # streams
+        (t_in + sub_command(apdu(InsType.ADD_T_IN, 1, data=b"\x01")), SW_INS_NOT_SUPPORTED),
+        (t_in + sub_command(apdu(InsType.SET_S_MERKLE_PROOF, 1, data=bytes(32))), SW_INS_NOT_SUPPORTED),
+        (t_in + sub_command(apdu(InsType.SET_O_MERKLE_PROOF, 1, data=bytes(32))), SW_INS_NOT_SUPPORTED),
+        # truncated header
+        (t_in + t_in[:3], SW_WRONG_DATA_LENGTH),
+        # Lc past the end of the batch
+        (t_in[:3] + bytes([len(t_in) - 3]) + t_in[4:], SW_WRONG_DATA_LENGTH),
+    ]
+    for batch, sw in rejected:
+        assert client.exchange_message(apdu(InsType.BATCH, data=batch)) == b"\x00" + sw
+
+    # none of the input amounts was added
+    run_flow(client, rest)
+
+
+def test_batch_partial(backend):
+    client = ZcashCommandSender(backend)
+    before, rest = split_at_t_in(client)
+    run_flow(client, before)
+
+    # the second amount is too short, the first one stays
+    batch = sub_command(rest[0][0]) + sub_command(apdu(InsType.ADD_T_IN, data=bytes(7)))
+    assert client.exchange_message(apdu(InsType.BATCH, data=batch)) == b"\x01" + SW_WRONG_DATA_LENGTH
+    run_flow(client, rest[1:])
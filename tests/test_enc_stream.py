@@ -0,0 +1,70 @@
+from hashlib import shake_256
+
+import pytest
+
+from application_client.command_sender import ZcashCommandSender, InsType, MAX_APDU_LEN
+from tx_flows import load_tx_tests, recorded_flow, run_flow, replies_of, \
+    apdu, ins_of, data_of, chain_apdus, blake2b_256, SIGHASH_INS
+
+# In this test we stream the output ciphertexts of the recorded transactions with
+# SET_S_MERKLE_PROOF and SET_O_MERKLE_PROOF P1 != 0 instead of sending their memo and
+# noncompact digests. The ciphertexts are made up and their digests are computed here.
+# Both flows must give the same sighashes
+
+ENC_MEMO_LEN = 512
+STREAMS = {
+    # ins: (output ins, record length, memos and noncompact personalizations)
+    InsType.SET_S_MERKLE_PROOF: (InsType.ADD_S_OUT, ENC_MEMO_LEN + 32 + 16 + 80,
+                                 b"ZTxIdSOutM__Hash", b"ZTxIdSOutN__Hash"),
+    InsType.SET_O_MERKLE_PROOF: (InsType.ADD_O_ACTION, ENC_MEMO_LEN + 32 + 32 + 16 + 80,
+                                 b"ZTxIdOrcActMHash", b"ZTxIdOrcActNHash"),
+}
+
+
+def enc_records(flow, ins):
+    out_ins, record_len, _, _ = STREAMS[ins]
+    n = sum(1 for req, _ in flow if ins_of(req) == out_ins)
+    return [shake_256(b"enc" + bytes([ins, i])).digest(record_len) for i in range(n)]
+
+
+def explicit_flow(flow):
+    out = []
+    for req, rep in flow:
+        if ins_of(req) in STREAMS:
+            _, _, memos_perso, noncompact_perso = STREAMS[ins_of(req)]
+            records = enc_records(flow, ins_of(req))
+            proofs = data_of(req)[:32] + \
+                blake2b_256(memos_perso, b"".join(r[:ENC_MEMO_LEN] for r in records)) + \
+                blake2b_256(noncompact_perso, b"".join(r[ENC_MEMO_LEN:] for r in records))
+            out.append((apdu(ins_of(req), data=proofs), None))
+        else:
+            out.append((req, None))
+    return out
+
+
+def streamed_flow(flow):
+    out = []
+    for req, rep in flow:
+        if ins_of(req) in STREAMS:
+            # spends digest or anchor || records
+            stream = data_of(req)[:32] + b"".join(enc_records(flow, ins_of(req)))
+            out += [(r, None) for r in chain_apdus(ins_of(req), stream, 0, MAX_APDU_LEN)]
+        else:
+            out.append((req, None))
+    return out
+
+
+def test_enc_stream(backend, firmware):
+    if firmware.device == "nanos":
+        pytest.skip("No ciphertext stream on the Nano S")
+    client = ZcashCommandSender(backend)
+    for test in load_tx_tests(client.has_orchard()):
+        flow = recorded_flow(test)
+        if not any(enc_records(flow, ins) for ins in STREAMS):
+            continue
+
+        explicit = explicit_flow(flow)
+        expected = replies_of(explicit, run_flow(client, explicit), SIGHASH_INS)
+
+        streamed = streamed_flow(flow)
+        assert replies_of(streamed, run_flow(client, streamed), SIGHASH_INS) == expected
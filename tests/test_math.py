@@ -0,0 +1,10 @@
+from application_client.command_sender import ZcashCommandSender, InsType
+
+# In this test we run the self checks of the precomputed tables and of the
+# optimized arithmetic against the generic code of the app (TEST build only)
+# A failed check returns 0xB1nn where nn is the number of the check
+
+def test_math(backend):
+    client = ZcashCommandSender(backend)
+    rapdu = client.send_request_no_params(InsType.TEST_MATH)
+    assert(rapdu.status == 0x9000)
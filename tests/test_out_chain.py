@@ -0,0 +1,145 @@
+from hashlib import sha256
+
+import pytest
+from ragger.navigator import NavInsID
+
+from application_client.command_sender import ZcashCommandSender, InsType, MAX_APDU_LEN
+from tx_flows import load_tx_tests, recorded_flow, run_flow, replies_of, apdu, ins_of, data_of, \
+    chain_apdus, CHAIN_RSEED, SIGHASH_INS
+
+# In this test we add the outputs of the recorded transactions with ADD_S_OUT_CHAIN
+# and ADD_O_ACTION_CHAIN. The records are split between APDUs. The CMUs must match
+# those of ADD_S_OUT and the sighashes must match the recorded ones.
+# Then every output is repeated with other rseeds, so that a chain has several
+# records, parsed in place or reassembled. The CMUs must match those of ADD_S_OUT,
+# the CMXs those of chains of a single record, and the sighashes those of the
+# single output commands
+
+SAPLING_OUT_LEN = 43 + 8 + 32 + 52 + 32
+ORCHARD_OUT_LEN = 32 + 43 + 8 + 32 + 52 + 32
+
+CHAIN_INS = {
+    InsType.ADD_S_OUT: (InsType.ADD_S_OUT_CHAIN, SAPLING_OUT_LEN),
+    InsType.ADD_O_ACTION: (InsType.ADD_O_ACTION_CHAIN, ORCHARD_OUT_LEN),
+}
+CHAIN_CONFIRM = 0x02
+
+CHUNK = 100 # shorter than a record
+N_OUTPUTS = 3 # outputs per chain
+
+
+def with_cmu(flow):
+    # ADD_S_OUT with P2 = 1 returns the CMU
+    return [(req[:3] + b"\x01" + req[4:], None) if ins_of(req) == InsType.ADD_S_OUT else (req, rep)
+            for req, rep in flow]
+
+
+def multi_output(flow):
+    # the sighashes are not the recorded ones anymore
+    out = []
+    for req, rep in flow:
+        if ins_of(req) in CHAIN_INS:
+            record = data_of(req)
+            out += [(apdu(ins_of(req), req[2], req[3], record[:-32] + sha256(record + bytes([i])).digest()), rep)
+                    for i in range(N_OUTPUTS)]
+        else:
+            out.append((req, None if ins_of(req) in SIGHASH_INS else rep))
+    return out
+
+
+def chained(flow, chunk=CHUNK, p2=CHAIN_RSEED, per_record=False):
+    # consecutive outputs of a pool go to a single chain, or to a chain each
+    out = []
+    i = 0
+    while i < len(flow):
+        req, rep = flow[i]
+        if ins_of(req) not in CHAIN_INS:
+            out.append((req, rep))
+            i += 1
+            continue
+        chain_ins, record_len = CHAIN_INS[ins_of(req)]
+        records = b""
+        while i < len(flow) and ins_of(flow[i][0]) == ins_of(req) and (not per_record or not records):
+            record = data_of(flow[i][0])
+            assert len(record) == record_len # with rseed
+            records += record
+            i += 1
+        out += [(r, None) for r in chain_apdus(chain_ins, records, p2, chunk)]
+    return out
+
+
+def chain_replies(flow, replies):
+    return [b"".join(replies_of(flow, replies, ins)) for ins in
+            (InsType.ADD_S_OUT_CHAIN, InsType.ADD_O_ACTION_CHAIN, SIGHASH_INS)]
+
+
+def multi_output_tests(client: ZcashCommandSender):
+    return [test for test in load_tx_tests(client.has_orchard())
+            if any(ins_of(req) in CHAIN_INS for req, _ in recorded_flow(test))]
+
+
+def test_out_chain(backend):
+    client = ZcashCommandSender(backend)
+    for test in load_tx_tests(client.has_orchard()):
+        flow = recorded_flow(test)
+        single = with_cmu(flow)
+        replies = run_flow(client, single)
+        cmus = b"".join(replies_of(single, replies, InsType.ADD_S_OUT))
+        n_actions = len(replies_of(single, replies, InsType.ADD_O_ACTION))
+
+        chain = chained(flow)
+        replies = run_flow(client, chain)
+        assert b"".join(replies_of(chain, replies, InsType.ADD_S_OUT_CHAIN)) == cmus
+        assert len(b"".join(replies_of(chain, replies, InsType.ADD_O_ACTION_CHAIN))) == 32 * n_actions
+
+
+def test_out_chain_multi(backend):
+    client = ZcashCommandSender(backend)
+    for test in multi_output_tests(client):
+        flow = multi_output(recorded_flow(test))
+        single = with_cmu(flow)
+        replies = run_flow(client, single)
+        cmus = b"".join(replies_of(single, replies, InsType.ADD_S_OUT))
+        sighashes = b"".join(replies_of(single, replies, SIGHASH_INS))
+
+        one = chained(flow, MAX_APDU_LEN, per_record=True)
+        _, cmxs, one_sighashes = chain_replies(one, run_flow(client, one))
+        assert one_sighashes == sighashes
+        assert len(cmxs) == 32 * sum(1 for req, _ in flow if ins_of(req) == InsType.ADD_O_ACTION)
+
+        # split records, one record per APDU parsed in place, and both
+        for chunk in (CHUNK, SAPLING_OUT_LEN, ORCHARD_OUT_LEN, MAX_APDU_LEN):
+            chain = chained(flow, chunk)
+            assert chain_replies(chain, run_flow(client, chain)) == [cmus, cmxs, sighashes]
+
+
+def completed_records(req, offset):
+    # number of records completed by the chain APDU at this offset of the chain
+    _, record_len = next(v for v in CHAIN_INS.values() if v[0] == ins_of(req))
+    return (offset + len(data_of(req))) // record_len - offset // record_len
+
+
+def test_out_chain_confirm(backend, navigator, firmware):
+    if not firmware.is_nano:
+        pytest.skip("The outputs are confirmed on the Nano screens")
+    client = ZcashCommandSender(backend)
+    test = multi_output_tests(client)[-1]
+    flow = multi_output(recorded_flow(test))
+
+    chain = chained(flow)
+    expected = chain_replies(chain, run_flow(client, chain))
+
+    # the chain pauses at each output until it is approved
+    replies = []
+    offset = 0
+    for req, _ in chained(flow, p2=CHAIN_RSEED | CHAIN_CONFIRM):
+        if ins_of(req) not in (InsType.ADD_S_OUT_CHAIN, InsType.ADD_O_ACTION_CHAIN):
+            replies.append(client.exchange_message(req))
+            continue
+        offset = 0 if req[2] & 0x01 else offset
+        with backend.exchange_async_raw(req):
+            for _ in range(completed_records(req, offset)):
+                navigator.navigate_until_text(NavInsID.RIGHT_CLICK, [NavInsID.BOTH_CLICK], "Approve")
+        replies.append(backend.last_async_response.data)
+        offset += len(data_of(req))
+    assert chain_replies(chained(flow), replies) == expected
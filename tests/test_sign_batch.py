@@ -0,0 +1,125 @@
+from hashlib import sha256, sha512
+
+import pytest
+from ragger.error import ExceptionRAPDU
+
+from application_client.command_sender import ZcashCommandSender, InsType
+from tx_flows import load_tx_tests, recorded_flow, run_flow, replies_of, without, apdu, ins_of, data_of
+from utils import check_sighash_signature
+from test_t_in_stream import streamed_tests, input_records, streamed_flow, with_sighashes, stream_tags
+
+# In this test we sign the recorded transactions with several signatures per APDU
+# In TEST builds, the client gives alpha and the Sapling signatures are deterministic:
+# a batch must return the signatures of SIGN_SAPLING with one alpha at a time.
+# Orchard signatures use a random nonce, only their number is checked.
+# The transparent signatures are checked against the sighashes of GET_T_SIGHASH.
+# More than SIGN_BATCH_MAX signatures do not fit in the response and are refused.
+# The records of streamed inputs are signed in batches that continue each other,
+# and no more than the number of inputs
+
+SIGN_TESTS = ("t2z", "tz2tz", "z2zo", "tzo2tzo")
+SIGN_BATCH_MAX = 3
+SW_WRONG_P1P2 = 0x6A86
+SW_BAD_STATE = 0xB007
+
+ALPHAS = [sha512(b"alpha" + bytes([i])).digest() for i in range(SIGN_BATCH_MAX)]
+TXIN_DIGESTS = [sha256(b"txin" + bytes([i])).digest() for i in range(SIGN_BATCH_MAX)]
+
+
+def signed_tests(client: ZcashCommandSender):
+    return [test for test in load_tx_tests(client.has_orchard()) if test['test_name'] in SIGN_TESTS]
+
+
+def test_sign_sapling_batch(backend):
+    client = ZcashCommandSender(backend)
+    for test in signed_tests(client):
+        run_flow(client, without(recorded_flow(test), InsType.END_TX))
+
+        singles = b"".join(client.exchange_message(apdu(InsType.SIGN_SAPLING, data=alpha))
+                           for alpha in ALPHAS)
+        batch = client.exchange_message(apdu(InsType.SIGN_SAPLING, SIGN_BATCH_MAX, data=b"".join(ALPHAS)))
+        assert batch == singles
+
+        if "o" in test['test_name']:
+            batch = client.exchange_message(apdu(InsType.SIGN_ORCHARD, SIGN_BATCH_MAX, data=b"".join(ALPHAS)))
+            assert len(batch) == 64 * SIGN_BATCH_MAX
+
+        client.exchange_message(apdu(InsType.END_TX))
+
+
+def test_sign_transparent_batch(backend):
+    client = ZcashCommandSender(backend)
+    public_key = client.send_request_no_params(InsType.GET_PUBKEY).data
+    for test in signed_tests(client):
+        flow = recorded_flow(test)
+        recorded = [(data_of(req), rep) for req, rep in flow if ins_of(req) == InsType.GET_T_SIGHASH]
+        if not recorded: # no transparent input
+            continue
+        run_flow(client, without(flow, InsType.END_TX))
+
+        # the recorded input first, then inputs made up for the batch
+        digests = [recorded[0][0]] + TXIN_DIGESTS[1:]
+        sighashes = [recorded[0][1]] + [client.exchange_message(apdu(InsType.GET_T_SIGHASH, data=digest))
+                                        for digest in TXIN_DIGESTS[1:]]
+
+        single = client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, data=digests[0]))
+        assert check_sighash_signature(public_key, single, sighashes[0])
+
+        batch = client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, SIGN_BATCH_MAX, data=b"".join(digests)))
+        assert len(batch) == 64 * SIGN_BATCH_MAX
+        for i, sighash in enumerate(sighashes):
+            assert check_sighash_signature(public_key, batch[64 * i:64 * (i + 1)], sighash)
+
+        client.exchange_message(apdu(InsType.END_TX))
+
+
+def test_sign_batch_max(backend):
+    client = ZcashCommandSender(backend)
+    test = signed_tests(client)[0]
+    run_flow(client, without(recorded_flow(test), InsType.END_TX))
+
+    # 4 alphas would not even fit in the command, SIGN_SAPLING and SIGN_ORCHARD
+    # are sent without them
+    count = SIGN_BATCH_MAX + 1
+    requests = [(InsType.SIGN_TRANSPARENT, TXIN_DIGESTS[0] * count), (InsType.SIGN_SAPLING, b"")]
+    if client.has_orchard():
+        requests.append((InsType.SIGN_ORCHARD, b""))
+    for ins, data in requests:
+        with pytest.raises(ExceptionRAPDU) as e:
+            client.exchange_message(apdu(ins, count, data=data))
+        assert e.value.status == SW_WRONG_P1P2
+
+    client.exchange_message(apdu(InsType.END_TX))
+
+
+def test_sign_transparent_batch_continued(backend, firmware):
+    if firmware.device == "nanos":
+        pytest.skip("No input stream on the Nano S")
+    client = ZcashCommandSender(backend)
+    public_key = client.send_request_no_params(InsType.GET_PUBKEY).data
+    flow = recorded_flow(streamed_tests(client)[0])
+    records = input_records(flow, SIGN_BATCH_MAX)
+    streamed = with_sighashes(streamed_flow(flow, records), records)
+
+    replies = run_flow(client, streamed)
+    sighashes = replies_of(streamed, replies, InsType.GET_T_SIGHASH)
+    signed = [record + tag for record, tag in zip(records, stream_tags(streamed, replies))]
+
+    # the first batch ends partway through the inputs, the next one continues
+    signatures = client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, 2, 1, b"".join(signed[:2]))) + \
+        client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, 1, 1, signed[2]))
+    for i, sighash in enumerate(sighashes):
+        assert check_sighash_signature(public_key, signatures[64 * i:64 * (i + 1)], sighash)
+
+    # every input was signed
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, 1, 1, signed[2]))
+    assert e.value.status == SW_BAD_STATE
+
+    # a batch that goes past the last input
+    replies = run_flow(client, streamed)
+    signed = [record + tag for record, tag in zip(records, stream_tags(streamed, replies))]
+    client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, 2, 1, b"".join(signed[:2])))
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, 2, 1, signed[2] * 2))
+    assert e.value.status == SW_BAD_STATE
@@ -0,0 +1,137 @@
+from hashlib import sha256
+
+import pytest
+from ragger.error import ExceptionRAPDU
+
+from application_client.command_sender import ZcashCommandSender, InsType
+from tx_flows import load_tx_tests, recorded_flow, run_flow, replies_of, \
+    apdu, ins_of, data_of, blake2b_256, SIGHASH_INS
+from utils import check_sighash_signature
+
+# In this test we stream the transparent inputs of the recorded transactions with
+# ADD_T_IN P1 = 1 instead of sending their amounts and their digests with
+# ADD_T_IN and SET_T_MERKLE_PROOF. The inputs are made up and their digests
+# are computed here. Both flows must give the same sighashes, and the signatures
+# of SIGN_TRANSPARENT P2 = 1 must verify against them. The stream returns a tag
+# per record, a record is only signed with its tag
+
+CHUNK = 50 # shorter than a record
+TAG_LEN = 16
+SW_INVALID_PARAM = 0x6A88
+SW_BAD_STATE = 0xB007
+
+
+def t_in_record(i: int, amount: int) -> bytes:
+    prevout = sha256(b"prevout" + bytes([i])).digest() + i.to_bytes(4, 'little')
+    script = bytes([0x76, 0xA9, 0x14]) + sha256(b"pkh" + bytes([i])).digest()[:20] + bytes([0x88, 0xAC])
+    return prevout + amount.to_bytes(8, 'little') + bytes([len(script)]) + script + \
+        (0xFFFFFFFF).to_bytes(4, 'little')
+
+
+def t_proofs(records) -> bytes:
+    # prevouts || scriptPubKeys || sequences digests of ZIP-244
+    return blake2b_256(b"ZTxIdPrevoutHash", b"".join(r[:36] for r in records)) + \
+        blake2b_256(b"ZTxTrScriptsHash", b"".join(r[44:-4] for r in records)) + \
+        blake2b_256(b"ZTxIdSequencHash", b"".join(r[-4:] for r in records))
+
+
+def txin_sig_digest(record: bytes) -> bytes:
+    return blake2b_256(b"Zcash___TxInHash", record)
+
+
+def input_records(flow, n: int = 2):
+    # the recorded amount is split between n inputs
+    amount = int.from_bytes(next(data_of(req) for req, _ in flow if ins_of(req) == InsType.ADD_T_IN), 'little')
+    return [t_in_record(i, amount // n + (amount % n if i == n - 1 else 0)) for i in range(n)]
+
+
+def explicit_flow(flow, records):
+    out = []
+    for req, rep in flow:
+        if ins_of(req) == InsType.ADD_T_IN:
+            out += [(apdu(InsType.ADD_T_IN, data=r[36:44]), None) for r in records]
+        elif ins_of(req) == InsType.SET_T_MERKLE_PROOF:
+            out.append((apdu(InsType.SET_T_MERKLE_PROOF, data=t_proofs(records)), None))
+        elif ins_of(req) != InsType.END_TX:
+            out.append((req, None))
+    return out
+
+
+def streamed_flow(flow, records):
+    stream = bytes([len(records)]) + b"".join(records) # CompactSize(n) || records
+    out = []
+    for req, rep in flow:
+        if ins_of(req) == InsType.ADD_T_IN:
+            out += [(apdu(InsType.ADD_T_IN, 1, data=stream[i:i + CHUNK]), None)
+                    for i in range(0, len(stream), CHUNK)]
+        elif ins_of(req) not in (InsType.SET_T_MERKLE_PROOF, InsType.END_TX):
+            out.append((req, None))
+    return out
+
+
+def with_sighashes(flow, records):
+    return flow + [(apdu(InsType.GET_T_SIGHASH, data=txin_sig_digest(r)), None) for r in records]
+
+
+def stream_tags(flow, replies):
+    tags = b"".join(replies_of(flow, replies, InsType.ADD_T_IN))
+    return [tags[i:i + TAG_LEN] for i in range(0, len(tags), TAG_LEN)]
+
+
+def streamed_tests(client: ZcashCommandSender):
+    return [test for test in load_tx_tests(client.has_orchard())
+            if any(ins_of(req) == InsType.ADD_T_IN for req, _ in recorded_flow(test))]
+
+
+def test_t_in_stream(backend, firmware):
+    if firmware.device == "nanos":
+        pytest.skip("No input stream on the Nano S")
+    client = ZcashCommandSender(backend)
+    public_key = client.send_request_no_params(InsType.GET_PUBKEY).data
+    for test in streamed_tests(client):
+        flow = recorded_flow(test)
+        records = input_records(flow)
+
+        explicit = with_sighashes(explicit_flow(flow, records), records)
+        expected = replies_of(explicit, run_flow(client, explicit), SIGHASH_INS)
+        client.exchange_message(apdu(InsType.END_TX))
+
+        streamed = with_sighashes(streamed_flow(flow, records), records)
+        replies = run_flow(client, streamed)
+        assert replies_of(streamed, replies, SIGHASH_INS) == expected
+        tags = stream_tags(streamed, replies)
+        assert len(tags) == len(records)
+
+        # one record per APDU, the sighashes of the records are the last ones
+        for record, tag, sighash in zip(records, tags, expected[-len(records):]):
+            signature = client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, 0, 1, record + tag))
+            assert check_sighash_signature(public_key, signature, sighash)
+        client.exchange_message(apdu(InsType.END_TX))
+
+
+def test_t_in_stream_binding(backend, firmware):
+    if firmware.device == "nanos":
+        pytest.skip("No input stream on the Nano S")
+    client = ZcashCommandSender(backend)
+    test = streamed_tests(client)[0]
+    flow = recorded_flow(test)
+    records = input_records(flow)
+    streamed = streamed_flow(flow, records)
+    tags = stream_tags(streamed, run_flow(client, streamed))
+
+    # no record is signed without the tag of its position, not even the first one
+    tampered = records[0][:-4] + (0xFFFFFFFE).to_bytes(4, 'little')
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, 0, 1, tampered + tags[0]))
+    assert e.value.status == SW_INVALID_PARAM
+
+    run_flow(client, streamed)
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, 0, 1, records[1] + tags[1]))
+    assert e.value.status == SW_INVALID_PARAM
+
+    # nor from a txin_sig_digest given by the host
+    run_flow(client, streamed)
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, data=txin_sig_digest(records[0])))
+    assert e.value.status == SW_BAD_STATE
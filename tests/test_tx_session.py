@@ -0,0 +1,104 @@
+import pytest
+from ragger.error import ExceptionRAPDU
+
+from application_client.command_sender import ZcashCommandSender, InsType
+from tx_flows import load_tx_tests, recorded_flow, run_flow, without, apdu, ins_of, data_of, SIGHASH_INS
+from utils import check_sighash_signature
+
+# In this test we define the recorded transactions in signing sessions of
+# TX_RING_SIZE transactions (INIT_TX P1 = 1), then select each of them with
+# SELECT_TX. Their sighashes must match the recorded ones, and so must
+# the signatures of the transactions that are not the last one defined
+
+TX_RING_SIZE = 4
+SW_INVALID_PARAM = 0x6A88
+SW_BAD_STATE = 0xB007
+
+
+def session_flow(flow):
+    # INIT_TX with P1 = 1 keeps the previous transactions of the session
+    return [(apdu(InsType.INIT_TX, 1), rep) if ins_of(req) == InsType.INIT_TX else (req, rep)
+            for req, rep in without(flow, InsType.END_TX)]
+
+
+def sighash_flow(flow):
+    return [(req, rep) for req, rep in flow if ins_of(req) in SIGHASH_INS]
+
+
+def define_session(client, tests):
+    flows = [recorded_flow(test) for test in tests]
+    for flow in flows:
+        run_flow(client, session_flow(flow))
+    return flows
+
+
+def test_tx_session(backend, firmware):
+    if firmware.device == "nanos":
+        pytest.skip("A single transaction per session on the Nano S")
+    client = ZcashCommandSender(backend)
+    tests = load_tx_tests(client.has_orchard())
+    for i in range(0, len(tests), TX_RING_SIZE):
+        flows = define_session(client, tests[i:i + TX_RING_SIZE])
+
+        # every transaction of the session can still be signed
+        for slot, flow in enumerate(flows):
+            run_flow(client, [(apdu(InsType.SELECT_TX, slot), b"")] + sighash_flow(flow))
+        client.exchange_message(apdu(InsType.END_TX))
+
+
+def test_tx_session_sign(backend, firmware):
+    if firmware.device == "nanos":
+        pytest.skip("A single transaction per session on the Nano S")
+    client = ZcashCommandSender(backend)
+    public_key = client.send_request_no_params(InsType.GET_PUBKEY).data
+    tests = [test for test in load_tx_tests(client.has_orchard())
+             if any(ins_of(req) == InsType.GET_T_SIGHASH for req, _ in recorded_flow(test))]
+    flows = define_session(client, tests[:TX_RING_SIZE])
+
+    # the last transaction defined is the current one, sign the others first
+    for slot in reversed(range(len(flows))):
+        client.exchange_message(apdu(InsType.SELECT_TX, slot))
+        for req, sighash in flows[slot]:
+            if ins_of(req) == InsType.GET_T_SIGHASH:
+                signature = client.exchange_message(apdu(InsType.SIGN_TRANSPARENT, data=data_of(req)))
+                assert check_sighash_signature(public_key, signature, sighash)
+    client.exchange_message(apdu(InsType.END_TX))
+
+
+def test_tx_session_select_empty(backend, firmware):
+    if firmware.device == "nanos":
+        pytest.skip("A single transaction per session on the Nano S")
+    client = ZcashCommandSender(backend)
+    flows = define_session(client, load_tx_tests(client.has_orchard())[:2])
+
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.exchange_message(apdu(InsType.SELECT_TX, len(flows)))
+    assert e.value.status == SW_BAD_STATE
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.exchange_message(apdu(InsType.SELECT_TX, TX_RING_SIZE))
+    assert e.value.status == SW_INVALID_PARAM
+
+    # the session is kept
+    run_flow(client, [(apdu(InsType.SELECT_TX, 0), b"")] + sighash_flow(flows[0]))
+    client.exchange_message(apdu(InsType.END_TX))
+
+
+def test_tx_session_ring_full(backend, firmware):
+    if firmware.device == "nanos":
+        pytest.skip("A single transaction per session on the Nano S")
+    client = ZcashCommandSender(backend)
+    tests = load_tx_tests(client.has_orchard())
+    flows = define_session(client, tests[:TX_RING_SIZE])
+
+    # the ring does not wrap over the confirmed transactions
+    with pytest.raises(ExceptionRAPDU) as e:
+        client.exchange_message(apdu(InsType.INIT_TX, 1))
+    assert e.value.status == SW_BAD_STATE
+    for slot, flow in enumerate(flows):
+        run_flow(client, [(apdu(InsType.SELECT_TX, slot), b"")] + sighash_flow(flow))
+    client.exchange_message(apdu(InsType.END_TX))
+
+    # a new session starts at the first slot
+    flows = define_session(client, tests[TX_RING_SIZE:TX_RING_SIZE + 1])
+    run_flow(client, [(apdu(InsType.SELECT_TX, 0), b"")] + sighash_flow(flows[0]))
+    client.exchange_message(apdu(InsType.END_TX))
@@ -0,0 +1,87 @@
+import binascii
+import hashlib
+import json
+from typing import List, Optional, Tuple
+
+from application_client.command_sender import ZcashCommandSender, InsType, CLA, split_message
+
+# The recorded transactions of tx-tests.json are replayed with the single record
+# instructions. The tests of the chained, batched and streamed instructions
+# rewrite these flows and check that the device computes the same sighashes
+
+# A flow is a list of (request, expected reply), the reply is not checked when it is None
+Flow = List[Tuple[bytes, Optional[bytes]]]
+
+SIGHASH_INS = (InsType.GET_S_SIGHASH, InsType.GET_T_SIGHASH)
+
+# P1 and P2 of the chained instructions, see out_chain.h
+CHAIN_FIRST = 0x01
+CHAIN_LAST = 0x02
+CHAIN_RSEED = 0x01
+
+
+def load_tx_tests(orchard: bool) -> list:
+    with open("tests/tx-tests.json") as file:
+        tests = json.load(file)
+    return [test for test in tests if orchard or "o" not in test['test_name']]
+
+
+def apdu(ins: int, p1: int = 0, p2: int = 0, data: bytes = b"") -> bytes:
+    return bytes([CLA, ins, p1, p2, len(data)]) + data
+
+
+def ins_of(req: bytes) -> int:
+    return req[1]
+
+
+def data_of(req: bytes) -> bytes:
+    return req[5:]
+
+
+def recorded_flow(test) -> Flow:
+    flow = []
+    for msg in test['messages']:
+        req = binascii.unhexlify(msg['req'])
+        rep = binascii.unhexlify(msg['rep'])[:-2] # skip status code
+        # INIT_TX returns a random seed that changes every time
+        flow.append((req, None if ins_of(req) == InsType.INIT_TX else rep))
+    return flow
+
+
+def run_flow(client: ZcashCommandSender, flow: Flow) -> List[bytes]:
+    replies = []
+    for req, expected in flow:
+        rep = client.exchange_message(req)
+        if expected is not None:
+            assert rep == expected
+        replies.append(rep)
+    return replies
+
+
+def replies_of(flow: Flow, replies: List[bytes], ins) -> List[bytes]:
+    if not isinstance(ins, tuple):
+        ins = (ins,)
+    return [rep for (req, _), rep in zip(flow, replies) if ins_of(req) in ins]
+
+
+def unchecked(flow: Flow) -> Flow:
+    return [(req, None) for req, _ in flow]
+
+
+def without(flow: Flow, ins) -> Flow:
+    if not isinstance(ins, tuple):
+        ins = (ins,)
+    return [(req, rep) for req, rep in flow if ins_of(req) not in ins]
+
+
+def chain_apdus(ins: int, stream: bytes, p2: int, chunk: int) -> List[bytes]:
+    chunks = split_message(stream, chunk) or [b""]
+    apdus = []
+    for i, data in enumerate(chunks):
+        p1 = (CHAIN_FIRST if i == 0 else 0) | (CHAIN_LAST if i == len(chunks) - 1 else 0)
+        apdus.append(apdu(ins, p1, p2, data))
+    return apdus
+
+
+def blake2b_256(perso: bytes, data: bytes) -> bytes:
+    return hashlib.blake2b(data, digest_size=32, person=perso).digest()
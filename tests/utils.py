@@ -4,7 +4,7 @@ from sha3 import keccak_256
 
 from ecdsa.curves import SECP256k1
 from ecdsa.keys import VerifyingKey
-from ecdsa.util import sigdecode_der
+from ecdsa.util import sigdecode_der, sigdecode_string
 
 
 ROOT_SCREENSHOT_PATH = Path(__file__).parent.resolve()
@@ -21,3 +21,14 @@ def check_signature_validity(public_key: bytes, signature: bytes, message: bytes
                      data=message,
                      hashfunc=keccak_256,
                      sigdecode=sigdecode_der)
+
+
+# Check if a transparent signature (r || s) of a sighash is valid
+def check_sighash_signature(public_key: bytes, signature: bytes, sighash: bytes) -> bool:
+    pk: VerifyingKey = VerifyingKey.from_string(
+        public_key,
+        curve=SECP256k1
+    )
+    return pk.verify_digest(signature=signature,
+                            digest=sighash,
+                            sigdecode=sigdecode_string)
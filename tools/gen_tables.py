@@ -0,0 +1,607 @@
+#!/usr/bin/env python3
+# ****************************************************************************
+#    Zcash Ledger App
+#    (c) 2022 Hanh Huynh Huu.
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+# ****************************************************************************
+
+"""
+Generator of the precomputed constant tables stored in flash
+
+The app cannot afford to recompute fixed points (hash_to_curve outputs,
+multiples of generators) at runtime. This script recomputes them with
+plain python integers and writes C sources under src/crypto.
+
+Usage: python3 tools/gen_tables.py (or make tables)
+"""
+
+import hashlib
+import os
+import re
+
+ROOT = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+CRYPTO = os.path.join(ROOT, "src", "crypto")
+
+LICENSE = """/*****************************************************************************
+ *   Zcash Ledger App.
+ *   (c) 2022 Hanh Huynh Huu.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ *****************************************************************************/
+
+// GENERATED by tools/gen_tables.py - DO NOT EDIT
+"""
+
+# ---------------------------------------------------------------------------
+# Pallas
+
+P = 0x40000000000000000000000000000000224698fc094cf91b992d30ed00000001
+V = 0x40000000000000000000000000000000224698fc0994a8dd8c46eb2100000001
+
+ISO_A = 0x18354a2eb0ea8c9c49be2d7258370742b74134581a27a59f92bb4b0b657a014b
+ISO_B = 1265
+SWU_Z = P - 13
+# sqrt(SWU_Z/g) where g is the 2^32-th root of unity
+SWU_THETA = 0x0f7bdb65814179b44647aef782d5cdc851f64fc4dc888857ca330bcc09ac318e
+
+ISOGENY_CONSTANTS = [
+    0x0e38e38e38e38e38e38e38e38e38e38e4081775473d8375b775f6034aaaaaaab,
+    0x3509afd51872d88e267c7ffa51cf412a0f93b82ee4b994958cf863b02814fb76,
+    0x17329b9ec525375398c7d7ac3d98fd13380af066cfeb6d690eb64faef37ea4f7,
+    0x1c71c71c71c71c71c71c71c71c71c71c8102eea8e7b06eb6eebec06955555580,
+    0x1d572e7ddc099cff5a607fcce0494a799c434ac1c96b6980c47f2ab668bcd71f,
+    0x325669becaecd5d11d13bf2a7f22b105b4abf9fb9a1fc81c2aa3af1eae5b6604,
+    0x1a12f684bda12f684bda12f684bda12f7642b01ad461bad25ad985b5e38e38e4,
+    0x1a84d7ea8c396c47133e3ffd28e7a09507c9dc17725cca4ac67c31d8140a7dbb,
+    0x3fb98ff0d2ddcadd303216cce1db9ff11765e924f745937802e2be87d225b234,
+    0x025ed097b425ed097b425ed097b425ed0ac03e8e134eb3e493e53ab371c71c4f,
+    0x0c02c5bcca0e6b7f0790bfb3506defb65941a3a4a97aa1b35a28279b1d1b42ae,
+    0x17033d3c60c68173573b3d7f7d681310d976bbfabbc5661d4d90ab820b12320a,
+    0x40000000000000000000000000000000224698fc094cf91b992d30ecfffffde5,
+]
+
+
+def fp_inv(a):
+    return pow(a, P - 2, P)
+
+
+def weierstrass_add(p1, p2, a):
+    """Affine addition on y^2 = x^3 + a.x + b over Fp, None is the identity"""
+    if p1 is None:
+        return p2
+    if p2 is None:
+        return p1
+    x1, y1 = p1
+    x2, y2 = p2
+    if x1 == x2:
+        if (y1 + y2) % P == 0:
+            return None
+        l = (3 * x1 * x1 + a) * fp_inv(2 * y1) % P
+    else:
+        l = (y2 - y1) * fp_inv(x2 - x1) % P
+    x3 = (l * l - x1 - x2) % P
+    y3 = (l * (x1 - x3) - y1) % P
+    return (x3, y3)
+
+
+def pallas_add(p1, p2):
+    return weierstrass_add(p1, p2, 0)
+
+
+def pallas_neg(p):
+    return None if p is None else (p[0], (P - p[1]) % P)
+
+
+def pallas_mul(p, k):
+    r = None
+    while k > 0:
+        if k & 1:
+            r = pallas_add(r, p)
+        p = pallas_add(p, p)
+        k >>= 1
+    return r
+
+
+def pallas_on_curve(p):
+    x, y = p
+    return (y * y - x * x * x - 5) % P == 0
+
+
+def hash_to_field(domain, msg):
+    dst = domain + b"-pallas_XMD:BLAKE2b_SSWU_RO_"
+    dst_prime = dst + bytes([len(dst)])
+    b0 = hashlib.blake2b(bytes(128) + msg + bytes([0, 128, 0]) + dst_prime).digest()
+    b1 = hashlib.blake2b(b0 + bytes([1]) + dst_prime).digest()
+    b2 = hashlib.blake2b(bytes(x ^ y for x, y in zip(b0, b1)) + bytes([2]) + dst_prime).digest()
+    return [int.from_bytes(b1, "big") % P, int.from_bytes(b2, "big") % P]
+
+
+def map_to_curve_simple_swu(u):
+    """Maps to the isogenous curve y^2 = x^3 + ISO_A.x + ISO_B
+    Same steps as pallas.c: x = num_x/div, one sqrt_ratio for both candidates"""
+    z_u2 = SWU_Z * u * u % P
+    ta = (z_u2 * z_u2 + z_u2) % P
+    num_x1 = ISO_B * (ta + 1) % P
+    div = ISO_A * (SWU_Z if ta == 0 else P - ta) % P
+    div3 = div * div * div % P
+    num_gx1 = ((num_x1 * num_x1 + ISO_A * div * div) * num_x1 + ISO_B * div3) % P
+    gx1_square, y1 = sqrt_ratio(P, 5, num_gx1, div3)
+    if gx1_square:
+        num_x, y = num_x1, y1
+    else:
+        num_x, y = z_u2 * num_x1 % P, SWU_THETA * z_u2 * u * y1 % P
+    if (u & 1) != (y & 1):
+        y = P - y
+    return (num_x * fp_inv(div) % P, y)
+
+
+def iso_map(p):
+    x, y = p
+    c = ISOGENY_CONSTANTS
+    x2 = x * x % P
+    x3 = x2 * x % P
+    num_x = (c[0] * x3 + c[1] * x2 + c[2] * x + c[3]) % P
+    div_x = (x2 + c[4] * x + c[5]) % P
+    num_y = (c[6] * x3 + c[7] * x2 + c[8] * x + c[9]) * y % P
+    div_y = (x3 + c[10] * x2 + c[11] * x + c[12]) % P
+    return (num_x * fp_inv(div_x) % P, num_y * fp_inv(div_y) % P)
+
+
+def hash_to_curve(domain, msg):
+    u = hash_to_field(domain, msg)
+    q = weierstrass_add(map_to_curve_simple_swu(u[0]), map_to_curve_simple_swu(u[1]), ISO_A)
+    return iso_map(q)
+
+
+def sinsemilla_S(i):
+    return hash_to_curve(b"z.cash:SinsemillaS", i.to_bytes(4, "little"))
+
+
+SPEND_AUTH_GEN = (
+    0x375523b328f1d6063b8d187c3e5f445f0c7f0ce37b70a10c8d1a7284b875c963,
+    0x1ad0357fdf1a66db7b10bcfcfed624fbdfc914fec005bdd84ce33e817b0c3bc9,
+)
+
+# ---------------------------------------------------------------------------
+# Jubjub: -u^2 + v^2 = 1 + d.u^2.v^2 over Fq
+
+Q = 0x73eda753299d7d483339d80809a1d80553bda402fffe5bfeffffffff00000001
+R = 0x0e7db4ea6533afa906673b0101343b00a6682093ccc81082d0970e5ed6f72cb7
+JJ_D = 0x2a9318e74bfa2b48f5fd9207e6bd7fd4292d7f6d37579d2601065fd6d6343eb1
+
+
+def jj_add(p1, p2):
+    """Complete twisted Edwards addition in affine coordinates"""
+    u1, v1 = p1
+    u2, v2 = p2
+    t = JJ_D * u1 * u2 * v1 * v2 % Q
+    u3 = (u1 * v2 + v1 * u2) * pow(1 + t, Q - 2, Q) % Q
+    v3 = (v1 * v2 + u1 * u2) * pow(1 - t, Q - 2, Q) % Q
+    return (u3, v3)
+
+
+def jj_mul(p, k):
+    r = (0, 1)
+    while k > 0:
+        if k & 1:
+            r = jj_add(r, p)
+        p = jj_add(p, p)
+        k >>= 1
+    return r
+
+
+def jj_on_curve(p):
+    u, v = p
+    return (v * v - u * u - 1 - JJ_D * u * u * v * v) % Q == 0
+
+
+def jj_from_niels(vpu, vmu):
+    inv2 = pow(2, Q - 2, Q)
+    return ((vpu - vmu) * inv2 % Q, (vpu + vmu) * inv2 % Q)
+
+
+def jj_to_niels(p, mont):
+    """(v+u, v-u, 2d.u.v), multiplied by 2^256 if mont"""
+    u, v = p
+    f = pow(2, 256, Q) if mont else 1
+    return ((v + u) * f % Q, (v - u) * f % Q, 2 * JJ_D * u * v * f % Q)
+
+
+# Generators of sapling.h as (v+u, v-u)
+SPENDING_GEN = jj_from_niels(
+    0x60c7d6918e437d8827d3dfcfe8923870431f0f21be6a05e37815793fb5885c83,
+    0x4e7a2cab4d8fef627fa28fd19ba7c19a97abbf79df4db594e896ec1ba05d0ddd)
+PROOF_GEN = jj_from_niels(
+    0x690e76094aad0d5a4f0c0575f7d9a94dfed22223e89d01f2816dd5e799cc0e58,
+    0x405f2c04e711479b6e85fd9226b8e84aa2ec81b202a591b20b881e0826efc376)
+CMU_RAND_GEN = jj_from_niels(
+    0x3837148c4bd776e435de11e9616218c2874928f1fa4eb1277a109e9a224fdc0e,
+    0x5e4d7cca37e69f132696b4ad848c186df9e392e6fae933712fe8282fd089134b)
+
+
+
+def read_ph_gens():
+    """Pedersen hash generators, from the PH_GENS array of sapling.h"""
+    with open(os.path.join(CRYPTO, "sapling.h")) as f:
+        src = f.read()
+    src = src[src.index("PH_GENS[]"):]
+    src = src[:src.index("};")]
+    gens = []
+    for block in src.split(".vpu")[1:]:
+        vpu = bytes(int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]{2}", block.split(".vmu")[0]))
+        vmu = bytes(int(x, 16) for x in re.findall(r"0x[0-9A-Fa-f]{2}", block.split(".vmu")[1].split(".z")[0]))
+        gens.append(jj_from_niels(int.from_bytes(vpu, "big"), int.from_bytes(vmu, "big")))
+    return gens
+
+
+PH_GENS = read_ph_gens()
+# A segment of the Pedersen hash has 63 chunks of 3 bits
+PH_SEGMENT_CHUNKS = 63
+
+# Scalars are < r < 2^252, the signed recoding needs 65 digits
+JJ_FB_DIGITS = 65
+# Nano S (NO_MONTGOMERY) is short of flash: fewer teeth, more doublings
+JJ_FB_SPACING = 4
+JJ_FB_SPACING_NANOS = 22
+
+# ---------------------------------------------------------------------------
+# C output
+
+
+def c_bytes(v, indent):
+    b = v.to_bytes(32, "big")
+    return indent + ", ".join("0x%02x" % x for x in b)
+
+
+def c_point(p, indent):
+    x, y = p
+    return "%s{ { %s },\n%s  { %s } }" % (
+        indent, c_bytes(x, ""), indent, c_bytes(y, ""))
+
+
+def to_mont(v, p, mont):
+    """v.2^256 mod p if mont, v otherwise"""
+    return v * pow(2, 256, p) % p if mont else v
+
+
+def c_consts(consts, p, mont):
+    """const uint8_t NAME[32] for each (name, value) in consts"""
+    return "".join("const uint8_t %s[32] = {\n%s\n};\n\n" % (
+        name, c_bytes(to_mont(v, p, mont), "    ")) for name, v in consts)
+
+
+def write_file(name, body):
+    path = os.path.join(CRYPTO, name)
+    with open(path, "w") as f:
+        f.write(LICENSE)
+        f.write(body)
+    print("wrote", os.path.relpath(path, ROOT))
+
+
+# Personalizations of the Orchard commitments, in the order of sinsemilla_perso_e
+SINSEMILLA_PERSOS = [b"z.cash:Orchard-NoteCommit", b"z.cash:Orchard-CommitIvk"]
+
+
+def sinsemilla_s(points, mont):
+    return "const aff_p_t SINSEMILLA_S[1024] = {\n%s\n};\n" % ",\n".join(
+        c_point((to_mont(x, P, mont), to_mont(y, P, mont)), "    ") for x, y in points)
+
+
+def gen_sinsemilla():
+    points = [sinsemilla_S(i) for i in range(1024)]
+    for p in points:
+        assert pallas_on_curve(p)
+    qs = [hash_to_curve(b"z.cash:SinsemillaQ", perso + b"-M") for perso in SINSEMILLA_PERSOS]
+    rs = [hash_to_curve(perso + b"-r", b"") for perso in SINSEMILLA_PERSOS]
+    for p in qs + rs:
+        assert pallas_on_curve(p)
+    body = """
+#include <stdint.h>
+
+#include "sinsemilla.h"
+
+#ifdef ORCHARD
+
+/// @brief S(i) = hash_to_curve("z.cash:SinsemillaS", i) for i in [0, 1024)
+/// in affine coordinates (x, y), big endian
+/// S values are in Montgomery form (x.2^256 mod p), except on the Nano S
+/// that does not use Montgomery multiplication. Q and R are not
+
+#ifdef NO_MONTGOMERY
+
+"""
+    body += sinsemilla_s(points, False)
+    body += """
+#else
+
+"""
+    body += sinsemilla_s(points, True)
+    body += """
+#endif
+
+/// @brief Q = hash_to_curve("z.cash:SinsemillaQ", perso || "-M")
+const aff_p_t SINSEMILLA_Q[SINSEMILLA_PERSO_COUNT] = {
+"""
+    body += ",\n".join(c_point(p, "    ") for p in qs)
+    body += """
+};
+
+/// @brief R = hash_to_curve(perso || "-r", "")
+const aff_p_t SINSEMILLA_R[SINSEMILLA_PERSO_COUNT] = {
+"""
+    body += ",\n".join(c_point(p, "    ") for p in rs)
+    body += """
+};
+
+#endif
+"""
+    write_file("sinsemilla_s.c", body)
+
+
+# Fixed base tables use signed radix-16 digits arranged as a comb:
+# with spacing S, tooth t covers the digits t*S .. t*S+S-1 and
+# the table has entry[t][j] = (j+1).16^(t*S).G for j in [0, 8)
+PALLAS_FB_SPACING = 2
+
+
+def fixed_base_table(add, mul, g, n_digits, spacing, n_entries):
+    teeth = (n_digits + spacing - 1) // spacing
+    rows = []
+    for t in range(teeth):
+        base = mul(g, 16 ** (t * spacing))
+        row = [base]
+        for _ in range(n_entries - 1):
+            row.append(add(row[-1], base))
+        rows.append(row)
+    return rows
+
+
+def pallas_consts(rows, mont):
+    consts = [("FP_ONE", 1), ("PALLAS_B", 5), ("SWU_Z", SWU_Z), ("SWU_THETA", SWU_THETA),
+              ("ISO_A", ISO_A), ("ISO_B", ISO_B)]
+    body = c_consts(consts, P, mont)
+    body += "const uint8_t ISOGENY_CONSTANTS[13][32] = {\n%s\n};\n\n" % ",\n".join(
+        "    { %s }" % c_bytes(to_mont(c, P, mont), "") for c in ISOGENY_CONSTANTS)
+    body += "const aff_p_t SPEND_AUTH_GEN_TABLE[PALLAS_FB_TEETH][8] = {\n"
+    body += ",\n".join(
+        "    {\n" + ",\n".join(c_point((to_mont(x, P, mont), to_mont(y, P, mont)), "        ")
+                          for x, y in row) + "\n    }" for row in rows)
+    body += "\n};\n"
+    return body
+
+
+def gen_pallas():
+    rows = fixed_base_table(pallas_add, pallas_mul, SPEND_AUTH_GEN, 64, PALLAS_FB_SPACING, 8)
+    body = """
+#include <stdint.h>
+
+#include "fr.h"
+#include "pallas.h"
+
+#ifdef ORCHARD
+
+/// @brief Field constants of Pallas, of the simplified SWU map to iso-Pallas
+/// and of the 3-isogeny back to Pallas, big endian
+/// SPEND_AUTH_GEN_TABLE[t][j] = (j+1).16^(t*PALLAS_FB_SPACING).SPEND_AUTH_GEN
+/// in affine coordinates (x, y), big endian
+/// Values are in Montgomery form (x.2^256 mod p), except on the Nano S
+/// that does not use Montgomery multiplication
+
+#ifdef NO_MONTGOMERY
+
+"""
+    body += pallas_consts(rows, False)
+    body += """
+#else
+
+"""
+    body += pallas_consts(rows, True)
+    body += """
+#endif
+
+#endif
+"""
+    write_file("pallas_tables.c", body)
+
+
+def c_niels(p, indent):
+    return "%s{ { %s },\n%s  { %s },\n%s  { %s } }" % (
+        indent, c_bytes(p[0], ""), indent, c_bytes(p[1], ""), indent, c_bytes(p[2], ""))
+
+
+def jj_rows(g, n_digits, spacing, n_entries, mont, indent):
+    # entry 0 is the identity so that zero digits go through the same
+    # complete addition
+    teeth = fixed_base_table(jj_add, jj_mul, g, n_digits, spacing, n_entries)
+    rows = []
+    for row in teeth:
+        row = [(0, 1)] + row
+        rows.append(indent + "{\n" + ",\n".join(
+            c_niels(jj_to_niels(p, mont), indent + "    ") for p in row) + "\n" + indent + "}")
+    return ",\n".join(rows)
+
+
+def jj_table(name, g, spacing, mont):
+    return "const ff_jj_en_aff_t %s[JJ_FB_TEETH][9] = {\n%s\n};\n" % (
+        name, jj_rows(g, JJ_FB_DIGITS, spacing, 8, mont, "    "))
+
+
+def ph_table(spacing, mont):
+    # chunks are encoded in [-4, 4]
+    segments = ["    {\n" + jj_rows(g, PH_SEGMENT_CHUNKS, spacing, 4, mont, "        ") + "\n    }"
+                for g in PH_GENS]
+    return "const ff_jj_en_aff_t PH_GENS_TABLE[4][PH_FB_TEETH][5] = {\n%s\n};\n" % ",\n".join(segments)
+
+
+JJ_CONSTS = [("FQ_ONE", 1), ("FQ_D", JJ_D), ("FQ_D2", 2 * JJ_D % Q)]
+
+
+def gen_jubjub():
+    gens = [("SPENDING_GEN_TABLE", SPENDING_GEN),
+            ("PROOF_GEN_TABLE", PROOF_GEN),
+            ("CMU_RAND_GEN_TABLE", CMU_RAND_GEN)]
+    body = """
+#include <stdint.h>
+#include <ox_bn.h>
+
+#include "sapling.h"
+
+/// @brief TABLE[t][j] = j.16^(t*JJ_FB_SPACING).G for the fixed generators
+/// of sapling.h, in affine extended Niels coordinates (v+u, v-u, 2d.u.v),
+/// big endian.
+/// PH_GENS_TABLE has the same layout for each of the PH_GENS, with one
+/// digit per 3 bit chunk of a segment
+/// FQ_ONE, FQ_D and FQ_D2 are 1, d and 2.d in Fq
+/// Values are in Montgomery form (x.2^256 mod q), except on the Nano S
+/// that does not use Montgomery multiplication
+
+#ifdef NO_MONTGOMERY
+
+"""
+    body += "\n".join(jj_table(n, g, JJ_FB_SPACING_NANOS, False) for n, g in gens)
+    body += "\n" + ph_table(JJ_FB_SPACING_NANOS, False)
+    body += "\n" + c_consts(JJ_CONSTS, Q, False)
+    body += """#else
+
+"""
+    body += "\n".join(jj_table(n, g, JJ_FB_SPACING, True) for n, g in gens)
+    body += "\n" + ph_table(JJ_FB_SPACING, True)
+    body += "\n" + c_consts(JJ_CONSTS, Q, True).rstrip("\n") + "\n"
+    body += """
+#endif
+"""
+    write_file("jubjub_tables.c", body)
+
+
+# ---------------------------------------------------------------------------
+# Square roots
+#
+# Fp and Fq both have p - 1 = 2^32.T with T odd. The square root of a ratio
+# is found with the windowed discrete log of Sarkar (eprint 2020/1407):
+# x = (num/div)^T is a 2^32-th root of unity g^k, its digits in radix 16 are
+# matched against SQRT_ROOTS[7] one window at a time, then
+# sqrt = (num/div)^((T+1)/2) / g^(k/2)
+
+SQRT_WINDOWS = 8
+# (modulus, generator of the multiplicative group, C prefix, guard)
+SQRT_FIELDS = [(P, 5, "FP", "ORCHARD"), (Q, 7, "FQ", None)]
+
+
+def sqrt_root_of_unity(p, gen):
+    return pow(gen, (p - 1) >> 32, p)
+
+
+def sqrt_roots(p, gen):
+    """roots[m][d] = g^(-d.16^m)"""
+    g = sqrt_root_of_unity(p, gen)
+    return [[pow(g, -d * 16 ** m, p) for d in range(16)] for m in range(SQRT_WINDOWS)]
+
+
+def sqrt_ratio(p, gen, num, div):
+    """Model of ff_sqrt_ratio (sqrt.c): (is_square, sqrt(num/div) or sqrt(g.num/div))"""
+    t = (p - 1) >> 32
+    roots = sqrt_roots(p, gen)
+    s = pow(div, 2 ** 32 - 1, p)
+    w = pow(s * s * div * num % p, (t - 1) // 2, p) * s % p
+    uv = w * num % p
+    xs = [uv * w * div % p]
+    for _ in range(SQRT_WINDOWS - 1):
+        xs.append(pow(xs[-1], 16, p))
+    k = 0
+    for i in range(SQRT_WINDOWS):
+        y = xs[SQRT_WINDOWS - 1 - i]
+        for j in range(i):
+            y = y * roots[SQRT_WINDOWS - 1 - i + j][(k >> (4 * j)) & 15] % p
+        d = roots[SQRT_WINDOWS - 1].index(y) if y in roots[SQRT_WINDOWS - 1] else 0
+        k |= (-d & 15) << (4 * i)
+    k >>= 1
+    r = uv
+    for m in range(SQRT_WINDOWS):
+        r = r * roots[m][(k >> (4 * m)) & 15] % p
+    return r * r * div % p == num % p, r
+
+
+def sqrt_field(p, gen, prefix, mont):
+    f = pow(2, 256, p) if mont else 1
+    rows = ["    {\n" + ",\n".join("        { %s }" % c_bytes(x * f % p, "") for x in row) + "\n    }"
+            for row in sqrt_roots(p, gen)]
+    return "const uint8_t SQRT_%s_ROOTS[SQRT_WINDOWS][16][32] = {\n%s\n};\n" % (prefix, ",\n".join(rows))
+
+
+def gen_sqrt():
+    body = """
+#include <stdint.h>
+#include <ox_bn.h>
+
+#include "fr.h"
+#include "sqrt.h"
+
+/// @brief SQRT_x_ROOTS[m][d] = g^(-d.16^m) where g = gen^T is the 2^32-th
+/// root of unity of the field, big endian.
+/// SQRT_x_EXP = (T-1)/2 where p - 1 = 2^32.T
+/// Roots are in Montgomery form (x.2^256 mod p), except on the Nano S
+/// that does not use Montgomery multiplication
+"""
+    for p, gen, prefix, guard in SQRT_FIELDS:
+        body += "\n"
+        if guard:
+            body += "#ifdef %s\n\n" % guard
+        body += "const uint8_t SQRT_%s_EXP[32] = {\n%s\n};\n\n" % (
+            prefix, c_bytes((((p - 1) >> 32) - 1) // 2, "    "))
+        body += "#ifdef NO_MONTGOMERY\n\n" + sqrt_field(p, gen, prefix, False)
+        body += "\n#else\n\n" + sqrt_field(p, gen, prefix, True) + "\n#endif\n"
+        if guard:
+            body += "\n#endif\n"
+    write_file("sqrt_tables.c", body)
+
+
+def self_test():
+    assert hash_to_curve(b"z.cash:Orchard", b"G") == SPEND_AUTH_GEN
+    assert pallas_on_curve(SPEND_AUTH_GEN)
+    assert pallas_mul(SPEND_AUTH_GEN, V) is None
+    assert len(PH_GENS) == 4
+    for g in [SPENDING_GEN, PROOF_GEN, CMU_RAND_GEN] + PH_GENS:
+        assert jj_on_curve(g)
+        assert jj_mul(g, R) == (0, 1)
+    for p, gen, _, _ in SQRT_FIELDS:
+        g = sqrt_root_of_unity(p, gen)
+        assert pow(g, 2 ** 31, p) == p - 1
+        for num, div in [(0, 1), (4, 1), (5, 3), (7, 11), (1, 0), (p - 1, 2)]:
+            ok, r = sqrt_ratio(p, gen, num, div)
+            if div == 0:
+                assert not ok and r == 0
+                continue
+            x = num * pow(div, -1, p) % p
+            assert ok == (pow(x, (p - 1) // 2, p) != p - 1)
+            assert r * r % p == (x if ok else g * x % p)
+    assert SWU_THETA ** 2 % P == SWU_Z * fp_inv(sqrt_root_of_unity(P, 5)) % P
+    assert sqrt_root_of_unity(P, 5) == 0x2bce74deac30ebda362120830561f81aea322bf2b7bb7584bdad6fabd87ea32f
+
+
+if __name__ == "__main__":
+    self_test()
+    gen_sinsemilla()
+    gen_pallas()
+    gen_jubjub()
+    gen_sqrt()